@@ -23,8 +23,8 @@ $tgtBase = $Args[1]
 
 switch ($tgtBase)
 { "CglBase"
-  { $fileNames = "CglCutGenerator.obj","CglMessage.obj","CglParam.obj"
-    $fileNames += "CglStored.obj","CglTreeInfo.obj"
+  { $fileNames = "CglCutGenerator.obj","CglCutProfile.obj","CglMessage.obj","CglParam.obj"
+    $fileNames += "CglParallelCuts.obj","CglPropagator.obj","CglStored.obj","CglTableauCache.obj","CglThread.obj","CglTreeInfo.obj","CglWorkspace.obj","CglModelStructure.obj","CglCutPool.obj","CglStoredFile.obj"
     $babyString = ".*Cgl.*"
     break }
   "CglAllDifferent"
@@ -13,6 +13,24 @@
 
 /*****************************************************************************/
 
+/* position of lowest bit set in a non zero word */
+static inline int
+lowestBit(CoinUInt64 word)
+{
+#if defined(__GNUC__)
+   return __builtin_ctzll(word);
+#else
+   int bit = 0;
+   while (!(word & 1)) {
+      word >>= 1;
+      bit++;
+   }
+   return bit;
+#endif
+}
+
+/*****************************************************************************/
+
 CglClique::CglClique(bool setPacking, bool justOriginalRows) :
   CglCutGenerator(),
    setPacking_(setPacking),
@@ -27,6 +45,7 @@ CglClique::CglClique(bool setPacking, bool justOriginalRows) :
    sp_row_start(0),
    sp_row_ind(0),
    node_node(0),
+   node_node_words(0),
    petol(-1.0),
    do_row_clique(true),
    do_star_clique(true),
@@ -35,6 +54,7 @@ CglClique::CglClique(bool setPacking, bool justOriginalRows) :
    scl_report_result(true),
    rcl_candidate_length_threshold(12),
    rcl_report_result(true),
+   adjacency_rule(ADJACENCY_AUTOMATIC),
    cl_perm_indices(0),
    cl_perm_length(0),
    cl_indices(0),
@@ -57,6 +77,7 @@ CglClique::CglClique(const CglClique& rhs)
     sp_row_start(rhs.sp_row_start),
     sp_row_ind(rhs.sp_row_ind),
     node_node(rhs.node_node),
+    node_node_words(rhs.node_node_words),
     petol(rhs.petol),
     do_row_clique(rhs.do_row_clique),
     do_star_clique(rhs.do_star_clique),
@@ -65,6 +86,7 @@ CglClique::CglClique(const CglClique& rhs)
     scl_report_result(rhs.scl_report_result),
     rcl_candidate_length_threshold(rhs.rcl_candidate_length_threshold),
     rcl_report_result(rhs.rcl_report_result),
+    adjacency_rule(rhs.adjacency_rule),
     cl_perm_indices(rhs.cl_perm_indices),
     cl_perm_length(rhs.cl_perm_length),
     cl_indices(rhs.cl_indices),
@@ -112,8 +134,8 @@ CglClique::generateCuts(const OsiSolverInterface& si, OsiCuts & cs,
      
 
    createSetPackingSubMatrix(si);
-   fgraph.edgenum = createNodeNode();
    createFractionalGraph();
+   createNodeNode();
 
    cl_indices = new int[sp_numcols];
    cl_del_indices = new int[sp_numcols];
@@ -157,9 +179,10 @@ CglClique::find_rcl(OsiCuts& cs)
    const int nodenum = fgraph.nodenum;
    const fnode *nodes = fgraph.nodes;
 
-   /* A flag for each column that might be used to extend the current row
-      clique */
-   bool *cand = new bool[nodenum];
+   /* A bit for each column that might be used to extend the current row
+      clique (only if node_node is there) */
+   const int words = node_node_words;
+   CoinUInt64 *cand = node_node ? new CoinUInt64[words] : 0;
    /* In cl_indices we'll list the indices of the 'true' entries in cand */
    /* The degree of each candidate (those listed in cl_indices) */
    int *degrees = new int[nodenum];
@@ -188,21 +211,44 @@ CglClique::find_rcl(OsiCuts& cs)
       /* the beginning of the row to be considered */
       const int *row = sp_row_ind + sp_row_start[j];
 
-      /* copy the row of node_node corresponding to the first column in 'row'
-	 into cand, and take the AND of this vector with every row of
-	 node_node corresponding to the rest of the columns in 'row' to
-	 determine those columns that are non-orthog to every column in row */
-      std::copy(node_node + row[0]*nodenum, node_node + (row[0]+1)*nodenum,
-		cand);
-      for (i = 1; i < len; i++) {
-	 const bool* node_node_col = node_node + row[i] * nodenum;
-	 for (k = 0; k < nodenum; k++)
-	    cand[k] &= node_node_col[k];
-      }
       cl_length = 0;
-      for (k = 0; k < nodenum; k++)
-	 if (cand[k])
-	    cl_indices[cl_length++] = k;
+      if (node_node) {
+	 /* copy the row of node_node corresponding to the first column in
+	    'row' into cand, and take the AND of this vector with every row of
+	    node_node corresponding to the rest of the columns in 'row' to
+	    determine those columns that are non-orthog to every column in
+	    row */
+	 const CoinUInt64* node_node_col = node_node + row[0] * words;
+	 std::copy(node_node_col, node_node_col + words, cand);
+	 for (i = 1; i < len; i++) {
+	    node_node_col = node_node + row[i] * words;
+	    for (k = 0; k < words; k++)
+	       cand[k] &= node_node_col[k];
+	 }
+	 for (k = 0; k < words; k++) {
+	    CoinUInt64 word = cand[k];
+	    while (word) {
+	       cl_indices[cl_length++] = (k << 6) + lowestBit(word);
+	       word &= word - 1;
+	    }
+	 }
+      } else {
+	 /* only the neighbours of the column of smallest degree in 'row'
+	    can be non-orthog to every column in row */
+	 int shortest = row[0];
+	 for (i = 1; i < len; i++)
+	    if (nodes[row[i]].degree < nodes[shortest].degree)
+	       shortest = row[i];
+	 const int *nbrs = nodes[shortest].nbrs;
+	 for (k = 0; k < nodes[shortest].degree; k++) {
+	    const int other = nbrs[k];
+	    for (i = 0; i < len; i++)
+	       if (row[i] != shortest && !adjacent(row[i], other))
+		  break;
+	    if (i == len)
+	       cl_indices[cl_length++] = other;
+	 }
+      }
       largest_length = CoinMax(cl_length, largest_length);
 
       /* if there is anything in indices, enumerate (or greedily find)
@@ -322,14 +368,18 @@ CglClique::find_scl(OsiCuts& cs)
 	 continue;
       }
 
-      /* star will contain the indices of v's neighbors (but not v's index) */
-      const bool* node_node_start = node_node + nodenum * v;
+      /* star will contain the indices of v's neighbors (but not v's index).
+	 Both v's neighbors and current_indices are in increasing order. */
+      const int *nbrs = nodes[v].nbrs;
+      const int *nbrs_end = nbrs + nodes[v].degree;
       int& star_length = cl_length;
       star_length = 0;
       double star_val = v_val;
-      for (i = 0; i < current_nodenum; i++) {
+      for (i = 0; i < current_nodenum && nbrs != nbrs_end; i++) {
 	 const int other_node = current_indices[i];
-	 if (node_node_start[other_node]) {
+	 while (nbrs != nbrs_end && *nbrs < other_node)
+	    ++nbrs;
+	 if (nbrs != nbrs_end && *nbrs == other_node) {
 	    star[star_length] = other_node;
 	    star_deg[star_length++] = current_degrees[i];
 	    star_val += current_values[i];
@@ -472,7 +522,6 @@ CglClique::scl_choose_next_node(const int current_nodenum,
  * and that this ordering is maintained here.
  *
  * fgraph: IN, pointer to the fractional graph
- * node_node: IN, node_node incidence matrix
  * del_ind: IN, the index of the node to be deleted (wrt to current_indices)
  * pcurrent_nodenum: INOUT, pointer to the current number of nodes
  * current_indices: INOUT, array of current node indices
@@ -501,11 +550,17 @@ CglClique::scl_delete_node(const int del_ind, int& current_nodenum,
 	   (current_nodenum-del_ind-1) * sizeof(double));
    current_nodenum--;
    
-   /* decrease the degrees of v's neighbors by 1 */
-   const bool* node_node_start = node_node + (fgraph.nodenum * v);
-   for (int i = 0; i < current_nodenum; ++i)
-      if (node_node_start[current_indices[i]])
+   /* decrease the degrees of v's neighbors by 1 (both lists are in
+      increasing order) */
+   const int *nbrs = fgraph.nodes[v].nbrs;
+   const int *nbrs_end = nbrs + fgraph.nodes[v].degree;
+   for (int i = 0; i < current_nodenum && nbrs != nbrs_end; ++i) {
+      const int other_node = current_indices[i];
+      while (nbrs != nbrs_end && *nbrs < other_node)
+	 ++nbrs;
+      if (nbrs != nbrs_end && *nbrs == other_node)
 	 current_degrees[i]--;
+   }
 }
 
 /*****************************************************************************/
@@ -540,7 +595,6 @@ int
 CglClique::enumerate_maximal_cliques(int& pos, bool* label, OsiCuts& cs)
 {
    const fnode *nodes = fgraph.nodes;
-   const int nodenum = fgraph.nodenum;
 
    int i, j, k, cnt;
 
@@ -548,9 +602,9 @@ CglClique::enumerate_maximal_cliques(int& pos, bool* label, OsiCuts& cs)
       can be added to the clique, and label it with true */
    while (pos < cl_length) {
       label[pos] = true;
-      const bool* node_node_start = node_node + cl_indices[pos] * nodenum;
+      const int node = cl_indices[pos];
       for (j = 0; j < pos; j++)
-	 if (label[j] && ! node_node_start[cl_indices[j]]) {
+	 if (label[j] && ! adjacent(node, cl_indices[j])) {
 	    label[pos] = false;
 	    break;
 	 }
@@ -585,9 +639,9 @@ CglClique::enumerate_maximal_cliques(int& pos, bool* label, OsiCuts& cs)
       /* check if the clique can be extended on cl_indices */
       for (k = cl_length - 1; k >= 0; k--) {
 	 if (!label[k]) {
-	    const bool* node_node_start = node_node + cl_indices[k] * nodenum;
+	    const int node = cl_indices[k];
 	    for (i = cnt - 1; i >= 0; i--)
-	       if (!node_node_start[coef[i]])
+	       if (!adjacent(node, coef[i]))
 		  break;
 	    /* if k can be added to the clique, return (the clique is not
 	       maximal, so it will be or was recorded) */
@@ -615,9 +669,9 @@ CglClique::enumerate_maximal_cliques(int& pos, bool* label, OsiCuts& cs)
       /* if clique can be extended on cl_del_indices then it can be
 	 discarded (was already counted) */
       for (i = 0; i < cl_del_length; i++) {
-	 const bool* node_node_start = node_node + cl_del_indices[i]*nodenum;
+	 const int node = cl_del_indices[i];
 	 for (j = cnt - 1; j >= 0; j--)
-	    if (!node_node_start[coef[j]])
+	    if (!adjacent(node, coef[j]))
 	       break;
 	 /* if cl_del_indices[i] can be added to the clique, return */
 	 if (j < 0) {
@@ -649,7 +703,6 @@ CglClique::greedy_maximal_clique(OsiCuts& cs)
 {
    assert(cl_length > 0);
    const fnode *nodes = fgraph.nodes;
-   const int nodenum = fgraph.nodenum;
    int i, j;
 
    int * coef = new int[cl_length + cl_perm_length];
@@ -657,9 +710,8 @@ CglClique::greedy_maximal_clique(OsiCuts& cs)
    int cnt = 1;
    for (j = 1; j < cl_length; j++) {
       const int var = cl_indices[j];
-      const bool* node_node_start = node_node + var * nodenum;
       for (i = cnt-1; i >= 0; i--)
-	 if (!node_node_start[coef[i]])
+	 if (!adjacent(var, coef[i]))
 	    break;
       if (i < 0)
 	 coef[cnt++] = var;
@@ -773,6 +825,14 @@ CglClique::generateCpp( FILE * fp)
   else
     fprintf(fp,"4  clique.setDoRowClique(%s);\n",
 	    do_row_clique ? "true" : "false");
+  std::string adjacencies[] = {"ADJACENCY_AUTOMATIC","ADJACENCY_BITSET",
+			       "ADJACENCY_SPARSE"};
+  if (adjacency_rule!=other.adjacency_rule)
+    fprintf(fp,"3  clique.setAdjacencyMethod(CglClique::%s);\n",
+	    adjacencies[adjacency_rule].c_str());
+  else
+    fprintf(fp,"4  clique.setAdjacencyMethod(CglClique::%s);\n",
+	    adjacencies[adjacency_rule].c_str());
   if (petol!=other.petol)
     fprintf(fp,"3  clique.setMinViolation(%g);\n",petol);
   else
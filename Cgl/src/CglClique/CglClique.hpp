@@ -6,6 +6,9 @@
 #ifndef _CglClique_h_
 #define _CglClique_h_
 
+#include <algorithm>
+
+#include "CoinTypes.hpp"
 #include "CglCutGenerator.hpp"
 
 //class OsiCuts;
@@ -20,6 +23,9 @@ public:
     CglClique(const CglClique& rhs);
     /// Clone
     virtual CglCutGenerator * clone() const;
+    /// Can be run on a thread at same time as other generators
+    virtual bool threadSafe() const
+    { return true;}
 
     /// Assignment operator
     CglClique& operator=(const CglClique& rhs);
@@ -87,6 +93,22 @@ public:
     void setMinViolation(double minviol) { petol = minviol; }
     double getMinViolation() const { return petol; }
 
+    /** How adjacency in the fractional graph is held
+     */
+    enum adjacency_method {
+	/** bitset unless the graph is large and sparse */
+	ADJACENCY_AUTOMATIC,
+	/** packed bitset, nodenum bits for each node */
+	ADJACENCY_BITSET,
+	/** sorted neighbour lists only */
+	ADJACENCY_SPARSE
+    };
+
+    void setAdjacencyMethod(adjacency_method method) {
+	adjacency_rule = method;
+    }
+    adjacency_method getAdjacencyMethod() const { return adjacency_rule; }
+
 private:
 
     struct frac_graph ;
@@ -152,8 +174,12 @@ protected:
 
     /** the intersection graph corresponding to the set packing problem */
     frac_graph fgraph;
-    /** the node-node incidence matrix of the intersection graph. */
-    bool* node_node;
+    /** the node-node incidence matrix of the intersection graph, packed
+	into node_node_words 64 bit words for each node.  NULL if the graph
+	is held only as the neighbour lists in fgraph. */
+    CoinUInt64* node_node;
+    /** number of words for each node in node_node */
+    int node_node_words;
 
     /** The primal tolerance in the solverinterface. */
     double petol;
@@ -184,6 +210,9 @@ protected:
     int rcl_candidate_length_threshold;
     /** whether to give a detailed statistics on the row clique method */
     bool rcl_report_result;
+
+    /** How adjacency is held (see adjacency_method) */
+    adjacency_method adjacency_rule;
     /**@}*/
 
     /** variables/arrays that are used across many methods */
@@ -224,7 +253,15 @@ private:
     /**  */
     void createFractionalGraph();
     /**  */
-    int createNodeNode();
+    void createNodeNode();
+    /** whether nodes i and j of the fractional graph are adjacent */
+    inline bool adjacent(const int i, const int j) const {
+	if (node_node)
+	    return ((node_node[i * node_node_words + (j >> 6)] >>
+		     (j & 63)) & 1) != 0;
+	const fnode& node = fgraph.nodes[i];
+	return std::binary_search(node.nbrs, node.nbrs + node.degree, j);
+    }
     /**  */
     void deleteSetPackingSubMatrix();
     /**  */
@@ -182,14 +182,10 @@ CglClique::createSetPackingSubMatrix(const OsiSolverInterface& si)
    assert(nzcnt == sp_row_start[sp_numrows]);
 /*
   Now create the vectors with row indices for each column (sp_col_ind) and
-  column indices for each row (sp_row_ind). It turns out that
-  CoinIsOrthogonal assumes that the row indices for a given column are listed
-  in ascending order. This is *not* a solver-independent assumption! At best,
-  one can hope that the underlying solver will produce an index vector that's
-  either ascending or descending. Under that assumption, compare the first
-  and last entries and proceed accordingly. Eventually some solver will come
-  along that hands back an index vector in random order, and CoinIsOrthogonal
-  will break.  Until then, try and avoid the cost of a sort.
+  column indices for each row (sp_row_ind). Row indices for each column are
+  kept in ascending order. Most solvers give an index vector that's either
+  ascending or descending so compare the first and last entries and proceed
+  accordingly; the sort below then costs little.
 */
    sp_col_ind = new int[nzcnt];
    sp_row_ind = new int[nzcnt];
@@ -232,21 +228,6 @@ CglClique::createSetPackingSubMatrix(const OsiSolverInterface& si)
 
 /*****************************************************************************/
 
-static inline bool
-CoinIsOrthogonal(const int* first0, const int* last0,
-		 const int* first1, const int* last1)
-{
-   while (first0 != last0 && first1 != last1) {
-      if (*first0 == *first1)
-	 return false;
-      if (*first0 < *first1)
-	 ++first0;
-      else
-	 ++first1;
-   }
-   return true;
-}
-
 /*===========================================================================*
   Build up the fractional graph
  *===========================================================================*/
@@ -254,12 +235,9 @@ CoinIsOrthogonal(const int* first0, const int* last0,
 void
 CglClique::createFractionalGraph()
 {
-   // fgraph.edgenum is filled when createNodeNode is invoked
    fgraph.nodenum = sp_numcols;
-   fgraph.all_nbr = new int[2*fgraph.edgenum];
    fgraph.nodes = new fnode[sp_numcols+1];
 
-   int *all_nbr = fgraph.all_nbr;
    fnode *nodes = fgraph.nodes;
    int min_degree, max_degree, min_deg_node, max_deg_node;
 
@@ -268,26 +246,59 @@ CglClique::createFractionalGraph()
    nodes[0].degree = 0 ;
 #  endif
 
-   int i, j, total_deg, old_total;
+   int i, j, k, total_deg;
 
    /*========================================================================*
       Construct the adjacency lists (neighbors) of the nodes in fgraph.
       Two nodes are adjacent iff the columns corresponding to them are
-      non-orthogonal.
+      non-orthogonal, i.e., they have a row in common.  So the neighbors of
+      a node are found by going through the rows of its column, with
+      marker[j] == i once j has been seen for node i. The first pass counts,
+      the second fills in all_nbr.
     *========================================================================*/
 
+   int *marker = new int[sp_numcols];
+   std::fill(marker, marker + sp_numcols, -1);
    for ( i = 0, total_deg = 0; i < sp_numcols; i++ ) {
-      old_total = total_deg;
-      const bool* node_node_i = node_node + i * sp_numcols;
-      for ( j = 0; j < sp_numcols; j++ ) {
-	 if ( node_node_i[j] ) {
-	    all_nbr[total_deg++] = j;
+      marker[i] = i;
+      int degree = 0;
+      for ( k = sp_col_start[i]; k < sp_col_start[i+1]; k++ ) {
+	 const int row = sp_col_ind[k];
+	 for ( j = sp_row_start[row]; j < sp_row_start[row+1]; j++ ) {
+	    const int other = sp_row_ind[j];
+	    if ( marker[other] != i ) {
+	       marker[other] = i;
+	       degree++;
+	    }
 	 }
       }
+      nodes[i].degree = degree;
+      total_deg += degree;
+   }
+   fgraph.edgenum = total_deg / 2;
+   fgraph.all_nbr = new int[total_deg];
+   int *all_nbr = fgraph.all_nbr;
+
+   std::fill(marker, marker + sp_numcols, -1);
+   for ( i = 0, total_deg = 0; i < sp_numcols; i++ ) {
+      marker[i] = i;
+      int *nbrs = all_nbr + total_deg;
+      for ( k = sp_col_start[i]; k < sp_col_start[i+1]; k++ ) {
+	 const int row = sp_col_ind[k];
+	 for ( j = sp_row_start[row]; j < sp_row_start[row+1]; j++ ) {
+	    const int other = sp_row_ind[j];
+	    if ( marker[other] != i ) {
+	       marker[other] = i;
+	       all_nbr[total_deg++] = other;
+	    }
+	 }
+      }
+      // everything else relies on neighbors being in increasing order
+      std::sort(nbrs, all_nbr + total_deg);
       nodes[i].val = sp_colsol[i];
-      nodes[i].degree = total_deg - old_total;
-      nodes[i].nbrs = all_nbr + old_total;
+      nodes[i].nbrs = nbrs;
    }
+   delete[] marker;
 
    fgraph.density = static_cast<double> (total_deg) / (sp_numcols * (sp_numcols-1));
 
@@ -315,29 +326,47 @@ CglClique::createFractionalGraph()
 /*****************************************************************************/
 
 /*===========================================================================*
- * Construct the node-node incidence matrix from the fractional graph.
+ * Construct the node-node incidence matrix from the fractional graph, one
+ * bit per node pair.  For a large sparse graph the bitset would be much
+ * bigger than the neighbor lists, so unless asked for it is then not
+ * created and adjacent() searches the neighbor lists instead.
  *===========================================================================*/
-int
+void
 CglClique::createNodeNode()
 {
-   node_node = new bool[sp_numcols * sp_numcols];
-   std::fill(node_node, node_node + sp_numcols * sp_numcols, false);
-
-   int i, j;
-   int edgenum = 0;
-   for (i = 0; i < sp_numcols; ++i) {
-      for (j = i+1; j < sp_numcols; ++j) {
-	 if (! CoinIsOrthogonal(sp_col_ind + sp_col_start[i],
-				sp_col_ind + sp_col_start[i+1],
-				sp_col_ind + sp_col_start[j],
-				sp_col_ind + sp_col_start[j+1]) ) {
-	    node_node[i * sp_numcols + j] = true;
-	    node_node[j * sp_numcols + i] = true;
-	    ++edgenum;
-	 }
+   node_node = 0;
+   node_node_words = (sp_numcols + 63) >> 6;
+   const double bitsetBytes =
+      static_cast<double>(sp_numcols) * node_node_words * sizeof(CoinUInt64);
+   const double listBytes = 2.0 * fgraph.edgenum * sizeof(int);
+   bool useBitset;
+   switch (adjacency_rule) {
+   case ADJACENCY_BITSET:
+      useBitset = true;
+      break;
+   case ADJACENCY_SPARSE:
+      useBitset = false;
+      break;
+   default:
+      // bitset is faster to query so allow it to be 4 times bigger
+      useBitset = sp_numcols < 1024 || bitsetBytes < 4.0 * listBytes;
+      break;
+   }
+   if (!useBitset)
+      return;
+
+   const int size = sp_numcols * node_node_words;
+   node_node = new CoinUInt64[size];
+   std::fill(node_node, node_node + size, static_cast<CoinUInt64>(0));
+
+   const fnode *nodes = fgraph.nodes;
+   for (int i = 0; i < sp_numcols; ++i) {
+      CoinUInt64* node_node_i = node_node + i * node_node_words;
+      for (int k = 0; k < nodes[i].degree; ++k) {
+	 const int j = nodes[i].nbrs[k];
+	 node_node_i[j >> 6] |= static_cast<CoinUInt64>(1) << (j & 63);
       }
    }
-   return edgenum;
 }
 
 /*****************************************************************************/
@@ -74,5 +74,32 @@ CglCliqueUnitTest(const OsiSolverInterface *baseSiP,
     delete siP;
   }
 
+  // Test bitset and sparse adjacency give the same cuts
+  {
+    OsiSolverInterface  *siP = baseSiP->clone();
+    std::string fn = mpsDir+"l152lav";
+    std::string fn2 = mpsDir+"l152lav.mps";
+    FILE *in_f = fopen(fn2.c_str(), "r");
+    if(in_f != NULL) {
+      fclose(in_f);
+      siP->readMps(fn.c_str(),"mps");
+      siP->initialSolve();
+
+      CglClique bitset;
+      bitset.setAdjacencyMethod(CglClique::ADJACENCY_BITSET);
+      OsiCuts csBitset;
+      bitset.generateCuts(*siP, csBitset);
+      CglClique sparse(bitset);
+      sparse.setAdjacencyMethod(CglClique::ADJACENCY_SPARSE);
+      OsiCuts csSparse;
+      sparse.generateCuts(*siP, csSparse);
+      assert(csBitset.sizeRowCuts() > 0);
+      assert(csBitset.sizeRowCuts() == csSparse.sizeRowCuts());
+      for (int i = 0; i < csBitset.sizeRowCuts(); i++)
+	assert(csBitset.rowCut(i) == csSparse.rowCut(i));
+    }
+    delete siP;
+  }
+
 }
 
@@ -5,12 +5,15 @@
 
 #include <cstdlib>
 #include <cassert>
+#include <cmath>
 //#include <cfloat>
 //#include <iostream>
 
 #include "CoinPragma.hpp"
 #include "CglCutGenerator.hpp"
 #include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+#include "CglCutProfile.hpp"
  
 
 //-------------------------------------------------------------------
@@ -18,7 +21,10 @@
 //-------------------------------------------------------------------
 CglCutGenerator::CglCutGenerator ()
   : aggressive_(0),
-canDoGlobalCuts_(false)
+canDoGlobalCuts_(false),
+profile_(NULL),
+profileIndex_(-1),
+modelStructure_(NULL)
 {
   // nothing to do here
 }
@@ -29,7 +35,11 @@ canDoGlobalCuts_(false)
 CglCutGenerator::CglCutGenerator (
                   const CglCutGenerator & source)         
   : aggressive_(source.aggressive_),
-    canDoGlobalCuts_(source.canDoGlobalCuts_)
+    canDoGlobalCuts_(source.canDoGlobalCuts_),
+    profile_(source.profile_),
+    profileIndex_(source.profileIndex_),
+    workspace_(),
+    modelStructure_(source.modelStructure_)
 {  
   // nothing to do here
 }
@@ -53,6 +63,9 @@ CglCutGenerator::operator=(
   if (this != &rhs) {
     aggressive_ = rhs.aggressive_;
     canDoGlobalCuts_ = rhs.canDoGlobalCuts_;
+    profile_ = rhs.profile_;
+    profileIndex_ = rhs.profileIndex_;
+    modelStructure_ = rhs.modelStructure_;
   }
   return *this;
 }
@@ -67,6 +80,83 @@ CglCutGenerator::needsOptimalBasis() const
 {
   return false;
 }
+// Return true if can run at same time as other generators
+bool 
+CglCutGenerator::threadSafe() const
+{
+  return false;
+}
+
+// Attach a profile
+void
+CglCutGenerator::setProfile(CglCutProfile * profile, const char * name)
+{
+  profile_ = profile;
+  profileIndex_ = profile ? profile->addGenerator(name) : -1;
+}
+// Generate cuts and record call
+void
+CglCutGenerator::generateCutsAndRecord(const OsiSolverInterface & si,
+				       OsiCuts & cs,
+				       const CglTreeInfo info)
+{
+  OsiCuts generated;
+  double wallTime = CoinGetTimeOfDay();
+  double cpuTime = CoinCpuTime();
+  generateCuts(si,generated,info);
+  wallTime = CoinGetTimeOfDay()-wallTime;
+  cpuTime = CoinCpuTime()-cpuTime;
+  recordCuts(si,generated,cs,info,wallTime,cpuTime);
+}
+// Move cuts to cs and record call
+void
+CglCutGenerator::recordCuts(const OsiSolverInterface & si,
+			    OsiCuts & generated, OsiCuts & cs,
+			    const CglTreeInfo & info,
+			    double wallTime, double cpuTime)
+{
+  const double * solution = si.getColSolution();
+  int numberColumns = si.getNumCols();
+  int numberRowCuts = generated.sizeRowCuts();
+  int numberColumnCuts = generated.sizeColCuts();
+  CglCutProfile::Entry call;
+  call.numberCalls = 1;
+  call.wallTime = wallTime;
+  call.cpuTime = cpuTime;
+  call.numberCuts = numberRowCuts+numberColumnCuts;
+  // cuts are still all inserted - only count those which are new
+  bool hashing = cs.duplicateHashing();
+  if (profile_)
+    cs.setDuplicateHashing(true);
+  for (int i=0;i<numberRowCuts;i++) {
+    OsiRowCut & cut = generated.rowCut(i);
+    call.numberRowCuts++;
+    if (!profile_) {
+      cs.insert(cut);
+      continue;
+    }
+    if (!cs.isDuplicate(cut))
+      call.numberSurviving++;
+    cs.insert(cut);
+    const CoinPackedVector & row = cut.row();
+    int n = row.getNumElements();
+    const double * element = row.getElements();
+    double norm = 0.0;
+    for (int j=0;j<n;j++)
+      norm += element[j]*element[j];
+    double violation = solution ? CoinMax(cut.violated(solution),0.0) : 0.0;
+    call.sumDensity += numberColumns ? static_cast<double>(n)/numberColumns : 0.0;
+    call.sumViolation += violation;
+    call.sumEfficacy += norm>0.0 ? violation/sqrt(norm) : 0.0;
+  }
+  for (int i=0;i<numberColumnCuts;i++)
+    cs.insert(generated.colCut(i));
+  if (profile_) {
+    cs.setDuplicateHashing(hashing);
+    call.numberSurviving += numberColumnCuts;
+    profile_->record(profileIndex_,info.level,call);
+  }
+}
 
 #ifdef NDEBUG
 #undef NDEBUG
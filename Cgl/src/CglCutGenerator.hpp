@@ -8,6 +8,9 @@
 #include "OsiCuts.hpp"
 #include "OsiSolverInterface.hpp"
 #include "CglTreeInfo.hpp"
+#include "CglWorkspace.hpp"
+class CglCutProfile;
+class CglModelStructure;
 
 //-------------------------------------------------------------------
 //
@@ -102,6 +105,65 @@ public:
   /// Return maximum length of cut in tree
   virtual int maximumLengthOfCutInTree() const
   { return COIN_INT_MAX;}
+  /** Return true if generateCuts may be run on one thread (with its own
+      solver) while other generators run on other threads.
+      Only true if generator has no shared (static) state.
+      Default is false
+  */
+  virtual bool threadSafe() const;
+  //@}
+
+  /**@name Profiling */
+  //@{
+  /** Attach a profile (not owned, NULL to detach).  Calls through
+      generateCutsAndRecord are then recorded in it under name.
+      Clones record in the same profile. */
+  void setProfile(CglCutProfile * profile, const char * name);
+  /// Profile (NULL if none)
+  inline CglCutProfile * profile() const
+  { return profile_;}
+  /** Generate cuts and add them to cs (as generateCuts), recording the
+      call if a profile is attached. */
+  void generateCutsAndRecord( const OsiSolverInterface & si, OsiCuts & cs,
+			      const CglTreeInfo info = CglTreeInfo());
+  /** Move cuts generated for si in wallTime and cpuTime from generated
+      to cs and record the call in profile
+      if there is one.  For callers which time generateCuts themselves. */
+  void recordCuts( const OsiSolverInterface & si, OsiCuts & generated,
+		   OsiCuts & cs, const CglTreeInfo & info,
+		   double wallTime, double cpuTime);
+  //@}
+
+  /**@name Model structure */
+  //@{
+  /** Share an analysis of the formulation (not owned, NULL for none).
+      Generators which can use it (mixed integer rounding, flow cover,
+      residual capacity) then bring it up to date at the start of
+      generateCuts and only redo their own preprocessing when its
+      version changes.  Clones share the same structure. */
+  inline void setModelStructure(CglModelStructure * structure)
+  { modelStructure_ = structure;}
+  /// Model structure (NULL if none)
+  inline CglModelStructure * modelStructure() const
+  { return modelStructure_;}
+  //@}
+
+  /**@name Workspace */
+  //@{
+  /** Scratch space kept from one call to the next (not copied).
+      Generators using it reset it at the start of generateCuts. */
+  inline CglWorkspace & workspace()
+  { return workspace_;}
+  inline const CglWorkspace & workspace() const
+  { return workspace_;}
+  /** Bytes of scratch space allocated in last call to generateCuts
+      (zero once warmed up, always zero if generator does not use
+      workspace) */
+  inline size_t bytesAllocatedLastCall() const
+  { return workspace_.bytesAllocated();}
+  /// Free scratch space
+  inline void freeWorkspace()
+  { workspace_.clear();}
   //@}
   
   // test this class
@@ -116,6 +178,14 @@ public:
   int aggressive_;
   /// True if can do global cuts i.e. no general integers
   bool canDoGlobalCuts_;
+  /// Profile (not owned)
+  CglCutProfile * profile_;
+  /// Index of this generator in profile
+  int profileIndex_;
+  /// Scratch space
+  CglWorkspace workspace_;
+  /// Shared model structure (not owned)
+  CglModelStructure * modelStructure_;
 };
 
 #endif
@@ -0,0 +1,506 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cmath>
+#include <cstring>
+#include <cassert>
+#include <algorithm>
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinSort.hpp"
+#include "CglCutPool.hpp"
+
+namespace {
+  // Mixes bit pattern of value into hash
+  inline CoinUInt64 mix(CoinUInt64 hash, double value)
+  {
+    CoinUInt64 bits;
+    memcpy(&bits,&value,sizeof(bits));
+    hash ^= bits;
+    hash *= 1099511628211ULL;
+    return hash^(hash>>29);
+  }
+  // Hash of bounds and (sorted) coefficients
+  CoinUInt64 hashCut(const OsiRowCut & cut)
+  {
+    const CoinPackedVector & row = cut.row();
+    int n = row.getNumElements();
+    const int * index = row.getIndices();
+    const double * element = row.getElements();
+    CoinUInt64 hash = 14695981039346656037ULL;
+    hash = mix(hash,cut.lb());
+    hash = mix(hash,cut.ub());
+    for (int j=0;j<n;j++) {
+      hash = mix(hash,static_cast<double>(index[j]));
+      hash = mix(hash,element[j]);
+    }
+    return hash;
+  }
+  // True if cuts exactly the same
+  bool sameCut(const OsiRowCut & x, const OsiRowCut & y)
+  {
+    const CoinPackedVector & xRow = x.row();
+    const CoinPackedVector & yRow = y.row();
+    int n = xRow.getNumElements();
+    if (n!=yRow.getNumElements()||x.lb()!=y.lb()||x.ub()!=y.ub())
+      return false;
+    return !memcmp(xRow.getIndices(),yRow.getIndices(),n*sizeof(int))&&
+      !memcmp(xRow.getElements(),yRow.getElements(),n*sizeof(double));
+  }
+  // Fraction of rounds active (new cuts count as active)
+  inline double activeFraction(int numberActive, int numberRounds)
+  {
+    return (numberActive+1.0)/(numberRounds+1.0);
+  }
+}
+
+//-------------------------------------------------------------------
+// Select cuts from pool
+//-------------------------------------------------------------------
+void
+CglCutPool::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
+			 const CglTreeInfo /*info*/)
+{
+  numberSelected_=0;
+  if (!numberCuts_)
+    return;
+  const double * solution = si.getColSolution();
+  int numberColumns = si.getNumCols();
+  workspace_.reset();
+  double * score = workspace_.doubleArray(numberCuts_);
+  int * which = workspace_.intArray(numberCuts_);
+  int numberCandidates=0;
+  CoinBigIndex numberElements=0;
+  int i;
+  for (i=0;i<numberCuts_;i++) {
+    PoolCut & poolCut = cuts_[i];
+    const CoinPackedVector & row = poolCut.cut->row();
+    int n = row.getNumElements();
+    const int * index = row.getIndices();
+    const double * element = row.getElements();
+    double sum=0.0;
+    for (int j=0;j<n;j++) {
+      assert (index[j]<numberColumns);
+      sum += solution[index[j]]*element[j];
+    }
+    double lb = poolCut.cut->lb();
+    double ub = poolCut.cut->ub();
+    double violation=0.0;
+    if (sum>ub)
+      violation = sum-ub;
+    else if (sum<lb)
+      violation = lb-sum;
+    poolCut.numberRounds++;
+    poolCut.age++;
+    if (fabs(sum-ub)<=1.0e-7||fabs(sum-lb)<=1.0e-7) {
+      // binding
+      poolCut.numberActive++;
+      poolCut.age=0;
+    }
+    double efficacy = violation/poolCut.norm;
+    if (violation>0.0&&efficacy>=minimumEfficacy_) {
+      double fraction = activeFraction(poolCut.numberActive,
+				       poolCut.numberRounds);
+      score[numberCandidates] = -efficacy*(1.0+activityWeight_*fraction);
+      which[numberCandidates++]=i;
+      numberElements += n;
+    }
+  }
+  // best first
+  CoinSort_2(score,score+numberCandidates,which);
+  int maximumSelected = CoinMin(numberCandidates,maximumCutsPerRound_);
+  if (maximumParallelism_<1.0) {
+    // Index of selected cuts by column - cuts already in cs count
+    int numberExisting = cs.sizeRowCuts();
+    CoinBigIndex numberExistingElements=0;
+    for (i=0;i<numberExisting;i++)
+      numberExistingElements += cs.rowCutPtr(i)->row().getNumElements();
+    int numberSlots = numberExisting+maximumSelected;
+    CoinBigIndex numberEntries = numberExistingElements+numberElements;
+    int * columnFirst = workspace_.intArray(numberColumns);
+    CoinFillN(columnFirst,numberColumns,-1);
+    int * next = workspace_.intArray(numberEntries);
+    int * slot = workspace_.intArray(numberEntries);
+    double * value = workspace_.doubleArray(numberEntries);
+    double * slotNorm = workspace_.doubleArray(numberSlots);
+    double * dot = workspace_.doubleArray(numberSlots);
+    CoinZeroN(dot,numberSlots);
+    int * touched = workspace_.intArray(numberSlots);
+    char * mark = workspace_.charArray(numberSlots);
+    CoinZeroN(mark,numberSlots);
+    int numberFilled=0;
+    int entry=0;
+    for (i=0;i<numberExisting+numberCandidates&&
+	   numberSelected_<maximumSelected;i++) {
+      const OsiRowCut * cut;
+      double norm;
+      bool existing = i<numberExisting;
+      if (existing) {
+	cut = cs.rowCutPtr(i);
+	norm = cut->row().twoNorm();
+	if (!norm)
+	  continue;
+      } else {
+	const PoolCut & poolCut = cuts_[which[i-numberExisting]];
+	cut = poolCut.cut;
+	norm = poolCut.norm;
+      }
+      const CoinPackedVector & row = cut->row();
+      int n = row.getNumElements();
+      const int * index = row.getIndices();
+      const double * element = row.getElements();
+      int j;
+      if (!existing) {
+	// dot products with cuts sharing a column
+	int numberTouched=0;
+	for (j=0;j<n;j++) {
+	  double elementJ = element[j];
+	  for (int k=columnFirst[index[j]];k>=0;k=next[k]) {
+	    int iSlot = slot[k];
+	    if (!mark[iSlot]) {
+	      mark[iSlot]=1;
+	      touched[numberTouched++]=iSlot;
+	    }
+	    dot[iSlot] += elementJ*value[k];
+	  }
+	}
+	double parallelism=0.0;
+	for (j=0;j<numberTouched;j++) {
+	  int iSlot = touched[j];
+	  parallelism = CoinMax(parallelism,
+				fabs(dot[iSlot])/(norm*slotNorm[iSlot]));
+	  dot[iSlot]=0.0;
+	  mark[iSlot]=0;
+	}
+	if (parallelism>maximumParallelism_)
+	  continue;
+	PoolCut & poolCut = cuts_[which[i-numberExisting]];
+	cs.insert(*cut);
+	poolCut.numberActive++;
+	poolCut.age=0;
+	numberSelected_++;
+      }
+      // add to index
+      slotNorm[numberFilled]=norm;
+      for (j=0;j<n;j++) {
+	int iColumn = index[j];
+	next[entry]=columnFirst[iColumn];
+	columnFirst[iColumn]=entry;
+	slot[entry]=numberFilled;
+	value[entry++]=element[j];
+      }
+      numberFilled++;
+    }
+  } else {
+    for (i=0;i<maximumSelected;i++) {
+      PoolCut & poolCut = cuts_[which[i]];
+      cs.insert(*poolCut.cut);
+      poolCut.numberActive++;
+      poolCut.age=0;
+    }
+    numberSelected_=maximumSelected;
+  }
+  evict();
+}
+
+//-------------------------------------------------------------------
+// Add cuts
+//-------------------------------------------------------------------
+int
+CglCutPool::addCuts(const OsiCuts & cs)
+{
+  int numberAdded=0;
+  int n = cs.sizeRowCuts();
+  for (int i=0;i<n;i++) {
+    if (addCut(*cs.rowCutPtr(i)))
+      numberAdded++;
+  }
+  return numberAdded;
+}
+
+// Add a row cut
+bool
+CglCutPool::addCut(const OsiRowCut & cut)
+{
+  OsiRowCut * newCut = new OsiRowCut(cut);
+  CoinPackedVector & row = newCut->mutableRow();
+  row.sortIncrIndex();
+  double norm = row.twoNorm();
+  if (!norm) {
+    delete newCut;
+    return false;
+  }
+  CoinUInt64 hash = hashCut(*newCut);
+  int position = findCut(*newCut,hash);
+  if (position>=0&&hashTable_[position]>=0) {
+    // already there - count as active
+    PoolCut & poolCut = cuts_[hashTable_[position]];
+    poolCut.age=0;
+    delete newCut;
+    return false;
+  }
+  if (numberCuts_==maximumCuts_) {
+    maximumCuts_ = 2*maximumCuts_+100;
+    PoolCut * temp = new PoolCut [maximumCuts_];
+    CoinMemcpyN(cuts_,numberCuts_,temp);
+    delete [] cuts_;
+    cuts_ = temp;
+    rebuildHash(maximumCuts_);
+    position = findCut(*newCut,hash);
+  }
+  PoolCut & poolCut = cuts_[numberCuts_];
+  poolCut.cut = newCut;
+  poolCut.norm = norm;
+  poolCut.hash = hash;
+  poolCut.age = 0;
+  poolCut.numberRounds = 0;
+  poolCut.numberActive = 0;
+  hashTable_[position]=numberCuts_;
+  numberCuts_++;
+  bytes_ += bytes(*newCut);
+  if (memoryBudget_&&bytes_>memoryBudget_)
+    evict();
+  return true;
+}
+
+// Remove all cuts
+void
+CglCutPool::clear()
+{
+  for (int i=0;i<numberCuts_;i++)
+    delete cuts_[i].cut;
+  numberCuts_=0;
+  bytes_=0;
+  numberSelected_=0;
+  if (hashTable_)
+    CoinFillN(hashTable_,hashSize_,-1);
+}
+
+// Position of cut in hash table (entry with -1 if not there)
+int
+CglCutPool::findCut(const OsiRowCut & cut, CoinUInt64 hash) const
+{
+  if (!hashSize_)
+    return -1;
+  int mask = hashSize_-1;
+  int position = static_cast<int>(hash&mask);
+  while (true) {
+    int iCut = hashTable_[position];
+    if (iCut<0)
+      return position;
+    if (cuts_[iCut].hash==hash&&sameCut(cut,*cuts_[iCut].cut))
+      return position;
+    position = (position+1)&mask;
+  }
+}
+
+// Rebuild hash table (size for at least number cuts)
+void
+CglCutPool::rebuildHash(int number)
+{
+  int size = 16;
+  while (size<2*number)
+    size *= 2;
+  if (size!=hashSize_) {
+    delete [] hashTable_;
+    hashSize_ = size;
+    hashTable_ = new int [hashSize_];
+  }
+  CoinFillN(hashTable_,hashSize_,-1);
+  int mask = hashSize_-1;
+  for (int i=0;i<numberCuts_;i++) {
+    int position = static_cast<int>(cuts_[i].hash&mask);
+    while (hashTable_[position]>=0)
+      position = (position+1)&mask;
+    hashTable_[position]=i;
+  }
+}
+
+namespace {
+  // Order for eviction - least active fraction then oldest
+  class CglEvictOrder {
+  public:
+    const int * numberActive;
+    const int * numberRounds;
+    const int * age;
+    bool operator()(int i, int j) const
+    {
+      double fractionI = activeFraction(numberActive[i],numberRounds[i]);
+      double fractionJ = activeFraction(numberActive[j],numberRounds[j]);
+      if (fractionI!=fractionJ)
+	return fractionI<fractionJ;
+      if (age[i]!=age[j])
+	return age[i]>age[j];
+      return i<j;
+    }
+  };
+}
+
+// Remove old cuts then cuts with least activity until within budget
+void
+CglCutPool::evict()
+{
+  int numberBefore = numberCuts_;
+  int n=0;
+  int i;
+  for (i=0;i<numberCuts_;i++) {
+    if (maximumAge_>=0&&cuts_[i].age>maximumAge_) {
+      bytes_ -= bytes(*cuts_[i].cut);
+      delete cuts_[i].cut;
+    } else {
+      cuts_[n++]=cuts_[i];
+    }
+  }
+  numberCuts_=n;
+  if (memoryBudget_&&bytes_>memoryBudget_) {
+    int * order = new int [4*numberCuts_];
+    int * numberActive = order+numberCuts_;
+    int * numberRounds = numberActive+numberCuts_;
+    int * age = numberRounds+numberCuts_;
+    for (i=0;i<numberCuts_;i++) {
+      order[i]=i;
+      numberActive[i]=cuts_[i].numberActive;
+      numberRounds[i]=cuts_[i].numberRounds;
+      age[i]=cuts_[i].age;
+    }
+    CglEvictOrder compare;
+    compare.numberActive=numberActive;
+    compare.numberRounds=numberRounds;
+    compare.age=age;
+    std::sort(order,order+numberCuts_,compare);
+    for (i=0;i<numberCuts_&&bytes_>memoryBudget_;i++) {
+      OsiRowCut * cut = cuts_[order[i]].cut;
+      bytes_ -= bytes(*cut);
+      delete cut;
+      cuts_[order[i]].cut=NULL;
+    }
+    delete [] order;
+    n=0;
+    for (i=0;i<numberCuts_;i++) {
+      if (cuts_[i].cut)
+	cuts_[n++]=cuts_[i];
+    }
+    numberCuts_=n;
+  }
+  if (numberCuts_<numberBefore) {
+    numberEvicted_ += numberBefore-numberCuts_;
+    rebuildHash(maximumCuts_);
+  }
+}
+
+// Bytes taken by a cut
+size_t
+CglCutPool::bytes(const OsiRowCut & cut)
+{
+  return sizeof(PoolCut)+sizeof(OsiRowCut)+
+    cut.row().getNumElements()*(sizeof(int)+sizeof(double));
+}
+
+// Copies in rhs
+void
+CglCutPool::gutsOfCopy(const CglCutPool & rhs)
+{
+  minimumEfficacy_ = rhs.minimumEfficacy_;
+  maximumParallelism_ = rhs.maximumParallelism_;
+  activityWeight_ = rhs.activityWeight_;
+  memoryBudget_ = rhs.memoryBudget_;
+  bytes_ = rhs.bytes_;
+  numberCuts_ = rhs.numberCuts_;
+  maximumCuts_ = rhs.maximumCuts_;
+  hashSize_ = rhs.hashSize_;
+  maximumCutsPerRound_ = rhs.maximumCutsPerRound_;
+  maximumAge_ = rhs.maximumAge_;
+  numberEvicted_ = rhs.numberEvicted_;
+  numberSelected_ = rhs.numberSelected_;
+  if (maximumCuts_) {
+    cuts_ = new PoolCut [maximumCuts_];
+    for (int i=0;i<numberCuts_;i++) {
+      cuts_[i] = rhs.cuts_[i];
+      cuts_[i].cut = new OsiRowCut(*rhs.cuts_[i].cut);
+    }
+  }
+  hashTable_ = CoinCopyOfArray(rhs.hashTable_,hashSize_);
+}
+
+// Frees everything
+void
+CglCutPool::gutsOfDelete()
+{
+  for (int i=0;i<numberCuts_;i++)
+    delete cuts_[i].cut;
+  delete [] cuts_;
+  delete [] hashTable_;
+  cuts_=NULL;
+  hashTable_=NULL;
+  numberCuts_=0;
+  maximumCuts_=0;
+  hashSize_=0;
+  bytes_=0;
+}
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+CglCutPool::CglCutPool ()
+  : CglCutGenerator(),
+    cuts_(NULL),
+    hashTable_(NULL),
+    minimumEfficacy_(1.0e-4),
+    maximumParallelism_(0.99),
+    activityWeight_(0.1),
+    memoryBudget_(0),
+    bytes_(0),
+    numberCuts_(0),
+    maximumCuts_(0),
+    hashSize_(0),
+    maximumCutsPerRound_(100),
+    maximumAge_(10),
+    numberEvicted_(0),
+    numberSelected_(0)
+{
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+CglCutPool::CglCutPool (const CglCutPool & rhs)
+  : CglCutGenerator(rhs),
+    cuts_(NULL),
+    hashTable_(NULL)
+{
+  gutsOfCopy(rhs);
+}
+
+//-------------------------------------------------------------------
+// Clone
+//-------------------------------------------------------------------
+CglCutGenerator *
+CglCutPool::clone() const
+{
+  return new CglCutPool(*this);
+}
+
+//-------------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+CglCutPool &
+CglCutPool::operator=(const CglCutPool & rhs)
+{
+  if (this != &rhs) {
+    CglCutGenerator::operator=(rhs);
+    gutsOfDelete();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+CglCutPool::~CglCutPool ()
+{
+  gutsOfDelete();
+}
@@ -0,0 +1,216 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglCutPool_H
+#define CglCutPool_H
+
+#include "CglCutGenerator.hpp"
+
+/** Cut pool with aging, efficacy scoring and parallelism filtering.
+
+    Cuts added (exact duplicates are not stored twice) are kept until
+    they get too old or the pool goes over its memory budget.  Each call
+    to generateCuts is a round.  The efficacy of a cut is its violation
+    at the current solution divided by the two norm of its coefficients
+    (the distance cut off).  Cuts with efficacy at least
+    minimumEfficacy() are candidates, scored by
+
+      efficacy * (1 + activityWeight * fraction of rounds cut was active)
+
+    where a cut is active in a round if it was selected or was binding
+    (within 1.0e-7) at the solution.  Candidates are taken in order of
+    score unless the cosine of the angle with a cut already selected (in
+    this round, or already in cs on entry) is above maximumParallelism(),
+    up to maximumCutsPerRound() cuts.  A sparse column index of selected
+    cuts means only cuts sharing a column are looked at.
+
+    Age is the number of rounds since a cut was last active.  At the end
+    of a round cuts older than maximumAge() are removed and then, if the
+    pool is over memoryBudget() bytes, cuts with the smallest active
+    fraction (oldest first if equal) until it is not.  New cuts count as
+    active until they have been through a round.
+*/
+class CglCutPool : public CglCutGenerator {
+
+public:
+
+  /**@name Generate Cuts */
+  //@{
+  /** Select cuts from pool for the current solution of si and insert
+      them into cs.  Also updates ages and activity and evicts cuts. */
+  virtual void generateCuts( const OsiSolverInterface & si, OsiCuts & cs,
+			     const CglTreeInfo info = CglTreeInfo());
+  //@}
+
+  /**@name Cut stuff */
+  //@{
+  /// Add row cuts in cs (returns number not already in pool)
+  int addCuts(const OsiCuts & cs);
+  /** Add a row cut.  Returns false if already in pool (when it is
+      treated as active). */
+  bool addCut(const OsiRowCut & cut);
+  /// Number of cuts in pool
+  inline int numberCuts() const
+  { return numberCuts_;}
+  /// Cut in pool
+  inline const OsiRowCut * cut(int i) const
+  { return cuts_[i].cut;}
+  /// Rounds since cut was last active
+  inline int age(int i) const
+  { return cuts_[i].age;}
+  /// Number of rounds cut was active
+  inline int numberActive(int i) const
+  { return cuts_[i].numberActive;}
+  /// Number of rounds cut has been through
+  inline int numberRounds(int i) const
+  { return cuts_[i].numberRounds;}
+  /// Bytes taken by cuts in pool
+  inline size_t bytes() const
+  { return bytes_;}
+  /// Number of cuts evicted so far
+  inline int numberEvicted() const
+  { return numberEvicted_;}
+  /// Number of cuts selected in last round
+  inline int numberSelected() const
+  { return numberSelected_;}
+  /// Remove all cuts
+  void clear();
+  //@}
+
+  /**@name Selection criteria */
+  //@{
+  /// Set minimum efficacy of candidate (default 1.0e-4)
+  inline void setMinimumEfficacy(double value)
+  { minimumEfficacy_=value;}
+  inline double minimumEfficacy() const
+  { return minimumEfficacy_;}
+  /** Set maximum cosine of angle between selected cuts (default 0.99,
+      1.0 switches off filtering) */
+  inline void setMaximumParallelism(double value)
+  { maximumParallelism_=value;}
+  inline double maximumParallelism() const
+  { return maximumParallelism_;}
+  /// Set maximum number of cuts selected in a round (default 100)
+  inline void setMaximumCutsPerRound(int value)
+  { maximumCutsPerRound_=value;}
+  inline int maximumCutsPerRound() const
+  { return maximumCutsPerRound_;}
+  /// Set weight of active fraction in score (default 0.1)
+  inline void setActivityWeight(double value)
+  { activityWeight_=value;}
+  inline double activityWeight() const
+  { return activityWeight_;}
+  //@}
+
+  /**@name Eviction */
+  //@{
+  /// Set maximum age (default 10, -1 never too old)
+  inline void setMaximumAge(int value)
+  { maximumAge_=value;}
+  inline int maximumAge() const
+  { return maximumAge_;}
+  /// Set memory budget in bytes (default 0 no limit)
+  inline void setMemoryBudget(size_t value)
+  { memoryBudget_=value;}
+  inline size_t memoryBudget() const
+  { return memoryBudget_;}
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor
+  CglCutPool ();
+
+  /// Copy constructor
+  CglCutPool (const CglCutPool & rhs);
+
+  /// Clone
+  virtual CglCutGenerator * clone() const;
+
+  /// Assignment operator
+  CglCutPool &
+    operator=(const CglCutPool& rhs);
+
+  /// Destructor
+  virtual
+    ~CglCutPool ();
+  //@}
+
+private:
+
+  /// What is kept for each cut
+  struct PoolCut {
+    /// Cut (owned, coefficients sorted by column)
+    OsiRowCut * cut;
+    /// Two norm of coefficients
+    double norm;
+    /// Hash of bounds and coefficients
+    CoinUInt64 hash;
+    /// Rounds since last active
+    int age;
+    /// Rounds through
+    int numberRounds;
+    /// Rounds active
+    int numberActive;
+  };
+
+  /**@name Private methods */
+  //@{
+  /// Position of cut in hash table (entry with -1 if not there)
+  int findCut(const OsiRowCut & cut, CoinUInt64 hash) const;
+  /// Rebuild hash table (size for at least number cuts)
+  void rebuildHash(int number);
+  /// Remove old cuts then cuts with least activity until within budget
+  void evict();
+  /// Bytes taken by a cut
+  static size_t bytes(const OsiRowCut & cut);
+  /// Copies in rhs
+  void gutsOfCopy(const CglCutPool & rhs);
+  /// Frees everything
+  void gutsOfDelete();
+  //@}
+
+  /**@name Private member data */
+  //@{
+  /// Cuts
+  PoolCut * cuts_;
+  /// Hash table (index in cuts_ or -1)
+  int * hashTable_;
+  /// Minimum efficacy of candidate
+  double minimumEfficacy_;
+  /// Maximum cosine between selected cuts
+  double maximumParallelism_;
+  /// Weight of active fraction in score
+  double activityWeight_;
+  /// Memory budget (0 no limit)
+  size_t memoryBudget_;
+  /// Bytes taken by cuts
+  size_t bytes_;
+  /// Number of cuts
+  int numberCuts_;
+  /// Room for cuts
+  int maximumCuts_;
+  /// Size of hash table (power of 2)
+  int hashSize_;
+  /// Maximum number selected in round
+  int maximumCutsPerRound_;
+  /// Maximum age
+  int maximumAge_;
+  /// Number evicted
+  int numberEvicted_;
+  /// Number selected in last round
+  int numberSelected_;
+  //@}
+};
+
+//#############################################################################
+/** A function that tests the methods in the CglCutPool class. The
+    only reason for it not to be a member method is that this way it doesn't
+    have to be compiled into the library. And that's a gain, because the
+    library should be compiled with optimization on, but this method should be
+    compiled with debugging. */
+void CglCutPoolUnitTest(const OsiSolverInterface * siP,
+			const std::string mpdDir );
+#endif
@@ -0,0 +1,142 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "OsiSolverInterface.hpp"
+#include "OsiCuts.hpp"
+#include "CglCutPool.hpp"
+#include "CglStored.hpp"
+
+//--------------------------------------------------------------------------
+// test CglCutPool
+void
+CglCutPoolUnitTest(
+  const OsiSolverInterface * baseSiP,
+  const std::string mpsDir )
+{
+  // Test default constructor and copy & assignment
+  {
+    CglCutPool aGenerator;
+    CglCutPool rhs;
+    {
+      CglCutPool bGenerator;
+      CglCutPool cGenerator(bGenerator);
+      rhs=bGenerator;
+    }
+  }
+
+  // Cut pool
+  {
+    OsiSolverInterface * siP = baseSiP->clone();
+    std::string fn(mpsDir+"p0033");
+    siP->readMps(fn.c_str(),"mps");
+    siP->initialSolve();
+    int numberColumns = siP->getNumCols();
+    const double * solution = siP->getColSolution();
+    // violated cuts on a few columns each
+    CglStored stored;
+    int index[4];
+    double element[4];
+    for (int i=0;i<30;i++) {
+      int n = 2+(i%3);
+      double sum=0.0;
+      for (int j=0;j<n;j++) {
+	index[j]=(7*i+11*j)%numberColumns;
+	element[j]=1.0+((i+j)%2);
+	sum += element[j]*solution[index[j]];
+      }
+      stored.addCut(-COIN_DBL_MAX,sum-0.1*(1+(i%4)),n,index,element);
+    }
+    OsiCuts cuts;
+    stored.generateCuts(*siP,cuts);
+    int nRowCuts = cuts.sizeRowCuts();
+    assert (nRowCuts==30);
+    CglCutPool pool;
+    assert (pool.addCuts(cuts)==nRowCuts);
+    // no duplicates
+    assert (!pool.addCuts(cuts));
+    assert (pool.numberCuts()==nRowCuts);
+    size_t bytes = pool.bytes();
+    assert (bytes>0);
+    // selected cuts are violated and not too parallel
+    pool.setMaximumParallelism(0.9);
+    pool.setMaximumCutsPerRound(3);
+    OsiCuts selected;
+    pool.generateCuts(*siP,selected);
+    int nSelected = selected.sizeRowCuts();
+    assert (nSelected>0&&nSelected<=3);
+    assert (pool.numberSelected()==nSelected);
+    for (int i=0;i<nSelected;i++) {
+      const OsiRowCut & cutI = selected.rowCut(i);
+      assert (cutI.violated(solution)>0.0);
+      for (int j=0;j<i;j++) {
+	const OsiRowCut & cutJ = selected.rowCut(j);
+	double dot = cutI.row().dotProduct(cutJ.row().denseVector(numberColumns));
+	assert (fabs(dot)<=0.9*cutI.row().twoNorm()*cutJ.row().twoNorm()+1.0e-9);
+      }
+    }
+    // cuts selected are now active
+    int nActive=0;
+    for (int i=0;i<pool.numberCuts();i++) {
+      assert (pool.numberRounds(i)==1);
+      if (pool.numberActive(i))
+	nActive++;
+    }
+    assert (nActive>=nSelected);
+    // cuts already in cs are filtered against
+    OsiCuts again;
+    for (int i=0;i<nSelected;i++)
+      again.insert(selected.rowCut(i));
+    pool.generateCuts(*siP,again);
+    for (int i=nSelected;i<again.sizeRowCuts();i++) {
+      for (int j=0;j<nSelected;j++) 
+	assert (!(again.rowCut(i)==again.rowCut(j)));
+    }
+    /* move to a point where all cuts have slack apart from one extra
+       binding cut - slack cuts then age out */
+    std::vector<double> moved(solution,solution+numberColumns);
+    for (int i=0;i<numberColumns;i++)
+      moved[i] -= 1.0;
+    OsiRowCut binding;
+    int column0=0;
+    double one=1.0;
+    binding.setRow(1,&column0,&one);
+    binding.setLb(-COIN_DBL_MAX);
+    binding.setUb(moved[0]);
+    assert (pool.addCut(binding));
+    siP->setColSolution(&moved[0]);
+    pool.setMaximumAge(2);
+    for (int k=0;k<4;k++) {
+      OsiCuts none;
+      pool.generateCuts(*siP,none);
+      assert (!none.sizeRowCuts());
+    }
+    // only binding cut stays
+    assert (pool.numberCuts()==1);
+    assert (*pool.cut(0)==binding);
+    assert (!pool.age(0));
+    assert (pool.numberEvicted()==nRowCuts);
+    // memory budget
+    CglCutPool pool2;
+    pool2.setMemoryBudget(bytes/2);
+    pool2.addCuts(cuts);
+    assert (pool2.bytes()<=bytes/2);
+    assert (pool2.numberCuts()<nRowCuts);
+    assert (pool2.numberEvicted()+pool2.numberCuts()==nRowCuts);
+    CglCutPool pool3(pool2);
+    assert (pool3.numberCuts()==pool2.numberCuts());
+    assert (!pool3.addCut(*pool2.cut(0)));
+    delete siP;
+  }
+}
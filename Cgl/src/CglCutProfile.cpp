@@ -0,0 +1,197 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdio>
+#include <cstring>
+
+#include "CoinPragma.hpp"
+#include "CglCutProfile.hpp"
+
+namespace {
+  // Name with anything which could upset a reader of the file escaped
+  std::string quoted(const std::string & name, bool json)
+  {
+    std::string value = "\"";
+    for (size_t i=0;i<name.size();i++) {
+      char c = name[i];
+      if (c=='"')
+	value += json ? "\\\"" : "\"\"";
+      else if (json&&c=='\\')
+	value += "\\\\";
+      else if (c=='\n'||c=='\r')
+	value += ' ';
+      else
+	value += c;
+    }
+    value += "\"";
+    return value;
+  }
+
+  void writeCsvLine(FILE * fp, const std::string & name, int level,
+		    const CglCutProfile::Entry & entry)
+  {
+    fprintf(fp,"%s,%d,%d,%.6f,%.6f,%d,%d,%.6g,%.6g,%.6g\n",
+	    quoted(name,false).c_str(),level,entry.numberCalls,
+	    entry.wallTime,entry.cpuTime,entry.numberCuts,
+	    entry.numberSurviving,entry.averageDensity(),
+	    entry.averageViolation(),entry.averageEfficacy());
+  }
+
+  void writeJsonEntry(FILE * fp, const CglCutProfile::Entry & entry)
+  {
+    fprintf(fp,"\"calls\": %d, \"wallTime\": %.6f, \"cpuTime\": %.6f, "
+	    "\"cuts\": %d, \"surviving\": %d, \"density\": %.6g, "
+	    "\"violation\": %.6g, \"efficacy\": %.6g",
+	    entry.numberCalls,entry.wallTime,entry.cpuTime,
+	    entry.numberCuts,entry.numberSurviving,entry.averageDensity(),
+	    entry.averageViolation(),entry.averageEfficacy());
+  }
+}
+
+CglCutProfile::Entry::Entry()
+  : numberCalls(0),
+    numberCuts(0),
+    numberSurviving(0),
+    numberRowCuts(0),
+    wallTime(0.0),
+    cpuTime(0.0),
+    sumDensity(0.0),
+    sumViolation(0.0),
+    sumEfficacy(0.0)
+{
+}
+
+// Add in another entry
+void
+CglCutProfile::Entry::add(const Entry & rhs)
+{
+  numberCalls += rhs.numberCalls;
+  numberCuts += rhs.numberCuts;
+  numberSurviving += rhs.numberSurviving;
+  numberRowCuts += rhs.numberRowCuts;
+  wallTime += rhs.wallTime;
+  cpuTime += rhs.cpuTime;
+  sumDensity += rhs.sumDensity;
+  sumViolation += rhs.sumViolation;
+  sumEfficacy += rhs.sumEfficacy;
+}
+
+//-------------------------------------------------------------------
+// Index of generator (added if new)
+//-------------------------------------------------------------------
+int
+CglCutProfile::addGenerator(const char * name)
+{
+  int n = numberGenerators();
+  for (int i=0;i<n;i++) {
+    if (name_[i]==name)
+      return i;
+  }
+  name_.push_back(name);
+  entry_.push_back(std::vector<Entry>());
+  return n;
+}
+
+//-------------------------------------------------------------------
+// Record one call
+//-------------------------------------------------------------------
+void
+CglCutProfile::record(int generator, int level, const Entry & call)
+{
+  if (level<0)
+    level=0;
+  std::vector<Entry> & entries = entry_[generator];
+  if (level>=static_cast<int>(entries.size()))
+    entries.resize(level+1);
+  entries[level].add(call);
+}
+
+// Zero all statistics
+void
+CglCutProfile::clear()
+{
+  for (size_t i=0;i<entry_.size();i++)
+    entry_[i].clear();
+}
+
+// Statistics over all levels
+CglCutProfile::Entry
+CglCutProfile::total(int generator) const
+{
+  Entry sum;
+  const std::vector<Entry> & entries = entry_[generator];
+  for (size_t i=0;i<entries.size();i++)
+    sum.add(entries[i]);
+  return sum;
+}
+
+//-------------------------------------------------------------------
+// Write as comma separated values
+//-------------------------------------------------------------------
+int
+CglCutProfile::writeCsv(const char * fileName) const
+{
+  FILE * fp = fopen(fileName,"w");
+  if (!fp)
+    return -1;
+  fprintf(fp,"generator,level,calls,wallTime,cpuTime,cuts,surviving,"
+	  "density,violation,efficacy\n");
+  int n = numberGenerators();
+  for (int i=0;i<n;i++) {
+    writeCsvLine(fp,name_[i],-1,total(i));
+    for (int j=0;j<numberLevels(i);j++) {
+      if (entry_[i][j].numberCalls)
+	writeCsvLine(fp,name_[i],j,entry_[i][j]);
+    }
+  }
+  fclose(fp);
+  return 0;
+}
+
+//-------------------------------------------------------------------
+// Write as JSON
+//-------------------------------------------------------------------
+int
+CglCutProfile::writeJson(const char * fileName) const
+{
+  FILE * fp = fopen(fileName,"w");
+  if (!fp)
+    return -1;
+  fprintf(fp,"[");
+  int n = numberGenerators();
+  for (int i=0;i<n;i++) {
+    fprintf(fp,"%s\n  {\"generator\": %s, ",i ? "," : "",
+	    quoted(name_[i],true).c_str());
+    writeJsonEntry(fp,total(i));
+    fprintf(fp,",\n   \"levels\": [");
+    bool first=true;
+    for (int j=0;j<numberLevels(i);j++) {
+      if (!entry_[i][j].numberCalls)
+	continue;
+      fprintf(fp,"%s\n     {\"level\": %d, ",first ? "" : ",",j);
+      writeJsonEntry(fp,entry_[i][j]);
+      fprintf(fp,"}");
+      first=false;
+    }
+    fprintf(fp,"]}");
+  }
+  fprintf(fp,"\n]\n");
+  fclose(fp);
+  return 0;
+}
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+CglCutProfile::CglCutProfile ()
+{
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+CglCutProfile::~CglCutProfile ()
+{
+}
@@ -0,0 +1,135 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglCutProfile_H
+#define CglCutProfile_H
+
+#include <string>
+#include <vector>
+
+class OsiSolverInterface;
+
+/** Statistics on cut generators, by generator and by tree level.
+
+    A profile is attached to generators with
+    CglCutGenerator::setProfile and calls made through
+    CglCutGenerator::generateCutsAndRecord (or CglParallelCuts) are then
+    recorded here.  For each call the wall clock and cpu time are kept
+    together with the number of cuts produced, the number which were not
+    already in the output (all are added), and for row cuts added the density (elements / columns), violation and efficacy (violation /
+    2-norm of cut) at the solution cuts were generated for.
+
+    Nothing here is thread safe - generators running on other threads
+    must be recorded by the calling thread (as CglParallelCuts does).
+*/
+class CglCutProfile {
+
+public:
+
+  /// Totals for one generator at one level (or over all levels)
+  struct Entry {
+    /// Number of calls
+    int numberCalls;
+    /// Number of cuts produced (row and column)
+    int numberCuts;
+    /** Number of cuts not duplicating one already in output (row cuts
+        as OsiCuts::isDuplicate, column cuts all count) */
+    int numberSurviving;
+    /// Number of row cuts added (for averages)
+    int numberRowCuts;
+    /// Wall clock time
+    double wallTime;
+    /// Cpu time
+    double cpuTime;
+    /// Sum of density of row cuts added
+    double sumDensity;
+    /// Sum of violation of row cuts added
+    double sumViolation;
+    /// Sum of efficacy of row cuts added
+    double sumEfficacy;
+    Entry();
+    /// Add in another entry
+    void add(const Entry & rhs);
+    /// Average density of row cuts added
+    inline double averageDensity() const
+    { return numberRowCuts ? sumDensity/numberRowCuts : 0.0;}
+    /// Average violation of row cuts added
+    inline double averageViolation() const
+    { return numberRowCuts ? sumViolation/numberRowCuts : 0.0;}
+    /// Average efficacy of row cuts added
+    inline double averageEfficacy() const
+    { return numberRowCuts ? sumEfficacy/numberRowCuts : 0.0;}
+  };
+
+  /**@name Recording */
+  //@{
+  /** Index of generator with this name (added if not there) */
+  int addGenerator(const char * name);
+  /** Record one call of generator at level (negative levels
+      are taken as 0) */
+  void record(int generator, int level, const Entry & call);
+  /// Zero all statistics (generators are kept)
+  void clear();
+  //@}
+
+  /**@name Results */
+  //@{
+  /// Number of generators
+  inline int numberGenerators() const
+  { return static_cast<int>(name_.size());}
+  /// Name of generator
+  inline const char * generatorName(int generator) const
+  { return name_[generator].c_str();}
+  /// Number of levels for which generator has an entry (highest level+1)
+  inline int numberLevels(int generator) const
+  { return static_cast<int>(entry_[generator].size());}
+  /// Statistics for generator at level (level<numberLevels)
+  inline const Entry & entry(int generator, int level) const
+  { return entry_[generator][level];}
+  /// Statistics for generator over all levels
+  Entry total(int generator) const;
+  //@}
+
+  /**@name Output */
+  //@{
+  /** Write one line per generator and level (level -1 for totals)
+      as comma separated values with a header line.
+      Returns 0 if okay, -1 if file could not be opened. */
+  int writeCsv(const char * fileName) const;
+  /** Write as JSON - an array of generators each with totals and
+      an array of levels.
+      Returns 0 if okay, -1 if file could not be opened. */
+  int writeJson(const char * fileName) const;
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor
+  CglCutProfile ();
+  /// Destructor
+  ~CglCutProfile ();
+  //@}
+
+private:
+
+  /**@name Private member data */
+  //@{
+  /// Generator names
+  std::vector<std::string> name_;
+  /// Entries by generator then level
+  std::vector<std::vector<Entry> > entry_;
+  //@}
+};
+
+//#############################################################################
+/** A function that tests the methods in the CglCutProfile class. The
+    only reason for it not to be a member method is that this way it doesn't
+    have to be compiled into the library. And that's a gain, because the
+    library should be compiled with optimization on, but this method should be
+    compiled with debugging. */
+void CglCutProfileUnitTest(const OsiSolverInterface * siP,
+			   const std::string mpdDir );
+
+#endif
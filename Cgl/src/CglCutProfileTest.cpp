@@ -0,0 +1,133 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "OsiSolverInterface.hpp"
+#include "OsiCuts.hpp"
+#include "CglCutProfile.hpp"
+#include "CglStored.hpp"
+
+//--------------------------------------------------------------------------
+// test CglCutProfile
+void
+CglCutProfileUnitTest(
+  const OsiSolverInterface * baseSiP,
+  const std::string mpsDir )
+{
+  // Test default constructor and statistics
+  {
+    CglCutProfile profile;
+    assert (!profile.numberGenerators());
+    int iGenerator = profile.addGenerator("A");
+    assert (profile.addGenerator("B")==iGenerator+1);
+    assert (profile.addGenerator("A")==iGenerator);
+    CglCutProfile::Entry call;
+    call.numberCalls=1;
+    call.numberCuts=3;
+    call.numberSurviving=2;
+    call.numberRowCuts=2;
+    call.sumDensity=0.5;
+    profile.record(iGenerator,-1,call);
+    profile.record(iGenerator,2,call);
+    assert (profile.numberLevels(iGenerator)==3);
+    assert (profile.entry(iGenerator,0).numberCuts==3);
+    assert (profile.total(iGenerator).numberCuts==6);
+    assert (profile.total(iGenerator).averageDensity()==0.25);
+    profile.clear();
+    assert (profile.numberGenerators()==2);
+    assert (!profile.total(iGenerator).numberCalls);
+  }
+
+  // Profile on p0033
+  {
+    OsiSolverInterface  * siP = baseSiP->clone();
+    std::string fn(mpsDir+"p0033");
+    siP->readMps(fn.c_str(),"mps");
+    siP->initialSolve();
+    int numberColumns = siP->getNumCols();
+    const double * solution = siP->getColSolution();
+    // violated cuts with known density, violation and efficacy
+    CglStored test;
+    int index[4];
+    double element[4]={1.0,1.0,1.0,1.0};
+    int nCuts=20;
+    double sumDensity=0.0;
+    double sumViolation=0.0;
+    double sumEfficacy=0.0;
+    for (int i=0;i<nCuts;i++) {
+      int n = 1+(i%4);
+      double sum=0.0;
+      for (int j=0;j<n;j++) {
+	index[j]=(5*i+3*j)%numberColumns;
+	sum += solution[index[j]];
+      }
+      double violation = 0.25*(1+(i%3));
+      test.addCut(sum+violation,COIN_DBL_MAX,n,index,element);
+      sumDensity += static_cast<double>(n)/numberColumns;
+      sumViolation += violation;
+      sumEfficacy += violation/sqrt(static_cast<double>(n));
+    }
+    CglCutProfile profile;
+    test.setProfile(&profile,"Stored");
+    CglStored * copy = dynamic_cast<CglStored *>(test.clone());
+    assert (copy->profile()==&profile);
+    OsiCuts cuts;
+    CglTreeInfo info;
+    test.generateCutsAndRecord(*siP,cuts,info);
+    int nRowCuts = cuts.sizeRowCuts();
+    assert (nRowCuts==nCuts);
+    // same cuts again at level 2 - added as generateCuts would
+    info.level=2;
+    copy->generateCutsAndRecord(*siP,cuts,info);
+    assert (cuts.sizeRowCuts()==2*nRowCuts);
+    assert (!cuts.duplicateHashing());
+    assert (profile.numberGenerators()==1);
+    assert (!strcmp(profile.generatorName(0),"Stored"));
+    assert (profile.numberLevels(0)==3);
+    const CglCutProfile::Entry & root = profile.entry(0,0);
+    assert (root.numberCalls==1);
+    assert (root.numberCuts==nRowCuts);
+    assert (root.numberSurviving==nRowCuts);
+    assert (fabs(root.averageDensity()-sumDensity/nCuts)<1.0e-12);
+    assert (fabs(root.averageViolation()-sumViolation/nCuts)<1.0e-9);
+    assert (fabs(root.averageEfficacy()-sumEfficacy/nCuts)<1.0e-9);
+    assert (profile.entry(0,1).numberCalls==0);
+    // second time all are already there
+    assert (profile.entry(0,2).numberSurviving==0);
+    CglCutProfile::Entry total = profile.total(0);
+    assert (total.numberCalls==2);
+    assert (total.numberCuts==2*nRowCuts);
+    // generateCutsAndRecord adds same cuts as generateCuts
+    OsiCuts cuts2;
+    test.generateCuts(*siP,cuts2);
+    assert (cuts2.sizeRowCuts()==nRowCuts);
+    for (int i=0;i<nRowCuts;i++)
+      assert (cuts2.rowCut(i)==cuts.rowCut(i));
+    assert (!profile.writeCsv("CglCutProfile.csv"));
+    assert (!profile.writeJson("CglCutProfile.json"));
+    FILE * fp = fopen("CglCutProfile.csv","r");
+    assert (fp);
+    int numberLines=0;
+    char line[200];
+    while (fgets(line,200,fp))
+      numberLines++;
+    fclose(fp);
+    // header, total, two levels
+    assert (numberLines==4);
+    remove("CglCutProfile.csv");
+    remove("CglCutProfile.json");
+    delete copy;
+    delete siP;
+  }
+}
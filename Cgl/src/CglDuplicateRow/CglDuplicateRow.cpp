@@ -9,6 +9,7 @@
 #include <cfloat>
 #include <cassert>
 #include <iostream>
+#include <algorithm>
 //#define PRINT_DEBUG
 //#define CGL_DEBUG
 #include "CoinPragma.hpp"
@@ -18,6 +19,218 @@
 #include "OsiRowCutDebugger.hpp"
 #include "CglDuplicateRow.hpp"
 #include "CglStored.hpp"
+/* For subset tests between rows of ones.  Two rows can only be subset
+   and superset if they share a free column (or one has no free columns)
+   so candidates come from column copy.  Each row also has a bitmap of
+   its free columns - if neither bitmap is inside the other neither row
+   is inside the other.  Bitmaps and counts must be kept up to date by
+   fixed() as columns are fixed.
+*/
+class CglSubsetRows {
+public:
+  CglSubsetRows(int numberRows, const CoinBigIndex * rowStart,
+		const int * rowLength, const int * column,
+		const CoinBigIndex * columnStart, const int * columnLength,
+		const int * row, const double * columnLower,
+		const double * columnUpper)
+    : rowStart_(rowStart), rowLength_(rowLength), column_(column),
+      columnStart_(columnStart), columnLength_(columnLength), row_(row),
+      columnLower_(columnLower), columnUpper_(columnUpper),
+      duplicate_(NULL), effectiveRhs_(NULL), wanted_(-1),
+      numberRows_(numberRows), numberEmpty_(0), numberLive_(0)
+  {
+    signature_ = new CoinUInt64 [numberRows];
+    numberFree_ = new int [3*numberRows];
+    emptyRow_ = numberFree_+numberRows;
+    liveRow_ = emptyRow_+numberRows;
+    candidate_ = new int [2*numberRows];
+    previous_ = candidate_+numberRows;
+    mark_ = new char [numberRows];
+    memset(mark_,0,numberRows);
+    for (int iRow=0;iRow<numberRows;iRow++)
+      signature(iRow);
+  }
+  ~CglSubsetRows()
+  {
+    delete [] signature_;
+    delete [] numberFree_;
+    delete [] candidate_;
+    delete [] mark_;
+  }
+  /// Rows wanted have duplicate wanted (and effectiveRhs 1 if given)
+  void setWanted(const int * duplicate, int wanted, const int * effectiveRhs)
+  {
+    duplicate_ = duplicate;
+    wanted_ = wanted;
+    effectiveRhs_ = effectiveRhs;
+    numberEmpty_=0;
+    numberLive_=0;
+    for (int iRow=0;iRow<numberRows_;iRow++) {
+      previous_[iRow]=iRow;
+      if (isWanted(iRow)) {
+	liveRow_[numberLive_++]=iRow;
+	if (!numberFree_[iRow])
+	  emptyRow_[numberEmpty_++]=iRow;
+      }
+    }
+  }
+  /// Column has just been fixed - returns number of rows now empty
+  int fixed(int iColumn)
+  {
+    int numberNowEmpty=0;
+    for (CoinBigIndex j=columnStart_[iColumn];
+	 j<columnStart_[iColumn]+columnLength_[iColumn];j++) {
+      int iRow = row_[j];
+      int wasFree = numberFree_[iRow];
+      signature(iRow);
+      if (wasFree&&!numberFree_[iRow]) {
+	emptyRow_[numberEmpty_++]=iRow;
+	numberNowEmpty++;
+      }
+    }
+    return numberNowEmpty;
+  }
+  /// False if neither row can be inside other
+  inline bool maybeSubset(int iRow, int kRow) const
+  {
+    CoinUInt64 signatureI = signature_[iRow];
+    CoinUInt64 signatureK = signature_[kRow];
+    return (signatureK&~signatureI)==0||(signatureI&~signatureK)==0;
+  }
+  /** Rows >= first which may be subset or superset of iRow with nn free
+      columns which.  Returned in increasing order in candidate().  If
+      nn is zero all rows wanted are candidates except, if effectiveLower
+      given, those with nothing free and effectiveLower not rhs. */
+  int candidates(int iRow, int first, int nn, const int * which,
+		 const int * effectiveLower, const int * rhs)
+  {
+    int n=0;
+    // prune lists to rows after iRow still wanted
+    for (int i=0;i<numberEmpty_;i++) {
+      int kRow = emptyRow_[i];
+      if (kRow>iRow&&isWanted(kRow))
+	emptyRow_[n++]=kRow;
+    }
+    numberEmpty_=n;
+    n=0;
+    if (!nn) {
+      for (int i=0;i<numberLive_;i++) {
+	int kRow = liveRow_[i];
+	if (kRow>iRow&&isWanted(kRow)&&
+	    (!effectiveLower||numberFree_[kRow]||
+	     effectiveLower[kRow]==rhs[kRow]))
+	  liveRow_[n++]=kRow;
+      }
+      numberLive_=n;
+      n=0;
+      for (int i=0;i<numberLive_;i++) {
+	if (liveRow_[i]>=first)
+	  candidate_[n++]=liveRow_[i];
+      }
+      return n;
+    }
+    for (int i=0;i<nn;i++) {
+      int iColumn = which[i];
+      for (CoinBigIndex j=columnStart_[iColumn];
+	   j<columnStart_[iColumn]+columnLength_[iColumn];j++) {
+	int kRow = row_[j];
+	if (kRow>=first&&!mark_[kRow]) {
+	  mark_[kRow]=1;
+	  candidate_[n++]=kRow;
+	}
+      }
+    }
+    for (int i=0;i<numberEmpty_;i++) {
+      int kRow = emptyRow_[i];
+      if (kRow>=first&&!mark_[kRow]) {
+	mark_[kRow]=1;
+	candidate_[n++]=kRow;
+      }
+    }
+    for (int i=0;i<n;i++)
+      mark_[candidate_[i]]=0;
+    std::sort(candidate_,candidate_+n);
+    return n;
+  }
+  /** Last row after iRow wanted with anything free and rhs no more
+      than rhs of iRow (or -1) */
+  int lastWithFree(int iRow, const int * rhs)
+  {
+    int kRow = lastAlive(numberRows_-1);
+    while (kRow>iRow) {
+      if (rhs[kRow]<=rhs[iRow])
+	return kRow;
+      kRow = lastAlive(kRow-1);
+    }
+    return -1;
+  }
+  /// Candidates from last call to candidates()
+  inline const int * candidate() const
+  { return candidate_;}
+private:
+  /// Bitmap and number of free columns in row
+  void signature(int iRow)
+  {
+    CoinUInt64 bits=0;
+    int n=0;
+    for (CoinBigIndex j=rowStart_[iRow];j<rowStart_[iRow]+rowLength_[iRow];j++) {
+      int iColumn = column_[j];
+      if (columnLower_[iColumn]!=columnUpper_[iColumn]) {
+	// spread columns over 64 bits
+	unsigned int hash = static_cast<unsigned int>(iColumn)*2654435761U;
+	bits |= static_cast<CoinUInt64>(1)<<(hash>>26);
+	n++;
+      }
+    }
+    signature_[iRow]=bits;
+    numberFree_[iRow]=n;
+  }
+  /* Last row up to kRow wanted with anything free (or -1).  Once a row
+     fails it always will so previous_ skips over it. */
+  int lastAlive(int kRow)
+  {
+    int iRow=kRow;
+    while (iRow>=0) {
+      if (previous_[iRow]!=iRow) {
+	iRow = previous_[iRow];
+      } else if (!numberFree_[iRow]||!isWanted(iRow)) {
+	previous_[iRow]=iRow-1;
+	iRow--;
+      } else {
+	break;
+      }
+    }
+    while (kRow>iRow) {
+      int next = previous_[kRow];
+      previous_[kRow]=iRow;
+      kRow=next;
+    }
+    return iRow;
+  }
+  inline bool isWanted(int iRow) const
+  { return duplicate_[iRow]==wanted_&&(!effectiveRhs_||effectiveRhs_[iRow]==1);}
+  const CoinBigIndex * rowStart_;
+  const int * rowLength_;
+  const int * column_;
+  const CoinBigIndex * columnStart_;
+  const int * columnLength_;
+  const int * row_;
+  const double * columnLower_;
+  const double * columnUpper_;
+  const int * duplicate_;
+  const int * effectiveRhs_;
+  CoinUInt64 * signature_;
+  int * numberFree_;
+  int * emptyRow_;
+  int * liveRow_;
+  int * candidate_;
+  int * previous_;
+  char * mark_;
+  int wanted_;
+  int numberRows_;
+  int numberEmpty_;
+  int numberLive_;
+};
 //-------------------------------------------------------------------
 // Generate duplicate row column cuts
 //------------------------------------------------------------------- 
@@ -515,6 +728,11 @@ void CglDuplicateRow::generateCuts12(const OsiSolverInterface & si, OsiCuts & cs
       effectiveRhs[i]=-1000;
     }
   }
+  // So most pairs of rows need not be looked at
+  CglSubsetRows subset(numberRows,rowStart,rowLength,column,
+		       columnStart,columnLength,row,columnLower,colUpper2);
+  subset.setWanted(duplicate_,-1,effectiveRhs);
+  const int * candidate = subset.candidate();
   // Look at <= rows
   for (i=0;i<numberRows;i++) {
     // initially just one
@@ -531,8 +749,30 @@ void CglDuplicateRow::generateCuts12(const OsiSolverInterface & si, OsiCuts & cs
           which2[nn++]=iColumn;
         }
       }
-      for ( k=i+1;k<numberRows;k++) {
+      if (!nn&&effectiveLower[i]!=rhs_[i]) {
+	/* Nothing free so nothing can be fixed - only possibility is
+	   row is slack subset of last row with anything free */
+	if (effectiveLower[i]<=0) {
+	  k = subset.lastWithFree(i,rhs_);
+	  if (k>=0) {
+	    if (logLevel_)
+	      printf("row %d slack subset of row %d, drop row %d\n",
+		     i,k,i);
+	    // treat i as duplicate
+	    duplicate_[i]=k;
+	  }
+	}
+	continue;
+      }
+      int nCandidate = subset.candidates(i,i+1,nn,which2,
+					 effectiveLower,rhs_);
+      for (int kk=0;kk<nCandidate;kk++) {
+	k=candidate[kk];
         if (effectiveRhs[k]==1&&duplicate_[k]==-1) {
+	  if (!subset.maybeSubset(i,k))
+	    continue;
+	  int numberFixedBefore = ubs.getNumElements();
+	  int numberFreeBefore = nn;
           int nn2=0;
           int nnsame=0;
           for ( j=rowStart[k];j<rowStart[k]+rowLength[k];j++) {
@@ -650,6 +890,20 @@ void CglDuplicateRow::generateCuts12(const OsiSolverInterface & si, OsiCuts & cs
               }
             }
           }
+	  if (ubs.getNumElements()>numberFixedBefore) {
+	    // update rows with fixed columns
+	    const int * fixedColumn = ubs.getIndices();
+	    int numberNowEmpty=0;
+	    for (int jj=numberFixedBefore;jj<ubs.getNumElements();jj++)
+	      numberNowEmpty += subset.fixed(fixedColumn[jj]);
+	    /* rest of candidates still cover rows sharing a free column
+	       so only look again if rows (or row i) have become empty */
+	    if ((nn&&numberNowEmpty)||(!nn&&numberFreeBefore)) {
+	      nCandidate = subset.candidates(i,k+1,nn,which2,
+					     effectiveLower,rhs_);
+	      kk=-1;
+	    }
+	  }
         }
       }
       for (k=0;k<nn;k++) 
@@ -658,6 +912,7 @@ void CglDuplicateRow::generateCuts12(const OsiSolverInterface & si, OsiCuts & cs
     }
   }
   // Look at >=1 rows
+  subset.setWanted(duplicate_,-4,NULL);
   for (i=0;i<numberRows;i++) {
     if (duplicate_[i]==-4) {
       int nn=0;
@@ -672,8 +927,12 @@ void CglDuplicateRow::generateCuts12(const OsiSolverInterface & si, OsiCuts & cs
           which2[nn++]=iColumn;
         }
       }
-      for ( k=i+1;k<numberRows;k++) {
+      int nCandidate = subset.candidates(i,i+1,nn,which2,NULL,NULL);
+      for (int kk=0;kk<nCandidate;kk++) {
+	k=candidate[kk];
         if (duplicate_[k]==-4) {
+	  if (!subset.maybeSubset(i,k))
+	    continue;
           int nn2=0;
           int nnsame=0;
           for ( j=rowStart[k];j<rowStart[k]+rowLength[k];j++) {
@@ -186,4 +186,13 @@ protected:
   int logLevel_;
   //@}
 };
+
+//#############################################################################
+/** A function that tests the methods in the CglDuplicateRow class. The
+    only reason for it not to be a member method is that this way it doesn't
+    have to be compiled into the library. And that's a gain, because the
+    library should be compiled with optimization on, but this method should be
+    compiled with debugging. */
+void CglDuplicateRowUnitTest(const OsiSolverInterface * siP,
+			     const std::string mpdDir );
 #endif
@@ -0,0 +1,164 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CglDuplicateRow.hpp"
+
+// Set packing, partitioning and cover rows - some duplicates, subsets
+// and supersets of earlier rows
+static OsiSolverInterface *
+setModel(const OsiSolverInterface * baseSiP, int numberRows,
+	 int numberColumns, unsigned int seed)
+{
+  std::vector<std::vector<int> > rows(numberRows);
+  std::vector<double> rowLower(numberRows);
+  std::vector<double> rowUpper(numberRows);
+  CoinPackedMatrix matrix(false,0,0);
+  matrix.setDimensions(0,numberColumns);
+  for (int i=0;i<numberRows;i++) {
+    std::vector<int> & row = rows[i];
+    seed = 1103515245*seed+12345;
+    int type = (seed>>16)%40;
+    if (type<2&&i) {
+      seed = 1103515245*seed+12345;
+      row = rows[(seed>>8)%i];
+      seed = 1103515245*seed+12345;
+      if (type==1&&row.size()>2)
+	row.pop_back();
+      else if (!type&&((seed>>16)&1))
+	row.push_back((seed>>4)%numberColumns);
+    } else {
+      seed = 1103515245*seed+12345;
+      int length = 2+(seed>>16)%8;
+      for (int k=0;k<length;k++) {
+	seed = 1103515245*seed+12345;
+	row.push_back((seed>>8)%numberColumns);
+      }
+    }
+    std::sort(row.begin(),row.end());
+    row.erase(std::unique(row.begin(),row.end()),row.end());
+    std::vector<double> element(row.size(),1.0);
+    matrix.appendRow(static_cast<int>(row.size()),&row[0],&element[0]);
+    seed = 1103515245*seed+12345;
+    int sense = (seed>>16)%6;
+    rowLower[i] = sense<3 ? -COIN_DBL_MAX : 1.0;
+    rowUpper[i] = sense<5 ? 1.0 : COIN_DBL_MAX;
+  }
+  std::vector<double> columnLower(numberColumns,0.0);
+  std::vector<double> columnUpper(numberColumns,1.0);
+  std::vector<double> objective(numberColumns);
+  for (int j=0;j<numberColumns;j++)
+    objective[j] = 1.0+(j%5);
+  OsiSolverInterface * model = baseSiP->clone();
+  model->loadProblem(matrix,&columnLower[0],&columnUpper[0],&objective[0],
+		     &rowLower[0],&rowUpper[0]);
+  for (int j=0;j<numberColumns;j++)
+    model->setInteger(j);
+  return model;
+}
+
+/* Runs generator with default mode and checks number of rows marked,
+   columns fixed and row cuts and checksums of duplicate() and of fixed
+   columns in order */
+static void
+checkDuplicates(OsiSolverInterface * model, int expectedMarked,
+		unsigned int expectedMarkHash, int expectedFixed,
+		unsigned int expectedFixHash, int expectedRowCuts)
+{
+  CglDuplicateRow generator(model);
+  generator.setLogLevel(0);
+  OsiCuts cs;
+  generator.generateCuts(*model,cs);
+  const int * duplicate = generator.duplicate();
+  int numberMarked=0;
+  unsigned int markHash=0;
+  for (int i=0;i<model->getNumRows();i++) {
+    markHash = 31*markHash+duplicate[i]+7;
+    if (duplicate[i]!=-1)
+      numberMarked++;
+  }
+  int numberFixed=0;
+  unsigned int fixHash=0;
+  for (int k=0;k<cs.sizeColCuts();k++) {
+    const CoinPackedVector & ubs = cs.colCut(k).ubs();
+    for (int j=0;j<ubs.getNumElements();j++) {
+      fixHash = 31*fixHash+ubs.getIndices()[j];
+      numberFixed++;
+    }
+  }
+  assert (numberMarked==expectedMarked);
+  assert (markHash==expectedMarkHash);
+  assert (numberFixed==expectedFixed);
+  assert (fixHash==expectedFixHash);
+  assert (cs.sizeRowCuts()==expectedRowCuts);
+}
+
+//--------------------------------------------------------------------------
+// test CglDuplicateRow
+void
+CglDuplicateRowUnitTest(
+  const OsiSolverInterface * baseSiP,
+  const std::string mpsDir )
+{
+  // Test default constructor and copy & assignment
+  {
+    CglDuplicateRow aGenerator;
+    CglDuplicateRow rhs;
+    {
+      CglDuplicateRow bGenerator;
+      CglDuplicateRow cGenerator(bGenerator);
+      rhs=bGenerator;
+    }
+  }
+
+  /* Same duplicate rows and fixings as code which compared every pair
+     of rows (before rows were only compared with those sharing a free
+     column).  Expected values are from that code. */
+  {
+    const char * models[] = {"p0033","p0201","pack1"};
+    const int expectedMarked[] = {1,6,3};
+    const unsigned int expectedMarkHash[] = {3706635775U,417469000U,4965U};
+    const int expectedRowCuts[] = {0,0,1};
+    for (int iModel=0;iModel<3;iModel++) {
+      OsiSolverInterface * siP = baseSiP->clone();
+      siP->messageHandler()->setLogLevel(0);
+      std::string fn = mpsDir+models[iModel];
+      siP->readMps(fn.c_str(),"mps");
+      checkDuplicates(siP,expectedMarked[iModel],expectedMarkHash[iModel],
+		      0,0,expectedRowCuts[iModel]);
+      delete siP;
+    }
+    // rows, columns, seed then expected values
+    const int sizes[][3] = {{200,100,1},{200,100,3},
+			    {3000,2000,3},{3000,2000,4}};
+    const int expectedRandomMarked[] = {53,39,701,598};
+    const unsigned int expectedRandomMarkHash[] =
+      {2582219743U,458662825U,342736031U,2390877071U};
+    const int expectedRandomFixed[] = {15,12,338,41};
+    const unsigned int expectedRandomFixHash[] =
+      {2433153710U,1673998592U,3251330862U,964322366U};
+    for (int iModel=0;iModel<4;iModel++) {
+      OsiSolverInterface * siP = setModel(baseSiP,sizes[iModel][0],
+					  sizes[iModel][1],sizes[iModel][2]);
+      siP->messageHandler()->setLogLevel(0);
+      checkDuplicates(siP,expectedRandomMarked[iModel],
+		      expectedRandomMarkHash[iModel],
+		      expectedRandomFixed[iModel],
+		      expectedRandomFixHash[iModel],0);
+      delete siP;
+    }
+  }
+}
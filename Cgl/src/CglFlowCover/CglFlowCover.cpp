@@ -45,7 +45,16 @@ int CglFlowCover::numFlowCuts_ = 0;
 void 
 CglFlowCover::flowPreprocess(const OsiSolverInterface& si)
 {
-  CoinPackedMatrix matrixByRow(*si.getMatrixByRow());
+  // Use shared analysis if up to date and counting zeros as we do
+  const CglModelStructure * structure = modelStructure_;
+  if (structure&&(!structure->valid()||
+		  structure->numberRows()!=si.getNumRows()||
+		  structure->numberColumns()!=si.getNumCols()||
+		  structure->epsilon()!=EPSILON_))
+    structure=NULL;
+  structureVersion_ = structure ? structure->version() : -1;
+  const CoinPackedMatrix & matrixByRow = structure ?
+    *structure->rowCopy() : *si.getMatrixByRow();
 
   int numRows = si.getNumRows();
   int numCols = si.getNumCols();
@@ -68,7 +77,8 @@ CglFlowCover::flowPreprocess(const OsiSolverInterface& si)
   }
   rowTypes_ = new CglFlowRowType [numRows];// Destructor will free memory
   // Get integer types
-  const char * columnType = si.getColType (true);
+  const char * columnType = structure ? structure->columnType() :
+    si.getColType (true);
     
   // Summarize the row type infomation.
   int numUNDEFINED   = 0;
@@ -90,11 +100,16 @@ CglFlowCover::flowPreprocess(const OsiSolverInterface& si)
     char sen     = sense[iRow];
     double rhs   = RHS[iRow];
 
-    CoinDisjointCopyN(colInds + rowStarts[iRow], rowLen, ind);
-    CoinDisjointCopyN(coefByRow + rowStarts[iRow], rowLen, coef);
+    const CglModelStructure::RowCounts * counts = NULL;
+    if (structure) {
+      counts = &structure->rowCounts(iRow);
+    } else {
+      CoinDisjointCopyN(colInds + rowStarts[iRow], rowLen, ind);
+      CoinDisjointCopyN(coefByRow + rowStarts[iRow], rowLen, coef);
+    }
  
     CglFlowRowType rowType = determineOneRowType(si, rowLen, ind, coef, 
-						 sen, rhs);
+						 sen, rhs, counts);
 
     rowTypes_[iRow] = rowType;
 
@@ -251,9 +266,17 @@ void CglFlowCover::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 #endif
     int numberRowCutsBefore = cs.sizeRowCuts();
     
-  flowPreprocess(si);
-
-  CoinPackedMatrix matrixByRow(*si.getMatrixByRow());
+  // With a shared structure only redo if formulation changed
+  if (modelStructure_)
+    modelStructure_->update(si);
+  if (!modelStructure_||structureVersion_!=modelStructure_->version())
+    flowPreprocess(si);
+
+  CoinPackedMatrix ownMatrixByRow;
+  if (structureVersion_<0)
+    ownMatrixByRow = *si.getMatrixByRow();
+  const CoinPackedMatrix & matrixByRow = structureVersion_>=0 ?
+    *modelStructure_->rowCopy() : ownMatrixByRow;
   const char* sense = si.getRowSense();
   const double* rhs = si.getRightHandSide();
 
@@ -361,7 +384,8 @@ CglFlowCover::CglFlowCover()
   doneInitPre_(false),
   vubs_(0),
   vlbs_(0),
-  rowTypes_(0)
+  rowTypes_(0),
+  structureVersion_(-1)
 { 
   // DO NOTHING
 }
@@ -381,7 +405,8 @@ CglFlowCover::CglFlowCover (const CglFlowCover & source)
   firstProcess_(true),
   numRows_(source.numRows_),
   numCols_(source.numCols_),
-  doneInitPre_(source.doneInitPre_)
+  doneInitPre_(source.doneInitPre_),
+  structureVersion_(source.structureVersion_)
 { 
   setNumFlowCuts(source.numFlowCuts_);
   if (numCols_ > 0) {
@@ -431,6 +456,7 @@ CglFlowCover::operator=(const CglFlowCover& rhs)
     //    numFlowCuts_ = rhs.numFlowCuts_;
     setNumFlowCuts(rhs.numFlowCuts_);
     doneInitPre_ = rhs.doneInitPre_;
+    structureVersion_ = rhs.structureVersion_;
     if (numCols_ > 0) {
       vubs_ = new CglFlowVUB [numCols_];
       vlbs_ = new CglFlowVLB [numCols_];
@@ -1259,7 +1285,8 @@ CglFlowRowType
 CglFlowCover::determineOneRowType(const OsiSolverInterface& si,
 				  int rowLen, int* ind, 
 				  double* coef, char sense, 
-				  double rhs) const
+				  double rhs,
+				  const CglModelStructure::RowCounts * counts) const
 {
   if (rowLen == 0) 
     return CGLFLOW_ROW_UNDEFINED;
@@ -1276,23 +1303,40 @@ CglFlowCover::determineOneRowType(const OsiSolverInterface& si,
   int  i;
   bool flipped = false;
 
-  // Range row will only consider as 'L'
-  if (sense == 'G') {        // Transform to " <= "
-    flipRow(rowLen, coef, sense, rhs);                
-    flipped = true;
-  }
-    
-  // Summarize the variable types of the given row.
-  for ( i = 0; i < rowLen; ++i ) {
-    if ( coef[i] < -EPSILON_ ) {
-      ++numNegCol;
-      if( columnType[ind[i]]==1 )
-	++numNegBin;
+  if (counts) {
+    // already summarized - just see as if flipped
+    int numberBinary = counts->positive[1]+counts->negative[1]+
+      counts->zero[1];
+    if (sense == 'G') {
+      sense = 'L';
+      rhs = -rhs;
+      numNegCol = counts->positive[0]+counts->positive[1]+counts->positive[2];
+      numNegBin = counts->positive[1];
+    } else {
+      numNegCol = counts->negative[0]+counts->negative[1]+counts->negative[2];
+      numNegBin = counts->negative[1];
     }
-    else {
-      ++numPosCol;
-      if( columnType[ind[i]]==1 )
-	++numPosBin;    
+    numPosCol = rowLen - numNegCol;
+    numPosBin = numberBinary - numNegBin;
+  } else {
+    // Range row will only consider as 'L'
+    if (sense == 'G') {        // Transform to " <= "
+      flipRow(rowLen, coef, sense, rhs);                
+      flipped = true;
+    }
+    
+    // Summarize the variable types of the given row.
+    for ( i = 0; i < rowLen; ++i ) {
+      if ( coef[i] < -EPSILON_ ) {
+	++numNegCol;
+	if( columnType[ind[i]]==1 )
+	  ++numNegBin;
+      }
+      else {
+	++numPosCol;
+	if( columnType[ind[i]]==1 )
+	  ++numPosBin;    
+      }
     }
   }
   numBin = numNegBin + numPosBin;
@@ -19,6 +19,7 @@
 #include "CoinError.hpp"
 
 #include "CglCutGenerator.hpp"
+#include "CglModelStructure.hpp"
 
 //=============================================================================
 
@@ -235,11 +236,13 @@ private:
     /** Transform a row from ">=" to "<=", and vice versa. Have 'sense'. */
     void flipRow(int rowLen, double* coef, char& sen, double& rhs) const;
 
-    /** Determine the type of a given row. */
+    /** Determine the type of a given row.  If counts (from a model
+	structure) are given ind and coef are not looked at. */
     CglFlowRowType determineOneRowType(const OsiSolverInterface& si,
 				       int rowLen, int* ind, 
 				       double* coef, char sen, 
-				       double rhs) const;
+				       double rhs,
+				       const CglModelStructure::RowCounts * counts=NULL) const;
     /** Lift functions */
     void liftMinus(double &movement, /* Output */ 
 		   int t,
@@ -357,6 +360,8 @@ private:
     CglFlowVLB* vlbs_;
     /** CglFlowRowType of the rows in model. */
     CglFlowRowType* rowTypes_;
+    /** Version of model structure used in preprocessing (-1 if none) */
+    int structureVersion_;
 };
 
 //#############################################################################
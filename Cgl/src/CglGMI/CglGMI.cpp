@@ -25,6 +25,7 @@
 #include "OsiRowCutDebugger.hpp"
 #include "CoinFactorization.hpp"
 #include "CglGMI.hpp"
+#include "CglTableauCache.hpp"
 #include "CoinFinite.hpp"
 
 //-------------------------------------------------------------------
@@ -46,6 +47,7 @@ CglGMI::CglGMI() :
   cstat(NULL),
   rstat(NULL),
   solver(NULL),
+  tableauCache(NULL),
   xlp(NULL),
   rowActivity(NULL),
   byRow(NULL),
@@ -82,6 +84,7 @@ CglGMI::CglGMI(const CglGMIParam &parameters) :
   cstat(NULL),
   rstat(NULL),
   solver(NULL),
+  tableauCache(NULL),
   xlp(NULL),
   rowActivity(NULL),
   byRow(NULL),
@@ -118,6 +121,7 @@ CglGMI::CglGMI(const CglGMI& rhs) :
   cstat(rhs.cstat),
   rstat(rhs.rstat),
   solver(rhs.solver),
+  tableauCache(rhs.tableauCache),
   xlp(rhs.xlp),
   rowActivity(rhs.rowActivity),
   byRow(rhs.byRow),
@@ -155,6 +159,7 @@ CglGMI & CglGMI::operator=(const CglGMI& rhs) {
     cstat = rhs.cstat;
     rstat = rhs.rstat;
     solver = rhs.solver;
+    tableauCache = rhs.tableauCache;
     xlp = rhs.xlp;
     rowActivity = rhs.rowActivity;
     byRow = rhs.byRow;
@@ -1092,7 +1097,7 @@ long CglGMI::computeGcd(long a, long b) {
 
 /************************************************************************/
 void CglGMI::generateCuts(const OsiSolverInterface &si, OsiCuts & cs,
-			  const CglTreeInfo )
+			  const CglTreeInfo info)
 {
   solver = const_cast<OsiSolverInterface *>(&si);
   if (solver == NULL) {
@@ -1127,8 +1132,14 @@ void CglGMI::generateCuts(const OsiSolverInterface &si, OsiCuts & cs,
   rowActivity = solver->getRowActivity();
   byRow = solver->getMatrixByRow();
   byCol = solver->getMatrixByCol();
+
+  // Use shared tableau rows if there are any for this basis
+  tableauCache = info.tableauCache;
+  if (tableauCache && !tableauCache->update(*solver))
+    tableauCache = NULL;
   
   generateCuts(cs);
+  tableauCache = NULL;
 
 } /* generateCuts */
 
@@ -1213,10 +1224,19 @@ void CglGMI::generateCuts(OsiCuts &cs)
   }
 #else
   CoinFactorization factorization;
-  if (factorize(factorization, colBasisIndex, rowBasisIndex)) {
+  if (tableauCache) {
+    // rows come from cache so only need to know what is basic
+    for (int i = 0; i < ncol; ++i)
+      colBasisIndex[i] = (cstat[i] == 1) ? 0 : -1;
+    for (int i = 0; i < nrow; ++i)
+      rowBasisIndex[i] = (rstat[i] == 1) ? 0 : -1;
+    tableauCache->computeRows(*solver, numFracBasic, listFracBasic);
+  } else if (factorize(factorization, colBasisIndex, rowBasisIndex)) {
     printf("### WARNING: CglGMI::generateCuts(): error during factorization!\n");
     return;
   }
+  // Row of the simplex tableau if it comes from cache
+  const double* cachedRow = NULL;
 #endif
 
 
@@ -1239,12 +1259,25 @@ void CglGMI::generateCuts(OsiCuts &cs)
   // Column part and row part of a row of the simplex tableau
   double* tableauColPart = new double[ncol];
   double* tableauRowPart = new double[nrow];
+  // Rows of the simplex tableau which will be wanted, all at once (sparse)
+  int* tableauRows = new int[numFracBasic];
+  int* tableauPosition = new int[numFracBasic];
+  int numTableauRows = 0;
+  for (int i = 0; i < numFracBasic; ++i) {
+    double f = aboveInteger(xlp[listFracBasic[i]]);
+    if (f < param.getAway() || 1 - f < param.getAway()) {
+      tableauPosition[i] = -1;
+    } else {
+      tableauPosition[i] = numTableauRows;
+      tableauRows[numTableauRows++] = colBasisIndex[listFracBasic[i]];
+    }
+  }
+  CoinPackedMatrix tableau;
+  solver->getBInvARows(numTableauRows, tableauRows, tableau);
 #else
-  // Need some more data for simplex tableau computation
-  const int * row = byCol->getIndices();
-  const CoinBigIndex * columnStart = byCol->getVectorStarts();
-  const int * columnLength = byCol->getVectorLengths(); 
-  const double * columnElements = byCol->getElements();
+  // Column part of a row of the simplex tableau (computed by rows of
+  // matrix so only rows in row of basis inverse are looked at)
+  double* tableauColPart = new double[ncol];
 
   // Create work arrays for factorization
   // two vectors for updating: the first one is needed to do the computations
@@ -1294,14 +1327,45 @@ void CglGMI::generateCuts(OsiCuts &cs)
 #endif
 
 #if defined OSI_TABLEAU
-    solver->getBInvARow(iBasic, tableauColPart, tableauRowPart);
+    memset(tableauColPart, 0, ncol*sizeof(double));
+    memset(tableauRowPart, 0, nrow*sizeof(double));
+    {
+      assert (tableauPosition[i] >= 0 && 
+	      tableauRows[tableauPosition[i]] == iBasic);
+      const CoinShallowPackedVector tableauRow = 
+	tableau.getVector(tableauPosition[i]);
+      const int* tableauIndex = tableauRow.getIndices();
+      const double* tableauElement = tableauRow.getElements();
+      for (int j = 0; j < tableauRow.getNumElements(); ++j) {
+	if (tableauIndex[j] < ncol)
+	  tableauColPart[tableauIndex[j]] = tableauElement[j];
+	else
+	  tableauRowPart[tableauIndex[j] - ncol] = tableauElement[j];
+      }
+    }
 #else
-    array.clear();
-    array.setVector(1, &iBasic, &one);
-
-    factorization.updateColumnTranspose (&work, &array);
-
-    int numberInArray=array.getNumElements();
+    int numberInArray = 0;
+    if (tableauCache) {
+      cachedRow = tableauCache->row(*solver, listFracBasic[i]);
+      // slacks are scanned densely
+      numberInArray = nrow;
+    } else {
+      array.clear();
+      array.setVector(1, &iBasic, &one);
+
+      factorization.updateColumnTranspose (&work, &array);
+
+      numberInArray=array.getNumElements();
+      // add in rows of matrix
+      memset(tableauColPart, 0, ncol*sizeof(double));
+      for (int k = 0; k < numberInArray; ++k) {
+	int iRow = arrayRows[k];
+	double value = arrayElements[iRow];
+	for (int h = rowStart[iRow]; h < rowStart[iRow]+rowLength[iRow]; ++h) {
+	  tableauColPart[indices[h]] += elements[h]*value;
+	}
+      }
+    }
 #endif
 
     // reset the cut
@@ -1318,10 +1382,10 @@ void CglGMI::generateCuts(OsiCuts &cs)
 #ifdef OSI_TABLEAU
       rowElem = tableauColPart[j];
 #else
-      rowElem = 0.0;
-      // add in row of tableau
-      for (int h = columnStart[j]; h < columnStart[j]+columnLength[j]; ++h) {
-	rowElem += columnElements[h]*arrayElements[row[h]];
+      if (cachedRow) {
+	rowElem = cachedRow[j];
+      } else {
+	rowElem = tableauColPart[j];
       }
 #endif
       if (!isZero(fabs(rowElem))) {
@@ -1351,9 +1415,18 @@ void CglGMI::generateCuts(OsiCuts &cs)
       rowElem = tableauRowPart[j];
 #else
     for (int j = 0 ; j < numberInArray ; ++j) {
-      // index of the row corresponding to the slack variable
-      slackIndex = arrayRows[j];
-      rowElem = arrayElements[slackIndex];
+      if (cachedRow) {
+	slackIndex = j;
+	if (rowBasisIndex[j] >= 0) {
+	  // Basic variable -- skip it
+	  continue;
+	}
+	rowElem = cachedRow[ncol + j];
+      } else {
+	// index of the row corresponding to the slack variable
+	slackIndex = arrayRows[j];
+	rowElem = arrayElements[slackIndex];
+      }
 #endif
       if (!isZero(fabs(rowElem))) {
 	slackIndex += ncol;
@@ -1408,9 +1481,11 @@ void CglGMI::generateCuts(OsiCuts &cs)
 #if defined OSI_TABLEAU
   solver->disableFactorization();
   delete[] basicVars;
-  delete[] tableauColPart;
   delete[] tableauRowPart;
+  delete[] tableauRows;
+  delete[] tableauPosition;
 #endif
+  delete[] tableauColPart;
 
   delete[] colBasisIndex;
   delete[] rowBasisIndex;
@@ -16,6 +16,8 @@
 #include "CoinWarmStartBasis.hpp"
 #include "CoinFactorization.hpp"
 
+class CglTableauCache;
+
 /* Enable tracking of rejection of cutting planes. If this is disabled,
    the cut generator is slightly faster. If defined, it enables proper use
    of setTrackRejection and related functions. */
@@ -315,6 +317,10 @@ private:
   /// Pointer on solver. Reset by each call to generateCuts().
   OsiSolverInterface *solver;
 
+  /// Pointer on shared tableau rows (may be NULL). 
+  /// Reset by each call to generateCuts().
+  CglTableauCache *tableauCache;
+
   /// Pointer on point to separate. Reset by each call to generateCuts().
   const double *xlp;
 
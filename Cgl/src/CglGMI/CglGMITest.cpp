@@ -0,0 +1,79 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include "CoinPragma.hpp"
+#include "CglGMI.hpp"
+#include "CglTableauCache.hpp"
+
+
+void
+CglGMIUnitTest(const OsiSolverInterface *baseSiP,
+	       const std::string mpsDir)
+{
+  // Test default constructor
+  {
+    CglGMI aGenerator;
+  }
+
+  // Test copy & assignment
+  {
+    CglGMI rhs;
+    {
+      CglGMI bGenerator;
+      CglGMI cGenerator(bGenerator);
+      rhs=bGenerator;
+    }
+  }
+
+  // Test generateCuts with shared tableau rows
+  {
+    const char * models[] = {"p0033","p0201","lseu"};
+    for (int iModel = 0; iModel < 3; iModel++) {
+      OsiSolverInterface  *siP = baseSiP->clone();
+      siP->messageHandler()->setLogLevel(0);
+      std::string fn = mpsDir+models[iModel];
+      siP->readMps(fn.c_str(),"mps");
+      siP->initialSolve();
+
+      CglGMI gct;
+      OsiCuts cs;
+      gct.generateCuts(*siP, cs);
+      assert(cs.sizeRowCuts() > 0);
+
+      CglTableauCache cache(2);
+      CglTreeInfo info;
+      info.tableauCache = &cache;
+      OsiCuts csCached;
+      gct.generateCuts(*siP, csCached, info);
+      assert(csCached.sizeRowCuts() == cs.sizeRowCuts());
+      // same cuts up to rounding
+      for (int i = 0; i < cs.sizeRowCuts(); i++) {
+	const OsiRowCut & cut = cs.rowCut(i);
+	const OsiRowCut & cutCached = csCached.rowCut(i);
+	assert(cut.row().getNumElements() == cutCached.row().getNumElements());
+	assert(fabs(cut.ub() - cutCached.ub()) < 1.0e-7);
+	for (int j = 0; j < cut.row().getNumElements(); j++) {
+	  assert(cut.row().getIndices()[j] == cutCached.row().getIndices()[j]);
+	  assert(fabs(cut.row().getElements()[j] -
+		      cutCached.row().getElements()[j]) < 1.0e-7);
+	}
+      }
+      // all rows were computed up front
+      assert(cache.numberMisses() == 0);
+      assert(cache.numberHits() > 0);
+      delete siP;
+    }
+  }
+
+}
@@ -35,6 +35,8 @@
 #include "CoinWarmStartBasis.hpp"
 #include "CglGomory.hpp"
 #include "CoinFinite.hpp"
+// Rows of tableau asked for in one call when using solver's factorization
+#define CGL_GOMORY_FETCH_ROWS 32
 #ifdef CGL_DEBUG_GOMORY
 int gomory_try=CGL_DEBUG_GOMORY;
 #endif
@@ -49,9 +51,17 @@ void CglGomory::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 #endif
   // Get basic problem information
   int numberColumns=si.getNumCols(); 
+  int numberRows=si.getNumRows(); 
+  // work arrays here and in matrix version come from workspace
+  workspace_.reset(CglWorkspace::bytes(numberColumns,sizeof(char))+
+		   2*CglWorkspace::bytes(numberRows,sizeof(int))+
+		   CglWorkspace::bytes(numberColumns,sizeof(int))+
+		   CglWorkspace::bytes(numberColumns,sizeof(bool))+
+		   CglWorkspace::bytes(numberRows,sizeof(double))+
+		   CglWorkspace::bytes(3*numberColumns+2,sizeof(double)));
   
   // get integer variables and basis
-  char * intVar = new char[numberColumns];
+  char * intVar = workspace_.charArray(numberColumns);
   int i;
   CoinWarmStart * warmstart = si.getWarmStart();
   CoinWarmStartBasis* warm =
@@ -99,7 +109,6 @@ void CglGomory::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
     }
     ClpSimplex * simplex = clpSolver->getModelPtr();
     numberOriginalRows = simplex->numberRows();
-    int numberRows = si.getNumRows();
     assert (numberOriginalRows<=numberRows);
     // only do if different (unless type 2x)
     int gomoryType = gomoryType_%10;
@@ -266,6 +275,10 @@ void CglGomory::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 #endif
   int numberRowCutsBefore = cs.sizeRowCuts();
 
+  // See if we can use factorization in solver
+  if (solverFactorization_&&useSolver==&si&&si.canDoSimplexInterface()&&
+      si.basisIsAvailable())
+    tableauSolver_ = &si;
   if (warmstart)
     generateCuts(debugger, cs, *useSolver->getMatrixByCol(), 
 		 *useSolver->getMatrixByRow(),
@@ -273,6 +286,7 @@ void CglGomory::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 		 useSolver->getColLower(), useSolver->getColUpper(), 
 		 useSolver->getRowLower(), useSolver->getRowUpper(),
 		 intVar,warm,info);
+  tableauSolver_ = NULL;
 #ifdef COIN_HAS_CLP_GOMORY
   if (objective) {
     ClpSimplex * simplex = clpSolver->getModelPtr();
@@ -315,7 +329,6 @@ void CglGomory::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 #endif
 
   delete warmstart;
-  delete [] intVar;
   if ((!info.inTree&&((info.options&4)==4||((info.options&8)&&!info.pass)))
       ||(info.options&16)!=0) {
     int limit = maximumLengthOfCutInTree();
@@ -501,9 +514,11 @@ CglGomory::generateCuts(
   // or we can just increment iBasic one by one
   // for now let ...iBasic give pivot row
   int status=-100;
+  // may be inside generateCuts so give back just what is used here
+  CglWorkspace::Mark workspaceMark = workspace_.mark();
   // probably could use pivotVariables from OsiSimplexModel
-  int * rowIsBasic = new int[numberRows];
-  int * columnIsBasic = new int[numberColumns];
+  int * rowIsBasic = workspace_.intArray(numberRows);
+  int * columnIsBasic = workspace_.intArray(numberColumns);
   int i;
   int numberBasic=0;
   for (i=0;i<numberRows;i++) {
@@ -522,6 +537,41 @@ CglGomory::generateCuts(
       columnIsBasic[i]=-1;
     }
   }
+  // If solver has same basis then just ask it for rows of inverse
+  bool fromSolver=false;
+  if (tableauSolver_&&numberBasic==numberRows&&
+      tableauSolver_->getNumRows()==numberRows&&
+      tableauSolver_->getNumCols()==numberColumns) {
+    tableauSolver_->enableFactorization();
+    int * basics = workspace_.intArray(numberRows);
+    tableauSolver_->getBasics(basics);
+    fromSolver=true;
+    for (i=0;i<numberRows;i++) {
+      int iSequence=basics[i];
+      if (iSequence<numberColumns) {
+	if (columnIsBasic[iSequence]<0)
+	  fromSolver=false;
+      } else if (iSequence<numberColumns+numberRows) {
+	if (rowIsBasic[iSequence-numberColumns]<0)
+	  fromSolver=false;
+      } else {
+	fromSolver=false;
+      }
+    }
+    if (fromSolver) {
+      // pivot row is position in solver's basis
+      for (i=0;i<numberRows;i++) {
+	int iSequence=basics[i];
+	if (iSequence<numberColumns) 
+	  columnIsBasic[iSequence]=i;
+	else
+	  rowIsBasic[iSequence-numberColumns]=i;
+      }
+      status=0;
+    } else {
+      tableauSolver_->disableFactorization();
+    }
+  }
   //returns 0 -okay, -1 singular, -2 too many in basis, -99 memory */
   while (status<-98) {
 #ifdef CLP_OSL
@@ -543,23 +593,56 @@ CglGomory::generateCuts(
 #ifdef COIN_DEVELOP
     std::cout<<"Bad factorization of basis - status "<<status<<std::endl;
 #endif
-    delete [] rowIsBasic;
-    delete [] columnIsBasic;
+#ifdef CLP_OSL
+    delete factorization2;
+#endif
+    workspace_.release(workspaceMark);
     return -1;
   }
   // End of creation of factorization (A) ====
   
+  double relaxation = COIN_DBL_MAX;
+  /* No condition number from solver - estimate from norm of basis here
+     and norm of each row of inverse as it is fetched.  Tableau row comes
+     ready made so also save largest nonbasic element in each row for
+     largest factor */
+  double basisNorm = 0.0;
+  double * rowLargest = NULL;
+  if (fromSolver) {
+    double * rowSum = workspace_.doubleArray(numberRows);
+    rowLargest = workspace_.doubleArray(numberRows);
+    for (i=0;i<numberRows;i++) {
+      rowSum[i] = (rowIsBasic[i]>=0) ? 1.0 : 0.0;
+      rowLargest[i] = 0.0;
+    }
+    const int * row = columnCopy.getIndices();
+    const CoinBigIndex * columnStart = columnCopy.getVectorStarts();
+    const int * columnLength = columnCopy.getVectorLengths(); 
+    const double * columnElements = columnCopy.getElements();
+    for (i=0;i<numberColumns;i++) {
+      if (columnIsBasic[i]>=0) {
+	for (CoinBigIndex k=columnStart[i];k<columnStart[i]+columnLength[i];k++)
+	  rowSum[row[k]] += fabs(columnElements[k]);
+      } else if (colUpper[i]>colLower[i]+testFixed) {
+	for (CoinBigIndex k=columnStart[i];k<columnStart[i]+columnLength[i];k++)
+	  rowLargest[row[k]] = CoinMax(rowLargest[row[k]],fabs(columnElements[k]));
+      }
+    }
+    for (i=0;i<numberRows;i++)
+      basisNorm = CoinMax(basisNorm,rowSum[i]);
+  } else {
 #ifdef CLP_OSL
-  double relaxation = !alternateFactorization_ ? factorization.conditionNumber() :
-    factorization2->conditionNumber();
+    relaxation = !alternateFactorization_ ? factorization.conditionNumber() :
+      factorization2->conditionNumber();
 #else
-  double relaxation = factorization.conditionNumber();
+    relaxation = factorization.conditionNumber();
 #endif
 #ifdef COIN_DEVELOP_z
-  if (relaxation>1.0e49)
-    printf("condition %g\n",relaxation);
+    if (relaxation>1.0e49)
+      printf("condition %g\n",relaxation);
 #endif
-  relaxation *= conditionNumberMultiplier_;
+    relaxation *= conditionNumberMultiplier_;
+  }
   double bounds[2]={-COIN_DBL_MAX,0.0};
   int iColumn,iRow;
 
@@ -574,7 +657,7 @@ CglGomory::generateCuts(
 
   // we need to do book-keeping for variables at ub
   double tolerance = 1.0e-7;
-  bool * swap= new bool [numberColumns];
+  bool * swap= workspace_.boolArray(numberColumns);
   for (iColumn=0;iColumn<numberColumns;iColumn++) {
     if (columnIsBasic[iColumn]<0&&
 	colUpper[iColumn]-colsol[iColumn]<=tolerance) {
@@ -585,7 +668,7 @@ CglGomory::generateCuts(
   }
 
   // get row activities (could use solver but lets do here )
-  double * rowActivity = new double [numberRows];
+  double * rowActivity = workspace_.doubleArray(numberRows);
   CoinFillN(rowActivity,numberRows,0.0);
   for (iColumn=0;iColumn<numberColumns;iColumn++) {
     double value = colsol[iColumn];
@@ -602,7 +685,7 @@ CglGomory::generateCuts(
      and 4 bit is set if slack must be integer
 
   */
-  int * rowType = new int[numberRows];
+  int * rowType = workspace_.intArray(numberRows);
   for (iRow=0;iRow<numberRows;iRow++) {
     if (rowIsBasic[iRow]<0&&rowUpper[iRow]>rowLower[iRow]+1.0e-7) {
       int type=0;
@@ -676,7 +759,7 @@ CglGomory::generateCuts(
   int lengthArray = static_cast<int>(numberColumns+1+((numberColumns+1)*sizeof(int))/sizeof(double));
   if (doSorted)
     lengthArray+=numberColumns;
-  double * packed = new double[lengthArray]; 
+  double * packed = workspace_.doubleArray(lengthArray); 
   double * sort = packed+numberColumns+1;
   int * which = reinterpret_cast<int *>(doSorted ? (sort+numberColumns): (sort));
   double tolerance1=1.0e-6;
@@ -791,6 +874,19 @@ CglGomory::generateCuts(
 #if MORE_GOMORY_CUTS==1||MORE_GOMORY_CUTS==3
   OsiCuts secondaryCuts;
 #endif
+  /* Rows of tableau from solver are fetched a block at a time - all
+     candidates are basic so candidate kColumn is row kColumn-firstFetched
+     of tableauRows */
+  CoinPackedMatrix tableauRows;
+  double * tableauRow = NULL;
+  int * fetchRows = NULL;
+  int firstFetched = 0;
+  int lastFetched = 0;
+  if (fromSolver) {
+    tableauRow = workspace_.doubleArray(numberColumns);
+    CoinZeroN(tableauRow,numberColumns);
+    fetchRows = workspace_.intArray(CGL_GOMORY_FETCH_ROWS);
+  }
   for (int kColumn=0;kColumn<nCandidates;kColumn++) {
     if (nTotalEls<=0)
       break;  // Got enough
@@ -803,7 +899,7 @@ CglGomory::generateCuts(
   // Debug code below computes tableau column of basic ====
       int j;
 #ifdef CGL_DEBUG
-      {
+      if (!fromSolver) {
 	// put column into array
 	array.setVector(columnLength[iColumn],row+columnStart[iColumn],
 			columnElements+columnStart[iColumn]);
@@ -839,19 +935,50 @@ CglGomory::generateCuts(
 	cutVector.checkClear();
 #endif
 	// get row of tableau
-	double one =1.0;
-	array.setVector(1,&iBasic,&one);
 	int numberNonInteger=0;
 	//Code below computes tableau row ====
 	// get pi
+	if (fromSolver) {
+	  if (kColumn>=lastFetched) {
+	    // next block of rows in one call
+	    int n=0;
+	    for (lastFetched=kColumn;lastFetched<nCandidates&&
+		   n<CGL_GOMORY_FETCH_ROWS;lastFetched++)
+	      fetchRows[n++]=columnIsBasic[which[lastFetched]];
+	    tableauSolver_->getBInvARows(n,fetchRows,tableauRows);
+	    firstFetched=kColumn;
+	  }
+	  // structurals to dense tableauRow - logicals are row of inverse
+	  int kRow=kColumn-firstFetched;
+	  const int * tableauIndex = tableauRows.getIndices();
+	  const double * tableauElement = tableauRows.getElements();
+	  CoinBigIndex start = tableauRows.getVectorStarts()[kRow];
+	  CoinBigIndex end = start+tableauRows.getVectorSize(kRow);
+	  double inverseNorm=0.0;
+	  for (CoinBigIndex k=start;k<end;k++) {
+	    int iSequence=tableauIndex[k];
+	    double value=tableauElement[k];
+	    if (iSequence<numberColumns) {
+	      tableauRow[iSequence]=value;
+	    } else if (fabs(value)>=1.0e-13) {
+	      // small values dropped as in factorization
+	      array.insert(iSequence-numberColumns,value);
+	      inverseNorm += fabs(value);
+	    }
+	  }
+	  relaxation = basisNorm*inverseNorm*conditionNumberMultiplier_;
+	} else {
+	  double one =1.0;
+	  array.setVector(1,&iBasic,&one);
 #ifdef CLP_OSL
-	if (!alternateFactorization_)
+	  if (!alternateFactorization_)
 #endif
-	  factorization.updateColumnTranspose ( &work, &array );
+	    factorization.updateColumnTranspose ( &work, &array );
 #ifdef CLP_OSL
-	else
-	  factorization2->updateColumnTranspose ( &work, &array );
+	  else
+	    factorization2->updateColumnTranspose ( &work, &array );
 #endif
+	}
 	int numberInArray=array.getNumElements();
 #ifdef CGL_DEBUG
 	// check pivot on iColumn
@@ -873,6 +1000,10 @@ CglGomory::generateCuts(
 	  int indexValue=arrayRows[j];
 	  double value=arrayElements[indexValue];
 	  largestFactor = CoinMax(largestFactor,fabs(value));
+	  // same as largest dual*element in loop on columns below
+	  if (fromSolver)
+	    largestFactor = CoinMax(largestFactor,
+				    fabs(value)*rowLargest[indexValue]);
 	}
 	//reducedValue=colsol[iColumn];
 	// coding from pg 130 of Wolsey 
@@ -887,13 +1018,17 @@ CglGomory::generateCuts(
 	for (j=0;j<numberColumns;j++) {
 	  if (columnIsBasic[j]<0&&colUpper[j]>colLower[j]+testFixed) {
 	    double value=0.0;
-	    int k;
-	    // add in row of tableau
-	    for (k=columnStart[j];k<columnStart[j]+columnLength[j];k++) {
-	      iRow = row[k];
-	      double value2 = columnElements[k]*arrayElements[iRow];
-	      largestFactor = CoinMax(largestFactor,fabs(value2));
-	      value += value2;
+	    if (fromSolver) {
+	      value = tableauRow[j];
+	    } else {
+	      int k;
+	      // add in row of tableau
+	      for (k=columnStart[j];k<columnStart[j]+columnLength[j];k++) {
+		iRow = row[k];
+		double value2 = columnElements[k]*arrayElements[iRow];
+		largestFactor = CoinMax(largestFactor,fabs(value2));
+		value += value2;
+	      }
 	    }
 #ifdef CGL_DEBUG_GOMORY
 	    if (!gomory_try&&value)
@@ -962,6 +1097,18 @@ CglGomory::generateCuts(
 	    continue;
 	  }
 	}
+	if (fromSolver) {
+	  // clear structurals
+	  int kRow=kColumn-firstFetched;
+	  const int * tableauIndex = tableauRows.getIndices();
+	  CoinBigIndex start = tableauRows.getVectorStarts()[kRow];
+	  CoinBigIndex end = start+tableauRows.getVectorSize(kRow);
+	  for (CoinBigIndex k=start;k<end;k++) {
+	    int iSequence=tableauIndex[k];
+	    if (iSequence<numberColumns)
+	      tableauRow[iSequence]=0.0;
+	  }
+	}
 	cutVector.setNumElements(number);
 	// If too many - just clear vector and skip
 	if (number>limit) {
@@ -1379,13 +1526,10 @@ CglGomory::generateCuts(
 #ifdef CLP_OSL
   delete factorization2;
 #endif
+  if (fromSolver)
+    tableauSolver_->disableFactorization();
 
-  delete [] rowActivity;
-  delete [] swap;
-  delete [] rowType;
-  delete [] packed;
-  delete [] rowIsBasic;
-  delete [] columnIsBasic;
+  workspace_.release(workspaceMark);
 #ifdef MORE_GOMORY_CUTS
 #if MORE_GOMORY_CUTS==1
   int numberInaccurate = secondaryCuts.sizeRowCuts();
@@ -1538,6 +1682,8 @@ limit_(50),
 limitAtRoot_(0),
 dynamicLimitInTree_(-1),
 alternateFactorization_(0),
+solverFactorization_(0),
+tableauSolver_(NULL),
 gomoryType_(0)
 {
 
@@ -1557,6 +1703,8 @@ CglGomory::CglGomory (const CglGomory & source) :
   limitAtRoot_(source.limitAtRoot_),
   dynamicLimitInTree_(source.dynamicLimitInTree_),
   alternateFactorization_(source.alternateFactorization_),
+  solverFactorization_(source.solverFactorization_),
+  tableauSolver_(NULL),
   gomoryType_(source.gomoryType_)
 { 
   if (source.originalSolver_)
@@ -1596,6 +1744,7 @@ CglGomory::operator=(const CglGomory& rhs)
     limitAtRoot_=rhs.limitAtRoot_;
     dynamicLimitInTree_ = rhs.dynamicLimitInTree_;
     alternateFactorization_=rhs.alternateFactorization_; 
+    solverFactorization_=rhs.solverFactorization_;
     gomoryType_ = rhs.gomoryType_;
     delete originalSolver_;
     if (rhs.originalSolver_)
@@ -131,6 +131,20 @@ public:
    /// Get whether alternative factorization being used
    inline bool alternativeFactorization() const
    { return (alternateFactorization_!=0);} 
+   /** Set/unset use of solver's factorization.  If set and the solver
+       has an optimal basis and does the tableau access methods
+       (canDoSimplexInterface), rows of the basis inverse come from the
+       solver (getBInvARows, a block of rows at a time) instead of
+       factorizing the basis here.  The solver gives no condition number
+       so for each row it is estimated as norm of basis times norm of
+       that row of the inverse (infinity norms).  Not used with an
+       original solver (gomoryType).
+   */
+   inline void useSolverFactorization(bool yes=true)
+   { solverFactorization_= (yes) ? 1 : 0;} 
+   /// Get whether solver's factorization being used
+   inline bool solverFactorization() const
+   { return (solverFactorization_!=0);} 
   //@}
 
   /**@name Constructors and destructors */
@@ -187,6 +201,10 @@ private:
   int numberTimesStalled_;
   /// nonzero to use alternative factorization
   int alternateFactorization_;
+  /// nonzero to use solver's factorization if possible
+  int solverFactorization_;
+  /// Solver to get basis inverse from (only during generateCuts)
+  const OsiSolverInterface * tableauSolver_;
   /// Type - 0 normal, 1 add original matrix one, 2 replace
   int gomoryType_;
   //@}
@@ -3,6 +3,7 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include <cstdio>
+#include <cmath>
 
 #ifdef NDEBUG
 #undef NDEBUG
@@ -1494,5 +1495,55 @@ CglGomoryUnitTest(
     
     delete siP;
   } 
+
+  // Factorization from solver gives same cuts (rows fetched in blocks)
+  {
+    const char * models[] = {"p0033","p0201","p0548"};
+    for (int iModel=0;iModel<3;iModel++) {
+      OsiSolverInterface * siP = baseSiP->clone();
+      std::string fn(mpsDir+models[iModel]);
+      siP->readMps(fn.c_str(),"mps");
+      siP->initialSolve();
+      if (siP->canDoSimplexInterface()) {
+	CglGomory test;
+	OsiCuts cuts;
+	test.generateCuts(*siP,cuts);
+	CglGomory test2(test);
+	test2.useSolverFactorization();
+	assert (test2.solverFactorization());
+	OsiCuts cuts2;
+	test2.generateCuts(*siP,cuts2);
+	int nRowCuts = cuts.sizeRowCuts();
+	assert (nRowCuts>0);
+	assert (cuts2.sizeRowCuts()==nRowCuts);
+	// may be in different order
+	for (int i=0;i<nRowCuts;i++) {
+	  CoinPackedVector row2 = cuts2.rowCut(i).row();
+	  row2.sortIncrIndex();
+	  bool found=false;
+	  for (int j=0;j<nRowCuts&&!found;j++) {
+	    CoinPackedVector row = cuts.rowCut(j).row();
+	    if (row.getNumElements()!=row2.getNumElements())
+	      continue;
+	    row.sortIncrIndex();
+	    // condition number is estimated differently so relaxation may differ
+	    double ub = cuts.rowCut(j).ub();
+	    found = fabs(ub-cuts2.rowCut(i).ub())<1.0e-7*CoinMax(1.0,fabs(ub));
+	    for (int k=0;k<row.getNumElements()&&found;k++) {
+	      if (row.getIndices()[k]!=row2.getIndices()[k]||
+		  fabs(row.getElements()[k]-row2.getElements()[k])>1.0e-7)
+		found=false;
+	    }
+	  }
+	  assert (found);
+	}
+	// solver still at optimal basis
+	siP->resolve();
+	assert (!siP->getIterationCount());
+      }
+      delete siP;
+    }
+  }
+
 }
 
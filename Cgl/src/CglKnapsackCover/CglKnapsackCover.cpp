@@ -39,15 +39,21 @@ void CglKnapsackCover::generateCuts(const OsiSolverInterface& si, OsiCuts& cs,
   CoinPackedVector krow; 
   double b=0.0;
   int numberRowCutsBefore = cs.sizeRowCuts();
-  int * complement= new int[nCols];
+  // All work arrays come from workspace kept between calls
+  workspace_.reset(5*CglWorkspace::bytes(nCols,sizeof(int))+
+		   CglWorkspace::bytes(2*nCols,sizeof(double))+
+		   2*CglWorkspace::bytes(nCols,sizeof(double))+
+		   2*CglWorkspace::bytes(nRows,sizeof(int))+
+		   4*CglWorkspace::bytes(nRows,sizeof(double)));
+  int * complement= workspace_.intArray(nCols);
   complement_ = complement;
 #if GUBCOVER==1
-  elements_=new double [2*nCols];
+  elements_=workspace_.doubleArray(2*nCols);
   CoinZeroN(elements_,2*nCols);
 #elif GUBCOVER==2
   int size1=4*nCols+2*numberCliques_;
   int size2=2*nCols+5*numberCliques_+5;
-  elements_=reinterpret_cast<double *>(new int [size2+size1*sizeof(double)/sizeof(int)]);
+  elements_=reinterpret_cast<double *>(workspace_.intArray(size2+size1*sizeof(double)/sizeof(int)));
   CoinZeroN(elements_,2*nCols+2*numberCliques_);
   int * restInd = reinterpret_cast<int *> (elements_+size1);
   CoinFillN(restInd,nCols,-2);
@@ -57,13 +63,13 @@ void CglKnapsackCover::generateCuts(const OsiSolverInterface& si, OsiCuts& cs,
   // inititalize it. 
   // Assumes the lp-relaxation has been solved, and the solver interface
   // has a meaningful colsol.
-  double * xstar= new double[nCols];
+  double * xstar= workspace_.doubleArray(nCols);
   solver_ = &si;
 
   // To allow for vub knapsacks
-  int * thisColumnIndex = new int [nCols];
-  double * thisElement = new double[nCols];
-  int * back = new int[nCols];
+  int * thisColumnIndex = workspace_.intArray(nCols);
+  double * thisElement = workspace_.doubleArray(nCols);
+  int * back = workspace_.intArray(nCols);
   
   const double *colsol = si.getColSolution(); 
   int k; 
@@ -71,21 +77,21 @@ void CglKnapsackCover::generateCuts(const OsiSolverInterface& si, OsiCuts& cs,
   // -1 if no vub
   // -2 if can skip row for knapsacks
 
-  int * vub = new int [nRows];
+  int * vub = workspace_.intArray(nRows);
 
   // Now vubValue are for positive coefficients and vlbValue for negative
   // when L row
   // For each column point to vub row
-  int * vubRow = new int [nCols];
-  double * vubValue = new double [nRows];
+  int * vubRow = workspace_.intArray(nCols);
+  double * vubValue = workspace_.doubleArray(nRows);
 
   // For each column point to vlb row
-  int * vlbRow = new int [nCols];
-  double * vlbValue = new double [nRows];
+  int * vlbRow = workspace_.intArray(nCols);
+  double * vlbValue = workspace_.doubleArray(nRows);
 
   // Take out all fixed
-  double * effectiveUpper = new double [nRows];
-  double * effectiveLower = new double [nRows];
+  double * effectiveUpper = workspace_.doubleArray(nRows);
+  double * effectiveLower = workspace_.doubleArray(nRows);
   const double * colUpper = si.getColUpper();
   const double * colLower = si.getColLower();
   for (k=0; k<nCols; k++){
@@ -243,7 +249,7 @@ void CglKnapsackCover::generateCuts(const OsiSolverInterface& si, OsiCuts& cs,
   int numCheck = 0;
   int* toCheck = 0;
   if (!rowsToCheck_) {
-     toCheck = new int[nRows];
+     toCheck = workspace_.intArray(nRows);
      CoinIotaN(toCheck, nRows, 0);
      numCheck = nRows;
   } else {
@@ -752,24 +758,9 @@ void CglKnapsackCover::generateCuts(const OsiSolverInterface& si, OsiCuts& cs,
     for (int i=numberRowCutsBefore;i<numberRowCutsAfter;i++)
       cs.rowCutPtr(i)->setGloballyValid();
   }
-  // Clean up: free allocated memory
-  if (toCheck != rowsToCheck_)
-     delete[] toCheck;
-  delete[] xstar;
-  delete[] complement;
-#ifdef GUBCOVER
-  delete [] elements_;
-#endif
-  delete [] thisColumnIndex;
-  delete [] thisElement;
-  delete [] back;
-  delete [] vub;
-  delete [] vubRow;
-  delete [] vubValue;
-  delete [] vlbRow;
-  delete [] vlbValue;
-  delete [] effectiveLower;
-  delete [] effectiveUpper;
+  // Clean up: work arrays stay in workspace for next time
+  complement_ = NULL;
+  elements_ = NULL;
 }
 
 void
@@ -838,5 +838,29 @@ CglKnapsackCoverUnitTest(
   }
 #endif
 
+  // Work arrays are kept between calls
+  {
+    OsiSolverInterface  * siP = baseSiP->clone();
+    std::string fn(mpsDir+"p0201");
+    siP->readMps(fn.c_str(),"mps");
+    siP->initialSolve();
+    CglKnapsackCover kccg;
+    OsiCuts cuts;
+    kccg.generateCuts(*siP,cuts);
+    assert (kccg.bytesAllocatedLastCall()>0);
+    for (int iPass=0;iPass<2;iPass++) {
+      OsiCuts cuts2;
+      kccg.generateCuts(*siP,cuts2);
+      assert (!kccg.bytesAllocatedLastCall());
+      assert (cuts2.sizeRowCuts()==cuts.sizeRowCuts());
+      for (int j=0;j<cuts.sizeRowCuts();j++)
+	assert (cuts2.rowCut(j)==cuts.rowCut(j));
+    }
+    // copy starts with nothing
+    CglKnapsackCover copy(kccg);
+    assert (!copy.workspace().capacity());
+    delete siP;
+  }
+
 }
 
@@ -10,6 +10,8 @@
 //---------------------------------------------------------------------------
 #include "CglLandP.hpp"
 #include "CglLandPSimplex.hpp"
+#include "CglTableauCache.hpp"
+#include "CglThread.hpp"
 
 #define INT_INFEAS(value) fabs(value - floor(value+0.5))
 
@@ -50,6 +52,7 @@ CglLandP::Parameters::Parameters():
         failedPivotLimit(1),
         degeneratePivotLimit(0),
         extraCutsLimit(5),
+        numberThreads(1),
         pivotTol(1e-4),
         away(5e-4),
         timeLimit(COIN_DBL_MAX),
@@ -78,6 +81,7 @@ CglLandP::Parameters::Parameters(const Parameters &other):
         failedPivotLimit(other.failedPivotLimit),
         degeneratePivotLimit(other.degeneratePivotLimit),
         extraCutsLimit(other.extraCutsLimit),
+        numberThreads(other.numberThreads),
         pivotTol(other.pivotTol),
         away(other.away),
         timeLimit(other.timeLimit),
@@ -107,6 +111,7 @@ CglLandP::Parameters & CglLandP::Parameters::operator=(const Parameters &other)
         failedPivotLimit = other.failedPivotLimit;
         degeneratePivotLimit = other.failedPivotLimit;
         extraCutsLimit = other.extraCutsLimit;
+        numberThreads = other.numberThreads;
         pivotTol = other.pivotTol;
         away = other.away;
         timeLimit = other.timeLimit;
@@ -130,7 +135,7 @@ CglLandP::Parameters & CglLandP::Parameters::operator=(const Parameters &other)
 CglLandP::CachedData::CachedData(int nBasics, int nNonBasics):
         basics_(NULL), nonBasics_(NULL), nBasics_(nBasics),
         nNonBasics_(nNonBasics), basis_(NULL), colsol_(NULL),
-        slacks_(NULL), integers_(NULL), solver_(NULL)
+        slacks_(NULL), integers_(NULL)
 {
     if (nBasics_>0)
     {
@@ -149,7 +154,7 @@ CglLandP::CachedData::CachedData(int nBasics, int nNonBasics):
 CglLandP::CachedData::CachedData(const CachedData &source):
         basics_(NULL), nonBasics_(NULL), nBasics_(source.nBasics_),
         nNonBasics_(source.nNonBasics_), basis_(NULL),
-        colsol_(NULL), slacks_(NULL), integers_(NULL), solver_(NULL)
+        colsol_(NULL), slacks_(NULL), integers_(NULL)
 {
     if (nBasics_>0)
     {
@@ -161,7 +166,7 @@ CglLandP::CachedData::CachedData(const CachedData &source):
     if (nNonBasics_>0)
     {
         nonBasics_ = new int[nNonBasics_];
-        CoinCopyN(source.nonBasics_, nBasics_, nonBasics_);
+        CoinCopyN(source.nonBasics_, nNonBasics_, nonBasics_);
     }
     if (nBasics_ + nNonBasics_ > 0)
     {
@@ -171,8 +176,6 @@ CglLandP::CachedData::CachedData(const CachedData &source):
     }
     if (source.basis_!=NULL)
         basis_ = new CoinWarmStartBasis(*source.basis_);
-    if (source.solver_!=NULL)
-      solver_ = source.solver_->clone();
 }
 
 CglLandP::CachedData& CglLandP::CachedData::operator=(const CachedData &source)
@@ -203,7 +206,7 @@ CglLandP::CachedData& CglLandP::CachedData::operator=(const CachedData &source)
         if (nNonBasics_>0)
         {
             nonBasics_ = new int[nNonBasics_];
-            CoinCopyN(source.nonBasics_, nBasics_, nonBasics_);
+            CoinCopyN(source.nonBasics_, nNonBasics_, nonBasics_);
         }
         if (nBasics_ + nNonBasics_ > 0)
         {
@@ -213,9 +216,6 @@ CglLandP::CachedData& CglLandP::CachedData::operator=(const CachedData &source)
         }
         if (source.basis_!=NULL)
             basis_ = new CoinWarmStartBasis(*source.basis_);
-        delete solver_;
-	if (source.solver_)
-	  solver_ = source.solver_->clone();
     }
     return *this;
 }
@@ -344,14 +344,6 @@ CglLandP::CachedData::getData(const OsiSolverInterface &si)
         OsiSolverInterface * ncSi = (const_cast<OsiSolverInterface *>(&si));
         ncSi->enableSimplexInterface(0);
         ncSi->getBasics(basics_);
-	// Save enabled solver
-	solver_ = si.clone();
-#ifdef COIN_HAS_OSICLP
-	OsiClpSolverInterface * clpSi = dynamic_cast<OsiClpSolverInterface *>(solver_);
-	const OsiClpSolverInterface * clpSiRhs = dynamic_cast<const OsiClpSolverInterface *>(&si);
-	if (clpSi)
-	  clpSi->getModelPtr()->copyEnabledStuff(clpSiRhs->getModelPtr());;
-#endif
         ncSi->disableSimplexInterface();
     }
 
@@ -402,8 +394,6 @@ CglLandP::CachedData::clean(){
 
    nBasics_ = 0;
    nNonBasics_ = 0;
-   delete solver_;
-   solver_ = NULL;
 }
 CglLandP::CachedData::~CachedData()
 {
@@ -416,7 +406,6 @@ CglLandP::CachedData::~CachedData()
     delete basis_;
     if (integers_)
         delete [] integers_;
-    delete solver_;
 }
 
 CglLandP::CglLandP(const CglLandP::Parameters &params,
@@ -564,6 +553,21 @@ CglLandP::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 #endif
 
     cached_.getData(*t_si);
+    std::vector<int> indices;
+    getSortedFractionalIndices(indices,cached_, params);
+
+    int numberTasks = std::min(params.numberThreads, static_cast<int>(indices.size()));
+    if (numberTasks > 1 && params.pivotLimit != 0)
+    {
+        generateCutsInParallel(si, *t_si, indices, numberTasks, params, cs);
+        cached_.clean();
+#ifdef APPEND_ROW
+        assert(t_si != &si);
+        delete t_si;
+#endif
+        return;
+    }
+
     CglLandPSimplex landpSi(*t_si, cached_, params, validator_);
     if (params.generateExtraCuts == CglLandP::AllViolatedMigs)
     {
@@ -572,8 +576,17 @@ CglLandP::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
     landpSi.setLogLevel(handler_->logLevel());
     int nCut = 0;
 
-    std::vector<int> indices;
-    getSortedFractionalIndices(indices,cached_, params);
+    // Starting tableau rows may be shared with other generators
+    CglTableauCache * tableauCache = info.tableauCache;
+    if (tableauCache && t_si == &si && tableauCache->update(si))
+    {
+        int n = std::min(static_cast<int>(indices.size()), params.maxCutPerRound);
+        std::vector<int> variables(n + 1);
+        for (int i = 0 ; i < n ; i++)
+            variables[i] = cached_.basics_[indices[i]];
+        tableauCache->computeRows(si, n, &variables[0]);
+        landpSi.setTableauCache(tableauCache);
+    }
 
 #ifndef NDEBUG
     int numrows = si.getNumRows();
@@ -593,6 +606,15 @@ CglLandP::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
     params_.timeLimit += CoinCpuTime();
     CoinRelFltEq eq(1e-04);
 
+    // One solver for all rows - optimize starts it from optimal basis
+    if (params.pivotLimit != 0)
+    {
+        OsiSolverInterface * ncSi = t_si->clone();
+        ncSi->setDblParam(OsiDualObjectiveLimit, COIN_DBL_MAX);
+        ncSi->messageHandler()->setLogLevel(0);
+        landpSi.setSi(ncSi);
+    }
+
     for (unsigned int i = 0; i < indices.size() && nCut < params.maxCutPerRound &&
             nCut < cached_.nBasics_ ; i++)
     {
@@ -602,15 +624,6 @@ CglLandP::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
         assert(iRow < numrows);
         OsiRowCut cut;
         int code=1;
-        OsiSolverInterface * ncSi = NULL;
-
-        if (params.pivotLimit != 0)
-        {
-            ncSi = t_si->clone();
-            landpSi.setSi(ncSi);
-            ncSi->setDblParam(OsiDualObjectiveLimit, COIN_DBL_MAX);
-            ncSi->messageHandler()->setLogLevel(0);
-        }
 
         int generated = 0;
         if (params.pivotLimit == 0)
@@ -634,22 +647,16 @@ CglLandP::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
             if (params.pivotLimit !=0)
             {
                 handler_->message(LAP_CUT_FAILED_DO_MIG, messages_)<<validator_.failureString(code)<<CoinMessageEol;
-                landpSi.freeSi();
-                OsiSolverInterface * ncSi = t_si->clone();
-                landpSi.setSi(ncSi);
                 params.pivotLimit = 0;
                 if (landpSi.optimize(iRow, cut, cached_, params))
                 {
                     code = validator_(cut, cached_.colsol_, si, params, originalColLower_, originalColUpper_);
                 }
+                landpSi.resetSolver(cached_.basis_);
                 params.pivotLimit = params_.pivotLimit;
             }
         }
 
-        if (params.pivotLimit != 0)
-        {
-            landpSi.freeSi();
-        }
         if (code)
         {
             handler_->message(CUT_REJECTED, messages_)<<
@@ -669,6 +676,10 @@ CglLandP::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
             }
         }
     }
+    if (params.pivotLimit != 0)
+    {
+        landpSi.freeSi();
+    }
 
     Cuts& extra = landpSi.extraCuts();
     for (int i = 0 ; i < cached_.nNonBasics_; i++)
@@ -702,6 +713,210 @@ CglLandP::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 #endif
 }
 
+/* Everything one task needs.  Each task has its own solver, cached data,
+   validator and simplex so that the only things shared are read.  Results
+   are stored by position in indices and task only does positions
+   task, task+numberTasks, ... */
+struct CglLandP::SeparationTask
+{
+    /// Number of tasks
+    int numberTasks;
+    /// Rows to separate from (all tasks)
+    const std::vector<int> * indices;
+    /// Parameters for the round
+    const Parameters * params;
+    /// Copy of solver
+    OsiSolverInterface * solver;
+    /// Copy of cached data
+    CachedData * cached;
+    /// Copy of validator
+    Validator * validator;
+    /// Simplex working on solver
+    CglLandPSimplex * simplex;
+    /// Original bounds for validator (may be NULL)
+    const double * originalColLower;
+    const double * originalColUpper;
+    /// Cut from each row (NULL if none)
+    OsiRowCut ** cuts;
+    /// Validator code if Gomory cut had to be tried instead (-1 if not)
+    int * fallback;
+    /// Validator code if cut rejected (0 if not)
+    int * rejected;
+};
+
+void
+CglLandP::separateTask(int task, int , void * voidData)
+{
+    SeparationTask & data = reinterpret_cast<SeparationTask *>(voidData)[task];
+    Parameters params = *data.params;
+    const std::vector<int> & indices = *data.indices;
+    CachedData & cached = *data.cached;
+    Validator & validator = *data.validator;
+    CglLandPSimplex & landpSi = *data.simplex;
+    const OsiSolverInterface & si = *data.solver;
+    int numberIndices = static_cast<int>(indices.size());
+    // cpu time counts all threads so time limit is on wall clock
+    double startTime = CoinGetTimeOfDay();
+    int nCut = 0;
+
+    for (int i = task; i < numberIndices && nCut < params.maxCutPerRound &&
+            nCut < cached.nBasics_ ; i += data.numberTasks)
+    {
+        //Check for time limit
+        double timeLeft = data.params->timeLimit - (CoinGetTimeOfDay() - startTime);
+        if (timeLeft < 0.)
+            break;
+        params.timeLimit = timeLeft;
+        int iRow = indices[i];
+        OsiRowCut cut;
+        int generated = landpSi.optimize(iRow, cut, cached, params);
+        if (params.generateExtraCuts == CglLandP::AllViolatedMigs)
+        {
+            landpSi.genThisBasisMigs(cached, params);
+        }
+        landpSi.resetSolver(cached.basis_);
+        int code = 0;
+        if (generated)
+            code = validator(cut, cached.colsol_, si, params, data.originalColLower, data.originalColUpper);
+        if (!generated || code)
+        {
+            data.fallback[i] = code;
+            params.pivotLimit = 0;
+            if (landpSi.optimize(iRow, cut, cached, params))
+            {
+                code = validator(cut, cached.colsol_, si, params, data.originalColLower, data.originalColUpper);
+            }
+            landpSi.resetSolver(cached.basis_);
+            params.pivotLimit = data.params->pivotLimit;
+        }
+        if (code)
+        {
+            data.rejected[i] = code;
+        }
+        else
+        {
+            data.cuts[i] = new OsiRowCut(cut);
+            nCut++;
+        }
+    }
+}
+
+void
+CglLandP::generateCutsInParallel(const OsiSolverInterface & si,
+                                 const OsiSolverInterface & t_si,
+                                 const std::vector<int> & indices,
+                                 int numberTasks,
+                                 const Parameters & params, OsiCuts & cs)
+{
+    int numberIndices = static_cast<int>(indices.size());
+    std::vector<OsiRowCut *> cuts(numberIndices, static_cast<OsiRowCut *>(NULL));
+    std::vector<int> fallback(numberIndices, -1);
+    std::vector<int> rejected(numberIndices, 0);
+    // Set up everything here so tasks do not touch this
+    std::vector<SeparationTask> tasks(numberTasks);
+    for (int iTask = 0 ; iTask < numberTasks ; iTask++)
+    {
+        SeparationTask & task = tasks[iTask];
+        task.numberTasks = numberTasks;
+        task.indices = &indices;
+        task.params = &params;
+        task.solver = t_si.clone();
+        task.cached = new CachedData(cached_);
+        task.validator = new Validator(validator_);
+        task.simplex = new CglLandPSimplex(*task.solver, *task.cached, params,
+                                           *task.validator);
+        if (params.pivotLimit != 0)
+        {
+            // Each task pivots on its own solver
+            OsiSolverInterface * ncSi = t_si.clone();
+            ncSi->setDblParam(OsiDualObjectiveLimit, COIN_DBL_MAX);
+            ncSi->messageHandler()->setLogLevel(0);
+            task.simplex->setSi(ncSi);
+        }
+        task.simplex->setLogLevel(handler_->logLevel());
+        task.simplex->setUseWallclock(true);
+        task.originalColLower = originalColLower_;
+        task.originalColUpper = originalColUpper_;
+        task.cuts = &cuts[0];
+        task.fallback = &fallback[0];
+        task.rejected = &rejected[0];
+    }
+    if (params.generateExtraCuts == CglLandP::AllViolatedMigs)
+    {
+        tasks[0].simplex->genThisBasisMigs(*tasks[0].cached, params);
+    }
+
+    CglRunTasks(numberTasks, numberTasks, separateTask, &tasks[0]);
+
+    // Merge in order of rows so result does not depend on number of threads
+    CoinRelFltEq eq(1e-04);
+    int nCut = 0;
+    for (int i = 0 ; i < numberIndices ; i++)
+    {
+        if (fallback[i] >= 0)
+        {
+            handler_->message(LAP_CUT_FAILED_DO_MIG, messages_)<<validator_.failureString(fallback[i])<<CoinMessageEol;
+        }
+        if (rejected[i])
+        {
+            handler_->message(CUT_REJECTED, messages_)<<
+            validator_.failureString(rejected[i])<<CoinMessageEol;
+        }
+        OsiRowCut * cut = cuts[i];
+        if (cut == NULL) continue;
+        if (nCut < params.maxCutPerRound && nCut < cached_.nBasics_)
+        {
+            if (canLift_)
+            {
+                cut->setGloballyValid(true);
+            }
+            cs.insertIfNotDuplicate(*cut, eq);
+            nCut++;
+        }
+        delete cut;
+    }
+
+    // Extra cuts - keep most effective for each variable as one simplex would
+    for (int i = 0 ; i < cached_.nNonBasics_; i++)
+    {
+        OsiRowCut * best = NULL;
+        for (int iTask = 0 ; iTask < numberTasks ; iTask++)
+        {
+            OsiRowCut * cut = tasks[iTask].simplex->extraCuts().rowCut(i);
+            if (cut == NULL) continue;
+            if (best == NULL || cut->effectiveness() > best->effectiveness())
+                best = cut;
+        }
+        if (best == NULL) continue;
+        int code = validator_(*best, cached_.colsol_, si, params,
+                              originalColLower_, originalColUpper_);
+        if (code)
+        {
+            handler_->message(LAP_CUT_FAILED_DO_MIG, messages_)
+            <<validator_.failureString(code)<<CoinMessageEol;
+        }
+        else
+        {
+            cs.insertIfNotDuplicate(*best, eq);
+            nCut++;
+        }
+        for (int iTask = 0 ; iTask < numberTasks ; iTask++)
+            delete tasks[iTask].simplex->extraCuts().rowCut(i);
+    }
+
+    for (int iTask = 0 ; iTask < numberTasks ; iTask++)
+    {
+        SeparationTask & task = tasks[iTask];
+        task.simplex->outPivInfo(nCut);
+        if (params.pivotLimit != 0)
+            task.simplex->freeSi();
+        delete task.simplex;
+        delete task.validator;
+        delete task.cached;
+        delete task.solver;
+    }
+}
+
 
 template < class S, class T, class U >
 class StableCompare
@@ -131,6 +131,11 @@ public:
         int degeneratePivotLimit;
         /** Maximum number of extra rows to generate per round.*/
         int extraCutsLimit;
+        /** Number of threads separating cuts in a round (<=1 separate in the calling thread).
+          Each thread gets its own copy of the solver and a share of the rows and
+          timeLimit is enforced for each thread on wall clock time.
+          \default 1 */
+        int numberThreads;
         ///@}
         /// @name double parameters
         ///@{
@@ -235,6 +240,18 @@ private:
 
     void scanExtraCuts(OsiCuts& cs, const double * colsol) const;
 
+    /** What one thread separating rows needs (defined in CglLandP.cpp).*/
+    struct SeparationTask;
+    /** Separate from rows indices with numberTasks threads and add cuts to cs
+        in the order of indices.*/
+    void generateCutsInParallel(const OsiSolverInterface & si,
+                                const OsiSolverInterface & t_si,
+                                const std::vector<int> & indices,
+                                int numberTasks,
+                                const Parameters & params, OsiCuts & cs);
+    /** Separate rows indices[i] for i = task modulo number of tasks (CglRunTasks function).*/
+    static void separateTask(int task, int thread, void * data);
+
     Parameters params_;
 
     /** Some informations that will be changed by the pivots and that we want to keep*/
@@ -266,8 +283,6 @@ private:
         double * slacks_;
         /** Stores wheter slacks are integer constrained */
         bool * integers_;
-        /** Solver before pivots */
-        OsiSolverInterface * solver_;
     };
     /** Retrieve sorted integer variables which are fractional in the solution.
         Return the number of variables.*/
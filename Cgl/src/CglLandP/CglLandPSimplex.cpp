@@ -9,6 +9,7 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 //---------------------------------------------------------------------------
 #include "CglLandPSimplex.hpp"
+#include "CglTableauCache.hpp"
 #include "CoinTime.hpp"
 #ifdef COIN_HAS_OSICLP
 #include "OsiClpSolverInterface.hpp"
@@ -222,7 +223,9 @@ CglLandPSimplex::CglLandPSimplex(const OsiSolverInterface &si,
         validator_(validator),
         numPivots_(0),
         numSourceRowEntered_(0),
-        numIncreased_(0)
+        numIncreased_(0),
+        tableauCache_(NULL),
+        useWallclock_(false)
 {
     ncols_orig_ = si.getNumCols();
     nrows_orig_ = si.getNumRows();
@@ -604,7 +607,7 @@ CglLandPSimplex::generateMig(int row, OsiRowCut & cut,
                              const CglLandP::Parameters & params)
 {
     row_k_.num = row;
-    pullTableauRow(row_k_);
+    pullTableauRow(row_k_, true);
     row_k_.rhs = row_k_.rhs - floor(row_k_.rhs);
     if (params.strengthen || params.modularize)
         createMIG(row_k_, cut);
@@ -622,11 +625,12 @@ CglLandPSimplex::optimize
     int nRowFailed = 0;
 
     double timeLimit = CoinMin(params.timeLimit, params.singleCutTimeLimit);
-    timeLimit += CoinCpuTime();
+    timeLimit += useWallclock_ ? CoinGetTimeOfDay() : CoinCpuTime();
     // double timeBegin = CoinCpuTime();
     /** Copy the cached information */
     nrows_ = nrows_orig_;
     ncols_ = ncols_orig_;
+    random_.setSeed(row + 1);
     CoinCopyN(cached.basics_, nrows_, basics_);
     CoinCopyN(cached.nonBasics_, ncols_, nonBasics_);
     CoinCopyN(cached.colsol_, nrows_+ ncols_, colsol_);
@@ -634,22 +638,14 @@ CglLandPSimplex::optimize
 
     delete basis_;
     basis_ = new CoinWarmStartBasis(*cached.basis_);
-#define CACHED_SOLVER
-#ifndef CACHED_SOLVER
-    si_->enableSimplexInterface(0);
-#else
-    delete si_;
-    si_ = cached.solver_->clone();
+    /* Same solver is used for every row (resetSolver disabled simplex
+       interface) - put back optimal basis and factorize it again */
+    si_->setWarmStart(cached.basis_);
 #ifdef COIN_HAS_OSICLP
-    OsiClpSolverInterface * clpSi = dynamic_cast<OsiClpSolverInterface *>(si_);
-    OsiClpSolverInterface * clpSiRhs = dynamic_cast<OsiClpSolverInterface *>(cached.solver_);
-    if (clpSi)
-    {
-        clp_ = clpSi;
-	clpSi->getModelPtr()->copyEnabledStuff(clpSiRhs->getModelPtr());;
-    }
-#endif
+    if (clp_)
+        clp_->setBasis();
 #endif
+    si_->enableSimplexInterface(0);
 #ifdef APPEND_ROW
     if (params.modularize)
     {
@@ -670,7 +666,7 @@ CglLandPSimplex::optimize
 #endif
         row_k_.num = row;
 
-    pullTableauRow(row_k_);
+    pullTableauRow(row_k_, true);
     row_k_.rhs = row_k_.rhs - floor(row_k_.rhs);
 
     if (params.modularize)
@@ -700,7 +696,7 @@ CglLandPSimplex::optimize
     int maxTryRow = 5;
     while (  !optimal && numPivots < params.pivotLimit)
     {
-        if (timeLimit - CoinCpuTime() < 0.) break;
+        if (timeLimit - (useWallclock_ ? CoinGetTimeOfDay() : CoinCpuTime()) < 0.) break;
 
         updateM1_M2_M3(row_k_, 0., params.perturb);
         sigma_ = computeCglpObjective(row_k_);
@@ -2520,7 +2516,7 @@ CglLandPSimplex::updateM1_M2_M3(TabRow & row, double tolerance, bool perturb)
             {
                 if (perturb)   //assign to M1 or M2 at random
                 {
-                    int sign = CoinDrand48() > 0.5 ? 1 : -1;
+                    int sign = random_.randomDouble() > 0.5 ? 1 : -1;
                     if (sign == -1)   //put into M1
                     {
                         M1_.push_back(ii);
@@ -3094,7 +3090,7 @@ CglLandPSimplex::update_row(TabRow &row)
 
 /** Get the row i of the tableau */
 void
-CglLandPSimplex::pullTableauRow(TabRow &row) const
+CglLandPSimplex::pullTableauRow(TabRow &row, bool startingBasis) const
 {
     const double * rowLower = si_->getRowLower();
     const double * rowUpper = si_->getRowUpper();
@@ -3103,6 +3099,29 @@ CglLandPSimplex::pullTableauRow(TabRow &row) const
     row.modularized_ = false;
     double infty = si_->getInfinity();
     /* Get the row */
+    const double * cachedRow = NULL;
+    if (startingBasis && tableauCache_ &&
+        tableauCache_->numberColumns() == ncols_ &&
+        tableauCache_->numberRows() == nrows_ &&
+        tableauCache_->haveRow(basics_[row.num]))
+        cachedRow = tableauCache_->row(*si_, basics_[row.num]);
+    if (cachedRow)
+    {
+        // same layout as getBInvARow (and indices as the sparse version)
+        int * indices = row.getIndices();
+        double * elements = row.denseVector();
+        int n = 0;
+        for (int i = 0 ; i < ncols_ + nrows_ ; i++)
+        {
+            if (cachedRow[i])
+            {
+                elements[i] = cachedRow[i];
+                indices[n++] = i;
+            }
+        }
+        row.setNumElements(n);
+    }
+    else
 #ifdef COIN_HAS_OSICLP
     if (clp_)
     {
@@ -22,6 +22,7 @@
 #include "CoinMessageHandler.hpp"
 #include "CoinWarmStartBasis.hpp"
 #include "CoinPackedMatrix.hpp"
+#include "CoinHelperFunctions.hpp"
 
 #ifdef COIN_HAS_OSICLP
 #include "OsiClpSolverInterface.hpp"
@@ -34,6 +35,8 @@
 //#define APPEND_ROW
 #define OLD_COMPUTATION
 
+class CglTableauCache;
+
 namespace LAP
 {
 /** Forward declaration of class to store extra debug data.*/
@@ -87,6 +90,17 @@ public:
         }
 #endif
     }
+    /** Set tableau rows for the starting basis (may be NULL, not owned).*/
+    void setTableauCache(CglTableauCache * cache)
+    {
+        tableauCache_ = cache;
+    }
+    /** Measure singleCutTimeLimit on wall clock rather than process cpu time
+        (cpu time counts all threads).*/
+    void setUseWallclock(bool yesNo)
+    {
+        useWallclock_ = yesNo;
+    }
     void freeSi()
     {
         assert(si_ != NULL);
@@ -195,8 +209,10 @@ protected:
     //  void createIntersectionCut(double * row);
     /** Create MIG cut from row k*/
     void createMIG( TabRow & row, OsiRowCut &cut) const;
-    /** Get the row i of the tableau */
-    void pullTableauRow(TabRow & row) const;
+    /** Get the row i of the tableau.
+        If si_ is still at the starting basis (startingBasis true) the row
+        is taken from the tableau cache if it is there.*/
+    void pullTableauRow(TabRow & row, bool startingBasis = false) const;
     /** Adjust the row of the tableau to reflect leaving variable direction */
     void adjustTableauRow(int var, TabRow & row, int direction);
     /** reset the tableau row after a call to adjustTableauRow */
@@ -386,6 +402,13 @@ private:
     int numSourceRowEntered_;
     /** Record the number of times that sigma increased.*/
     int numIncreased_;
+    /** Shared tableau rows for the starting basis (not owned).*/
+    CglTableauCache * tableauCache_;
+    /** Time limits on wall clock */
+    bool useWallclock_;
+    /** Random numbers for perturbation (seeded from source row so that
+        cut from a row does not depend on rows separated before).*/
+    CoinThreadRandom random_;
 
     /** Message handler. */
     CoinMessageHandler * handler_;
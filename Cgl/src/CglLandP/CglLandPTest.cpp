@@ -6,6 +6,7 @@
 // UnitTest for CglGomory adapted for lift-and-project
 
 #include <cstdio>
+#include <cstring>
 
 #ifdef NDEBUG
 #undef NDEBUG
@@ -18,6 +19,7 @@
 #include "OsiCuts.hpp"
 #include "CoinWarmStartBasis.hpp"
 #include "CglLandP.hpp"
+#include "CglTableauCache.hpp"
 
 void
 CglLandPUnitTest(
@@ -230,6 +232,58 @@ CglLandPUnitTest(
 
         delete siP;
     }
+    if (1)  //Test separating with several threads gives same cuts
+    {
+        const char * models[] = {"p0033","p0201","lseu"};
+        for (int iModel = 0 ; iModel < 3 ; iModel++)
+        {
+            OsiSolverInterface  * siP = si->clone();
+            std::string fn(mpsDir+models[iModel]);
+            siP->readMps(fn.c_str(),"mps");
+            siP->initialSolve();
+            // generateCuts leaves solver in a different state so each run
+            // starts from a resolved clone
+            OsiSolverInterface  * siRun = siP->clone();
+            siRun->resolve();
+            OsiCuts cuts;
+            CglLandP test;
+            test.generateCuts(*siRun,cuts);
+            delete siRun;
+            int nRowCuts = cuts.sizeRowCuts();
+            assert(nRowCuts > 0);
+            for (int numberThreads = 2 ; numberThreads <= 4 ; numberThreads += 2)
+            {
+                siRun = siP->clone();
+                siRun->resolve();
+                OsiCuts cutsThreaded;
+                CglLandP testThreaded;
+                testThreaded.parameter().numberThreads = numberThreads;
+                testThreaded.generateCuts(*siRun,cutsThreaded);
+                delete siRun;
+                // rows are merged in the same order so cuts should be the same
+                assert(cutsThreaded.sizeRowCuts() == nRowCuts);
+                for (int i = 0 ; i < nRowCuts ; i++)
+                {
+                    const OsiRowCut & cut = cuts.rowCut(i);
+                    const OsiRowCut & cutThreaded = cutsThreaded.rowCut(i);
+                    int n = cut.row().getNumElements();
+                    assert(cutThreaded.row().getNumElements() == n);
+                    assert(!memcmp(cut.row().getIndices(),cutThreaded.row().getIndices(),
+                                   n*sizeof(int)));
+                    assert(!memcmp(cut.row().getElements(),cutThreaded.row().getElements(),
+                                   n*sizeof(double)));
+                    assert(cut.lb() == cutThreaded.lb() && cut.ub() == cutThreaded.ub());
+                }
+            }
+            if (!iModel)
+            {
+                siP->applyCuts(cuts);
+                siP->resolve();
+                assert( siP->getObjValue() > 2840. );
+            }
+            delete siP;
+        }
+    }
     if (1)  //test again with modularization
     {
         // Setup
@@ -349,4 +403,37 @@ CglLandPUnitTest(
 
         delete siP;
     }
+
+    if (1)  //test with shared tableau rows
+    {
+        const char * models[] = {"p0033","p0201","lseu"};
+        for (int iModel = 0; iModel < 3; iModel++)
+        {
+            OsiSolverInterface  * siP = si->clone();
+            siP->messageHandler()->setLogLevel(0);
+            std::string fn(mpsDir+models[iModel]);
+            siP->readMps(fn.c_str(),"mps");
+            siP->initialSolve();
+
+            CglLandP test;
+            OsiCuts cuts;
+            test.generateCuts(*siP, cuts);
+            assert(cuts.sizeRowCuts() > 0);
+
+            CglTableauCache cache(2);
+            CglTreeInfo info;
+            info.tableauCache = &cache;
+            OsiCuts cutsCached;
+            test.generateCuts(*siP, cutsCached, info);
+            assert(cutsCached.sizeRowCuts() == cuts.sizeRowCuts());
+            // same cuts up to rounding (order is not fixed)
+            for (int i = 0; i < cutsCached.sizeRowCuts(); i++)
+                assert(cuts.isDuplicate(cutsCached.rowCut(i),
+                                        CoinAbsFltEq(1.0e-7)));
+            // starting rows were computed up front
+            assert(cache.numberMisses() == 0);
+            assert(cache.numberHits() > 0);
+            delete siP;
+        }
+    }
 }
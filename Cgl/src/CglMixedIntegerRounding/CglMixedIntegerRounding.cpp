@@ -29,6 +29,10 @@ CglMixedIntegerRounding::generateCuts(const OsiSolverInterface& si,
 				      const CglTreeInfo )
 {
 
+  // Bring shared analysis up to date
+  if (modelStructure_)
+    modelStructure_->update(si);
+
   // If the LP or integer presolve is used, then need to redo preprocessing
   // everytime this function is called. Otherwise, just do once.
   bool preInit = false;
@@ -43,7 +47,10 @@ CglMixedIntegerRounding::generateCuts(const OsiSolverInterface& si,
   }
   else {
     if(doPreproc_ == 1){ // Do everytime       
-      mixIntRoundPreprocess(si);
+      // unless shared structure says nothing can have changed
+      if (!modelStructure_||structureVersion_!=modelStructure_->version()||
+	  modelStructure_->numberRanged())
+	mixIntRoundPreprocess(si);
       doneInitPre_ = true;
     } 
     else {
@@ -58,12 +65,23 @@ CglMixedIntegerRounding::generateCuts(const OsiSolverInterface& si,
   const double* colUpperBound = si.getColUpper();  // vector of upper bounds
   const double* colLowerBound = si.getColLower();  // vector of lower bounds
 
-  // get matrix by row
-  const CoinPackedMatrix & tempMatrixByRow = *si.getMatrixByRow();
-  CoinPackedMatrix matrixByRow;
-  matrixByRow.submatrixOf(tempMatrixByRow, numRows_, indRows_);
-  CoinPackedMatrix matrixByCol = matrixByRow;
-  matrixByCol.reverseOrdering();
+  // get matrix by row (shared copies are of same rows if versions match)
+  CoinPackedMatrix ownMatrixByRow;
+  CoinPackedMatrix ownMatrixByCol;
+  const CoinPackedMatrix * rowCopy = &ownMatrixByRow;
+  const CoinPackedMatrix * columnCopy = &ownMatrixByCol;
+  if (modelStructure_&&structureVersion_==modelStructure_->version()&&
+      numRows_==modelStructure_->numberRows()) {
+    rowCopy = modelStructure_->rowCopy();
+    columnCopy = modelStructure_->columnCopy();
+  } else {
+    const CoinPackedMatrix & tempMatrixByRow = *si.getMatrixByRow();
+    ownMatrixByRow.submatrixOf(tempMatrixByRow, numRows_, indRows_);
+    ownMatrixByCol = ownMatrixByRow;
+    ownMatrixByCol.reverseOrdering();
+  }
+  const CoinPackedMatrix & matrixByRow = *rowCopy;
+  const CoinPackedMatrix & matrixByCol = *columnCopy;
   //const CoinPackedMatrix & matrixByRow = *si.getMatrixByRow();
   const double* LHS        = si.getRowActivity();
   const double* coefByRow  = matrixByRow.getElements();
@@ -206,6 +224,7 @@ CglMixedIntegerRounding::gutsOfConstruct (const int maxaggr,
   indRowContVB_ = 0;
   sense_=NULL;
   RHS_=NULL;
+  structureVersion_=-1;
 }
 
 //-------------------------------------------------------------------
@@ -246,6 +265,7 @@ CglMixedIntegerRounding::gutsOfCopy (const CglMixedIntegerRounding& rhs)
   numRowCont_ = rhs.numRowCont_;
   numRowInt_ = rhs.numRowInt_;
   numRowContVB_ = rhs.numRowContVB_;
+  structureVersion_ = rhs.structureVersion_;
 
   if (numCols_ > 0) {
     vubs_ = new CglMixIntRoundVUB [numCols_];
@@ -311,8 +331,14 @@ void
 CglMixedIntegerRounding::
 mixIntRoundPreprocess(const OsiSolverInterface& si)
 {
+  // Row counts and variable bounds may come from shared structure
+  const CglModelStructure * structure = usableStructure(si);
+  structureVersion_ = structure ? structure->version() : -1;
+  // Bounds can be taken as they are if no ranges
+  bool structureBounds = structure&&!structure->numberRanged();
   // get matrix stored by row
-  const CoinPackedMatrix & matrixByRow = *si.getMatrixByRow();
+  const CoinPackedMatrix & matrixByRow = structure ?
+    *structure->rowCopy() : *si.getMatrixByRow();
   numRows_ = si.getNumRows();
   numCols_ = si.getNumCols();
   const double* coefByRow  = matrixByRow.getElements();
@@ -363,7 +389,8 @@ mixIntRoundPreprocess(const OsiSolverInterface& si)
     // get the type of a row
     const RowType rowType = 
       determineRowType(si, rowLengths[iRow], colInds+rowStarts[iRow],
-		       coefByRow+rowStarts[iRow], sense_[iRow], RHS_[iRow]);
+		       coefByRow+rowStarts[iRow], sense_[iRow], RHS_[iRow],
+		       structure ? &structure->rowCounts(iRow) : NULL);
     // store the type of the current row
     rowTypes_[iRow] = rowType;
 
@@ -472,6 +499,9 @@ mixIntRoundPreprocess(const OsiSolverInterface& si)
       countI++;
     }
     // create vectors with variable lower and upper bounds
+    else if (structureBounds) {
+      // done below
+    }
     else if ( (rowType == ROW_VARUB) || 
 	      (rowType == ROW_VARLB) || 
 	      (rowType == ROW_VAREQ) )  { 
@@ -519,6 +549,21 @@ mixIntRoundPreprocess(const OsiSolverInterface& si)
     }
   }
 
+  if (structureBounds) {
+    for (int iCol = 0; iCol < numCols_; ++iCol) {
+      int yInd = structure->upperBoundColumn(iCol);
+      if (yInd>=0) {
+	vubs_[iCol].setVar(yInd);
+	vubs_[iCol].setVal(structure->upperBoundValue(iCol));
+      }
+      yInd = structure->lowerBoundColumn(iCol);
+      if (yInd>=0) {
+	vlbs_[iCol].setVar(yInd);
+	vlbs_[iCol].setVal(structure->lowerBoundValue(iCol));
+      }
+    }
+  }
+
   // allocate memory for vector of indices of rows of type ROW_CONT
   // that have at least one variable with variable upper or lower bound
   if (indRowContVB_ != 0) { delete [] indRowContVB_; indRowContVB_ = 0; }
@@ -546,6 +591,22 @@ mixIntRoundPreprocess(const OsiSolverInterface& si)
 
 }
 
+//-------------------------------------------------------------------
+// Model structure to use in preprocessing (NULL if none or not usable)
+//-------------------------------------------------------------------
+const CglModelStructure *
+CglMixedIntegerRounding::usableStructure(const OsiSolverInterface& si) const
+{
+  const CglModelStructure * structure = modelStructure_;
+  // must be up to date and count zeros as we do
+  if (structure&&(!structure->valid()||
+		  structure->numberRows()!=si.getNumRows()||
+		  structure->numberColumns()!=si.getNumCols()||
+		  structure->epsilon()!=EPSILON_))
+    structure=NULL;
+  return structure;
+}
+
 //-------------------------------------------------------------------
 // Determine the type of a given row 
 //-------------------------------------------------------------------
@@ -553,7 +614,8 @@ CglMixedIntegerRounding::RowType
 CglMixedIntegerRounding::determineRowType(const OsiSolverInterface& si,
 				  const int rowLen, const int* ind, 
 				  const double* coef, const char sense, 
-				  const double rhs) const
+				  const double rhs,
+				  const CglModelStructure::RowCounts * counts) const
 {
   if (rowLen == 0) 
     return ROW_UNDEFINED;
@@ -571,19 +633,27 @@ CglMixedIntegerRounding::determineRowType(const OsiSolverInterface& si,
   int  numCon    = 0;      // num of continuous variables
 
 
-  // Summarize the variable types of the given row.
-  for ( int i = 0; i < rowLen; ++i ) {
-    if ( coef[i] < -EPSILON_ ) {
-      if( si.isInteger(ind[i]) )
-	++numNegInt;
-      else
-	++numNegCon;
-    }
-    else if ( coef[i] > EPSILON_ ) {
-      if( si.isInteger(ind[i]) )
-	++numPosInt;
-      else
-	++numPosCon;
+  if (counts) {
+    // already summarized
+    numNegInt = counts->negative[1] + counts->negative[2];
+    numPosInt = counts->positive[1] + counts->positive[2];
+    numNegCon = counts->negative[0];
+    numPosCon = counts->positive[0];
+  } else {
+    // Summarize the variable types of the given row.
+    for ( int i = 0; i < rowLen; ++i ) {
+      if ( coef[i] < -EPSILON_ ) {
+	if( si.isInteger(ind[i]) )
+	  ++numNegInt;
+	else
+	  ++numNegCon;
+      }
+      else if ( coef[i] > EPSILON_ ) {
+	if( si.isInteger(ind[i]) )
+	  ++numPosInt;
+	else
+	  ++numPosCon;
+      }
     }
   }
   numInt = numNegInt + numPosInt;
@@ -19,6 +19,7 @@
 #include "CoinError.hpp"
 
 #include "CglCutGenerator.hpp"
+#include "CglModelStructure.hpp"
 
 //=============================================================================
 
@@ -148,6 +149,9 @@ public:
 
   /// Clone
   virtual CglCutGenerator * clone() const;
+  /// Can be run on a thread at same time as other generators
+  virtual bool threadSafe() const
+  { return true;}
 
   /// Assignment operator 
   CglMixedIntegerRounding &
@@ -230,11 +234,16 @@ private:
   // It may change sense and RHS for ranged rows
   void mixIntRoundPreprocess(const OsiSolverInterface& si);
 
+  // Model structure to use in preprocessing (NULL if none or not usable)
+  const CglModelStructure * usableStructure(const OsiSolverInterface& si) const;
+
   // Determine the type of a given row.
+  // If counts given they are used instead of looking at coefficients.
   RowType determineRowType(const OsiSolverInterface& si,
 			   const int rowLen, const int* ind, 
 			   const double* coef, const char sense, 
-			   const double rhs) const;
+			   const double rhs,
+			   const CglModelStructure::RowCounts * counts=NULL) const;
 
   // Generate MIR cuts
   void generateMirCuts( const OsiSolverInterface& si,
@@ -414,6 +423,8 @@ private:
   char * sense_;
   // RHS of rows (modified if ranges)
   double * RHS_;
+  // Version of model structure used in preprocessing (-1 if none)
+  int structureVersion_;
   
 };
 
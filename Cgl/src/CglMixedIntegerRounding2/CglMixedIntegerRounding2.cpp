@@ -29,6 +29,10 @@ CglMixedIntegerRounding2::generateCuts(const OsiSolverInterface& si,
 				      const CglTreeInfo info)
 {
 
+  // Bring shared analysis up to date
+  if (modelStructure_)
+    modelStructure_->update(si);
+
   // If the LP or integer presolve is used, then need to redo preprocessing
   // everytime this function is called. Otherwise, just do once.
   bool preInit = false;
@@ -44,7 +48,10 @@ CglMixedIntegerRounding2::generateCuts(const OsiSolverInterface& si,
   }
   else {
     if(doPreproc_ == 1){ // Do everytime       
-      mixIntRoundPreprocess(si);
+      // unless shared structure says nothing can have changed
+      if (!modelStructure_||structureVersion_!=modelStructure_->version()||
+	  modelStructure_->numberRanged())
+	mixIntRoundPreprocess(si);
       doneInitPre_ = true;
     } 
     else {
@@ -60,12 +67,23 @@ CglMixedIntegerRounding2::generateCuts(const OsiSolverInterface& si,
   const double* colUpperBound = si.getColUpper();  // vector of upper bounds
   const double* colLowerBound = si.getColLower();  // vector of lower bounds
 
-  // get matrix by row
-  const CoinPackedMatrix & tempMatrixByRow = *si.getMatrixByRow();
-  CoinPackedMatrix matrixByRow(false,0.0,0.0);
-  // There are no duplicates but this is faster
-  matrixByRow.submatrixOfWithDuplicates(tempMatrixByRow, numRows_, indRows_);
-  CoinPackedMatrix matrixByCol(matrixByRow,0,0,true);
+  // get matrix by row (shared copies are of same rows if versions match)
+  CoinPackedMatrix ownMatrixByRow(false,0.0,0.0);
+  CoinPackedMatrix ownMatrixByCol;
+  const CoinPackedMatrix * rowCopy = &ownMatrixByRow;
+  const CoinPackedMatrix * columnCopy = &ownMatrixByCol;
+  if (modelStructure_&&structureVersion_==modelStructure_->version()&&
+      numRows_==modelStructure_->numberRows()) {
+    rowCopy = modelStructure_->rowCopy();
+    columnCopy = modelStructure_->columnCopy();
+  } else {
+    const CoinPackedMatrix & tempMatrixByRow = *si.getMatrixByRow();
+    // There are no duplicates but this is faster
+    ownMatrixByRow.submatrixOfWithDuplicates(tempMatrixByRow, numRows_, indRows_);
+    ownMatrixByCol.reverseOrderedCopyOf(ownMatrixByRow);
+  }
+  const CoinPackedMatrix & matrixByRow = *rowCopy;
+  const CoinPackedMatrix & matrixByCol = *columnCopy;
   //matrixByCol.reverseOrdering();
   //const CoinPackedMatrix & matrixByRow = *si.getMatrixByRow();
   const double* LHS        = si.getRowActivity();
@@ -214,6 +232,7 @@ CglMixedIntegerRounding2::gutsOfConstruct (const int maxaggr,
   integerType_ = NULL;
   sense_=NULL;
   RHS_=NULL;
+  structureVersion_=-1;
 }
 
 //-------------------------------------------------------------------
@@ -255,6 +274,7 @@ CglMixedIntegerRounding2::gutsOfCopy (const CglMixedIntegerRounding2& rhs)
   numRowCont_ = rhs.numRowCont_;
   numRowInt_ = rhs.numRowInt_;
   numRowContVB_ = rhs.numRowContVB_;
+  structureVersion_ = rhs.structureVersion_;
 
   if (numCols_ > 0) {
     vubs_ = new CglMixIntRoundVUB2 [numCols_];
@@ -322,8 +342,15 @@ void
 CglMixedIntegerRounding2::
 mixIntRoundPreprocess(const OsiSolverInterface& si)
 {
+  // Row counts, integer types and variable bounds may come from
+  // shared structure
+  const CglModelStructure * structure = usableStructure(si);
+  structureVersion_ = structure ? structure->version() : -1;
+  // Bounds can be taken as they are if no ranges
+  bool structureBounds = structure&&!structure->numberRanged();
   // get matrix stored by row
-  const CoinPackedMatrix & matrixByRow = *si.getMatrixByRow();
+  const CoinPackedMatrix & matrixByRow = structure ?
+    *structure->rowCopy() : *si.getMatrixByRow();
   numRows_ = si.getNumRows();
   numCols_ = si.getNumCols();
   const double* coefByRow  = matrixByRow.getElements();
@@ -342,11 +369,17 @@ mixIntRoundPreprocess(const OsiSolverInterface& si)
     delete [] integerType_;
   integerType_ = new char [numCols_];
   int iColumn;
-  for (iColumn=0;iColumn<numCols_;iColumn++) {
-    if (si.isInteger(iColumn))
-      integerType_[iColumn]=1;
-    else
-      integerType_[iColumn]=0;
+  if (structure) {
+    const char * columnType = structure->columnType();
+    for (iColumn=0;iColumn<numCols_;iColumn++) 
+      integerType_[iColumn] = columnType[iColumn] ? 1 : 0;
+  } else {
+    for (iColumn=0;iColumn<numCols_;iColumn++) {
+      if (si.isInteger(iColumn))
+	integerType_[iColumn]=1;
+      else
+	integerType_[iColumn]=0;
+    }
   }
 
   if (rowTypes_ != 0) {
@@ -385,7 +418,8 @@ mixIntRoundPreprocess(const OsiSolverInterface& si)
     // get the type of a row
     const RowType rowType = 
       determineRowType(/*si,*/ rowLengths[iRow], colInds+rowStarts[iRow],
-		       coefByRow+rowStarts[iRow], sense_[iRow], RHS_[iRow]);
+		       coefByRow+rowStarts[iRow], sense_[iRow], RHS_[iRow],
+		       structure ? &structure->rowCounts(iRow) : NULL);
     // store the type of the current row
     rowTypes_[iRow] = rowType;
 
@@ -494,6 +528,9 @@ mixIntRoundPreprocess(const OsiSolverInterface& si)
       countI++;
     }
     // create vectors with variable lower and upper bounds
+    else if (structureBounds) {
+      // done below
+    }
     else if ( (rowType == ROW_VARUB) || 
 	      (rowType == ROW_VARLB) || 
 	      (rowType == ROW_VAREQ) )  { 
@@ -541,6 +578,21 @@ mixIntRoundPreprocess(const OsiSolverInterface& si)
     }
   }
 
+  if (structureBounds) {
+    for (int iCol = 0; iCol < numCols_; ++iCol) {
+      int yInd = structure->upperBoundColumn(iCol);
+      if (yInd>=0) {
+	vubs_[iCol].setVar(yInd);
+	vubs_[iCol].setVal(structure->upperBoundValue(iCol));
+      }
+      yInd = structure->lowerBoundColumn(iCol);
+      if (yInd>=0) {
+	vlbs_[iCol].setVar(yInd);
+	vlbs_[iCol].setVal(structure->lowerBoundValue(iCol));
+      }
+    }
+  }
+
   // allocate memory for vector of indices of rows of type ROW_CONT
   // that have at least one variable with variable upper or lower bound
   if (indRowContVB_ != 0) { delete [] indRowContVB_; indRowContVB_ = 0; }
@@ -568,6 +620,22 @@ mixIntRoundPreprocess(const OsiSolverInterface& si)
 
 }
 
+//-------------------------------------------------------------------
+// Model structure to use in preprocessing (NULL if none or not usable)
+//-------------------------------------------------------------------
+const CglModelStructure *
+CglMixedIntegerRounding2::usableStructure(const OsiSolverInterface& si) const
+{
+  const CglModelStructure * structure = modelStructure_;
+  // must be up to date and count zeros as we do
+  if (structure&&(!structure->valid()||
+		  structure->numberRows()!=si.getNumRows()||
+		  structure->numberColumns()!=si.getNumCols()||
+		  structure->epsilon()!=EPSILON_))
+    structure=NULL;
+  return structure;
+}
+
 //-------------------------------------------------------------------
 // Determine the type of a given row 
 //-------------------------------------------------------------------
@@ -575,7 +643,8 @@ CglMixedIntegerRounding2::RowType
 CglMixedIntegerRounding2::determineRowType(//const OsiSolverInterface& si,
 				  const int rowLen, const int* ind, 
 				  const double* coef, const char sense, 
-				  const double rhs) const
+				  const double rhs,
+				  const CglModelStructure::RowCounts * counts) const
 {
   if (rowLen == 0 || fabs(rhs) > 1.0e20) 
     return ROW_UNDEFINED;
@@ -590,19 +659,27 @@ CglMixedIntegerRounding2::determineRowType(//const OsiSolverInterface& si,
   int  numCon    = 0;      // num of continuous variables
 
 
-  // Summarize the variable types of the given row.
-  for ( int i = 0; i < rowLen; ++i ) {
-    if ( coef[i] < -EPSILON_ ) {
-      if( integerType_[ind[i]] )
-	++numNegInt;
-      else
-	++numNegCon;
-    }
-    else if ( coef[i] > EPSILON_ ) {
-      if( integerType_[ind[i]] )
-	++numPosInt;
-      else
-	++numPosCon;
+  if (counts) {
+    // already summarized
+    numNegInt = counts->negative[1] + counts->negative[2];
+    numPosInt = counts->positive[1] + counts->positive[2];
+    numNegCon = counts->negative[0];
+    numPosCon = counts->positive[0];
+  } else {
+    // Summarize the variable types of the given row.
+    for ( int i = 0; i < rowLen; ++i ) {
+      if ( coef[i] < -EPSILON_ ) {
+	if( integerType_[ind[i]] )
+	  ++numNegInt;
+	else
+	  ++numNegCon;
+      }
+      else if ( coef[i] > EPSILON_ ) {
+	if( integerType_[ind[i]] )
+	  ++numPosInt;
+	else
+	  ++numPosCon;
+      }
     }
   }
   numInt = numNegInt + numPosInt;
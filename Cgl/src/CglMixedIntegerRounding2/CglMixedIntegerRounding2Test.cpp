@@ -11,6 +11,7 @@
 #include <cassert>
 #include "CoinPragma.hpp"
 #include "CglMixedIntegerRounding2.hpp"
+#include "CglModelStructure.hpp"
 
 
 void
@@ -95,5 +96,70 @@ CglMixedIntegerRounding2UnitTest(const OsiSolverInterface *baseSiP,
     delete siP;
   }
 
+  // Test sharing model structure
+  {
+    OsiSolverInterface  *siP = baseSiP->clone();
+    std::string fn = mpsDir+"capPlan1";
+    std::string fn2 = mpsDir+"capPlan1.mps";
+    FILE *in_f = fopen(fn2.c_str(), "r");
+    if(in_f == NULL) {
+      std::cout<<"Can not open file "<<fn2<<std::endl<<"Skip test of CglModelStructure"<<std::endl;
+    }
+    else {
+      fclose(in_f);
+      siP->readMps(fn.c_str(),"mps");
+      siP->initialSolve();
+      CglModelStructure structure;
+      assert (structure.update(*siP));
+      int version = structure.version();
+      assert (!structure.update(*siP));
+      assert (structure.version()==version);
+      int numberRows = siP->getNumRows();
+      const CoinPackedMatrix * rowCopy = structure.rowCopy();
+      int iRow;
+      for (iRow=0;iRow<numberRows;iRow++) {
+	const CglModelStructure::RowCounts & counts = structure.rowCounts(iRow);
+	int n=0;
+	for (int i=0;i<3;i++)
+	  n += counts.positive[i]+counts.negative[i]+counts.zero[i];
+	assert (n==rowCopy->getVectorLengths()[iRow]);
+      }
+      assert (structure.numberIntegers()+structure.numberContinuous()==
+	      siP->getNumCols());
+      const char * columnType = structure.columnType();
+      for (int iColumn=0;iColumn<siP->getNumCols();iColumn++) {
+	int jColumn = structure.upperBoundColumn(iColumn);
+	if (jColumn>=0) {
+	  assert (!columnType[iColumn]);
+	  assert (columnType[jColumn]);
+	}
+      }
+      // Same cuts whether shared or not (second pass skips preprocessing)
+      CglMixedIntegerRounding2 mir;
+      mir.setDoPreproc(1);
+      CglMixedIntegerRounding2 shared(mir);
+      shared.setModelStructure(&structure);
+      for (int pass=0;pass<2;pass++) {
+	OsiCuts cs1;
+	OsiCuts cs2;
+	mir.generateCuts(*siP, cs1);
+	shared.generateCuts(*siP, cs2);
+	assert (cs1.sizeRowCuts()>0);
+	assert (cs1.sizeRowCuts()==cs2.sizeRowCuts());
+	for (int j=0;j<cs1.sizeRowCuts();j++) 
+	  assert (cs1.rowCut(j)==cs2.rowCut(j));
+      }
+      assert (structure.version()==version);
+      // New row means analysis redone
+      int column[2]={0,1};
+      double element[2]={1.0,1.0};
+      siP->addRow(2,column,element,-siP->getInfinity(),1.0e5);
+      assert (structure.update(*siP));
+      assert (structure.version()==version+1);
+      assert (structure.numberRows()==numberRows+1);
+    }
+    delete siP;
+  }
+
 }
 
@@ -0,0 +1,266 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cmath>
+#include <cstring>
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CglModelStructure.hpp"
+
+//-------------------------------------------------------------------
+// Bring up to date with si
+//-------------------------------------------------------------------
+bool
+CglModelStructure::update(const OsiSolverInterface & si)
+{
+  if (valid_&&sameFormulation(si))
+    return false;
+  analyze(si);
+  return true;
+}
+
+// True if si has same formulation
+bool
+CglModelStructure::sameFormulation(const OsiSolverInterface & si) const
+{
+  if (si.getNumRows()!=numberRows_||si.getNumCols()!=numberColumns_||
+      si.getNumElements()!=numberElements_)
+    return false;
+  const double * rowLower = si.getRowLower();
+  const double * rowUpper = si.getRowUpper();
+  for (int iRow=0;iRow<numberRows_;iRow++) {
+    if (rowLower[iRow]!=rowLower_[iRow]||rowUpper[iRow]!=rowUpper_[iRow])
+      return false;
+  }
+  // bounds can make an integer binary
+  const char * columnType = si.getColType(true);
+  return !memcmp(columnType,columnType_,numberColumns_);
+}
+
+//-------------------------------------------------------------------
+// Does analysis
+//-------------------------------------------------------------------
+void
+CglModelStructure::analyze(const OsiSolverInterface & si)
+{
+  gutsOfDelete();
+  numberRows_ = si.getNumRows();
+  numberColumns_ = si.getNumCols();
+  numberElements_ = si.getNumElements();
+  rowCopy_ = *si.getMatrixByRow();
+  rowCopy_.removeGaps();
+  columnCopy_.reverseOrderedCopyOf(rowCopy_);
+  rowLower_ = CoinCopyOfArray(si.getRowLower(),numberRows_);
+  rowUpper_ = CoinCopyOfArray(si.getRowUpper(),numberRows_);
+  columnType_ = CoinCopyOfArray(si.getColType(true),numberColumns_);
+  integerColumns_ = new int [numberColumns_+1];
+  numberIntegers_=0;
+  int iColumn;
+  for (iColumn=0;iColumn<numberColumns_;iColumn++) {
+    if (columnType_[iColumn])
+      integerColumns_[numberIntegers_++]=iColumn;
+  }
+  continuousColumns_ = integerColumns_+numberIntegers_;
+  int numberContinuous=0;
+  for (iColumn=0;iColumn<numberColumns_;iColumn++) {
+    if (!columnType_[iColumn])
+      continuousColumns_[numberContinuous++]=iColumn;
+  }
+  upperBoundColumn_ = new int [numberColumns_];
+  upperBoundValue_ = new double [numberColumns_];
+  lowerBoundColumn_ = new int [numberColumns_];
+  lowerBoundValue_ = new double [numberColumns_];
+  CoinFillN(upperBoundColumn_,numberColumns_,-1);
+  CoinZeroN(upperBoundValue_,numberColumns_);
+  CoinFillN(lowerBoundColumn_,numberColumns_,-1);
+  CoinZeroN(lowerBoundValue_,numberColumns_);
+  rowCounts_ = new RowCounts [numberRows_];
+  const double * element = rowCopy_.getElements();
+  const int * column = rowCopy_.getIndices();
+  const CoinBigIndex * rowStart = rowCopy_.getVectorStarts();
+  const char * sense = si.getRowSense();
+  const double * rhs = si.getRightHandSide();
+  double infinity = si.getInfinity();
+  numberRanged_=0;
+  for (int iRow=0;iRow<numberRows_;iRow++) {
+    RowCounts & counts = rowCounts_[iRow];
+    memset(&counts,0,sizeof(RowCounts));
+    for (CoinBigIndex j=rowStart[iRow];j<rowStart[iRow+1];j++) {
+      int type = columnType_[column[j]];
+      double value = element[j];
+      if (value>epsilon_)
+	counts.positive[type]++;
+      else if (value<-epsilon_)
+	counts.negative[type]++;
+      else
+	counts.zero[type]++;
+    }
+    if (sense[iRow]=='R')
+      numberRanged_++;
+    if (sense[iRow]=='R'||sense[iRow]=='N'||fabs(rhs[iRow])>epsilon_||
+	rhs[iRow]==infinity||rhs[iRow]==-infinity)
+      continue;
+    int nContinuous = counts.positive[0]+counts.negative[0];
+    int nInteger = counts.positive[1]+counts.negative[1]+
+      counts.positive[2]+counts.negative[2];
+    if (nContinuous!=1||nInteger!=1)
+      continue;
+    // x continuous, y integer
+    int xColumn=-1;
+    int yColumn=-1;
+    double xValue=0.0;
+    double yValue=0.0;
+    for (CoinBigIndex j=rowStart[iRow];j<rowStart[iRow+1];j++) {
+      double value = element[j];
+      if (fabs(value)>epsilon_) {
+	if (columnType_[column[j]]) {
+	  yColumn = column[j];
+	  yValue = value;
+	} else {
+	  xColumn = column[j];
+	  xValue = value;
+	}
+      }
+    }
+    double bound = -yValue/xValue;
+    bool upper = sense[iRow]=='E'||((sense[iRow]=='L')==(xValue>0.0));
+    bool lower = sense[iRow]=='E'||!upper;
+    if (upper) {
+      upperBoundColumn_[xColumn]=yColumn;
+      upperBoundValue_[xColumn]=bound;
+    }
+    if (lower) {
+      lowerBoundColumn_[xColumn]=yColumn;
+      lowerBoundValue_[xColumn]=bound;
+    }
+  }
+  version_++;
+  valid_=true;
+}
+
+// Copies in rhs
+void
+CglModelStructure::gutsOfCopy(const CglModelStructure & rhs)
+{
+  rowCopy_ = rhs.rowCopy_;
+  columnCopy_ = rhs.columnCopy_;
+  epsilon_ = rhs.epsilon_;
+  numberRows_ = rhs.numberRows_;
+  numberColumns_ = rhs.numberColumns_;
+  numberElements_ = rhs.numberElements_;
+  numberIntegers_ = rhs.numberIntegers_;
+  numberRanged_ = rhs.numberRanged_;
+  version_ = rhs.version_;
+  valid_ = rhs.valid_;
+  if (rhs.rowCounts_) {
+    rowLower_ = CoinCopyOfArray(rhs.rowLower_,numberRows_);
+    rowUpper_ = CoinCopyOfArray(rhs.rowUpper_,numberRows_);
+    columnType_ = CoinCopyOfArray(rhs.columnType_,numberColumns_);
+    integerColumns_ = CoinCopyOfArray(rhs.integerColumns_,numberColumns_+1);
+    continuousColumns_ = integerColumns_+numberIntegers_;
+    rowCounts_ = CoinCopyOfArray(rhs.rowCounts_,numberRows_);
+    upperBoundColumn_ = CoinCopyOfArray(rhs.upperBoundColumn_,numberColumns_);
+    upperBoundValue_ = CoinCopyOfArray(rhs.upperBoundValue_,numberColumns_);
+    lowerBoundColumn_ = CoinCopyOfArray(rhs.lowerBoundColumn_,numberColumns_);
+    lowerBoundValue_ = CoinCopyOfArray(rhs.lowerBoundValue_,numberColumns_);
+  }
+}
+
+// Frees arrays
+void
+CglModelStructure::gutsOfDelete()
+{
+  delete [] rowLower_;
+  delete [] rowUpper_;
+  delete [] columnType_;
+  delete [] integerColumns_;
+  delete [] rowCounts_;
+  delete [] upperBoundColumn_;
+  delete [] upperBoundValue_;
+  delete [] lowerBoundColumn_;
+  delete [] lowerBoundValue_;
+  rowLower_=NULL;
+  rowUpper_=NULL;
+  columnType_=NULL;
+  integerColumns_=NULL;
+  continuousColumns_=NULL;
+  rowCounts_=NULL;
+  upperBoundColumn_=NULL;
+  upperBoundValue_=NULL;
+  lowerBoundColumn_=NULL;
+  lowerBoundValue_=NULL;
+  numberRows_=0;
+  numberColumns_=0;
+  numberElements_=0;
+  numberIntegers_=0;
+  numberRanged_=0;
+  valid_=false;
+}
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+CglModelStructure::CglModelStructure (double epsilon)
+  : rowLower_(NULL),
+    rowUpper_(NULL),
+    columnType_(NULL),
+    integerColumns_(NULL),
+    continuousColumns_(NULL),
+    rowCounts_(NULL),
+    upperBoundColumn_(NULL),
+    upperBoundValue_(NULL),
+    lowerBoundColumn_(NULL),
+    lowerBoundValue_(NULL),
+    epsilon_(epsilon),
+    numberRows_(0),
+    numberColumns_(0),
+    numberElements_(0),
+    numberIntegers_(0),
+    numberRanged_(0),
+    version_(0),
+    valid_(false)
+{
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+CglModelStructure::CglModelStructure (const CglModelStructure & rhs)
+  : rowLower_(NULL),
+    rowUpper_(NULL),
+    columnType_(NULL),
+    integerColumns_(NULL),
+    continuousColumns_(NULL),
+    rowCounts_(NULL),
+    upperBoundColumn_(NULL),
+    upperBoundValue_(NULL),
+    lowerBoundColumn_(NULL),
+    lowerBoundValue_(NULL)
+{
+  gutsOfCopy(rhs);
+}
+
+//-------------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+CglModelStructure &
+CglModelStructure::operator=(const CglModelStructure & rhs)
+{
+  if (this != &rhs) {
+    gutsOfDelete();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+CglModelStructure::~CglModelStructure ()
+{
+  gutsOfDelete();
+}
@@ -0,0 +1,200 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglModelStructure_H
+#define CglModelStructure_H
+
+#include "CoinPackedMatrix.hpp"
+
+class OsiSolverInterface;
+
+/** Analysis of a formulation which several generators want.
+
+    Holds row and column copies of the matrix, the type of each column
+    (as OsiSolverInterface::getColType - 0 continuous, 1 binary, 2 general
+    integer), lists of integer and continuous columns, for each row the
+    number of positive, negative and (nearly) zero coefficients of each
+    column type, and simple variable bounds.
+
+    A variable upper bound on continuous x is a row with exactly one
+    continuous and one integer coefficient (ignoring those within
+    epsilon of zero), a zero right hand side and sense L, G or E, so
+    x <= value * y.  Lower bounds are the same with >=.  An E row gives
+    both.  If several rows give a bound the last one is kept.  Ranged
+    rows are not used.
+
+    update(si) redoes the analysis only if the formulation has changed -
+    number of rows or columns, number of elements, row bounds or column
+    types.  Column bounds may change freely (unless that changes a
+    column type).  version() goes up each time so users can tell when
+    anything they derived is out of date.  If coefficients are changed
+    in place without anything above changing, call invalidate().
+
+    Generators share a structure by CglCutGenerator::setModelStructure.
+    update() is not thread safe - if generators sharing a structure are
+    run at the same time it must be brought up to date first (as
+    CglParallelCuts does).
+*/
+class CglModelStructure {
+
+public:
+
+  /// Number of coefficients in a row by column type and sign
+  struct RowCounts {
+    /// Coefficients above epsilon
+    int positive[3];
+    /// Coefficients below -epsilon
+    int negative[3];
+    /// Coefficients within epsilon of zero
+    int zero[3];
+  };
+
+  /**@name Analysis */
+  //@{
+  /** Bring up to date with si.  Returns true if analysis was redone
+      (or false if formulation was as before). */
+  bool update(const OsiSolverInterface & si);
+  /// Make sure next update redoes analysis
+  inline void invalidate()
+  { valid_=false;}
+  /// True if analysis done and not invalidated
+  inline bool valid() const
+  { return valid_;}
+  /** Number of times analysis has been done.  Anything derived from
+      structure with a different version is out of date. */
+  inline int version() const
+  { return version_;}
+  //@}
+
+  /**@name Results */
+  //@{
+  /// Number of rows
+  inline int numberRows() const
+  { return numberRows_;}
+  /// Number of columns
+  inline int numberColumns() const
+  { return numberColumns_;}
+  /// Row copy (no gaps)
+  inline const CoinPackedMatrix * rowCopy() const
+  { return &rowCopy_;}
+  /// Column copy (no gaps)
+  inline const CoinPackedMatrix * columnCopy() const
+  { return &columnCopy_;}
+  /// Column types (0 continuous, 1 binary, 2 general integer)
+  inline const char * columnType() const
+  { return columnType_;}
+  /// Number of integer columns
+  inline int numberIntegers() const
+  { return numberIntegers_;}
+  /// Integer columns
+  inline const int * integerColumns() const
+  { return integerColumns_;}
+  /// Number of continuous columns
+  inline int numberContinuous() const
+  { return numberColumns_-numberIntegers_;}
+  /// Continuous columns
+  inline const int * continuousColumns() const
+  { return continuousColumns_;}
+  /// Counts for a row
+  inline const RowCounts & rowCounts(int iRow) const
+  { return rowCounts_[iRow];}
+  /// Number of ranged rows
+  inline int numberRanged() const
+  { return numberRanged_;}
+  /// Row lower bounds
+  inline const double * rowLower() const
+  { return rowLower_;}
+  /// Row upper bounds
+  inline const double * rowUpper() const
+  { return rowUpper_;}
+  /// Integer column giving variable upper bound on column (or -1)
+  inline int upperBoundColumn(int iColumn) const
+  { return upperBoundColumn_[iColumn];}
+  /// Multiplier in variable upper bound on column
+  inline double upperBoundValue(int iColumn) const
+  { return upperBoundValue_[iColumn];}
+  /// Integer column giving variable lower bound on column (or -1)
+  inline int lowerBoundColumn(int iColumn) const
+  { return lowerBoundColumn_[iColumn];}
+  /// Multiplier in variable lower bound on column
+  inline double lowerBoundValue(int iColumn) const
+  { return lowerBoundValue_[iColumn];}
+  /// Coefficients within this of zero are counted as zero
+  inline double epsilon() const
+  { return epsilon_;}
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor
+  CglModelStructure (double epsilon=1.0e-6);
+  /// Copy constructor
+  CglModelStructure (const CglModelStructure & rhs);
+  /// Assignment operator
+  CglModelStructure & operator=(const CglModelStructure & rhs);
+  /// Destructor
+  ~CglModelStructure ();
+  //@}
+
+private:
+
+  /**@name Private methods */
+  //@{
+  /// True if si has same formulation
+  bool sameFormulation(const OsiSolverInterface & si) const;
+  /// Does analysis
+  void analyze(const OsiSolverInterface & si);
+  /// Copies in rhs
+  void gutsOfCopy(const CglModelStructure & rhs);
+  /// Frees arrays
+  void gutsOfDelete();
+  //@}
+
+  /**@name Private member data */
+  //@{
+  /// Row copy
+  CoinPackedMatrix rowCopy_;
+  /// Column copy
+  CoinPackedMatrix columnCopy_;
+  /// Row lower bounds
+  double * rowLower_;
+  /// Row upper bounds
+  double * rowUpper_;
+  /// Column types
+  char * columnType_;
+  /// Integer columns then continuous columns
+  int * integerColumns_;
+  /// Continuous columns (in same array as integers)
+  int * continuousColumns_;
+  /// Counts for each row
+  RowCounts * rowCounts_;
+  /// Integer column giving variable upper bound (or -1)
+  int * upperBoundColumn_;
+  /// Multiplier in variable upper bound
+  double * upperBoundValue_;
+  /// Integer column giving variable lower bound (or -1)
+  int * lowerBoundColumn_;
+  /// Multiplier in variable lower bound
+  double * lowerBoundValue_;
+  /// Coefficients within this of zero are counted as zero
+  double epsilon_;
+  /// Number of rows
+  int numberRows_;
+  /// Number of columns
+  int numberColumns_;
+  /// Number of elements
+  CoinBigIndex numberElements_;
+  /// Number of integers
+  int numberIntegers_;
+  /// Number of ranged rows
+  int numberRanged_;
+  /// Number of times analysis done
+  int version_;
+  /// True if analysis done and not invalidated
+  bool valid_;
+  //@}
+};
+
+#endif
@@ -0,0 +1,229 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+#include "CglParallelCuts.hpp"
+#include "CglModelStructure.hpp"
+#include "CglThread.hpp"
+
+namespace {
+  // What one call of generateCuts passes to the tasks
+  typedef struct {
+    const OsiSolverInterface * solver;
+    OsiSolverInterface ** threadSolver;
+    CglCutGenerator ** generator;
+    const int * which;
+    OsiCuts * cuts;
+    const CglTreeInfo * info;
+    double * wallTime;
+    double * cpuTime;
+  } CglParallelData;
+
+  void runGenerator(int task, int thread, void * voidData)
+  {
+    CglParallelData * data = reinterpret_cast<CglParallelData *>(voidData);
+    int iGenerator = data->which[task];
+    const OsiSolverInterface * solver = data->threadSolver ?
+      data->threadSolver[thread] : data->solver;
+    CglTreeInfo info(*data->info);
+    CoinThreadRandom random;
+    if (info.randomNumberGenerator) {
+      // own copy so sequence does not depend on other generators
+      random = *info.randomNumberGenerator;
+      info.randomNumberGenerator = &random;
+    }
+    // profile is recorded by calling thread after merge
+    bool timed = data->generator[iGenerator]->profile()!=NULL;
+    double wallTime = timed ? CoinGetTimeOfDay() : 0.0;
+    double cpuTime = timed ? CoinCpuTime() : 0.0;
+    data->generator[iGenerator]->generateCuts(*solver,data->cuts[iGenerator],info);
+    if (timed) {
+      data->wallTime[iGenerator] = CoinGetTimeOfDay()-wallTime;
+      data->cpuTime[iGenerator] = CoinCpuTime()-cpuTime;
+    }
+  }
+}
+
+//-------------------------------------------------------------------
+// Generate cuts from all generators
+//------------------------------------------------------------------- 
+void 
+CglParallelCuts::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
+			      const CglTreeInfo info)
+{
+  OsiCuts * cuts = new OsiCuts [numberGenerators_];
+  int * parallel = new int [2*numberGenerators_];
+  int * serial = parallel+numberGenerators_;
+  int numberParallel=0;
+  int numberSerial=0;
+  bool canThread = (numberThreads_>1&&!info.strengthenRow);
+  for (int i=0;i<numberGenerators_;i++) {
+    if (canThread&&generator_[i]->threadSafe())
+      parallel[numberParallel++]=i;
+    else
+      serial[numberSerial++]=i;
+  }
+  if (numberParallel==1) {
+    // not worth cloning
+    serial[numberSerial++]=parallel[0];
+    numberParallel=0;
+  }
+  CglParallelData data;
+  data.solver = &si;
+  data.threadSolver = NULL;
+  data.generator = generator_;
+  data.cuts = cuts;
+  data.info = &info;
+  data.wallTime = new double [2*numberGenerators_];
+  data.cpuTime = data.wallTime+numberGenerators_;
+  numberThreadsUsed_=1;
+  if (numberParallel) {
+    int numberClones = CoinMin(numberThreads_,numberParallel);
+    // Shared structures are brought up to date here so threads only read
+    for (int i=0;i<numberParallel;i++) {
+      CglModelStructure * structure = 
+	generator_[parallel[i]]->modelStructure();
+      if (structure)
+	structure->update(si);
+    }
+    // Clone here so nothing touches si while threads are running
+    OsiSolverInterface ** threadSolver = new OsiSolverInterface * [numberClones];
+    for (int i=0;i<numberClones;i++) {
+      threadSolver[i] = si.clone();
+      /* make sure solution is there whatever clone does - but only set
+	 it if missing as setting it again can lose row activities (Clp
+	 recomputes them) and then cuts differ from serial */
+      int numberColumns = si.getNumCols();
+      int numberRows = si.getNumRows();
+      const double * solution = si.getColSolution();
+      const double * cloneSolution = threadSolver[i]->getColSolution();
+      if (solution&&(!cloneSolution||
+		     memcmp(solution,cloneSolution,numberColumns*sizeof(double))))
+	threadSolver[i]->setColSolution(solution);
+      const double * dual = si.getRowPrice();
+      const double * cloneDual = threadSolver[i]->getRowPrice();
+      if (dual&&(!cloneDual||
+		 memcmp(dual,cloneDual,numberRows*sizeof(double))))
+	threadSolver[i]->setRowPrice(dual);
+    }
+    data.threadSolver = threadSolver;
+    data.which = parallel;
+    numberThreadsUsed_ = CglRunTasks(numberParallel,numberClones,
+				     runGenerator,&data);
+    for (int i=0;i<numberClones;i++)
+      delete threadSolver[i];
+    delete [] threadSolver;
+    data.threadSolver = NULL;
+  }
+  // rest in order on this thread
+  data.which = serial;
+  CglRunTasks(numberSerial,1,runGenerator,&data);
+  // merge in order generators were added
+  for (int i=0;i<numberGenerators_;i++) {
+    numberRowCuts_[i] = cuts[i].sizeRowCuts();
+    numberColumnCuts_[i] = cuts[i].sizeColCuts();
+    if (generator_[i]->profile()) {
+      generator_[i]->recordCuts(si,cuts[i],cs,info,data.wallTime[i],
+				data.cpuTime[i]);
+      continue;
+    }
+    for (int j=0;j<numberRowCuts_[i];j++) {
+      OsiRowCut * cut = cuts[i].rowCutPtr(j);
+      cs.insert(cut);
+    }
+    // cs now owns row cuts
+    cuts[i].dumpCuts();
+    for (int j=0;j<numberColumnCuts_[i];j++) 
+      cs.insert(cuts[i].colCut(j));
+  }
+  delete [] cuts;
+  delete [] parallel;
+  delete [] data.wallTime;
+}
+// Add a generator
+void 
+CglParallelCuts::addGenerator(CglCutGenerator * generator)
+{
+  if (numberGenerators_==maximumGenerators_) {
+    maximumGenerators_ = 2*maximumGenerators_+4;
+    CglCutGenerator ** temp = new CglCutGenerator * [maximumGenerators_];
+    int * tempRow = new int [2*maximumGenerators_];
+    CoinMemcpyN(generator_,numberGenerators_,temp);
+    CoinMemcpyN(numberRowCuts_,numberGenerators_,tempRow);
+    CoinMemcpyN(numberColumnCuts_,numberGenerators_,tempRow+maximumGenerators_);
+    delete [] generator_;
+    delete [] numberRowCuts_;
+    generator_ = temp;
+    numberRowCuts_ = tempRow;
+    numberColumnCuts_ = tempRow+maximumGenerators_;
+  }
+  generator_[numberGenerators_]=generator;
+  numberRowCuts_[numberGenerators_]=0;
+  numberColumnCuts_[numberGenerators_]=0;
+  numberGenerators_++;
+}
+
+//-------------------------------------------------------------------
+// Default Constructor 
+//-------------------------------------------------------------------
+CglParallelCuts::CglParallelCuts (int numberThreads)
+:
+  numberThreads_(numberThreads),
+  numberThreadsUsed_(0),
+  numberGenerators_(0),
+  maximumGenerators_(0),
+  generator_(NULL),
+  numberRowCuts_(NULL),
+  numberColumnCuts_(NULL)
+{
+}
+
+//-------------------------------------------------------------------
+// Copy constructor 
+//-------------------------------------------------------------------
+CglParallelCuts::CglParallelCuts (const CglParallelCuts & source)
+:
+  numberThreads_(source.numberThreads_),
+  numberThreadsUsed_(0),
+  numberGenerators_(0),
+  maximumGenerators_(0),
+  generator_(NULL),
+  numberRowCuts_(NULL),
+  numberColumnCuts_(NULL)
+{  
+  for (int i=0;i<source.numberGenerators_;i++)
+    addGenerator(source.generator_[i]);
+}
+
+//-------------------------------------------------------------------
+// Destructor 
+//-------------------------------------------------------------------
+CglParallelCuts::~CglParallelCuts ()
+{
+  delete [] generator_;
+  delete [] numberRowCuts_;
+}
+
+//----------------------------------------------------------------
+// Assignment operator 
+//-------------------------------------------------------------------
+CglParallelCuts &
+CglParallelCuts::operator=(const CglParallelCuts& rhs)
+{
+  if (this != &rhs) {
+    numberThreads_ = rhs.numberThreads_;
+    numberThreadsUsed_ = 0;
+    numberGenerators_ = 0;
+    for (int i=0;i<rhs.numberGenerators_;i++)
+      addGenerator(rhs.generator_[i]);
+  }
+  return *this;
+}
@@ -0,0 +1,111 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglParallelCuts_H
+#define CglParallelCuts_H
+
+#include "CglCutGenerator.hpp"
+
+/** Runs a set of cut generators, possibly at the same time.
+
+    Generators which say they are threadSafe() are run on worker threads,
+    each thread using its own clone of the solver (made once per call,
+    before any thread starts).  Other generators are run on the calling
+    thread with the original solver.  Each generator writes into its own
+    OsiCuts and these are appended to the output in the order the
+    generators were added, so the result does not depend on timing or on
+    the number of threads.
+
+    Generators with a profile attached (CglCutGenerator::setProfile)
+    are timed on their own thread and recorded by the calling thread
+    while merging.
+
+    Generators are not owned.  If the CglTreeInfo has a strengthenRow
+    array everything is run serially as generators would share it.
+    If it has a random number generator each generator gets its own copy.
+    Model structures shared by generators are updated before threads
+    start.
+*/
+class CglParallelCuts {
+ 
+public:
+    
+  /**@name Generate Cuts */
+  //@{
+  /** Generate cuts from all generators for the model data contained
+      in si and append them to cs.
+  */
+  void generateCuts( const OsiSolverInterface & si, OsiCuts & cs,
+		     const CglTreeInfo info = CglTreeInfo());
+  //@}
+
+  /**@name Generators */
+  //@{
+  /// Add a generator (not owned)
+  void addGenerator(CglCutGenerator * generator);
+  /// Number of generators
+  inline int numberGenerators() const
+  { return numberGenerators_;}
+  /// Generator
+  inline CglCutGenerator * generator(int i) const
+  { return generator_[i];}
+  /// Number of row cuts generator i gave in last call
+  inline int numberRowCuts(int i) const
+  { return numberRowCuts_[i];}
+  /// Number of column cuts generator i gave in last call
+  inline int numberColumnCuts(int i) const
+  { return numberColumnCuts_[i];}
+  //@}
+
+  /**@name Threads */
+  //@{
+  /// Set number of threads (<=1 means run serially)
+  inline void setNumberThreads(int value)
+  { numberThreads_ = value;}
+  /// Get number of threads
+  inline int numberThreads() const
+  { return numberThreads_;}
+  /// Number of threads used in last call
+  inline int numberThreadsUsed() const
+  { return numberThreadsUsed_;}
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor 
+  CglParallelCuts (int numberThreads=1);
+ 
+  /// Copy constructor (generators are shared)
+  CglParallelCuts (const CglParallelCuts & rhs);
+
+  /// Assignment operator 
+  CglParallelCuts &
+    operator=(const CglParallelCuts& rhs);
+  
+  /// Destructor 
+  ~CglParallelCuts ();
+  //@}
+      
+private:
+  
+  /**@name Private member data */
+  //@{
+  /// Number of threads
+  int numberThreads_;
+  /// Number of threads used in last call
+  int numberThreadsUsed_;
+  /// Number of generators
+  int numberGenerators_;
+  /// Room for generators
+  int maximumGenerators_;
+  /// Generators
+  CglCutGenerator ** generator_;
+  /// Row cuts from each generator in last call
+  int * numberRowCuts_;
+  /// Column cuts from each generator in last call
+  int * numberColumnCuts_;
+  //@}
+};
+#endif
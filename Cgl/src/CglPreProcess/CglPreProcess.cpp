@@ -8,6 +8,7 @@
 #include <vector>
 #include <algorithm>
 #include <cfloat>
+#include <cstdio>
 
 #include "CoinPragma.hpp"
 #include "CglPreProcess.hpp"
@@ -16,6 +17,8 @@
 #include "OsiColCut.hpp"
 #include "OsiRowCutDebugger.hpp"
 #include "CglStored.hpp"
+#include "CglPropagator.hpp"
+#include "CglThread.hpp"
 #include "CglCutGenerator.hpp"
 #include "CoinTime.hpp"
 #include "CoinSort.hpp"
@@ -2828,7 +2831,6 @@ CglPreProcess::tightenPrimalBounds(OsiSolverInterface & model,double factor)
   const CoinBigIndex * rowStart = copy.getVectorStarts();
   const int * rowLength = copy.getVectorLengths(); 
   double * element = copy.getMutableElements();
-  int numberChanged=1,iPass=0;
   double large = model.getInfinity()*0.1; // treat bounds > this as infinite
   int numberInfeasible=0;
   int totalTightened = 0;
@@ -2881,249 +2883,31 @@ CglPreProcess::tightenPrimalBounds(OsiSolverInterface & model,double factor)
   int numberRows = model.getNumRows();
   const double * rowLower = model.getRowLower();
   const double * rowUpper = model.getRowUpper();
-#ifndef NDEBUG
-  double large2= 1.0e10*large;
-#endif
 #define MAXPASS 10
 
-  // Loop round seeing if we can tighten bounds
-  // Would be faster to have a stack of possible rows
-  // and we put altered rows back on stack
+  /* Tighten bounds from rows, only going back to rows whose
+     activities have changed.  Each pass looks at up to number of rows
+     rows and we stop when a pass does less than a sixteenth of first */
+  CglPropagator propagator(copy,rowLower,rowUpper,newLower,newUpper,
+			   NULL,large);
+  propagator.setPrimalTolerance(tolerance);
+  int numberChanged=1,iPass=0;
   int numberCheck=-1;
-  while(numberChanged>numberCheck) {
-
-    numberChanged = 0; // Bounds tightened this pass
-    
-    if (iPass==MAXPASS) break;
+  while (numberChanged>numberCheck) {
+    if (iPass==MAXPASS) 
+      break;
     iPass++;
-    
-    for (iRow = 0; iRow < numberRows; iRow++) {
-
-      if (rowLower[iRow]>-large||rowUpper[iRow]<large) {
-
-	// possible row
-	int infiniteUpper = 0;
-	int infiniteLower = 0;
-	double maximumUp = 0.0;
-	double maximumDown = 0.0;
-	double newBound;
-	CoinBigIndex rStart = rowStart[iRow];
-	CoinBigIndex rEnd = rowStart[iRow]+rowLength[iRow];
-	CoinBigIndex j;
-	// Compute possible lower and upper ranges
-      
-	for (j = rStart; j < rEnd; ++j) {
-	  double value=element[j];
-	  iColumn = column[j];
-	  if (value > 0.0) {
-	    if (newUpper[iColumn] >= large) {
-	      ++infiniteUpper;
-	    } else {
-	      maximumUp += newUpper[iColumn] * value;
-	    }
-	    if (newLower[iColumn] <= -large) {
-	      ++infiniteLower;
-	    } else {
-	      maximumDown += newLower[iColumn] * value;
-	    }
-	  } else if (value<0.0) {
-	    if (newUpper[iColumn] >= large) {
-	      ++infiniteLower;
-	    } else {
-	      maximumDown += newUpper[iColumn] * value;
-	    }
-	    if (newLower[iColumn] <= -large) {
-	      ++infiniteUpper;
-	    } else {
-	      maximumUp += newLower[iColumn] * value;
-	    }
-	  }
-	}
-	// Build in a margin of error
-	maximumUp += 1.0e-8*fabs(maximumUp);
-	maximumDown -= 1.0e-8*fabs(maximumDown);
-	double maxUp = maximumUp+infiniteUpper*1.0e31;
-	double maxDown = maximumDown-infiniteLower*1.0e31;
-	if (maxUp <= rowUpper[iRow] + tolerance && 
-	    maxDown >= rowLower[iRow] - tolerance) {
-	  
-	  // Row is redundant - make totally free
-	} else {
-	  if (maxUp < rowLower[iRow] -100.0*tolerance ||
-	      maxDown > rowUpper[iRow]+100.0*tolerance) {
-	    // problem is infeasible - exit at once
-	    numberInfeasible++;
-	    break;
-	  }
-	  double lower = rowLower[iRow];
-	  double upper = rowUpper[iRow];
-	  for (j = rStart; j < rEnd; ++j) {
-	    double value=element[j];
-	    iColumn = column[j];
-	    double nowLower = newLower[iColumn];
-	    double nowUpper = newUpper[iColumn];
-	    if (value > 0.0) {
-	      // positive value
-	      if (lower>-large) {
-		if (!infiniteUpper) {
-		  assert(nowUpper < large2);
-		  newBound = nowUpper + 
-		    (lower - maximumUp) / value;
-		  // relax if original was large
-		  if (fabs(maximumUp)>1.0e8)
-		    newBound -= 1.0e-12*fabs(maximumUp);
-		} else if (infiniteUpper==1&&nowUpper>large) {
-		  newBound = (lower -maximumUp) / value;
-		  // relax if original was large
-		  if (fabs(maximumUp)>1.0e8)
-		    newBound -= 1.0e-12*fabs(maximumUp);
-		} else {
-		  newBound = -COIN_DBL_MAX;
-		}
-		if (newBound > nowLower + 1.0e-12&&newBound>-large) {
-		  // Tighten the lower bound 
-		  newLower[iColumn] = newBound;
-		  numberChanged++;
-		  // check infeasible (relaxed)
-		  if (nowUpper - newBound < 
-		      -100.0*tolerance) {
-		    numberInfeasible++;
-		  }
-		  // adjust
-		  double now;
-		  if (nowLower<-large) {
-		    now=0.0;
-		    infiniteLower--;
-		  } else {
-		    now = nowLower;
-		  }
-		  maximumDown += (newBound-now) * value;
-		  nowLower = newBound;
-		}
-	      } 
-	      if (upper <large) {
-		if (!infiniteLower) {
-		  assert(nowLower >- large2);
-		  newBound = nowLower + 
-		    (upper - maximumDown) / value;
-		  // relax if original was large
-		  if (fabs(maximumDown)>1.0e8)
-		    newBound += 1.0e-12*fabs(maximumDown);
-		} else if (infiniteLower==1&&nowLower<-large) {
-		  newBound =   (upper - maximumDown) / value;
-		  // relax if original was large
-		  if (fabs(maximumDown)>1.0e8)
-		    newBound += 1.0e-12*fabs(maximumDown);
-		} else {
-		  newBound = COIN_DBL_MAX;
-		}
-		if (newBound < nowUpper - 1.0e-12&&newBound<large) {
-		  // Tighten the upper bound 
-		  newUpper[iColumn] = newBound;
-		  numberChanged++;
-		  // check infeasible (relaxed)
-		  if (newBound - nowLower < 
-		      -100.0*tolerance) {
-		    numberInfeasible++;
-		  }
-		  // adjust 
-		  double now;
-		  if (nowUpper>large) {
-		    now=0.0;
-		    infiniteUpper--;
-		  } else {
-		    now = nowUpper;
-		  }
-		  maximumUp += (newBound-now) * value;
-		  nowUpper = newBound;
-		}
-	      }
-	    } else {
-	      // negative value
-	      if (lower>-large) {
-		if (!infiniteUpper) {
-		  assert(nowLower < large2);
-		  newBound = nowLower + 
-		    (lower - maximumUp) / value;
-		  // relax if original was large
-		  if (fabs(maximumUp)>1.0e8)
-		    newBound += 1.0e-12*fabs(maximumUp);
-		} else if (infiniteUpper==1&&nowLower<-large) {
-		  newBound = (lower -maximumUp) / value;
-		  // relax if original was large
-		  if (fabs(maximumUp)>1.0e8)
-		    newBound += 1.0e-12*fabs(maximumUp);
-		} else {
-		  newBound = COIN_DBL_MAX;
-		}
-		if (newBound < nowUpper - 1.0e-12&&newBound<large) {
-		  // Tighten the upper bound 
-		  newUpper[iColumn] = newBound;
-		  numberChanged++;
-		  // check infeasible (relaxed)
-		  if (newBound - nowLower < 
-		      -100.0*tolerance) {
-		    numberInfeasible++;
-		  }
-		  // adjust
-		  double now;
-		  if (nowUpper>large) {
-		    now=0.0;
-		    infiniteLower--;
-		  } else {
-		    now = nowUpper;
-		  }
-		  maximumDown += (newBound-now) * value;
-		  nowUpper = newBound;
-		}
-	      }
-	      if (upper <large) {
-		if (!infiniteLower) {
-		  assert(nowUpper < large2);
-		  newBound = nowUpper + 
-		    (upper - maximumDown) / value;
-		  // relax if original was large
-		  if (fabs(maximumDown)>1.0e8)
-		    newBound -= 1.0e-12*fabs(maximumDown);
-		} else if (infiniteLower==1&&nowUpper>large) {
-		  newBound =   (upper - maximumDown) / value;
-		  // relax if original was large
-		  if (fabs(maximumDown)>1.0e8)
-		    newBound -= 1.0e-12*fabs(maximumDown);
-		} else {
-		  newBound = -COIN_DBL_MAX;
-		}
-		if (newBound > nowLower + 1.0e-12&&newBound>-large) {
-		  // Tighten the lower bound 
-		  newLower[iColumn] = newBound;
-		  numberChanged++;
-		  // check infeasible (relaxed)
-		  if (nowUpper - newBound < 
-		      -100.0*tolerance) {
-		    numberInfeasible++;
-		  }
-		  // adjust
-		  double now;
-		  if (nowLower<-large) {
-		    now=0.0;
-		    infiniteUpper--;
-		  } else {
-		    now = nowLower;
-		  }
-		  maximumUp += (newBound-now) * value;
-		  nowLower = newBound;
-		}
-	      }
-	    }
-	  }
-	}
-      }
+    numberChanged = propagator.propagate(numberRows);
+    if (numberChanged<0) {
+      numberInfeasible++;
+      break;
     }
     totalTightened += numberChanged;
     if (iPass==1)
       numberCheck=numberChanged>>4;
-    if (numberInfeasible) break;
   }
+  CoinMemcpyN(propagator.colLower(),numberColumns,newLower);
+  CoinMemcpyN(propagator.colUpper(),numberColumns,newUpper);
   if (!numberInfeasible) {
     // Set bounds slightly loose unless integral - now tighter
     double useTolerance = 1.0e-5;
@@ -4873,6 +4657,8 @@ CglPreProcess::CglPreProcess()
   prohibited_(NULL),
   numberRowType_(0),
   options_(0),
+  maximumCliqueWork_(1.0e7),
+  numberThreads_(1),
   rowType_(NULL)
 {
   handler_ = new CoinMessageHandler();
@@ -4894,7 +4680,9 @@ CglPreProcess::CglPreProcess(const CglPreProcess & rhs)
   numberIterationsPre_(rhs.numberIterationsPre_),
   numberIterationsPost_(rhs.numberIterationsPost_),
   numberRowType_(rhs.numberRowType_),
-  options_(rhs.options_)
+  options_(rhs.options_),
+  maximumCliqueWork_(rhs.maximumCliqueWork_),
+  numberThreads_(rhs.numberThreads_)
 {
   if (defaultHandler_) {
     handler_ = new CoinMessageHandler();
@@ -4934,6 +4722,7 @@ CglPreProcess::CglPreProcess(const CglPreProcess & rhs)
     }
   } else {
     model_=NULL;
+    modifiedModel_=NULL;
     presolve_=NULL;
   }
   numberSOS_=rhs.numberSOS_;
@@ -4969,6 +4758,8 @@ CglPreProcess::operator=(const CglPreProcess& rhs)
     numberIterationsPost_ = rhs.numberIterationsPost_;
     numberRowType_ = rhs.numberRowType_;
     options_ = rhs.options_;
+    maximumCliqueWork_ = rhs.maximumCliqueWork_;
+    numberThreads_ = rhs.numberThreads_;
     if (defaultHandler_) {
       handler_ = new CoinMessageHandler();
       handler_->setLogLevel(rhs.handler_->logLevel());
@@ -5005,6 +4796,7 @@ CglPreProcess::operator=(const CglPreProcess& rhs)
       }
     } else {
       model_=NULL;
+      modifiedModel_=NULL;
       presolve_=NULL;
     }
     numberSOS_=rhs.numberSOS_;
@@ -5159,6 +4951,43 @@ CglPreProcess::originalRows()
     createOriginalIndices();
   return originalRow_;
 }
+// Write processed model and mapping to original
+int 
+CglPreProcess::writeProcessedModel(const char * fileName,
+				   const OsiSolverInterface & model,
+				   bool keepNames)
+{
+  if (!originalModel_)
+    return 1;
+  const int * originalColumn = originalColumns();
+  const int * originalRow = originalRows();
+  // Sizes as in createOriginalIndices
+  int nRows=originalModel_->getNumRows();
+  int nColumns=originalModel_->getNumCols();
+  for (int iPass=numberSolvers_-1;iPass>=0;iPass--) {
+    if (presolve_[iPass]) {
+      nRows=model_[iPass]->getNumRows();
+      nColumns=model_[iPass]->getNumCols();
+      break;
+    }
+  }
+  // Rows may have been dropped into cuts
+  if (nRows!=model.getNumRows())
+    originalRow=NULL;
+  if (nColumns!=model.getNumCols())
+    originalColumn=NULL;
+  int returnCode = model.writeModelFile(fileName,keepNames,
+					originalColumn,originalRow);
+  std::string cutName = std::string(fileName)+".cuts";
+  if (cuts_.sizeRowCuts()) {
+    if (cuts_.writeFile(cutName.c_str()))
+      returnCode=1;
+  } else {
+    // so cuts from an earlier run are not picked up with this model
+    remove(cutName.c_str());
+  }
+  return returnCode;
+}
 // create original columns and rows
 void 
 CglPreProcess::createOriginalIndices()
@@ -5668,9 +5497,6 @@ CglPreProcess::makeInteger()
   delete [] changed;
 }
 //#define BRON_TIMES
-#ifdef BRON_TIMES
-static int numberTimesX=0;
-#endif
 /* Replace cliques by more maximal cliques
    Returns NULL if rows not reduced by greater than cliquesNeeded*rows
    
@@ -5680,15 +5506,10 @@ CglPreProcess::cliqueIt(OsiSolverInterface & model,
 			double cliquesNeeded) const
 {
   /*
-    Initial arrays
-    * Candidate nodes (columns)
-    First nIn already in
-    Next nCandidate are candidates
-    numberColumns-1 back to nNot are Nots
+    Conflict graph from x+y<=1 rows on binary columns
     * Starts
     * Other node
     * Original row (paired with other node)
-    * CliqueIn expanded array with 1 in, 2 not, 3 out, 0 possible, -1 never
     * Type (for original row)
     */
   const double *lower = model.getColLower() ;
@@ -5748,10 +5569,13 @@ CglPreProcess::cliqueIt(OsiSolverInterface & model,
     double time1 = CoinCpuTime();
 #endif
     CglBK bk(model,type,numberElements);
+    bk.setMaximumWork(maximumCliqueWork_);
+    bk.setNumberThreads(numberThreads_);
     bk.bronKerbosch();
     newSolver = bk.newSolver(model);
 #ifdef BRON_TIMES
-    printf("Time %g - bron called %d times\n",CoinCpuTime()-time1,numberTimesX);
+    printf("Time %g - bron searched %g nodes%s\n",CoinCpuTime()-time1,
+	   bk.work(),bk.stopped() ? " (stopped)" : "");
 #endif
   }
   delete [] type;
@@ -5761,7 +5585,6 @@ CglPreProcess::cliqueIt(OsiSolverInterface & model,
 CglBK::CglBK()
 {
   candidates_=NULL;
-  mark_=NULL;
   start_=NULL;
   otherColumn_=NULL;
   originalRow_=NULL;
@@ -5771,11 +5594,11 @@ CglBK::CglBK()
   numberColumns_=0;
   numberRows_=0;
   numberPossible_=0;
-  numberCandidates_=0;
-  firstNot_=0;
-  numberIn_=0;
   left_=0;
-  lastColumn_=0;
+  maximumWork_=1.0e7;
+  work_=0.0;
+  numberThreads_=1;
+  stopped_=false;
 } 
   
 // Useful constructor
@@ -5797,8 +5620,7 @@ CglBK::CglBK(const OsiSolverInterface & model, const char * rowType,
   const int * columnLength = model.getMatrixByCol()->getVectorLengths();
   start_ = new CoinBigIndex[numberColumns_+1];
   otherColumn_ = new int [numberElements];
-  candidates_ = new int [2*numberColumns_];
-  CoinZeroN(candidates_,2*numberColumns_); // for valgrind
+  candidates_ = new int [numberColumns_];
   originalRow_ = new int [numberElements];
   dominated_ = new int [numberRows_];
   CoinZeroN(dominated_,numberRows_);
@@ -5903,13 +5725,11 @@ CglBK::CglBK(const OsiSolverInterface & model, const char * rowType,
     }
   }
   start_[numberColumns_]=numberElements;
-  numberCandidates_=numberPossible_;
-  numberIn_=0;
-  firstNot_ = numberPossible_;
   left_=numberPossible_;
-  lastColumn_=-1;
-  mark_ = new char [numberColumns_];
-  memset(mark_,0,numberColumns_);
+  maximumWork_=1.0e7;
+  work_=0.0;
+  numberThreads_=1;
+  stopped_=false;
   cliqueMatrix_=new CoinPackedMatrix(false,0.5,0.0);
   int n=0;
   for (int i=0;i<numberRows_;i++) {
@@ -5924,8 +5744,7 @@ CglBK::CglBK(const CglBK & rhs)
 {
   // This only copies data in candidates_
   // rest just points
-  candidates_ = CoinCopyOfArray(rhs.candidates_,2*rhs.numberPossible_);
-  mark_=rhs.mark_;
+  candidates_ = CoinCopyOfArray(rhs.candidates_,rhs.numberPossible_);
   start_=rhs.start_;
   otherColumn_=rhs.otherColumn_;
   originalRow_=rhs.originalRow_;
@@ -5935,11 +5754,11 @@ CglBK::CglBK(const CglBK & rhs)
   numberColumns_=rhs.numberColumns_;
   numberRows_=rhs.numberRows_;
   numberPossible_=rhs.numberPossible_;
-  numberCandidates_=rhs.numberCandidates_;
-  firstNot_=rhs.firstNot_;
-  numberIn_=rhs.numberIn_;
   left_=rhs.left_;
-  lastColumn_=rhs.lastColumn_;
+  maximumWork_=rhs.maximumWork_;
+  work_=rhs.work_;
+  numberThreads_=rhs.numberThreads_;
+  stopped_=rhs.stopped_;
 } 
 
 // Assignment operator 
@@ -5949,8 +5768,7 @@ CglBK & CglBK::operator=(const CglBK& rhs)
     delete [] candidates_;
     // This only copies data in candidates_
     // rest just points
-    candidates_ = CoinCopyOfArray(rhs.candidates_,2*numberPossible_);
-    mark_=rhs.mark_;
+    candidates_ = CoinCopyOfArray(rhs.candidates_,rhs.numberPossible_);
     start_=rhs.start_;
     otherColumn_=rhs.otherColumn_;
     originalRow_=rhs.originalRow_;
@@ -5960,11 +5778,11 @@ CglBK & CglBK::operator=(const CglBK& rhs)
     numberColumns_=rhs.numberColumns_;
     numberRows_=rhs.numberRows_;
     numberPossible_=rhs.numberPossible_;
-    numberCandidates_=rhs.numberCandidates_;
-    firstNot_=rhs.firstNot_;
-    numberIn_=rhs.numberIn_;
     left_=rhs.left_;
-    lastColumn_=rhs.lastColumn_;
+    maximumWork_=rhs.maximumWork_;
+    work_=rhs.work_;
+    numberThreads_=rhs.numberThreads_;
+    stopped_=rhs.stopped_;
   }
   return *this;
 } 
@@ -5975,7 +5793,6 @@ CglBK::~CglBK ()
   delete [] candidates_;
   // only deletes if left_==-1
   if (left_==-1) {
-    delete [] mark_;
     delete [] start_;
     delete [] otherColumn_;
     delete [] originalRow_;
@@ -5983,165 +5800,449 @@ CglBK::~CglBK ()
     delete cliqueMatrix_;
   }
 }
-// For Bron-Kerbosch
-void 
-CglBK::bronKerbosch()
-{
-#ifdef BRON_TIMES
-  numberTimesX++;
-  if ((numberTimesX%1000)==0)
-    printf("times %d - %d candidates left\n",numberTimesX,numberCandidates_);
+namespace {
+  /* position of lowest bit set in a non zero word */
+  inline int lowestBit(CoinUInt64 word)
+  {
+#if defined(__GNUC__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while (!(word & 1)) {
+      word >>= 1;
+      bit++;
+    }
+    return bit;
+#endif
+  }
+  /* number of bits set */
+  inline int bitCount(CoinUInt64 word)
+  {
+#if defined(__GNUC__)
+    return __builtin_popcountll(word);
+#else
+    int n = 0;
+    while (word) {
+      word &= word-1;
+      n++;
+    }
+    return n;
 #endif
-  if (!numberCandidates_&&firstNot_==numberPossible_) {
-    // mark original rows which are dominated
-    // save if clique size >2
-    if (numberIn_>2) {
-      double * elements = new double [numberIn_];
-      int * column = candidates_+numberPossible_;
-      // mark those in clique
-      for (int i=0;i<numberIn_;i++) {
-	int iColumn=column[i];
-	mark_[iColumn]=1;
+  }
+  // Graph (read only so shared by threads)
+  typedef struct {
+    const CoinBigIndex * start;
+    const int * otherColumn;
+    const int * originalRow;
+    // possible columns in degeneracy order
+    const int * order;
+    // position of column in order (-1 if not possible)
+    const int * position;
+  } CglBKGraph;
+  // Result of search from one root column
+  typedef struct {
+    // number in clique then columns (root first) for each clique
+    std::vector<int> cliques;
+    // original rows with both columns in one of cliques
+    std::vector<int> dominated;
+    double maximumWork;
+    double work;
+    bool stopped;
+  } CglBKRoot;
+  /* Searches for maximal cliques whose first column in degeneracy
+     order is root.  Local indices 0..numberP_-1 are neighbours later in
+     order (the starting candidates) and the rest are earlier neighbours
+     next to at least one of them (the starting nots - others can never
+     stop a clique being maximal).  As candidates only ever lose
+     columns, adjacency rows of the nots and candidate sets need only
+     the first numberPWords_ words. */
+  class CglBKSearch {
+  public:
+    CglBKSearch(int numberColumns)
+      : localIndex_(numberColumns,-1), root_(NULL), rootColumn_(-1),
+	numberP_(0), numberWords_(0), numberPWords_(0), depthSize_(0) {}
+    void search(const CglBKGraph & graph, int iRoot, CglBKRoot & root);
+  private:
+    void expand(int depth);
+    // adjacency row of local index
+    inline CoinUInt64 * adjacency(int u)
+    { return &adjacency_[0]+(u<numberP_ ? u*numberWords_ :
+			     numberP_*numberWords_+(u-numberP_)*numberPWords_);}
+    // local index of column, -1 if none, -2 possible not
+    std::vector<int> localIndex_;
+    // column of local index
+    std::vector<int> column_;
+    // pairs of local indices (from candidate)
+    std::vector<int> edges_;
+    std::vector<CoinUInt64> adjacency_;
+    // pairs of candidates both in a clique found
+    std::vector<CoinUInt64> covered_;
+    // candidates, nots and columns to branch on at each depth
+    std::vector<CoinUInt64> stack_;
+    // local indices in clique (apart from root)
+    std::vector<int> clique_;
+    CglBKRoot * root_;
+    int rootColumn_;
+    int numberP_;
+    int numberWords_;
+    int numberPWords_;
+    int depthSize_;
+  };
+  void 
+  CglBKSearch::search(const CglBKGraph & graph, int iRoot, CglBKRoot & root)
+  {
+    root_ = &root;
+    root.cliques.clear();
+    root.dominated.clear();
+    root.work = 0.0;
+    root.stopped = false;
+    rootColumn_ = graph.order[iRoot];
+    CoinBigIndex start = graph.start[rootColumn_];
+    CoinBigIndex end = graph.start[rootColumn_+1];
+    column_.clear();
+    for (CoinBigIndex j=start;j<end;j++) {
+      int kColumn = graph.otherColumn[j];
+      if (localIndex_[kColumn]==-1&&graph.position[kColumn]>iRoot) {
+	localIndex_[kColumn]=static_cast<int>(column_.size());
+	column_.push_back(kColumn);
       }
-      for (int i=0;i<numberIn_;i++) {
-	elements[i]=1.0;
-	int iColumn=column[i];
-	for (int j=start_[iColumn];j<start_[iColumn+1];j++) {
-	  int jColumn = otherColumn_[j];
-	  if (mark_[jColumn]) {
-	    int iRow=originalRow_[j];
-	    dominated_[iRow]++;
+    }
+    numberP_ = static_cast<int>(column_.size());
+    // a clique of more than two columns needs two candidates
+    if (numberP_>=2) {
+      for (CoinBigIndex j=start;j<end;j++) {
+	int kColumn = graph.otherColumn[j];
+	if (localIndex_[kColumn]==-1&&graph.position[kColumn]>=0)
+	  localIndex_[kColumn]=-2;
+      }
+      // only candidates need be scanned
+      edges_.clear();
+      for (int u=0;u<numberP_;u++) {
+	int iColumn = column_[u];
+	for (CoinBigIndex j=graph.start[iColumn];j<graph.start[iColumn+1];j++) {
+	  int kColumn = graph.otherColumn[j];
+	  int v = localIndex_[kColumn];
+	  if (v==-2) {
+	    v = static_cast<int>(column_.size());
+	    localIndex_[kColumn]=v;
+	    column_.push_back(kColumn);
+	  }
+	  if (v>=0&&v!=u) {
+	    edges_.push_back(u);
+	    edges_.push_back(v);
 	  }
 	}
       }
-      for (int i=0;i<numberIn_;i++) {
-	int iColumn=column[i];
-	mark_[iColumn]=0;
+      int numberLocal = static_cast<int>(column_.size());
+      numberWords_ = (numberLocal+63)>>6;
+      numberPWords_ = (numberP_+63)>>6;
+      adjacency_.assign(numberP_*numberWords_+
+			(numberLocal-numberP_)*numberPWords_,0);
+      int numberEdges = static_cast<int>(edges_.size());
+      for (int i=0;i<numberEdges;i+=2) {
+	int u = edges_[i];
+	int v = edges_[i+1];
+	adjacency(u)[v>>6] |= static_cast<CoinUInt64>(1)<<(v&63);
+	if (v>=numberP_)
+	  adjacency(v)[u>>6] |= static_cast<CoinUInt64>(1)<<(u&63);
       }
-      cliqueMatrix_->appendRow(numberIn_,column,elements);
-      delete [] elements;
-    }
-  } else {
-#if 0
-    int nCplusN=numberCandidates_+(numberPossible_-firstNot_);
-    int iChoose = CoinDrand48()*nCplusN;
-    iChoose=CoinMin(0,nCplusN-1);
-    if (iChoose>=numberCandidates_) {
-      iChoose -= numberCandidates_;
-      iChoose += firstNot_;
-    }
-#else
-    for (int i=0;i<numberCandidates_;i++) {
-      int jColumn = candidates_[i];
-      mark_[jColumn]=1;
-    }
-    int nMax=0;
-    int iChoose=0;
-    for (int i=numberPossible_-1;i>=firstNot_;i--) {
-      int iColumn = candidates_[i];
-      int n=0;
-      for (int j=start_[iColumn];j<start_[iColumn+1];j++) {
-	int jColumn = otherColumn_[j];
-	n += mark_[jColumn];
-      }
-      if (n>nMax) {
-	nMax=n;
-	iChoose=i;
-      } 
-    }
-    if (nMax<numberCandidates_-1||!nMax) {
-      for (int i=0;i<numberCandidates_;i++) {
-	int iColumn = candidates_[i];
-	int n=0;
-	for (int j=start_[iColumn];j<start_[iColumn+1];j++) {
-	  int jColumn = otherColumn_[j];
-	  n += mark_[jColumn];
+      covered_.assign(numberP_*numberPWords_,0);
+      depthSize_ = 2*numberPWords_+numberWords_;
+      // depth can not be more than number of candidates
+      size_t needed = static_cast<size_t>(numberP_+2)*depthSize_;
+      if (stack_.size()<needed)
+	stack_.resize(needed);
+      CoinUInt64 * P = &stack_[0];
+      CoinUInt64 * X = P+numberPWords_;
+      memset(P,0,numberPWords_*sizeof(CoinUInt64));
+      memset(X,0,numberWords_*sizeof(CoinUInt64));
+      for (int u=0;u<numberP_;u++)
+	P[u>>6] |= static_cast<CoinUInt64>(1)<<(u&63);
+      for (int u=numberP_;u<numberLocal;u++)
+	X[u>>6] |= static_cast<CoinUInt64>(1)<<(u&63);
+      clique_.clear();
+      expand(0);
+      /* Rows dominated by cliques found (even if stopped) -
+	 root is in all so root to u if u in any */
+      for (CoinBigIndex j=start;j<end;j++) {
+	int u = localIndex_[graph.otherColumn[j]];
+	if (u>=0&&u<numberP_) {
+	  const CoinUInt64 * row = &covered_[u*numberPWords_];
+	  for (int w=0;w<numberPWords_;w++) {
+	    if (row[w]) {
+	      root.dominated.push_back(graph.originalRow[j]);
+	      break;
+	    }
+	  }
 	}
-	if (n>nMax) {
-	  nMax=n;
-	  iChoose=i;
+      }
+      for (int u=0;u<numberP_;u++) {
+	const CoinUInt64 * row = &covered_[u*numberPWords_];
+	int iColumn = column_[u];
+	for (CoinBigIndex j=graph.start[iColumn];j<graph.start[iColumn+1];j++) {
+	  int v = localIndex_[graph.otherColumn[j]];
+	  if (v>u&&v<numberP_&&(row[v>>6]&(static_cast<CoinUInt64>(1)<<(v&63))))
+	    root.dominated.push_back(graph.originalRow[j]);
 	}
       }
     }
-    for (int i=0;i<numberCandidates_;i++) {
-      int jColumn = candidates_[i];
-      mark_[jColumn]=0;
+    for (CoinBigIndex j=start;j<end;j++)
+      localIndex_[graph.otherColumn[j]]=-1;
+  }
+  void 
+  CglBKSearch::expand(int depth)
+  {
+    CglBKRoot & root = *root_;
+    root.work++;
+    if (root.work>root.maximumWork) {
+      root.stopped = true;
+      return;
     }
-#endif
-    iChoose = candidates_[iChoose];
-    int * temp = candidates_+numberPossible_+numberIn_;
-    int nTemp=0;
-    if (nMax<numberCandidates_) {
-      // Neighborhood of iColumn
-      for (int j=start_[iChoose];j<start_[iChoose+1];j++) {
-	int jColumn = otherColumn_[j];
-	mark_[jColumn]=1;
-      }
-      for (int i=0;i<numberCandidates_;i++) {
-	int jColumn = candidates_[i];
-	if (!mark_[jColumn])
-	  temp[nTemp++]=jColumn;
+    CoinUInt64 * P = &stack_[0]+depth*depthSize_;
+    CoinUInt64 * X = P+numberPWords_;
+    CoinUInt64 * branch = X+numberWords_;
+    int numberInP = 0;
+    for (int w=0;w<numberPWords_;w++)
+      numberInP += bitCount(P[w]);
+    int numberIn = static_cast<int>(clique_.size())+1;
+    if (!numberInP) {
+      bool anyX = false;
+      for (int w=0;w<numberWords_;w++) {
+	if (X[w]) {
+	  anyX = true;
+	  break;
+	}
       }
-      for (int j=start_[iChoose];j<start_[iChoose+1];j++) {
-	int jColumn = otherColumn_[j];
-	mark_[jColumn]=0;
+      if (!anyX&&numberIn>2) {
+	// maximal
+	root.cliques.push_back(numberIn);
+	root.cliques.push_back(rootColumn_);
+	for (int i=0;i<numberIn-1;i++) {
+	  int u = clique_[i];
+	  root.cliques.push_back(column_[u]);
+	  CoinUInt64 * row = &covered_[u*numberPWords_];
+	  for (int k=0;k<numberIn-1;k++) {
+	    int v = clique_[k];
+	    row[v>>6] |= static_cast<CoinUInt64>(1)<<(v&63);
+	  }
+	}
       }
+      return;
     }
-    //if (nMax==numberCandidates_)
-    //assert (!nTemp);
-    for (int kk=0;kk<nTemp;kk++) {
-      int iColumn=temp[kk];
-      // move up
-      int put=0;
-      for (int i=0;i<numberCandidates_;i++) {
-	if (candidates_[i]!=iColumn)  
-	  candidates_[put++]=candidates_[i];
+    if (numberIn+numberInP<3)
+      return;
+    // pivot is column in P or X with most neighbours in P
+    int pivot = -1;
+    int best = -1;
+    for (int w=0;w<numberWords_;w++) {
+      CoinUInt64 word = X[w];
+      if (w<numberPWords_)
+	word |= P[w];
+      while (word) {
+	int u = (w<<6)+lowestBit(word);
+	word &= word-1;
+	const CoinUInt64 * row = adjacency(u);
+	int n = 0;
+	for (int k=0;k<numberPWords_;k++)
+	  n += bitCount(P[k]&row[k]);
+	if (n>best) {
+	  if (n==numberInP) {
+	    // in X and covers P - nothing here is maximal
+	    return;
+	  }
+	  best = n;
+	  pivot = u;
+	}
       }
-      numberCandidates_--;
-      CglBK bk2(*this);
-      int * newCandidates=bk2.candidates_;
-#if 0
-      printf("%p (next %p) iColumn %d, %d candidates %d not %d in\n",
-	     this,&bk2,iColumn,numberCandidates_,
-	     numberPossible_-firstNot_,numberIn_);
-      for (int i=0;i<numberCandidates_;i++) {
-	printf(" %d",candidates_[i]);
+    }
+    const CoinUInt64 * pivotRow = adjacency(pivot);
+    for (int w=0;w<numberPWords_;w++)
+      branch[w] = P[w]&~pivotRow[w];
+    CoinUInt64 * newP = P+depthSize_;
+    CoinUInt64 * newX = newP+numberPWords_;
+    for (int w=0;w<numberPWords_;w++) {
+      CoinUInt64 word = branch[w];
+      while (word) {
+	int v = (w<<6)+lowestBit(word);
+	CoinUInt64 bit = word&(~word+1);
+	word &= word-1;
+	const CoinUInt64 * row = adjacency(v);
+	for (int k=0;k<numberPWords_;k++)
+	  newP[k] = P[k]&row[k];
+	for (int k=0;k<numberWords_;k++)
+	  newX[k] = X[k]&row[k];
+	clique_.push_back(v);
+	expand(depth+1);
+	clique_.pop_back();
+	if (root.stopped)
+	  return;
+	// move from candidates to nots
+	P[w] &= ~bit;
+	X[w] |= bit;
       }
-      printf("\n");
-#endif
-      newCandidates[numberPossible_+numberIn_]=iColumn;
-      bk2.numberIn_=numberIn_+1;
-      // Neighborhood of iColumn
-      for (int j=start_[iColumn];j<start_[iColumn+1];j++) {
-	int jColumn = otherColumn_[j];
-	mark_[jColumn]=1;
+    }
+  }
+  // Roots searched by one CglRunTasks call
+  typedef struct {
+    const CglBKGraph * graph;
+    CglBKSearch ** search;
+    CglBKRoot * roots;
+    int firstRoot;
+  } CglBKBatch;
+  void searchRoot(int task, int thread, void * data)
+  {
+    CglBKBatch * batch = reinterpret_cast<CglBKBatch *>(data);
+    batch->search[thread]->search(*batch->graph,batch->firstRoot+task,
+				  batch->roots[task]);
+  }
+}
+// For Bron-Kerbosch
+void 
+CglBK::bronKerbosch()
+{
+  work_ = 0.0;
+  stopped_ = false;
+  if (!numberPossible_)
+    return;
+  /* Degeneracy order - repeatedly take column with fewest neighbours
+     left (Batagelj and Zaversnik bucket method) */
+  int * position = new int [numberColumns_];
+  for (int i=0;i<numberColumns_;i++)
+    position[i]=-1;
+  for (int i=0;i<numberPossible_;i++)
+    position[candidates_[i]]=i;
+  int * degree = new int [numberPossible_];
+  int maximumDegree=0;
+  for (int i=0;i<numberPossible_;i++) {
+    int iColumn = candidates_[i];
+    degree[i]=start_[iColumn+1]-start_[iColumn];
+    maximumDegree = CoinMax(maximumDegree,degree[i]);
+  }
+  int * bin = new int [maximumDegree+1];
+  CoinZeroN(bin,maximumDegree+1);
+  for (int i=0;i<numberPossible_;i++)
+    bin[degree[i]]++;
+  int first=0;
+  for (int d=0;d<=maximumDegree;d++) {
+    int n = bin[d];
+    bin[d]=first;
+    first += n;
+  }
+  int * vertex = new int [numberPossible_];
+  int * where = new int [numberPossible_];
+  for (int i=0;i<numberPossible_;i++) {
+    where[i]=bin[degree[i]]++;
+    vertex[where[i]]=i;
+  }
+  for (int d=maximumDegree;d>0;d--)
+    bin[d]=bin[d-1];
+  bin[0]=0;
+  for (int k=0;k<numberPossible_;k++) {
+    int i = vertex[k];
+    int iColumn = candidates_[i];
+    for (int j=start_[iColumn];j<start_[iColumn+1];j++) {
+      int u = position[otherColumn_[j]];
+      if (u>=0&&degree[u]>degree[i]) {
+	// swap to front of bin and move to bin below
+	int du = degree[u];
+	int pu = where[u];
+	int pw = bin[du];
+	int w = vertex[pw];
+	if (u!=w) {
+	  where[u]=pw;
+	  vertex[pu]=w;
+	  where[w]=pu;
+	  vertex[pw]=u;
+	}
+	bin[du]++;
+	degree[u]--;
       }
-      // Intersection of candidates with neighborhood
-      int numberCandidates=0;
-      for (int i=0;i<bk2.numberCandidates_;i++) {
-	int jColumn = newCandidates[i];
-	if (mark_[jColumn])
-	  newCandidates[numberCandidates++]=jColumn;
+    }
+  }
+  int * order = new int [numberPossible_];
+  for (int k=0;k<numberPossible_;k++) {
+    int iColumn = candidates_[vertex[k]];
+    order[k]=iColumn;
+    position[iColumn]=k;
+  }
+  delete [] degree;
+  delete [] bin;
+  delete [] vertex;
+  delete [] where;
+  CglBKGraph graph;
+  graph.start = start_;
+  graph.otherColumn = otherColumn_;
+  graph.originalRow = originalRow_;
+  graph.order = order;
+  graph.position = position;
+  int numberThreads = CoinMax(numberThreads_,1);
+  CglBKSearch ** search = new CglBKSearch * [numberThreads];
+  for (int i=0;i<numberThreads;i++)
+    search[i] = new CglBKSearch(numberColumns_);
+  /* Fixed batch size (not depending on threads) so same cliques
+     found whatever the number of threads */
+  const int batchSize=256;
+  std::vector<CglBKRoot> roots(batchSize);
+  // all cliques added to cliqueMatrix_ at end (adding one by one is slow)
+  std::vector<CoinBigIndex> cliqueStart(1,0);
+  std::vector<int> cliqueColumn;
+  for (int firstRoot=0;firstRoot<numberPossible_;firstRoot+=batchSize) {
+    if (work_>=maximumWork_) {
+      stopped_=true;
+      break;
+    }
+    int numberRoots = CoinMin(batchSize,numberPossible_-firstRoot);
+    // share what is left so a batch can not do more than that
+    double share = (maximumWork_-work_)/numberRoots;
+    for (int i=0;i<numberRoots;i++)
+      roots[i].maximumWork = share;
+    CglBKBatch batch;
+    batch.graph = &graph;
+    batch.search = search;
+    batch.roots = &roots[0];
+    batch.firstRoot = firstRoot;
+    CglRunTasks(numberRoots,numberThreads,searchRoot,&batch);
+    for (int iRoot=0;iRoot<numberRoots;iRoot++) {
+      CglBKRoot & root = roots[iRoot];
+      if (root.stopped&&root.maximumWork<maximumWork_-work_) {
+	/* Only ran out of its share - search again with all that is
+	   left so result is as if searched one by one */
+	root.maximumWork = maximumWork_-work_;
+	search[0]->search(graph,firstRoot+iRoot,root);
       }
-      bk2.numberCandidates_=numberCandidates;
-      // Intersection of not with neighborhood
-      int firstNot=numberPossible_;
-      for (int i=numberPossible_-1;i>=bk2.firstNot_;i--) {
-	int jColumn = newCandidates[i];
-	if (mark_[jColumn])
-	  newCandidates[--firstNot]=jColumn;
+      /* Take roots in order while within limit - first root going
+	 over (and any after it) dropped, as if searched one by one */
+      if (root.stopped||work_+root.work>maximumWork_) {
+	stopped_=true;
+	break;
       }
-      bk2.firstNot_=firstNot;
-      for (int j=start_[iColumn];j<start_[iColumn+1];j++) {
-	int jColumn = otherColumn_[j];
-	mark_[jColumn]=0;
+      work_ += root.work;
+      for (size_t i=0;i<root.dominated.size();i++)
+	dominated_[root.dominated[i]]++;
+      const int * clique = root.cliques.empty() ? NULL : &root.cliques[0];
+      const int * endClique = clique+root.cliques.size();
+      while (clique<endClique) {
+	int numberIn = *clique;
+	const int * column = clique+1;
+	clique = column+numberIn;
+	cliqueColumn.insert(cliqueColumn.end(),column,column+numberIn);
+	cliqueStart.push_back(static_cast<CoinBigIndex>(cliqueColumn.size()));
       }
-      //for (int i=0;i<numberColumns_;i++)
-      //assert (!mark_[i]);
-      bk2.bronKerbosch();
-      candidates_[--firstNot_]=iColumn;
     }
+    if (stopped_)
+      break;
+  }
+  int numberCliques = static_cast<int>(cliqueStart.size())-1;
+  if (numberCliques) {
+    std::vector<double> elements(cliqueColumn.size(),1.0);
+    cliqueMatrix_->appendRows(numberCliques,&cliqueStart[0],
+			      &cliqueColumn[0],&elements[0]);
   }
+  for (int i=0;i<numberThreads;i++)
+    delete search[i];
+  delete [] search;
+  delete [] order;
+  delete [] position;
 }
 // Creates strengthened smaller model
 OsiSolverInterface * 
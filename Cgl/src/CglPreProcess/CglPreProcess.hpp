@@ -136,6 +136,19 @@ public:
   /** Return a pointer to the original rows
       MUST be called before postProcess otherwise you just get 0,1,2.. */
   const int * originalRows();
+  /** Write model returned by preProcess as a binary model file (see
+      CoinModelFile) together with originalColumns() and originalRows(),
+      so later runs can load it with OsiSolverInterface::readModelFile
+      and skip both reading and preprocessing.  Rows dropped into cuts()
+      are written as a CglStoredFile to fileName with ".cuts" added (any
+      such file is removed if there are none).
+      A solution of the stored model maps back via the original columns
+      but postProcess still needs this object.
+      MUST be called before postProcess.  Returns 0 if OK, 1 if a write
+      failed. */
+  int writeProcessedModel(const char * fileName,
+			  const OsiSolverInterface & model,
+			  bool keepNames=true);
   /// Number of SOS if found
   inline int numberSOS() const
   { return numberSOS_;}
@@ -188,6 +201,16 @@ public:
   /// Set options
   inline void setOptions(int value)
   { options_=value;}
+  /// Set maximum search nodes when merging cliques (default 1.0e7)
+  inline void setMaximumCliqueWork(double value)
+  { maximumCliqueWork_=value;}
+  inline double maximumCliqueWork() const
+  { return maximumCliqueWork_;}
+  /// Set number of threads used when merging cliques (default 1)
+  inline void setNumberThreads(int value)
+  { numberThreads_=value;}
+  inline int numberThreads() const
+  { return numberThreads_;}
   //@}
 
   ///@name Cut generator methods 
@@ -349,6 +372,10 @@ private:
       8 - don't do cliques
   */
   int options_;
+  /// Maximum search nodes when merging cliques
+  double maximumCliqueWork_;
+  /// Number of threads used when merging cliques
+  int numberThreads_;
   /** Row types (may be NULL) 
       Carried around and corresponds to existing rows
       -1 added by preprocess e.g. x+y=1
@@ -360,14 +387,39 @@ private:
   CglStored cuts_;
  //@}
 };
+//#############################################################################
+/** A function that tests the methods in the CglPreProcess class. The
+    only reason for it not to be a member method is that this way it doesn't
+    have to be compiled into the library. And that's a gain, because the
+    library should be compiled with optimization on, but this method should be
+    compiled with debugging. */
+void CglPreProcessUnitTest(const OsiSolverInterface * siP,
+			   const std::string mpdDir );
 /// For Bron-Kerbosch
 class CglBK  {
+  friend void CglPreProcessUnitTest(const OsiSolverInterface * siP,
+				    const std::string mpdDir );
   
 public:
 
   ///@name Main methods 
   //@{
-  /// For recursive Bron-Kerbosch
+  /** Finds maximal cliques (more than two columns) by Bron-Kerbosch.
+
+      Uses Tomita pivoting (pivot covers most candidates) and goes
+      through root columns in degeneracy order, so each maximal clique
+      is found once, from its first column in that order.  For each
+      root the candidates (neighbours later in order) and nots
+      (neighbours earlier in order) are bitsets over the neighbourhood
+      of the root.  Roots are done in batches of fixed size, on
+      several threads if numberThreads()>1 - the cliques found do not
+      depend on the number of threads.  Search stops (keeping cliques
+      found so far) when more than maximumWork() nodes would be
+      searched.  Each root in a batch may use what was left at the
+      start of the batch but results are then taken in root order
+      while the total is within maximumWork() - the first root to go
+      over and those after it are dropped.
+  */
   void bronKerbosch();
   /// Creates strengthened smaller model
   OsiSolverInterface * newSolver(const OsiSolverInterface & model);
@@ -384,6 +436,22 @@ public:
 
   */
   //@{
+  /// Set maximum number of search nodes (default 1.0e7)
+  inline void setMaximumWork(double value)
+  { maximumWork_=value;}
+  inline double maximumWork() const
+  { return maximumWork_;}
+  /// Set number of threads (default 1)
+  inline void setNumberThreads(int value)
+  { numberThreads_=value;}
+  inline int numberThreads() const
+  { return numberThreads_;}
+  /// Number of search nodes in last bronKerbosch (roots kept)
+  inline double work() const
+  { return work_;}
+  /// True if last bronKerbosch stopped on maximumWork()
+  inline bool stopped() const
+  { return stopped_;}
   //@}
 
   //---------------------------------------------------------------------------
@@ -414,10 +482,8 @@ public:
 private:
   ///@name Private member data 
   //@{
-  /// Current candidates (created at each level)
+  /// Possible columns (numberPossible_)
   int * candidates_;
-  /// Array to mark stuff 
-  char * mark_;
   /// Starts for graph (numberPossible+1)
   int * start_;
   /// Other column/node
@@ -436,15 +502,16 @@ private:
   int numberRows_;
   /// Number possible
   int numberPossible_;
-  /// Current number of candidates
-  int numberCandidates_;
-  /// First not (stored backwards from numberPossible_)
-  int firstNot_;
-  /// Current number in clique
-  int numberIn_;
-  /// For acceleration
+  /// -1 if arrays to be deleted
   int left_;
-  int lastColumn_;
+  /// Maximum number of search nodes
+  double maximumWork_;
+  /// Search nodes in last bronKerbosch
+  double work_;
+  /// Number of threads
+  int numberThreads_;
+  /// True if last bronKerbosch stopped on work
+  bool stopped_;
  //@}
 };
 /**
@@ -0,0 +1,247 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <set>
+#include <algorithm>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "CoinModelFile.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CglPreProcess.hpp"
+
+
+// Conflict graph as model - one row x+y<=1 for each edge
+static OsiSolverInterface *
+conflictModel(const OsiSolverInterface * baseSiP, int numberColumns,
+	      const std::vector<int> & edges)
+{
+  int numberRows = static_cast<int>(edges.size())/2;
+  std::vector<CoinBigIndex> start(numberRows+1);
+  std::vector<double> element(2*numberRows,1.0);
+  for (int i=0;i<=numberRows;i++)
+    start[i]=2*i;
+  CoinPackedMatrix matrix(false,numberColumns,numberRows,2*numberRows,
+			  &element[0],&edges[0],&start[0],NULL);
+  std::vector<double> columnLower(numberColumns,0.0);
+  std::vector<double> columnUpper(numberColumns,1.0);
+  std::vector<double> objective(numberColumns,-1.0);
+  std::vector<double> rowLower(numberRows,-COIN_DBL_MAX);
+  std::vector<double> rowUpper(numberRows,1.0);
+  OsiSolverInterface * model = baseSiP->clone();
+  model->loadProblem(matrix,&columnLower[0],&columnUpper[0],&objective[0],
+		     &rowLower[0],&rowUpper[0]);
+  for (int i=0;i<numberColumns;i++)
+    model->setInteger(i);
+  return model;
+}
+
+// Maximal cliques (more than two columns) as sorted column lists
+static std::set<std::vector<int> >
+cliquesFound(const CoinPackedMatrix & cliqueMatrix)
+{
+  std::set<std::vector<int> > cliques;
+  for (int i=0;i<cliqueMatrix.getNumRows();i++) {
+    CoinBigIndex start = cliqueMatrix.getVectorStarts()[i];
+    const int * column = cliqueMatrix.getIndices()+start;
+    std::vector<int> clique(column,column+cliqueMatrix.getVectorSize(i));
+    std::sort(clique.begin(),clique.end());
+    cliques.insert(clique);
+  }
+  return cliques;
+}
+
+
+//--------------------------------------------------------------------------
+// test CglPreProcess
+void
+CglPreProcessUnitTest(
+  const OsiSolverInterface * baseSiP,
+  const std::string mpsDir )
+{
+  // Test default constructor and copy & assignment
+  {
+    CglPreProcess aPreProcess;
+    CglPreProcess rhs;
+    {
+      CglPreProcess bPreProcess;
+      CglPreProcess cPreProcess(bPreProcess);
+      rhs=bPreProcess;
+    }
+  }
+
+  // Bron-Kerbosch on small conflict graph
+  {
+    /* 0-1-2-3 complete, 2-3-4 triangle, 4-5-6 triangle, 6-7 and
+       0-1-7 triangle - maximal cliques of more than two are
+       {0,1,2,3}, {2,3,4}, {4,5,6} and {0,1,7} */
+    int edgeList[] = {0,1, 0,2, 0,3, 1,2, 1,3, 2,3, 2,4, 3,4,
+		      4,5, 4,6, 5,6, 6,7, 0,7, 1,7};
+    int numberEdges = static_cast<int>(sizeof(edgeList)/sizeof(int))/2;
+    std::vector<int> edges(edgeList,edgeList+2*numberEdges);
+    OsiSolverInterface * model = conflictModel(baseSiP,8,edges);
+    std::vector<char> rowType(numberEdges,0);
+    std::set<std::vector<int> > expected;
+    int clique0[] = {0,1,2,3};
+    int clique1[] = {2,3,4};
+    int clique2[] = {4,5,6};
+    int clique3[] = {0,1,7};
+    expected.insert(std::vector<int>(clique0,clique0+4));
+    expected.insert(std::vector<int>(clique1,clique1+3));
+    expected.insert(std::vector<int>(clique2,clique2+3));
+    expected.insert(std::vector<int>(clique3,clique3+3));
+    for (int numberThreads=1;numberThreads<=4;numberThreads*=4) {
+      CglBK bk(*model,&rowType[0],2*numberEdges);
+      bk.setNumberThreads(numberThreads);
+      bk.bronKerbosch();
+      assert (!bk.stopped());
+      assert (bk.cliqueMatrix_->getNumRows()==4);
+      assert (cliquesFound(*bk.cliqueMatrix_)==expected);
+      // every row apart from 6-7 is in a clique
+      for (int i=0;i<numberEdges;i++)
+	assert ((bk.dominated_[i]!=0)==(i!=11));
+      OsiSolverInterface * newModel = bk.newSolver(*model);
+      assert (newModel);
+      delete newModel;
+    }
+    delete model;
+  }
+
+  // Same cliques whatever the number of threads
+  {
+    // random graph with enough columns for several batches
+    int numberColumns = 700;
+    std::vector<int> edges;
+    unsigned int seed = 12345;
+    for (int i=0;i<numberColumns;i++) {
+      for (int j=i+1;j<numberColumns;j++) {
+	seed = 1103515245*seed+12345;
+	if (((seed>>16)&1023)<20) {
+	  edges.push_back(i);
+	  edges.push_back(j);
+	}
+      }
+    }
+    int numberEdges = static_cast<int>(edges.size())/2;
+    OsiSolverInterface * model = conflictModel(baseSiP,numberColumns,edges);
+    std::vector<char> rowType(numberEdges,0);
+    CoinPackedMatrix cliques[3];
+    std::vector<int> dominated[3];
+    double work[3];
+    for (int iRun=0;iRun<3;iRun++) {
+      CglBK bk(*model,&rowType[0],2*numberEdges);
+      bk.setNumberThreads(1<<iRun);
+      bk.bronKerbosch();
+      assert (!bk.stopped());
+      cliques[iRun] = *bk.cliqueMatrix_;
+      dominated[iRun].assign(bk.dominated_,bk.dominated_+numberEdges);
+      work[iRun] = bk.work();
+      delete bk.newSolver(*model);
+    }
+    assert (cliques[0].getNumRows()>0);
+    for (int iRun=1;iRun<3;iRun++) {
+      // same cliques in same order
+      assert (cliques[iRun].getNumRows()==cliques[0].getNumRows());
+      assert (cliques[iRun].getNumElements()==cliques[0].getNumElements());
+      assert (!memcmp(cliques[iRun].getIndices(),cliques[0].getIndices(),
+		      cliques[0].getNumElements()*sizeof(int)));
+      assert (dominated[iRun]==dominated[0]);
+      assert (work[iRun]==work[0]);
+    }
+    // work limit kept exactly and still same whatever threads
+    int numberKept[3];
+    for (int iRun=0;iRun<3;iRun++) {
+      CglBK bk(*model,&rowType[0],2*numberEdges);
+      bk.setNumberThreads(1<<iRun);
+      bk.setMaximumWork(0.5*work[0]);
+      bk.bronKerbosch();
+      assert (bk.stopped());
+      assert (bk.work()<=0.5*work[0]);
+      // cliques kept are first of those found without limit
+      const CoinPackedMatrix * kept = bk.cliqueMatrix_;
+      numberKept[iRun] = kept->getNumRows();
+      for (int i=0;i<numberKept[iRun];i++) {
+	int n = kept->getVectorSize(i);
+	assert (n==cliques[0].getVectorSize(i));
+	assert (!memcmp(kept->getIndices()+kept->getVectorStarts()[i],
+			cliques[0].getIndices()+cliques[0].getVectorStarts()[i],
+			n*sizeof(int)));
+      }
+      delete bk.newSolver(*model);
+    }
+    assert (numberKept[0]<cliques[0].getNumRows());
+    assert (numberKept[1]==numberKept[0]&&numberKept[2]==numberKept[0]);
+    delete model;
+  }
+
+  // Preprocessed model written and read back
+  {
+    OsiSolverInterface  * siP = baseSiP->clone();
+    siP->messageHandler()->setLogLevel(0);
+    std::string fn = mpsDir+"p0033";
+    siP->readMps(fn.c_str(),"mps");
+    siP->initialSolve();
+    CglPreProcess process;
+    process.messageHandler()->setLogLevel(0);
+    OsiSolverInterface * processed = process.preProcess(*siP,false,5);
+    assert (processed);
+    int numberRows = processed->getNumRows();
+    int numberColumns = processed->getNumCols();
+    assert (numberColumns<=siP->getNumCols());
+    const char * fileName = "CglPreProcess.bin";
+    // cuts file left from an earlier run
+    std::string cutName = std::string(fileName)+".cuts";
+    FILE * fp = fopen(cutName.c_str(),"w");
+    assert (fp);
+    fclose(fp);
+    assert (!process.writeProcessedModel(fileName,*processed));
+    fp = fopen(cutName.c_str(),"rb");
+    assert ((fp!=NULL)==(process.cuts().sizeRowCuts()>0));
+    if (fp)
+      fclose(fp);
+    OsiSolverInterface * readBack = baseSiP->clone();
+    readBack->messageHandler()->setLogLevel(0);
+    assert (!readBack->readModelFile(fileName,true));
+    assert (readBack->getNumRows()==numberRows);
+    assert (readBack->getNumCols()==numberColumns);
+    assert (readBack->getNumElements()==processed->getNumElements());
+    assert (readBack->getMatrixByCol()->isEquivalent(*processed->getMatrixByCol()));
+    assert (!memcmp(readBack->getObjCoefficients(),
+		    processed->getObjCoefficients(),
+		    numberColumns*sizeof(double)));
+    for (int i=0;i<numberColumns;i++) {
+      assert (readBack->getColLower()[i]==processed->getColLower()[i]);
+      assert (readBack->getColUpper()[i]==processed->getColUpper()[i]);
+      assert (readBack->isInteger(i)==processed->isInteger(i));
+    }
+    // mapping to original
+    CoinModelFile file;
+    assert (!file.open(fileName,true));
+    assert (file.originalColumns());
+    assert (!memcmp(file.originalColumns(),process.originalColumns(),
+		    numberColumns*sizeof(int)));
+    if (file.originalRows())
+      assert (!memcmp(file.originalRows(),process.originalRows(),
+		      numberRows*sizeof(int)));
+    file.close();
+    // same objective
+    processed->initialSolve();
+    readBack->initialSolve();
+    assert (readBack->isProvenOptimal());
+    assert (readBack->getObjValue()==processed->getObjValue());
+    delete readBack;
+    remove(fileName);
+    remove(cutName.c_str());
+    delete siP;
+  }
+}
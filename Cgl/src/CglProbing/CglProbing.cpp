@@ -9,6 +9,7 @@
 #include <cfloat>
 #include <cassert>
 #include <iostream>
+#include <vector>
 #define PROBING100 0
 //#define PRINT_DEBUG
 //#define CGL_DEBUG 1
@@ -20,6 +21,8 @@
 #include "CoinFinite.hpp"
 #include "OsiRowCutDebugger.hpp"
 #include "CglProbing.hpp"
+#include "CglPropagator.hpp"
+#include "CglThread.hpp"
 //#define PROBING_EXTRA_STUFF true
 #define PROBING_EXTRA_STUFF false
 #define FIXED_ALLOWANCE 10
@@ -37,6 +40,17 @@ public:
 typedef struct {
   int index, next;
 } CoinHashLink;
+// Adjust count of users of shared snapshot matrices and return new count
+static int changeUsers(int * count, int change)
+{
+#ifdef __GNUC__
+  // clones may be deleted on other threads
+  return __sync_add_and_fetch(count,change);
+#else
+  *count += change;
+  return *count;
+#endif
+}
 static double multiplier[] = {1.23456789e2,-9.87654321};
 static int hashCut (const OsiRowCut2 & x, int size) 
 {
@@ -139,6 +153,20 @@ public:
   }
   OsiRowCut2 * cut(int i) const
   { return rowCut_[i];}
+  // Forgets cuts so can be used again
+  void clear()
+  {
+    if (!numberCuts_)
+      return;
+    for (int i=0;i<numberCuts_;i++)
+      delete rowCut_[i];
+    for (int i=0;i<hashSize_;i++) {
+      hash_[i].index=-1;
+      hash_[i].next=-1;
+    }
+    numberCuts_=0;
+    lastHash_=-1;
+  }
   int numberCuts() const
   { return numberCuts_;}
   inline bool outOfSpace() const
@@ -389,11 +417,9 @@ static void checkBounds(const OsiRowCutDebugger * debugger,OsiColCut & cut)
 // It may also declare rows to be redundant
 int 
 CglProbing::tighten(double *colLower, double * colUpper,
-                    const int *column, const double *rowElements, 
-                    const CoinBigIndex *rowStart, 
-		    const CoinBigIndex * rowStartPos,const int * rowLength,
+                    const CoinPackedMatrix & rowCopy,
                     double *rowLower, double *rowUpper, 
-                    int nRows,int nCols,char * intVar,int maxpass,
+                    char * intVar,int maxpass,
                     double tolerance)
 {
   int i, j, k, kre;
@@ -403,218 +429,40 @@ CglProbing::tighten(double *colLower, double * colUpper,
   int ntotal=0,nchange=1,jpass=0;
   double dmaxup, dmaxdown, dbound;
   int ninfeas=0;
-  // For clique stuff
-  double * cliqueMin=NULL;
-  double * cliqueMax=NULL;
-  // And second best ones
-  double * cliqueMin2 = NULL;
-  double * cliqueMax2 = NULL;
-  if (cliqueRowStart_&&numberRows_&&cliqueRowStart_[numberRows_]) {
-    cliqueMin = new double[nCols];
-    cliqueMax = new double[nCols];
-    cliqueMin2 = new double[nCols];
-    cliqueMax2 = new double[nCols];
-  } else {
-    // do without cliques and using sorted version
-    assert (rowStartPos);
-    while(nchange) {
-      nchange = 0; 
-      if (jpass==maxpass) break;
-      jpass++;
-      dolrows = (jpass & 1) == 1;
-      
+  int nRows = rowCopy.getNumRows();
+  int nCols = rowCopy.getNumCols();
+  if (!cliqueRowStart_||!numberRows_||!cliqueRowStart_[numberRows_]) {
+    /* do without cliques - only rows whose activities change
+       are looked at again (at most maxpass times number of rows) */
+    CglPropagator propagator(rowCopy,rowLower,rowUpper,colLower,colUpper,
+			     intVar,1.0e12);
+    propagator.setPrimalTolerance(tolerance);
+    if (propagator.propagate(maxpass*nRows)<0)
+      ninfeas=1;
+    CoinMemcpyN(propagator.colLower(),nCols,colLower);
+    CoinMemcpyN(propagator.colUpper(),nCols,colUpper);
+    if (!ninfeas) {
       for (i = 0; i < nRows; ++i) {
-	if (rowLower[i]>-1.0e20||rowUpper[i]<1.0e20) {
-	  int iflagu = 0;
-	  int iflagl = 0;
-	  double dmaxup = 0.0;
-	  double dmaxdown = 0.0;
-	  int krs = rowStart[i];
-	  int krs2 = rowStartPos[i];
-	  int kre = rowStart[i]+rowLength[i];
-	  
-	  /* ------------------------------------------------------------*/
-	  /* Compute L(i) and U(i) */
-	  /* ------------------------------------------------------------*/
-	  for (k = krs; k < krs2; ++k) {
-	    double value=rowElements[k];
-	    int j = column[k];
-	    if (colUpper[j] < 1.0e12) 
-	      dmaxdown += colUpper[j] * value;
-	    else
-	      ++iflagl;
-	    if (colLower[j] > -1.0e12) 
-	      dmaxup += colLower[j] * value;
-	    else
-	      ++iflagu;
-	  }
-	  for (k = krs2; k < kre; ++k) {
-	    double value=rowElements[k];
-	    int j = column[k];
-	    if (colUpper[j] < 1.0e12) 
-	      dmaxup += colUpper[j] * value;
-	    else
-	      ++iflagu;
-	    if (colLower[j] > -1.0e12) 
-	      dmaxdown += colLower[j] * value;
-	    else
-	      ++iflagl;
-	  }
-	  if (iflagu)
-	    dmaxup=1.0e31;
-	  if (iflagl)
-	    dmaxdown=-1.0e31;
-	  if (dmaxup <= rowUpper[i] + tolerance && dmaxdown >= rowLower[i] - tolerance) {
-	    /*
-	     * The sum of the column maxs is at most the row ub, and
-	     * the sum of the column mins is at least the row lb;
-	     * this row says nothing at all.
-	     * I suspect that this corresponds to
-	     * an implied column singleton in the paper (viii, on p. 325),
-	     * where the singleton in question is the row slack.
-	     */
-	    ++nchange;
-	    rowLower[i]=-COIN_DBL_MAX;
-	    rowUpper[i]=COIN_DBL_MAX;
-	  } else {
-	    if (dmaxup < rowLower[i] -tolerance || dmaxdown > rowUpper[i]+tolerance) {
-	      ninfeas++;
-	      break;
-	    }
-	    /*        Finite U(i) */
-	    /* -------------------------------------------------------------*/
-	    /* below is deliberate mistake (previously was by chance) */
-	    /*        never do both */
-	    if (iflagu == 0 && rowLower[i] > 0.0 && iflagl == 0 && rowUpper[i] < 1e15) {
-	      if (dolrows) {
-		iflagu = 1;
-	      } else {
-		iflagl = 1;
-	      }
-	    }
-	    if (iflagu == 0 && rowLower[i] > -1e15) {
-	      for (k = krs; k < kre; ++k) {
-		double value=rowElements[k];
-		j = column[k];
-		if (value > 0.0) {
-		  if (colUpper[j] < 1.0e12) {
-		    dbound = colUpper[j] + (rowLower[i] - dmaxup) / value;
-		    if (dbound > colLower[j] + 1.0e-8) {
-		      /* we can tighten the lower bound */
-		      /* the paper mentions this as a possibility on p. 227 */
-		      colLower[j] = dbound;
-		      ++nchange;
-		      
-		      /* this may have fixed the variable */
-		      /* I believe that this roughly corresponds to a
-		       * forcing constraint in the paper (p. 226).
-		       * If there is a forcing constraint (with respect
-		       * to the original, untightened bounds), then in this 
-		       * loop we will go through all the columns and fix
-		       * each of them to their implied bound, rather than
-		       * determining that the row as a whole is forced
-		       * and just fixing them without doing computation for
-		       * each column (as in the paper).
-		       * By doing it this way, we can tighten bounds and
-		       * get forcing constraints for free.
-		       */
-		      if (colUpper[j] - colLower[j] <= tolerance) {
-			/* --------------------------------------------------*/
-			/*                check if infeasible !!!!! */
-			/* --------------------------------------------------*/
-			if (colUpper[j] - colLower[j] < -100.0*tolerance) {
-			  ninfeas++;
-			}
-		      }
-		    }
-		  }
-		} else {
-		  if (colLower[j] > -1.0e12) {
-		    dbound = colLower[j] + (rowLower[i] - dmaxup) / value;
-		    if (dbound < colUpper[j] - 1.0e-8) {
-		      colUpper[j] = dbound;
-		      ++nchange;
-		      if (colUpper[j] - colLower[j] <= tolerance) {
-			/* --------------------------------------------------*/
-			/*                check if infeasible !!!!! */
-			/* --------------------------------------------------*/
-			if (colUpper[j] - colLower[j] < -100.0*tolerance) {
-			  ninfeas++;
-			}
-		      }
-		    }
-		  }
-		}
-	      }
-	    }
-	    
-	    /* ----------------------------------------------------------------*/
-	    /*        Finite L(i) */
-	    /* ----------------------------------------------------------------*/
-	    if (iflagl == 0 && rowUpper[i] < 1e15) {
-	      for (k = krs; k < kre; ++k) {
-		double value=rowElements[k];
-		j = column[k];
-		if (value < 0.0) {
-		  if (colUpper[j] < 1.0e12) {
-		    dbound = colUpper[j] + (rowUpper[i] - dmaxdown) / value;
-		    if (dbound > colLower[j] + 1.0e-8) {
-		      colLower[j] = dbound;
-		      ++nchange;
-		      if (! (colUpper[j] - colLower[j] > tolerance)) {
-			/* --------------------------------------------------*/
-			/*                check if infeasible !!!!! */
-			/* --------------------------------------------------*/
-			if (colUpper[j] - colLower[j] < -100.0*tolerance) {
-			  ninfeas++;
-			}
-		      }
-		    }
-		  } 
-		} else {
-		  if (colLower[j] > -1.0e12) {
-		    dbound = colLower[j] + (rowUpper[i] - dmaxdown) / value;
-		    if (dbound < colUpper[j] - 1.0e-8) {
-		      colUpper[j] = dbound;
-		      ++nchange;
-		      if (! (colUpper[j] - colLower[j] > tolerance)) {
-			/* --------------------------------------------------*/
-			/*                check if infeasible !!!!! */
-			/* --------------------------------------------------*/
-			if (colUpper[j] - colLower[j] < -100.0*tolerance) {
-			  ninfeas++;
-			}
-		      }
-		    }
-		  }
-		}
-	      }
-	    }
-	  }
-	}
-      }
-      for (j = 0; j < nCols; ++j) {
-	if (intVar[j]) {
-	  if (colUpper[j]-colLower[j]>1.0e-8) {
-	    if (floor(colUpper[j]+1.0e-4)<colUpper[j]) 
-	      nchange++;
-	    // clean up anyway
-	    colUpper[j]=floor(colUpper[j]+1.0e-4);
-	    if (ceil(colLower[j]-1.0e-4)>colLower[j]) 
-	      nchange++;
-	    // clean up anyway
-	    colLower[j]=ceil(colLower[j]-1.0e-4);
-	    if (colUpper[j]<colLower[j]) {
-	      /*printf("infeasible\n");*/
-	      ninfeas++;
-	    }
-	  }
+	if (propagator.maximumActivity(i) <= rowUpper[i] + tolerance &&
+	    propagator.minimumActivity(i) >= rowLower[i] - tolerance) {
+	  // this row says nothing at all
+	  rowLower[i]=-COIN_DBL_MAX;
+	  rowUpper[i]=COIN_DBL_MAX;
 	}
       }
-      if (ninfeas) break;
     }
     return (ninfeas);
   }
+  const int * column = rowCopy.getIndices();
+  const CoinBigIndex * rowStart = rowCopy.getVectorStarts();
+  const int * rowLength = rowCopy.getVectorLengths(); 
+  const double * rowElements = rowCopy.getElements();
+  // For clique stuff
+  double * cliqueMin = new double[nCols];
+  double * cliqueMax = new double[nCols];
+  // And second best ones
+  double * cliqueMin2 = new double[nCols];
+  double * cliqueMax2 = new double[nCols];
   
   while(nchange) {
     int ilbred = 0; /* bounds reduced */
@@ -1143,81 +991,26 @@ CglProbing::tighten(double *colLower, double * colUpper,
 }
 // This just sets minima and maxima on rows
 void 
-CglProbing::tighten2(double *colLower, double * colUpper,
-		     const int *column, const double *rowElements, 
-		     const CoinBigIndex *rowStart, 
-		     const int * rowLength,
-		     double *rowLower, double *rowUpper, 
-		     double * minR, double * maxR, int * markR,
-		     int nRows)
+CglProbing::tighten2(const double *colLower, const double * colUpper,
+		     const CoinPackedMatrix & rowCopy,
+		     const double *rowLower, const double *rowUpper, 
+		     double * minR, double * maxR, int * markR)
 {
-  int i, j, k, kre;
-  int krs;
-  int iflagu, iflagl;
-  double dmaxup, dmaxdown;
-
-  for (i = 0; i < nRows; ++i) {
+  // activities kept by propagator (bounds from 1.0e12 are infinite)
+  CglPropagator propagator(rowCopy,rowLower,rowUpper,colLower,colUpper,
+			   NULL,1.0e12);
+  int nRows = propagator.numberRows();
+  for (int i = 0; i < nRows; ++i) {
     if (rowLower[i]>-1.0e20||rowUpper[i]<1.0e20) {
-      iflagu = 0;
-      iflagl = 0;
-      dmaxup = 0.0;
-      dmaxdown = 0.0;
-      krs = rowStart[i];
-      kre = rowStart[i]+rowLength[i];
-      
-      /* ------------------------------------------------------------*/
-      /* Compute L(i) and U(i) */
-      /* ------------------------------------------------------------*/
-      for (k = krs; k < kre; ++k) {
-	double value=rowElements[k];
-	j = column[k];
-	if (value > 0.0) {
-	  if (colUpper[j] < 1.0e12) 
-	    dmaxup += colUpper[j] * value;
-	  else
-	    ++iflagu;
-	  if (colLower[j] > -1.0e12) 
-	    dmaxdown += colLower[j] * value;
-	  else
-	    ++iflagl;
-	} else if (value<0.0) {
-	  if (colUpper[j] < 1.0e12) 
-	    dmaxdown += colUpper[j] * value;
-	  else
-	    ++iflagl;
-	  if (colLower[j] > -1.0e12) 
-	    dmaxup += colLower[j] * value;
-	  else
-	    ++iflagu;
-	}
-      }
-      if (iflagu)
-	maxR[i]=1.0e60;
-      else
-	maxR[i]=dmaxup;
-      if (iflagl) 
-	minR[i]=-1.0e60;
-      else
-	minR[i]=dmaxdown;
-#if 0
-      if (minR[i]<-1.0e10&&maxR[i]>1.0e10) {
-	markR[i]=-2;
-      } else {
-#endif
-	markR[i]=-1;
-#if 0
-      }
-#endif
+      double value = propagator.maximumActivity(i);
+      maxR[i] = (value==COIN_DBL_MAX) ? 1.0e60 : value;
+      value = propagator.minimumActivity(i);
+      minR[i] = (value==-COIN_DBL_MAX) ? -1.0e60 : value;
     } else {
       minR[i]=-1.0e60;
       maxR[i]=1.0e60;
-#if 0
-      markR[i]=-2;
-      abort();
-#else
-      markR[i]=-1;
-#endif
     }
+    markR[i]=-1;
   }
 }
 #ifdef CGL_DEBUG
@@ -1262,17 +1055,20 @@ void CglProbing::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
       rowCuts_=-rowCuts_;
   }
   int nRows=si.getNumRows(); 
-  double * rowLower = new double[nRows+1];
-  double * rowUpper = new double[nRows+1];
-
   int nCols=si.getNumCols();
+  // bounds are only wanted during call so can come from workspace
+  workspace_.reset(2*CglWorkspace::bytes(nRows+1,sizeof(double))+
+		   2*CglWorkspace::bytes(nCols,sizeof(double)));
+  double * rowLower = workspace_.doubleArray(nRows+1);
+  double * rowUpper = workspace_.doubleArray(nRows+1);
+
   // Set size if not set
   if (!rowCopy_) {
     numberRows_=nRows;
     numberColumns_=nCols;
   }
-  double * colLower = new double[nCols];
-  double * colUpper = new double[nCols];
+  double * colLower = workspace_.doubleArray(nCols);
+  double * colUpper = workspace_.doubleArray(nCols);
 
   CglTreeInfo info = info2;
   int ninfeas=gutsOfGenerateCuts(si,cs,rowLower,rowUpper,colLower,colUpper,&info);
@@ -1288,10 +1084,6 @@ void CglProbing::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
       assert(!debugger->invalidCut(rc)); 
 #endif
   }
-  delete [] rowLower;
-  delete [] rowUpper;
-  delete [] colLower;
-  delete [] colUpper;
   delete [] colLower_;
   delete [] colUpper_;
   colLower_	= NULL;
@@ -1627,6 +1419,591 @@ bool analyze(const OsiSolverInterface * solverX, char * intVar,
   delete solver;
   return feasible;
 }
+namespace {
+  /* Rows probing works on - nSource rows of base, then rows of solver
+     from firstExtra on (nExtra of them), then objective row if any */
+  struct ProbingRows {
+    const CoinPackedMatrix * base;
+    int nSource;
+    const CoinPackedMatrix * solver;
+    int firstExtra;
+    int nExtra;
+    int numberObjective;
+    const int * objectiveColumn;
+    const double * objectiveElement;
+    int nRealRows;
+    // Gets row i and returns its length
+    int row(int i, const int *& rowColumn, const double *& rowElement) const
+    {
+      const CoinPackedMatrix * matrix;
+      if (i<nSource) {
+	matrix = base;
+      } else if (i<nSource+nExtra) {
+	matrix = solver;
+	i += firstExtra-nSource;
+      } else {
+	rowColumn = objectiveColumn;
+	rowElement = objectiveElement;
+	return numberObjective;
+      }
+      CoinBigIndex start = matrix->getVectorStarts()[i];
+      rowColumn = matrix->getIndices()+start;
+      rowElement = matrix->getElements()+start;
+      return matrix->getVectorLengths()[i];
+    }
+    // Row of solver for row i (-1 if objective)
+    int realRow(int i) const
+    {
+      if (i<nSource)
+	return (i<nRealRows) ? i : -1;
+      else if (i<nSource+nExtra)
+	return i+firstExtra-nSource;
+      else
+	return -1;
+    }
+  };
+}
+/* Returns number of leading rows of matrix which have same indices and
+   elements as rows of base */
+static int sameRows(const CoinPackedMatrix & base,
+		    const CoinPackedMatrix & matrix)
+{
+  if (base.getNumCols()!=matrix.getNumCols())
+    return 0;
+  int n = CoinMin(base.getNumRows(),matrix.getNumRows());
+  const CoinBigIndex * baseStart = base.getVectorStarts();
+  const int * baseLength = base.getVectorLengths();
+  const int * baseColumn = base.getIndices();
+  const double * baseElement = base.getElements();
+  const CoinBigIndex * start = matrix.getVectorStarts();
+  const int * length = matrix.getVectorLengths();
+  const int * column = matrix.getIndices();
+  const double * element = matrix.getElements();
+  int i;
+  for (i=0;i<n;i++) {
+    int nEl = length[i];
+    if (nEl!=baseLength[i]||
+	memcmp(column+start[i],baseColumn+baseStart[i],nEl*sizeof(int))||
+	memcmp(element+start[i],baseElement+baseStart[i],nEl*sizeof(double)))
+      break;
+  }
+  return i;
+}
+/* Packs row into elements and column from size on leaving out fixed
+   columns and zeros with negative elements first.  Sets startPos to
+   first positive and returns offset to row bounds from fixed columns.
+   elements2 and column2 must have room for row. */
+static double packProbingRow(int length, const int * rowColumn,
+			     const double * rowElement,
+			     const double * colLower, const double * colUpper,
+			     double * elements, int * column,
+			     CoinBigIndex & size, CoinBigIndex & startPos,
+			     double * elements2, int * column2)
+{
+  double offset = 0.0;
+  int nOther=0;
+  for (int j=0;j<length;j++) { 
+    int iColumn = rowColumn[j];
+    if (colUpper[iColumn]>colLower[iColumn]) {
+      double value = rowElement[j];
+      if (value<0.0) {
+	elements[size]=value;
+	column[size++]=iColumn;
+      } else if (value>0.0) {
+	elements2[nOther]=value;
+	column2[nOther++]=iColumn;
+      }
+    } else {
+      offset += colUpper[iColumn]*rowElement[j];
+    }
+  }
+  startPos = size;
+  for (int k=0;k<nOther;k++) {
+    elements[size]=elements2[k];
+    column[size++]=column2[k];
+  }
+  return offset;
+}
+/* Builds the row copy used by probing.  Rows are those of snapshotRows
+   (if given) followed by rows added to solver since snapshot, or rows
+   of solverRows followed by an objective row if objectiveColumn given.
+   rowLower and rowUpper must be laid out the same way.  Rows with more
+   than maxElements (real rows only) and free rows are left out and
+   rowLower, rowUpper are packed to match.  Elements for fixed columns
+   are taken out (adjusting row bounds) and in each row negative
+   elements come before positive ones with rowStartPos pointing to first
+   positive.  If info->strengthenRow then rows which can be strengthened
+   are changed and strengthened rows saved there.  realRows is set up if
+   strengthenRow and rows were left out.
+   Matrices are only read so they may be the solver's matrix or a shared
+   snapshot.  columnCopy is set to a column copy of the result.
+   Returns NULL if no rows left.
+   Unless there are rows to strengthen the copies are kept.  They are
+   used again while the same base rows are kept and the same columns are
+   fixed - base rows are the snapshot or, without one, leading rows of
+   solver which have not changed since copies were made.  Then only row
+   bounds are redone and rows after base rows (cuts added to solver and
+   objective) are put in place in spare room at end of row copy and at
+   end of each column of column copy.  Kept copies (including
+   rowStartPos) are owned by probingUsers_ so caller must not delete
+   them.
+*/
+CoinPackedMatrix * 
+CglProbing::probingRowCopy(const CoinPackedMatrix * snapshotRows,
+			   const CoinPackedMatrix & solverRows,
+			   int numberObjective,
+			   const int * objectiveColumn,
+			   const double * objectiveElement,
+			   const double * colLower, const double * colUpper,
+			   const char * intVar, int maxElements,
+			   double * rowLower, double * rowUpper,
+			   CoinBigIndex *& rowStartPos,
+			   int *& realRows, CoinPackedMatrix *& columnCopy,
+			   CglTreeInfo * info)
+{
+  int nCols = solverRows.getNumCols();
+  int nRealRows = solverRows.getNumRows();
+  bool keep = !(info->strengthenRow&&!info->pass);
+  ProbingRows rows;
+  rows.solver = &solverRows;
+  rows.numberObjective = numberObjective;
+  rows.objectiveColumn = objectiveColumn;
+  rows.objectiveElement = objectiveElement;
+  rows.nRealRows = nRealRows;
+  bool sameBase = true;
+  if (snapshotRows) {
+    rows.base = snapshotRows;
+    rows.nSource = numberRows_;
+    rows.firstExtra = numberSolverRows_;
+  } else {
+    rows.base = &solverRows;
+    rows.nSource = nRealRows;
+    if (keep&&probingBase_) {
+      int nSame = sameRows(*probingBase_,solverRows);
+      if (nSame<probingBase_->getNumRows()) {
+	// changed - rows still same (if any) will be base
+	sameBase = false;
+	if (nSame)
+	  rows.nSource = nSame;
+      } else {
+	rows.nSource = nSame;
+      }
+    } else {
+      sameBase = false;
+    }
+    rows.firstExtra = rows.nSource;
+  }
+  rows.nExtra = CoinMax(nRealRows-rows.firstExtra,0);
+  int nSource = rows.nSource;
+  int nRows = nSource + rows.nExtra + (objectiveColumn ? 1 : 0);
+  int i;
+  CoinBigIndex nElements=0;
+  int nTotalOut=0;
+  int maxLength=0;
+  const int * rowColumn;
+  const double * rowElement;
+  for (i=0;i<nRows;i++) {
+    int length = rows.row(i,rowColumn,rowElement);
+    nElements += length;
+    maxLength = CoinMax(maxLength,length);
+    if (length>maxElements||(rowLower[i]<-1.0e20&&rowUpper[i]>1.0e20)) {
+      // keep objective
+      if (rows.realRow(i)>=0) 
+	nTotalOut+=length;
+    }
+  }
+  // keep all if only a few dense
+  if (nTotalOut*10<nElements)
+    maxElements=nCols;
+  columnCopy=NULL;
+  int * key = NULL;
+  if (keep) {
+    // base rows kept and then columns fixed
+    key = new int [nSource+nCols+2];
+    int nKey=1;
+    for (i=0;i<nSource;i++) {
+      int length = rows.row(i,rowColumn,rowElement);
+      if ((length<=maxElements||rows.realRow(i)<0)&&
+	  (rowLower[i]>=-1.0e20||rowUpper[i]<=1.0e20)) 
+	key[nKey++]=i;
+    }
+    key[0]=nKey-1;
+    int nKeepBase=key[0];
+    int iFixed=nKey++;
+    for (i=0;i<nCols;i++) {
+      if (!(colUpper[i]>colLower[i]))
+	key[nKey++]=i;
+    }
+    key[iFixed]=nKey-iFixed-1;
+    if (sameBase&&probingKey_&&
+	probingKey_[0]==nKeepBase&&
+	probingKey_[nKeepBase+1]==key[iFixed]&&
+	!memcmp(probingKey_,key,nKey*sizeof(int))) {
+      // same as last time - bounds and rows after base
+      CoinPackedMatrix * rowCopy = probingRowCopy_;
+      CoinPackedMatrix * columnCopy2 = probingColumnCopy_;
+      double * elements = rowCopy->getMutableElements();
+      int * column = rowCopy->getMutableIndices();
+      CoinBigIndex * rowStart = rowCopy->getMutableVectorStarts();
+      int * rowLength = rowCopy->getMutableVectorLengths();
+      double * columnElements = columnCopy2->getMutableElements();
+      int * row = columnCopy2->getMutableIndices();
+      const CoinBigIndex * columnStart = columnCopy2->getVectorStarts();
+      int * columnLength = columnCopy2->getMutableVectorLengths();
+      int nOver=0;
+      bool fits = true;
+      if (nRows>nSource||rowCopy->getNumRows()>nKeepBase) {
+	// must be only user and have room
+	fits = (probingUsers_[0]==1);
+	int * count = NULL;
+	if (fits) {
+	  count = new int [nCols];
+	  CoinZeroN(count,nCols);
+	}
+	for (i=nSource;i<nRows&&fits;i++) {
+	  int length = rows.row(i,rowColumn,rowElement);
+	  if ((length>maxElements&&rows.realRow(i)>=0)||
+	      (rowLower[i]<-1.0e20&&rowUpper[i]>1.0e20)) 
+	    continue;
+	  nOver++;
+	  for (int j=0;j<length;j++) {
+	    int iColumn = rowColumn[j];
+	    if (colUpper[iColumn]>colLower[iColumn]&&rowElement[j]) {
+	      count[iColumn]++;
+	      if (columnStart[iColumn]+probingColumnLength_[iColumn]+
+		  count[iColumn]>columnStart[iColumn+1]) {
+		fits = false;
+		break;
+	      }
+	    }
+	  }
+	}
+	if (nKeepBase+nOver>rowCopy->getMaxMajorDim())
+	  fits = false;
+	delete [] count;
+      }
+      if (fits) {
+	delete [] key;
+	for (int k=0;k<nKeepBase;k++) {
+	  i=probingKey_[k+1];
+	  int length = rows.row(i,rowColumn,rowElement);
+	  double offset = 0.0;
+	  for (int j=0;j<length;j++) {
+	    int iColumn = rowColumn[j];
+	    if (!(colUpper[iColumn]>colLower[iColumn]))
+	      offset += colUpper[iColumn]*rowElement[j];
+	  }
+	  rowLower[k]=rowLower[i];
+	  rowUpper[k]=rowUpper[i];
+	  if (offset) {
+	    if (rowLower[k]>-1.0e20)
+	      rowLower[k] -= offset;
+	    if (rowUpper[k]<1.0e20)
+	      rowUpper[k] -= offset;
+	  }
+	}
+	int nKeep = nKeepBase;
+	int * which = NULL;
+	if (nKeepBase<nRows&&info->strengthenRow) {
+	  which = new int [nRows];
+	  for (int k=0;k<nKeepBase;k++) 
+	    which[k]=probingKey_[k+1];
+	}
+	if (nOver||rowCopy->getNumRows()>nKeepBase) {
+	  // put in rows after base
+	  CoinMemcpyN(probingColumnLength_,nCols,columnLength);
+	  CoinBigIndex newSize = rowStart[nKeepBase];
+	  double * work = new double [maxLength];
+	  int * column2 = new int [maxLength];
+	  for (i=nSource;i<nRows;i++) {
+	    int length = rows.row(i,rowColumn,rowElement);
+	    if ((length>maxElements&&rows.realRow(i)>=0)||
+		(rowLower[i]<-1.0e20&&rowUpper[i]>1.0e20)) 
+	      continue;
+	    rowLower[nKeep]=rowLower[i];
+	    rowUpper[nKeep]=rowUpper[i];
+	    rowStart[nKeep]=newSize;
+	    double offset = 
+	      packProbingRow(length,rowColumn,rowElement,colLower,colUpper,
+			     elements,column,newSize,probingRowStartPos_[nKeep],
+			     work,column2);
+	    rowLength[nKeep]=newSize-rowStart[nKeep];
+	    for (CoinBigIndex j=rowStart[nKeep];j<newSize;j++) {
+	      int iColumn = column[j];
+	      CoinBigIndex put = columnStart[iColumn]+columnLength[iColumn];
+	      columnLength[iColumn]++;
+	      columnElements[put]=elements[j];
+	      row[put]=nKeep;
+	    }
+	    if (offset) {
+	      if (rowLower[nKeep]>-1.0e20)
+		rowLower[nKeep] -= offset;
+	      if (rowUpper[nKeep]<1.0e20)
+		rowUpper[nKeep] -= offset;
+	    }
+	    if (which)
+	      which[nKeep]=i;
+	    nKeep++;
+	  }
+	  delete [] work;
+	  delete [] column2;
+	  rowStart[nKeep]=newSize;
+	  rowCopy->setMajorDim(nKeep);
+	  rowCopy->setNumElements(newSize);
+	  columnCopy2->setMinorDim(nKeep);
+	  columnCopy2->setNumElements(newSize);
+	}
+	if (which) {
+	  if (nKeep<nRows) {
+	    // Set up pointers to real rows
+	    realRows = new int [nRows];
+	    CoinZeroN(realRows,nRows);
+	    for (int k=0;k<nKeep;k++) 
+	      realRows[k] = rows.realRow(which[k]);
+	  }
+	  delete [] which;
+	}
+	rowStartPos = probingRowStartPos_;
+	columnCopy = columnCopy2;
+	return rowCopy;
+      }
+    }
+  }
+  // room for twice as many rows after base (and at least 32 more)
+  int maxRows = key ? nRows+(nRows-nSource)+32 : nRows;
+  CoinBigIndex maxSize = key ? 2*nElements+8*nCols : nElements;
+  double * elements = new double [maxSize];
+  int * column = new int [maxSize];
+  CoinBigIndex * rowStart = new CoinBigIndex [maxRows+1];
+  int * rowLength = new int [maxRows];
+  rowStartPos = new CoinBigIndex [maxRows];
+  // which source row each kept row came from
+  int * which = new int [nRows];
+  // strengthened row and positive elements of row
+  double * work = new double [2*maxLength];
+  double * elements2 = work+maxLength;
+  int * column2 = new int [maxLength];
+  int nKeep=0;
+  CoinBigIndex newSize=0;
+  for (i=0;i<nRows;i++) {
+    int length = rows.row(i,rowColumn,rowElement);
+    if ((length>maxElements&&rows.realRow(i)>=0)||
+	(rowLower[i]<-1.0e20&&rowUpper[i]>1.0e20)) 
+      continue;
+    if (info->strengthenRow&&!info->pass&&(rowLower[i]<-1.0e20||rowUpper[i]>1.0e20)) {
+      int nPlus=0;
+      int nMinus=0;
+      for (int j=0;j<length;j++) {
+	int jColumn=rowColumn[j];
+	if (intVar[jColumn]&&colLower[jColumn]==0.0&&colUpper[jColumn]==1.0) {
+	  double value=rowElement[j];
+	  if (value>0.0) {
+	    nPlus++;
+	  } else {
+	    nMinus++;
+	  }
+	} else {
+	  nPlus=2;
+	  nMinus=2;
+	  break;
+	}
+      }
+      double effectiveness=0.0;
+      if (nPlus==1&&rowUpper[i]>0.0&&rowUpper[i]<1.0e10) {
+	// can make element smaller
+	for (int j=0;j<length;j++) {
+	  double value=rowElement[j];
+	  if (value>0.0) 
+	    value -= rowUpper[i];
+	  work[j]=value;
+	  effectiveness += fabs(value);
+	}
+	rowUpper[i]=0.0;
+	rowElement = work;
+      } else if (nMinus==1&&rowLower[i]<0.0&&rowLower[i]>-1.0e10) {
+	// can make element smaller in magnitude
+	for (int j=0;j<length;j++) {
+	  double value=rowElement[j];
+	  if (value<0.0) 
+	    value -= rowLower[i];
+	  work[j]=value;
+	  effectiveness += fabs(value);
+	}
+	rowLower[i]=0.0;
+	rowElement = work;
+      }
+      if (effectiveness) {
+	OsiRowCut rc;
+	rc.setLb(rowLower[i]);
+	rc.setUb(rowUpper[i]);
+	rc.setRow(length,rowColumn,rowElement,false);
+	// but get rid of tinies
+	CoinPackedVector & row = rc.mutableRow();
+	double * elements = row.getElements();
+	int n2=0;
+	for (n2=0;n2<length;n2++) {
+	  if (fabs(elements[n2])<1.0e-12)
+	    break;
+	}
+	if (n2<length) {
+	  int * columns = row.getIndices();
+	  for (int k=n2+1;k<length;k++) {
+	    if (fabs(elements[k])>1.0e-12) {
+	      elements[n2]=elements[k];
+	      columns[n2++]=columns[k];
+	    }
+	  }
+	  row.truncate(n2);
+	}
+	rc.setEffectiveness(effectiveness);
+	assert (!info->strengthenRow[i]);
+	info->strengthenRow[i]=rc.clone();
+      }
+    }
+    rowLower[nKeep]=rowLower[i];
+    rowUpper[nKeep]=rowUpper[i];
+    // Out elements for fixed columns and put negative first
+    rowStart[nKeep]=newSize;
+    double offset = 
+      packProbingRow(length,rowColumn,rowElement,colLower,colUpper,
+		     elements,column,newSize,rowStartPos[nKeep],
+		     elements2,column2);
+    rowLength[nKeep]=newSize-rowStart[nKeep];
+    if (offset) {
+      if (rowLower[nKeep]>-1.0e20)
+	rowLower[nKeep] -= offset;
+      if (rowUpper[nKeep]<1.0e20)
+	rowUpper[nKeep] -= offset;
+    }
+    which[nKeep++]=i;
+  }
+  rowStart[nKeep]=newSize;
+  delete [] work;
+  delete [] column2;
+  if (nKeep<nRows&&info->strengthenRow) {
+    // Set up pointers to real rows (objective discarded)
+    realRows = new int [nRows];
+    CoinZeroN(realRows,nRows);
+    for (i=0;i<nKeep;i++) 
+      realRows[i]=rows.realRow(which[i]);
+  }
+  int nKeepBase=0;
+  while (nKeepBase<nKeep&&which[nKeepBase]<nSource)
+    nKeepBase++;
+  delete [] which;
+  if (!nKeep) {
+    delete [] elements;
+    delete [] column;
+    delete [] rowStart;
+    delete [] rowLength;
+    delete [] rowStartPos;
+    rowStartPos=NULL;
+    delete [] realRows;
+    realRows=NULL;
+    delete [] key;
+    return NULL;
+  }
+  CoinPackedMatrix * rowCopy = new CoinPackedMatrix();
+  if (!key) {
+    rowCopy->assignMatrix(false,nCols,nKeep,newSize,
+			  elements,column,rowStart,rowLength);
+    columnCopy = new CoinPackedMatrix(*rowCopy,0,0,true);
+    return rowCopy;
+  }
+  /* Column copy with room at end of each column for rows after base -
+     as many again as now and a few more */
+  CoinBigIndex * columnStart = new CoinBigIndex [nCols+1];
+  int * columnLength = new int [nCols];
+  int * baseLength = new int [nCols];
+  CoinZeroN(columnLength,nCols);
+  CoinBigIndex j;
+  for (j=0;j<rowStart[nKeepBase];j++)
+    columnLength[column[j]]++;
+  CoinMemcpyN(columnLength,nCols,baseLength);
+  for (;j<newSize;j++)
+    columnLength[column[j]]++;
+  CoinBigIndex columnSize=0;
+  for (i=0;i<nCols;i++) {
+    columnStart[i]=columnSize;
+    columnSize += 2*columnLength[i]+8;
+    columnLength[i]=0;
+  }
+  columnStart[nCols]=columnSize;
+  double * columnElements = new double [columnSize];
+  int * row = new int [columnSize];
+  for (int iRow=0;iRow<nKeep;iRow++) {
+    for (j=rowStart[iRow];j<rowStart[iRow]+rowLength[iRow];j++) {
+      int iColumn = column[j];
+      CoinBigIndex put = columnStart[iColumn]+columnLength[iColumn];
+      columnLength[iColumn]++;
+      columnElements[put]=elements[j];
+      row[put]=iRow;
+    }
+  }
+  // row copy can take as many elements as column copy
+  assert (columnSize<=maxSize);
+  rowCopy->assignMatrix(false,nCols,nKeep,newSize,
+			elements,column,rowStart,rowLength,
+			maxRows,maxSize);
+  columnCopy = new CoinPackedMatrix();
+  columnCopy->assignMatrix(true,nKeep,nCols,newSize,
+			   columnElements,row,columnStart,columnLength,
+			   nCols,columnSize);
+  // keep for next time
+  releaseProbingCopies();
+  probingRowCopy_ = rowCopy;
+  probingColumnCopy_ = columnCopy;
+  probingRowStartPos_ = rowStartPos;
+  probingKey_ = key;
+  probingColumnLength_ = baseLength;
+  if (!snapshotRows) {
+    // remember base rows to see if still same
+    probingBase_ = new CoinPackedMatrix(solverRows);
+    if (nSource<nRealRows) {
+      int * del = new int [nRealRows-nSource];
+      for (i=nSource;i<nRealRows;i++)
+	del[i-nSource]=i;
+      probingBase_->deleteRows(nRealRows-nSource,del);
+      delete [] del;
+    }
+  }
+  probingUsers_ = new int [1];
+  probingUsers_[0]=1;
+  return rowCopy;
+}
+// Drops this generator's share of kept probing copies
+void CglProbing::releaseProbingCopies()
+{
+  if (probingUsers_&&!changeUsers(probingUsers_,-1)) {
+    delete probingRowCopy_;
+    delete probingColumnCopy_;
+    delete [] probingRowStartPos_;
+    delete [] probingKey_;
+    delete probingBase_;
+    delete [] probingColumnLength_;
+    delete [] probingUsers_;
+  }
+  probingRowCopy_=NULL;
+  probingColumnCopy_=NULL;
+  probingRowStartPos_=NULL;
+  probingKey_=NULL;
+  probingBase_=NULL;
+  probingColumnLength_=NULL;
+  probingUsers_=NULL;
+}
+// Shares rhs's kept probing copies
+void CglProbing::shareProbingCopies(const CglProbing & rhs)
+{
+  probingRowCopy_=rhs.probingRowCopy_;
+  probingColumnCopy_=rhs.probingColumnCopy_;
+  probingRowStartPos_=rhs.probingRowStartPos_;
+  probingKey_=rhs.probingKey_;
+  probingBase_=rhs.probingBase_;
+  probingColumnLength_=rhs.probingColumnLength_;
+  probingUsers_=rhs.probingUsers_;
+  if (probingUsers_)
+    changeUsers(probingUsers_,1);
+}
 int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si, 
                                    OsiCuts & cs ,
                                    double * rowLower, double * rowUpper,
@@ -1637,7 +2014,6 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
   // Get basic problem information
   int nRows;
   
-  CoinPackedMatrix * rowCopy=NULL;
   int numberRowCutsBefore = cs.sizeRowCuts();
 
   // get branch and bound cutoff
@@ -1743,6 +2119,9 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
     printf("CglProbing obj offset %g\n",offset);
 #endif
   // see if using cached copy or not
+  int numberObjective=0;
+  int * objectiveColumn=NULL;
+  double * objectiveElement=NULL;
   if (!rowCopy_) {
     // create from current
     nRows=si.getNumRows(); 
@@ -1752,26 +2131,16 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
       mode=1;
     // add in objective if there is a cutoff
     if (cutoff<1.0e30&&usingObjective_>0) {
-      rowCopy = new CoinPackedMatrix(*si.getMatrixByRow(),1,nCols,false);
-    } else {
-      rowCopy = new CoinPackedMatrix(*si.getMatrixByRow());
-    }
-    // add in objective if there is a cutoff
-    if (cutoff<1.0e30&&usingObjective_>0) {
-      int * columns = new int[nCols];
-      double * elements = new double[nCols];
-      int n=0;
+      objectiveColumn = new int[nCols];
+      objectiveElement = new double[nCols];
       const double * objective = si.getObjCoefficients();
       bool maximize = (si.getObjSense()==-1);
       for (i=0;i<nCols;i++) {
 	if (objective[i]) {
-	  elements[n]= (maximize) ? -objective[i] : objective[i];
-	  columns[n++]=i;
+	  objectiveElement[numberObjective]= (maximize) ? -objective[i] : objective[i];
+	  objectiveColumn[numberObjective++]=i;
 	}
       }
-      rowCopy->appendRow(n,columns,elements);
-      delete [] columns;
-      delete [] elements;
       CoinMemcpyN(si.getRowLower(),nRows,rowLower);
       CoinMemcpyN(si.getRowUpper(),nRows,rowUpper);
       rowLower[nRows]=-COIN_DBL_MAX;
@@ -1782,278 +2151,58 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
       CoinMemcpyN(si.getRowUpper(),nRows,rowUpper);
     }
   } else {
-    // use snapshot
+    // use snapshot (shared so not changed) and rows added since
     nRows=numberRows_;
     assert(nCols==numberColumns_);
-    
-    rowCopy = new CoinPackedMatrix(*rowCopy_);
     assert (rowCopy_->getNumRows()==numberRows_);
-    rowLower = new double[nRows];
-    rowUpper = new double[nRows];
+    int nExtra = CoinMax(si.getNumRows()-numberSolverRows_,0);
+    rowLower = new double[nRows+nExtra];
+    rowUpper = new double[nRows+nExtra];
     CoinMemcpyN(rowLower_,nRows,rowLower);
     CoinMemcpyN(rowUpper_,nRows,rowUpper);
     if (usingObjective_>0) {
       rowLower[nRows-1]=-COIN_DBL_MAX;
       rowUpper[nRows-1]=cutoff+offset;
     }
+    CoinMemcpyN(si.getRowLower()+numberSolverRows_,nExtra,rowLower+nRows);
+    CoinMemcpyN(si.getRowUpper()+numberSolverRows_,nExtra,rowUpper+nRows);
   }
   CoinBigIndex * rowStartPos = NULL;
   int * realRows = NULL;
-  {
-    // Now take out rows with too many elements
-    int * rowLength = rowCopy->getMutableVectorLengths(); 
-    //#define OUTRUBBISH
-    double * elements = rowCopy->getMutableElements();
-    int * column = rowCopy->getMutableIndices();
-    CoinBigIndex * rowStart = rowCopy->getMutableVectorStarts();
-#ifdef OUTRUBBISH
-    double large=1.0e3;
-#endif
-    int nDelete = 0;
-    int nKeep=0;
-    int * which = new int[nRows];
-    int nElements=rowCopy->getNumElements();
-    int nTotalOut=0;
-    int nRealRows = si.getNumRows();
-    for (i=0;i<nRows;i++) {
-      if (rowLength[i]>maxElements||(rowLower[i]<-1.0e20&&rowUpper[i]>1.0e20)) {
-	// keep objective
-	if (i<nRealRows) 
-	  nTotalOut+=rowLength[i];
-      }
-    }
-    // keep all if only a few dense
-    if (nTotalOut*10<nElements)
-      maxElements=nCols;
-#ifdef OUTRUBBISH
-    int nExtraDel=0;
-#endif
-    for (i=0;i<nRows;i++) {
-      if ((rowLength[i]>maxElements&&i<nRealRows)||
-	  (rowLower[i]<-1.0e20&&rowUpper[i]>1.0e20)) {
-	which[nDelete++]=i;
-      } else {
-#ifdef OUTRUBBISH
-	// out all rows with infinite plus and minus
-	int nPlus=rowUpper[i]>-large ? 0 : 1;
-	int nMinus=rowLower[i]<large ? 0 : 1;
-	CoinBigIndex start = rowStart[i];
-	CoinBigIndex end = start + rowLength[i];
-	for (CoinBigIndex j=start; j<end ; j++) { 
-	  int iColumn = column[j];
-	  if (colUpper[iColumn]>large) {
-	    if (elements[j]>0.0)
-	      nPlus++;
-	    else
-	      nMinus++;
-	  }
-	  if (colLower[iColumn]<-large) {
-	    if (elements[j]<0.0)
-	      nPlus++;
-	    else
-	      nMinus++;
-	  }
-	}
-	if (!nPlus||!nMinus) {
-	  rowLower[nKeep]=rowLower[i];
-	  rowUpper[nKeep]=rowUpper[i];
-	  nKeep++;
-	} else {
-	  nExtraDel++;
-	  which[nDelete++]=i;
-	}
-#else
-	if (info->strengthenRow&&!info->pass&&(rowLower[i]<-1.0e20||rowUpper[i]>1.0e20)) {
-	  int nPlus=0;
-	  int nMinus=0;
-	  for (CoinBigIndex j=rowStart[i];j<rowStart[i+1];j++) {
-	    int jColumn=column[j];
-	    if (intVar[jColumn]&&colLower[jColumn]==0.0&&colUpper[jColumn]==1.0) {
-	      double value=elements[j];
-	      if (value>0.0) {
-		nPlus++;
-	      } else {
-		nMinus++;
-	      }
-	    } else {
-	      nPlus=2;
-	      nMinus=2;
-	      break;
-	    }
-	  }
-	  double effectiveness=0.0;
-	  if (nPlus==1&&rowUpper[i]>0.0&&rowUpper[i]<1.0e10) {
-	    // can make element smaller
-	    for (CoinBigIndex j=rowStart[i];j<rowStart[i+1];j++) {
-	      double value=elements[j];
-	      if (value>0.0) {
-		elements[j] -= rowUpper[i];
-		//printf("pass %d row %d plus el from %g to %g\n",info->pass,
-		//     i,elements[j]+rowUpper[i],elements[j]);
-	      }
-	      effectiveness += fabs(elements[j]);
-	    }
-	    rowUpper[i]=0.0;
-	  } else if (nMinus==1&&rowLower[i]<0.0&&rowLower[i]>-1.0e10) {
-	    // can make element smaller in magnitude
-	    for (CoinBigIndex j=rowStart[i];j<rowStart[i+1];j++) {
-	      double value=elements[j];
-	      if (value<0.0) {
-		elements[j] -= rowLower[i];
-		//printf("pass %d row %d minus el from %g to %g\n",info->pass,
-		//     i,elements[j]+rowLower[i],elements[j]);
-	      }
-	      effectiveness += fabs(elements[j]);
-	    }
-	    rowLower[i]=0.0;
-	  }
-	  if (effectiveness) {
-	    OsiRowCut rc;
-	    rc.setLb(rowLower[i]);
-	    rc.setUb(rowUpper[i]);
-	    int start = rowStart[i];
-	    int n = rowLength[i];
-	    rc.setRow(rowLength[i],column+start,elements+start,false);
-	    // but get rid of tinies
-	    CoinPackedVector & row = rc.mutableRow();
-	    double * elements = row.getElements();
-	    int n2=0;
-	    for (n2=0;n2<n;n2++) {
-	      if (fabs(elements[n2])<1.0e-12)
-		break;
-	    }
-	    if (n2<n) {
-	      int * columns = row.getIndices();
-	      for (int i=n2+1;i<n;i++) {
-		if (fabs(elements[i])>1.0e-12) {
-		  elements[n2]=elements[i];
-		  columns[n2++]=columns[i];
-		}
-	      }
-	      row.truncate(n2);
-	    }
-	    rc.setEffectiveness(effectiveness);
-	    assert (!info->strengthenRow[i]);
-	    info->strengthenRow[i]=rc.clone();
-	  }
-	}
-	rowLower[nKeep]=rowLower[i];
-	rowUpper[nKeep]=rowUpper[i];
-	nKeep++;
-#endif
-      }
-    }
-    if (nDelete) {
-#ifdef OUTRUBBISH
-      if (nExtraDel) {
-	printf("%d rows deleted (extra %d)\n",nDelete,nExtraDel);
-      }
-#else
-#endif
-      if (info->strengthenRow) {
-	// Set up pointers to real rows
-	realRows = new int [nRows];
-	CoinZeroN(realRows,nRows);
-	for (i=0;i<nDelete;i++)
-	  realRows[which[i]]=-1;
-	int k=0;
-	for (i=0;i<nRows;i++) {
-	  if (!realRows[i]) {
-	    if (i<nRealRows)
-	      realRows[k++]=i; // keep
-	    else
-	      realRows[k++]=-1; // objective - discard
-	  }
-	}
-      }
-      rowCopy->deleteRows(nDelete,which);
-      nRows=nKeep;
-    }
-    delete [] which;
-    if (!nRows) {
+  CoinPackedMatrix * columnCopy = NULL;
+  // Only rows and elements which are used are copied
+  CoinPackedMatrix * rowCopy = 
+    probingRowCopy(rowCopy_,*si.getMatrixByRow(),
+		   numberObjective,objectiveColumn,objectiveElement,
+		   colLower,colUpper,intVar,maxElements,
+		   rowLower,rowUpper,rowStartPos,realRows,columnCopy,info);
+  delete [] objectiveColumn;
+  delete [] objectiveElement;
+  if (!rowCopy) {
 #ifdef COIN_DEVELOP
-      printf("All rows too long for probing\n");
+    printf("All rows too long for probing\n");
 #endif
-      // nothing left!!
-      // delete stuff
-      delete rowCopy;
-      if (rowCopy_) {
-	delete [] rowLower;
-	delete [] rowUpper;
-      }
-      delete [] intVar;
-      // and put back unreasonable bounds on integer variables
-      const double * trueLower = si.getColLower();
-      const double * trueUpper = si.getColUpper();
-      for (i=0;i<nCols;i++) {
-	if (intVarOriginal[i]==2) {
-	  if (colUpper[i] == CGL_REASONABLE_INTEGER_BOUND) 
-	    colUpper[i] = trueUpper[i];
-	  if (colLower[i] == -CGL_REASONABLE_INTEGER_BOUND) 
-	    colLower[i] = trueLower[i];
-	}
-      }
-      delete [] realRows;
-      return 0;
+    // nothing left!!
+    // delete stuff
+    if (rowCopy_) {
+      delete [] rowLower;
+      delete [] rowUpper;
     }
-    // Out elements for fixed columns and sort
-    elements = rowCopy->getMutableElements();
-    column = rowCopy->getMutableIndices();
-    rowStart = rowCopy->getMutableVectorStarts();
-    rowLength = rowCopy->getMutableVectorLengths(); 
-#if 0
-    int nFixed=0;
+    delete [] intVar;
+    // and put back unreasonable bounds on integer variables
+    const double * trueLower = si.getColLower();
+    const double * trueUpper = si.getColUpper();
     for (i=0;i<nCols;i++) {
-      if (colUpper[i]==colLower[i])
-	nFixed++;
-    }
-    printf("%d columns fixed\n",nFixed);
-#endif
-    CoinBigIndex newSize=0;
-    int * column2 = new int[nCols];
-    double * elements2 = new double[nCols];
-    rowStartPos = new CoinBigIndex [nRows];
-    for (i=0;i<nRows;i++) {
-      double offset = 0.0;
-      CoinBigIndex start = rowStart[i];
-      rowStart[i]=newSize;
-      CoinBigIndex save=newSize;
-      CoinBigIndex end = start + rowLength[i];
-      int nOther=0;
-      for (CoinBigIndex j=start; j<end ; j++) { 
-	int iColumn = column[j];
-	if (colUpper[iColumn]>colLower[iColumn]) {
-	  double value = elements[j];
-	  if (value<0.0) {
-	    elements[newSize]=value;
-	    column[newSize++]=iColumn;
-	  } else if (value>0.0) {
-	    elements2[nOther]=value;
-	    column2[nOther++]=iColumn;
-	  }
-	} else {
-	  offset += colUpper[iColumn]*elements[j];
-	}
-      }
-      rowStartPos[i] = newSize;
-      for (int k=0;k<nOther;k++) {
-	elements[newSize]=elements2[k];
-	column[newSize++]=column2[k];
-      }
-      rowLength[i]=newSize-save;
-      if (offset) {
-	if (rowLower[i]>-1.0e20)
-	  rowLower[i] -= offset;
-	if (rowUpper[i]<1.0e20)
-	  rowUpper[i] -= offset;
+      if (intVarOriginal[i]==2) {
+	if (colUpper[i] == CGL_REASONABLE_INTEGER_BOUND) 
+	  colUpper[i] = trueUpper[i];
+	if (colLower[i] == -CGL_REASONABLE_INTEGER_BOUND) 
+	  colLower[i] = trueLower[i];
       }
     }
-    delete [] column2;
-    delete [] elements2;
-    rowStart[nRows]=newSize;
-    rowCopy->setNumElements(newSize);
+    return 0;
   }
-  CoinPackedMatrix * columnCopy=new CoinPackedMatrix(*rowCopy,0,0,true);
+  nRows = rowCopy->getNumRows();
   int nRowsSafe=CoinMin(nRows,si.getNumRows());
 #ifdef CGL_DEBUG
   const OsiRowCutDebugger * debugger = si.getRowCutDebugger();
@@ -2082,9 +2231,8 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
   double * minR = new double [nRows];
   double * maxR = new double [nRows];
   if (mode) {
-    ninfeas= tighten(colLower, colUpper, column, rowElements,
-		     rowStart, rowStartPos ,rowLength, rowLower, rowUpper,
-		     nRows, nCols, intVar, 2, primalTolerance_);
+    ninfeas= tighten(colLower, colUpper, *rowCopy, rowLower, rowUpper,
+		     intVar, 2, primalTolerance_);
     if (!feasible)
       ninfeas=1;
     if (!ninfeas) {
@@ -2132,9 +2280,8 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
       if (maxProbe>0) {
         numberThisTime_=0;
         // get min max etc for rows
-        tighten2(colLower, colUpper, column, rowElements,
-                 rowStart, rowLength, rowLower, rowUpper,
-                 minR , maxR , markR, nRows);
+        tighten2(colLower, colUpper, *rowCopy, rowLower, rowUpper,
+                 minR , maxR , markR);
         // decide what to look at
         if (mode==1) {
           const double * colsol = si.getColSolution();
@@ -2221,9 +2368,8 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
     //std::sort(lookedAt_,lookedAt_+numberThisTime_);
     delete [] array;
     // get min max etc for rows
-    tighten2(colLower, colUpper, column, rowElements,
-	     rowStart, rowLength, rowLower, rowUpper,
-	     minR , maxR , markR, nRows);
+    tighten2(colLower, colUpper, *rowCopy, rowLower, rowUpper,
+	     minR , maxR , markR);
     OsiCuts csNew;
     // don't do cuts at all if 0 (i.e. we are just checking bounds)
     if (rowCuts_) {
@@ -2888,15 +3034,17 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
   if (!ninfeas) {
     rowCut.addCuts(cs,info->strengthenRow,0);
   }
-  // delete stuff
-  delete rowCopy;
-  delete columnCopy;
+  // delete stuff (unless kept for next time)
+  if (rowCopy!=probingRowCopy_) {
+    delete rowCopy;
+    delete columnCopy;
+    delete [] rowStartPos;
+  }
   if (rowCopy_) {
     delete [] rowLower;
     delete [] rowUpper;
   }
   delete [] intVar;
-  delete [] rowStartPos;
   delete [] realRows;
   // and put back unreasonable bounds on integer variables
   const double * trueLower = si.getColLower();
@@ -2921,13 +3069,401 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
   }
   return ninfeas;
 }
+// Fewest candidates in a part when probing on threads
+#define CGL_PROBING_MINIMUM_PART 20
+// Rounds a pass is split into if nothing changes
+#define CGL_PROBING_ROUNDS 4
+// Number of parts when deterministic
+#define CGL_PROBING_PARTS 8
+namespace {
+  /* Stands in for CglTreeInfo while a part is probed on another thread.
+     Implications are kept so they can be passed on in order of parts. */
+  class CglProbingFixings : public CglTreeInfo {
+  public:
+    CglProbingFixings(const CglTreeInfo & info)
+      : CglTreeInfo(info) {}
+    virtual CglTreeInfo * clone() const
+    { return new CglProbingFixings(*this);}
+    virtual bool fixes(int variable, int toValue, int fixedVariable,
+		       bool fixedToLower)
+    {
+      fixing_.push_back(variable);
+      fixing_.push_back(toValue);
+      fixing_.push_back(fixedVariable);
+      fixing_.push_back(fixedToLower ? 1 : 0);
+      return true;
+    }
+    // Passes on implications - returns false if info wants no more
+    bool passOn(CglTreeInfo * info) const
+    {
+      for (size_t i=0;i<fixing_.size();i+=4) {
+	if (!info->fixes(fixing_[i],fixing_[i+1],fixing_[i+2],
+			 fixing_[i+3]!=0))
+	  return false;
+      }
+      return true;
+    }
+    // Forgets implications
+    void clear()
+    { fixing_.clear();}
+  private:
+    // Implications as variable, way, fixed variable, to lower
+    std::vector<int> fixing_;
+  };
+}
+/* What probe() works with while going through candidates.  Bounds, row
+   activities and marks are changed by probing (and put back unless
+   something is found).  A part probed on another thread has its own
+   copy of those and its own work arrays, cuts and implications. */
+struct CglProbing::ProbeState {
+  /// Read only
+  const OsiSolverInterface * si;
+  const OsiRowCutDebugger * debugger;
+  const CoinPackedMatrix * rowCopy;
+  const CoinPackedMatrix * columnCopy;
+  const CoinBigIndex * rowStartPos;
+  const int * realRows;
+  const double * rowLower;
+  const double * rowUpper;
+  const char * intVar;
+  const double * currentColLower;
+  const double * currentColUpper;
+  const double * objective;
+  const int * columnLength2;
+  const double * colsol;
+  const double * djs;
+  const double * largestPositiveInRow;
+  const double * largestNegativeInRow;
+#if PROBING100
+  const int * backward;
+#endif
+  int maxStack;
+  int maxProbe;
+  int nRowsFake;
+  bool justReplace;
+  double direction;
+  double cutoff;
+  double current;
+  double tolerance;
+  /// Changed by probing
+  double * colLower;
+  double * colUpper;
+  double * minR;
+  double * maxR;
+  int * markR;
+  int * markC;
+  double * columnGap;
+  /// Work arrays
+  double * saveL;
+  double * saveU;
+  double * saveMin;
+  double * saveMax;
+  double * element;
+  double * lo0;
+  double * up0;
+  int * stackC;
+  int * stackR;
+  int * index;
+  int * stackC0;
+  /// Row cuts (kept out of cs to find duplicates)
+  row_cut * rowCut;
+  OsiCuts * cs;
+  CglTreeInfo * info;
+  /// Counts and switches
+  int ipass;
+  int maxPass;
+  int nfixed;
+  int ninfeas;
+  int justFix;
+  int rowCuts;
+  int leftTotalStack;
+  double disaggEffectiveness;
+  double needEffectiveness;
+  bool anyColumnCuts;
+  bool saveFixingInfo;
+  /// Columns and rows which may have been changed (NULL if not wanted)
+  int * touchedC;
+  int * touchedR;
+  char * isTouchedC;
+  char * isTouchedR;
+  int numberTouchedC;
+  int numberTouchedR;
+  /// Adds columns and rows from probing stacks to touched
+  inline void touch(const int * stackC, int nstackC,
+		    const int * stackR, int nstackR)
+  {
+    if (!touchedC)
+      return;
+    for (int i=0;i<nstackC;i++) {
+      int iColumn = stackC[i];
+      if (!isTouchedC[iColumn]) {
+	isTouchedC[iColumn]=1;
+	touchedC[numberTouchedC++]=iColumn;
+      }
+    }
+    for (int i=0;i<nstackR;i++) {
+      int iRow = stackR[i];
+      if (!isTouchedR[iRow]) {
+	isTouchedR[iRow]=1;
+	touchedR[numberTouchedR++]=iRow;
+      }
+    }
+  }
+  /// True if touched bounds, activities and marks same (bit for bit) as other
+  bool sameTouched(const ProbeState & other) const
+  {
+    for (int i=0;i<numberTouchedC;i++) {
+      int iColumn = touchedC[i];
+      if (memcmp(colLower+iColumn,other.colLower+iColumn,sizeof(double))||
+	  memcmp(colUpper+iColumn,other.colUpper+iColumn,sizeof(double))||
+	  memcmp(columnGap+iColumn,other.columnGap+iColumn,sizeof(double))||
+	  markC[iColumn]!=other.markC[iColumn])
+	return false;
+    }
+    for (int i=0;i<numberTouchedR;i++) {
+      int iRow = touchedR[i];
+      if (memcmp(minR+iRow,other.minR+iRow,sizeof(double))||
+	  memcmp(maxR+iRow,other.maxR+iRow,sizeof(double))||
+	  markR[iRow]!=other.markR[iRow])
+	return false;
+    }
+    return true;
+  }
+  /// Copies values of columns and rows touched in list from other
+  void copyTouched(const ProbeState & list, const ProbeState & other)
+  {
+    for (int i=0;i<list.numberTouchedC;i++) {
+      int iColumn = list.touchedC[i];
+      colLower[iColumn]=other.colLower[iColumn];
+      colUpper[iColumn]=other.colUpper[iColumn];
+      columnGap[iColumn]=other.columnGap[iColumn];
+      markC[iColumn]=other.markC[iColumn];
+    }
+    for (int i=0;i<list.numberTouchedR;i++) {
+      int iRow = list.touchedR[i];
+      minR[iRow]=other.minR[iRow];
+      maxR[iRow]=other.maxR[iRow];
+      markR[iRow]=other.markR[iRow];
+    }
+  }
+  /// Forgets touched columns and rows
+  void clearTouched()
+  {
+    for (int i=0;i<numberTouchedC;i++)
+      isTouchedC[touchedC[i]]=0;
+    for (int i=0;i<numberTouchedR;i++)
+      isTouchedR[touchedR[i]]=0;
+    numberTouchedC=0;
+    numberTouchedR=0;
+  }
+};
+struct CglProbing::ProbingTask {
+  /// Generator (only probeCandidates used)
+  const CglProbing * generator;
+  /// Part of lookedAt_
+  int firstLook;
+  int lastLook;
+  /// Own bounds, row activities and work arrays
+  ProbeState state;
+  /// Cuts from this part
+  OsiCuts cuts;
+  /// Keeps implications
+  CglProbingFixings * info;
+};
+// Probes one part
+void
+CglProbing::probeTask(int task, int , void * voidData)
+{
+  ProbingTask & data = reinterpret_cast<ProbingTask *>(voidData)[task];
+  data.generator->probeCandidates(data.state,data.firstLook,data.lastLook);
+}
+// Number of parts to split candidates into for threads (1 serial)
+int 
+CglProbing::probingParts(const CglTreeInfo * info) const
+{
+  // strengthenRow would be shared
+  if (numberThreads_<=1||info->strengthenRow||(info->options&64)!=0)
+    return 1;
+  int maximumParts = deterministic_ ? CGL_PROBING_PARTS : numberThreads_;
+  return CoinMax(1,CoinMin(maximumParts,
+			   numberThisTime_/CGL_PROBING_MINIMUM_PART));
+}
+/* Does one pass of probe() with parts of lookedAt_ probed at the same
+   time.  In each round numberParts parts of consecutive candidates all
+   start from bounds and row activities in state.  Parts are then taken
+   in order.  Once a part has changed bounds or activities later parts
+   started from out of date values, so next round starts after that part.
+   If row cuts might have run out of space, or stack allowance run out,
+   rest of pass is done serially.  So result is same as serial probing.
+   Parts keep their copies for the whole pass.  Probing only changes
+   columns and rows on its stacks so just those are compared and put
+   back between rounds. */
+void 
+CglProbing::probeInParallel(int numberParts, ProbeState & state) const
+{
+  int nRows=state.rowCopy->getNumRows();
+  int nCols=state.rowCopy->getNumCols();
+  int maxStack=state.maxStack;
+  // few rounds if nothing changes
+  int partSize = CoinMax(CGL_PROBING_MINIMUM_PART,
+			 numberThisTime_/(CGL_PROBING_ROUNDS*numberParts));
+  std::vector<ProbingTask> tasks(numberParts);
+  for (int iPart=0;iPart<numberParts;iPart++) {
+    ProbingTask & task = tasks[iPart];
+    task.generator = this;
+    task.info = new CglProbingFixings(*state.info);
+    ProbeState & part = task.state;
+    part = state;
+    part.colLower = CoinCopyOfArray(state.colLower,nCols);
+    part.colUpper = CoinCopyOfArray(state.colUpper,nCols);
+    part.minR = CoinCopyOfArray(state.minR,nRows);
+    part.maxR = CoinCopyOfArray(state.maxR,nRows);
+    part.markR = CoinCopyOfArray(state.markR,nRows);
+    part.markC = CoinCopyOfArray(state.markC,nCols);
+    part.columnGap = CoinCopyOfArray(state.columnGap,nCols);
+    part.saveL = new double [2*nCols];
+    part.saveU = new double [2*nCols];
+    part.saveMin = new double [nRows];
+    part.saveMax = new double [nRows];
+    part.element = new double [nCols];
+    part.lo0 = new double [maxStack];
+    part.up0 = new double [maxStack];
+    part.stackC = new int [2*nCols];
+    part.stackR = new int [nRows];
+    part.index = new int [nCols];
+    part.stackC0 = new int [maxStack];
+    part.rowCut = new row_cut(state.nRowsFake,!state.info->inTree);
+    part.cs = &task.cuts;
+    part.info = task.info;
+    part.touchedC = new int [nCols];
+    part.touchedR = new int [nRows];
+    part.isTouchedC = new char [nCols];
+    part.isTouchedR = new char [nRows];
+    CoinZeroN(part.isTouchedC,nCols);
+    CoinZeroN(part.isTouchedR,nRows);
+    part.numberTouchedC = 0;
+    part.numberTouchedR = 0;
+  }
+  row_cut & rowCut = *state.rowCut;
+  int iLook=0;
+  int serialLook=-1;
+  while (iLook<numberThisTime_) {
+    if (rowCut.outOfSpace()||state.leftTotalStack<=0) {
+      serialLook=iLook;
+      break;
+    }
+    int nParts=0;
+    while (nParts<numberParts&&iLook<numberThisTime_) {
+      ProbingTask & task = tasks[nParts++];
+      task.firstLook=iLook;
+      iLook = CoinMin(iLook+partSize,numberThisTime_);
+      task.lastLook=iLook;
+      ProbeState & part = task.state;
+      task.cuts = OsiCuts();
+      task.info->clear();
+      part.ipass = state.ipass;
+      part.maxPass = state.maxPass;
+      part.nfixed = state.nfixed;
+      part.ninfeas = state.ninfeas;
+      part.justFix = state.justFix;
+      part.rowCuts = state.rowCuts;
+      part.leftTotalStack = state.leftTotalStack;
+      part.disaggEffectiveness = state.disaggEffectiveness;
+      part.needEffectiveness = state.needEffectiveness;
+      part.anyColumnCuts = state.anyColumnCuts;
+      part.saveFixingInfo = state.saveFixingInfo;
+    }
+    CglRunTasks(nParts,numberThreads_,probeTask,&tasks[0]);
+    int leftTotalStack = state.leftTotalStack;
+    int nfixed = state.nfixed;
+    int changedPart=-1;
+    for (int iPart=0;iPart<nParts;iPart++) {
+      ProbingTask & task = tasks[iPart];
+      ProbeState & part = task.state;
+      int stackUsed = leftTotalStack-part.leftTotalStack;
+      if (state.leftTotalStack-stackUsed<=0||
+	  rowCut.numberCuts()+part.rowCut->numberCuts()>=rowCut.maxSize_) {
+	// serial probing might have stopped or changed
+	serialLook=task.firstLook;
+	break;
+      }
+      iLook=task.lastLook;
+      state.leftTotalStack -= stackUsed;
+      state.nfixed += part.nfixed-nfixed;
+      state.ninfeas = part.ninfeas;
+      state.ipass = part.ipass;
+      int n = part.rowCut->numberCuts();
+      for (int i=0;i<n;i++) {
+	OsiRowCut2 * cut = part.rowCut->cut(i);
+	rowCut.addCutIfNotDuplicate(*cut,cut->whichRow());
+      }
+      n = task.cuts.sizeColCuts();
+      for (int i=0;i<n;i++)
+	state.cs->insert(task.cuts.colCut(i));
+      n = task.cuts.sizeRowCuts();
+      for (int i=0;i<n;i++)
+	state.cs->insert(task.cuts.rowCut(i));
+      if (state.saveFixingInfo)
+	state.saveFixingInfo = task.info->passOn(state.info);
+      if (part.ninfeas||part.anyColumnCuts!=state.anyColumnCuts||
+	  !part.sameTouched(state)) {
+	// later parts started from out of date values (or infeasible)
+	state.anyColumnCuts = part.anyColumnCuts;
+	state.copyTouched(part,part);
+	changedPart=iPart;
+	break;
+      }
+    }
+    if (state.ninfeas||serialLook>=0)
+      break;
+    // parts back to values in state for next round
+    for (int iPart=0;iPart<numberParts;iPart++) {
+      ProbeState & part = tasks[iPart].state;
+      part.rowCut->clear();
+      if (iPart!=changedPart) {
+	part.copyTouched(part,state);
+	if (changedPart>=0)
+	  part.copyTouched(tasks[changedPart].state,state);
+      }
+    }
+    for (int iPart=0;iPart<numberParts;iPart++)
+      tasks[iPart].state.clearTouched();
+  }
+  if (serialLook>=0)
+    probeCandidates(state,serialLook,numberThisTime_);
+  for (int iPart=0;iPart<numberParts;iPart++) {
+    ProbingTask & task = tasks[iPart];
+    ProbeState & part = task.state;
+    delete task.info;
+    delete [] part.colLower;
+    delete [] part.colUpper;
+    delete [] part.minR;
+    delete [] part.maxR;
+    delete [] part.markR;
+    delete [] part.markC;
+    delete [] part.columnGap;
+    delete [] part.saveL;
+    delete [] part.saveU;
+    delete [] part.saveMin;
+    delete [] part.saveMax;
+    delete [] part.element;
+    delete [] part.lo0;
+    delete [] part.up0;
+    delete [] part.stackC;
+    delete [] part.stackR;
+    delete [] part.index;
+    delete [] part.stackC0;
+    delete part.rowCut;
+    delete [] part.touchedC;
+    delete [] part.touchedR;
+    delete [] part.isTouchedC;
+    delete [] part.isTouchedR;
+  }
+}
 // Does probing and adding cuts
 int CglProbing::probe( const OsiSolverInterface & si, 
-		       const OsiRowCutDebugger *
-#ifdef CGL_DEBUG
-		       debugger
-#endif 
-		       ,OsiCuts & cs, 
+		       const OsiRowCutDebugger * debugger,
+		       OsiCuts & cs, 
 		       double * colLower, double * colUpper, 
 		       CoinPackedMatrix *rowCopy,
 		       CoinPackedMatrix *columnCopy,
@@ -2940,11 +3476,14 @@ int CglProbing::probe( const OsiSolverInterface & si,
   int nRows=rowCopy->getNumRows();
   int nRowsSafe=CoinMin(nRows,si.getNumRows());
   int nCols=rowCopy->getNumCols();
+  // What probeCandidates works with
+  ProbeState state;
   const double * currentColLower = si.getColLower();
   const double * currentColUpper = si.getColUpper();
   // Set up maxes
   int maxStack = info->inTree ? maxStack_ : maxStackRoot_;
-  int maxPass = info->inTree ? maxPass_ : maxPassRoot_;
+  int & maxPass = state.maxPass;
+  maxPass = info->inTree ? maxPass_ : maxPassRoot_;
   if ((totalTimesCalled_%10)==-1) {
     int newMax=CoinMin(2*maxStack,50);
     maxStack=CoinMax(newMax,maxStack);
@@ -3010,19 +3549,17 @@ int CglProbing::probe( const OsiSolverInterface & si,
   const int * column = rowCopy->getIndices();
   const CoinBigIndex * rowStart = rowCopy->getVectorStarts();
   const double * rowElements = rowCopy->getElements();
-  const int * row = columnCopy->getIndices();
-  const CoinBigIndex * columnStart = columnCopy->getVectorStarts();
-  const int * columnLength = columnCopy->getVectorLengths(); 
-  const double * columnElements = columnCopy->getElements();
 #define MOVE_SINGLETONS
 #ifdef MOVE_SINGLETONS
   const double * objective = si.getObjCoefficients();
   const int * columnLength2 = si.getMatrixByCol()->getVectorLengths(); 
 #endif
-  bool anyColumnCuts=false;
-  int ninfeas=0;
-  int rowCuts;
-  double disaggEffectiveness;
+  bool & anyColumnCuts = state.anyColumnCuts;
+  anyColumnCuts=false;
+  int & ninfeas = state.ninfeas;
+  ninfeas=0;
+  int & rowCuts = state.rowCuts;
+  double & disaggEffectiveness = state.disaggEffectiveness;
   /* clean up djs and solution */
   CoinMemcpyN(si.getReducedCost(),nCols,djs);
   CoinMemcpyN( si.getColSolution(),nCols,colsol);
@@ -3077,7 +3614,10 @@ int CglProbing::probe( const OsiSolverInterface & si,
     columnGap[i]=gap-primalTolerance_;
   }
 
-  int ipass=0,nfixed=-1;
+  int & ipass = state.ipass;
+  int & nfixed = state.nfixed;
+  ipass=0;
+  nfixed=-1;
 
   double cutoff;
   bool cutoff_available = si.getDblParam(OsiDualObjectiveLimit,cutoff);
@@ -3089,9 +3629,6 @@ int CglProbing::probe( const OsiSolverInterface & si,
     assert (cutoff>1.0e30);
   double current = si.getObjValue();
   current *= direction;
-  /* for both way coding */
-  int nstackC0=-1;
-  int nstackR,nstackC;
   //int nFix=0;
   for (int i=0;i<nCols;i++) {
     if (colUpper[i]-colLower[i]<1.0e-8) {
@@ -3109,7 +3646,8 @@ int CglProbing::probe( const OsiSolverInterface & si,
   double tolerance = 1.0e1*primalTolerance_;
   // If we are going to replace coefficient then we don't need to be effective
   //double needEffectiveness = info->strengthenRow ? -1.0e10 : 1.0e-3;
-  double needEffectiveness = info->strengthenRow ? 1.0e-8 : 1.0e-3;
+  double & needEffectiveness = state.needEffectiveness;
+  needEffectiveness = info->strengthenRow ? 1.0e-8 : 1.0e-3;
   if (justReplace&&(info->pass&1)!=0)
     needEffectiveness=-1.0e10;
   if (PROBING_EXTRA_STUFF) {
@@ -3168,7 +3706,8 @@ int CglProbing::probe( const OsiSolverInterface & si,
     if (nCut)
       printf("%d possible cuts\n",nCut);
   }
-  bool saveFixingInfo =  false;
+  bool & saveFixingInfo = state.saveFixingInfo;
+  saveFixingInfo = false;
 #if PROBING100
   CglTreeProbingInfo * probingInfo = dynamic_cast<CglTreeProbingInfo *> (info);
   const int * backward = NULL;
@@ -3188,12 +3727,70 @@ int CglProbing::probe( const OsiSolverInterface & si,
   } else {
     saveFixingInfo = (info->initializeFixing(&si)>0);
   }
+  state.si = &si;
+  state.debugger = debugger;
+  state.rowCopy = rowCopy;
+  state.columnCopy = columnCopy;
+  state.rowStartPos = rowStartPos;
+  state.realRows = realRows;
+  state.rowLower = rowLower;
+  state.rowUpper = rowUpper;
+  state.intVar = intVar;
+  state.currentColLower = currentColLower;
+  state.currentColUpper = currentColUpper;
+#ifdef MOVE_SINGLETONS
+  state.objective = objective;
+  state.columnLength2 = columnLength2;
+#endif
+  state.colsol = colsol;
+  state.djs = djs;
+  state.largestPositiveInRow = largestPositiveInRow;
+  state.largestNegativeInRow = largestNegativeInRow;
+#if PROBING100
+  state.backward = backward;
+#endif
+  state.maxStack = maxStack;
+  state.nRowsFake = nRowsFake;
+  state.justReplace = justReplace;
+  state.direction = direction;
+  state.cutoff = cutoff;
+  state.current = current;
+  state.tolerance = tolerance;
+  state.colLower = colLower;
+  state.colUpper = colUpper;
+  state.minR = minR;
+  state.maxR = maxR;
+  state.markR = markR;
+  state.markC = markC;
+  state.columnGap = columnGap;
+  state.saveL = saveL;
+  state.saveU = saveU;
+  state.saveMin = saveMin;
+  state.saveMax = saveMax;
+  state.element = element;
+  state.lo0 = lo0;
+  state.up0 = up0;
+  state.stackC = stackC;
+  state.stackR = stackR;
+  state.index = index;
+  state.stackC0 = stackC0;
+  state.rowCut = &rowCut;
+  state.touchedC = NULL;
+  state.touchedR = NULL;
+  state.isTouchedC = NULL;
+  state.isTouchedR = NULL;
+  state.numberTouchedC = 0;
+  state.numberTouchedR = 0;
+  state.cs = &cs;
+  state.info = info;
+  // Candidates may be probed on threads
+  int numberParts = probingParts(info);
   while (ipass<maxPass&&nfixed) {
-    int iLook;
     ipass++;
     //printf("pass %d\n",ipass);
     nfixed=0;
-    int justFix= (!info->inTree&&!info->pass) ? -1 : 0;
+    int & justFix = state.justFix;
+    justFix= (!info->inTree&&!info->pass) ? -1 : 0;
     int maxProbe = info->inTree ? maxProbe_ : maxProbeRoot_;
     if (justFix<0)
       maxProbe=numberThisTime_;
@@ -3254,170 +3851,524 @@ int CglProbing::probe( const OsiSolverInterface & si,
 	}
       }
     }
-    int leftTotalStack=maxStack*CoinMax(200,maxProbe);
+    int & leftTotalStack = state.leftTotalStack;
+    leftTotalStack=maxStack*CoinMax(200,maxProbe);
 #ifdef PROBING5
     if (!info->inTree&&!info->pass)
       leftTotalStack = 1234567890;
 #endif
     //printf("maxStack %d maxPass %d numberThisTime %d info pass %d\n",
     //   maxStack,maxPass,numberThisTime_,info->pass);
-    for (iLook=0;iLook<numberThisTime_;iLook++) {
-      double solval;
-      double down;
-      double up;
-      if (rowCut.outOfSpace()||leftTotalStack<=0) {
-	if (!justFix&&(!nfixed||info->inTree)) {
-#ifdef COIN_DEVELOP
-	  if (!info->inTree)
-	    printf("Exiting a on pass %d, maxProbe %d\n",
-		   ipass,maxProbe);
-#endif	  
-	  break;
-	} else if (justFix<=0) {
-	  if (!info->inTree) {
-	    rowCuts=0;
-	    justFix=1;
-	    disaggEffectiveness=COIN_DBL_MAX;
-	    needEffectiveness=COIN_DBL_MAX;
-	    //maxStack=10;
-	    maxPass=1;
-	  } else if (!nfixed) {
-#ifdef COIN_DEVELOP
-	    printf("Exiting b on pass %d, maxProbe %d\n",
-		   ipass,maxProbe);
-#endif	  
-	    break;
-	  }
-	}
-      }
-      int j=lookedAt_[iLook];
-      //if (j==231||j==226)
-      //printf("size %d %d j is %d\n",rowCut.numberCuts(),cs.sizeRowCuts(),j);//printf("looking at %d (%d out of %d)\n",j,iLook,numberThisTime_); 
-      solval=colsol[j];
-      down = floor(solval+tolerance);
-      up = ceil(solval-tolerance);
-      if(columnGap[j]<0.0) markC[j]=3;
-      if ((markC[j]&3)!=0||!intVar[j]) continue;
-      double saveSolval = solval;
-      if (solval>=colUpper[j]-tolerance||solval<=colLower[j]+tolerance||up==down) {
-	if (solval<=colLower[j]+2.0*tolerance) {
-	  solval = colLower[j]+1.0e-1;
-	  down=colLower[j];
-	  up=down+1.0;
-	} else if (solval>=colUpper[j]-2.0*tolerance) {
-	  solval = colUpper[j]-1.0e-1;
-	  up=colUpper[j];
-	  down=up-1;
-	} else {
-          // odd
-          up=down+1.0;
-          solval = down+1.0e-1;
-        }
-      }
-      assert (up<=colUpper[j]);
-      assert (down>=colLower[j]);
-      assert (up>down);
-      int istackC,iway, istackR;
-      int way[]={1,2,1};
-      int feas[]={1,2,4};
-      int feasible=0;
-      int notFeasible;
-      for (iway=0;iway<3;iway ++) {
-        int fixThis=0;
-        double objVal=current;
-        int goingToTrueBound=0;
-        stackC[0]=j;
-        markC[j]=way[iway];
-        double solMovement;
-        double movement;
-        if (way[iway]==1) {
-          movement=down-colUpper[j];
-          solMovement = down-colsol[j];
-          assert(movement<-0.99999);
-          if (fabs(down-colLower[j])<1.0e-7) {
-            goingToTrueBound=2;
-            down=colLower[j];
-          }
-        } else {
-          movement=up-colLower[j];
-          solMovement = up-colsol[j];
-          assert(movement>0.99999);
-          if (fabs(up-colUpper[j])<1.0e-7) {
-            goingToTrueBound=2;
-            up=colUpper[j];
-          }
-        }
-        if (goingToTrueBound&&(colUpper[j]-colLower[j]>1.5||colLower[j]))
-          goingToTrueBound=1;
-        // switch off disaggregation if not wanted
-        if ((rowCuts&1)==0)
-          goingToTrueBound=0;
-	bool canReplace = info->strengthenRow&&(goingToTrueBound==2);
-#ifdef PRINT_DEBUG
-        if (fabs(movement)>1.01) {
-          printf("big %d %g %g %g\n",j,colLower[j],solval,colUpper[j]);
-        }
-#endif
-        if (solMovement*djs[j]>0.0)
-          objVal += solMovement*djs[j];
-        nstackC=1;
-        nstackR=0;
-        saveL[0]=colLower[j];
-        saveU[0]=colUpper[j];
-        assert (saveU[0]>saveL[0]);
-        notFeasible=0;
-        if (movement<0.0) {
-          colUpper[j] += movement;
-          colUpper[j] = floor(colUpper[j]+0.5);
-	  columnGap[j] = colUpper[j]-colLower[j]-primalTolerance_;
-#ifdef PRINT_DEBUG
-          printf("** Trying %d down to 0\n",j);
-#endif
-        } else {
-          colLower[j] += movement;
-          colLower[j] = floor(colLower[j]+0.5);
-	  columnGap[j] = colUpper[j]-colLower[j]-primalTolerance_;
-#ifdef PRINT_DEBUG
-          printf("** Trying %d up to 1\n",j);
-#endif
-        }
-        if (fabs(colUpper[j]-colLower[j])<1.0e-6)
-          markC[j]=3; // say fixed
-	markC[j] &= ~12;
-	if (colUpper[j]>1.0e10)
-	  markC[j] |= 8;
-	if (colLower[j]<-1.0e10)
-	  markC[j] |= 4;
-        istackC=0;
-        /* update immediately */
+    state.maxProbe=maxProbe;
+    if (numberParts>1)
+      probeInParallel(numberParts,state);
+    else
+      probeCandidates(state,0,numberThisTime_);
+  }
+  if ((!ninfeas&&!rowCut.outOfSpace())&&(info->strengthenRow||
+                 !rowCut.numberCuts())&&rowCuts) {
+    // Try and find ALL big M's
+    for (int i = 0; i < nRowsSafe; ++i) {
+      if ((rowLower[i]>-1.0e20||rowUpper[i]<1.0e20)&&
+          (!info->strengthenRow||!info->strengthenRow[i])) {
+	int iflagu = 0;
+	int iflagl = 0;
+	double dmaxup = 0.0;
+	double dmaxdown = 0.0;
+	int krs = rowStart[i];
+	int kre = rowStart[i+1];
+        int kInt = -1;
+	double rhsAdjustment=0.0;
+	int nPosInt=0;
+	int nNegInt=0;
+        double valueInteger=0.0;
+        // Find largest integer coefficient
 	int k;
-        for ( k=columnStart[j];k<columnStart[j]+columnLength[j];k++) {
-          int irow = row[k];
-          double value = columnElements[k];
-          assert (markR[irow]!=-2);
-          if (markR[irow]==-1) {
-            stackR[nstackR]=irow;
-            markR[irow]=nstackR;
-            saveMin[nstackR]=minR[irow];
-            saveMax[nstackR]=maxR[irow];
-            nstackR++;
-#if 0
-          } else if (markR[irow]==-2) {
-            continue;
-#endif
+        for ( k = krs; k < kre; ++k) {
+          int j = column[k];
+          if (intVar[j]) {
+            double value=rowElements[k];
+            if (colUpper[j]>colLower[j]&&!colLower[j]&&
+                fabs(value)>fabs(valueInteger)) {
+              kInt=j;
+              valueInteger=value;
+            }
           }
-          /* could check immediately if violation */
-          if (movement>0.0) {
-            /* up */
-            if (value>0.0) {
-              /* up does not change - down does */
-              if (minR[irow]>-1.0e10)
-                minR[irow] += value;
-              if (minR[irow]>rowUpper[irow]+1.0e-5) {
-                notFeasible=1;
-                istackC=1;
-                break;
-              }
+        }
+        if (kInt>=0) {
+          double upperBound = CoinMin(colUpper[kInt],static_cast<double>(COIN_INT_MAX));
+	  double upAdjust=0.0;
+	  double downAdjust=0.0;
+          for (k = krs; k < kre; ++k) {
+            double value=rowElements[k];
+            int j = column[k];
+            if (colUpper[j]==colLower[j]) {
+	      rhsAdjustment += colUpper[j]*value;
+              continue;
+            }
+	    if (intVar[j]) {
+	      if (value>0.0)
+		nPosInt++;
+	      else
+		nNegInt++;
+	    } else {
+	      nPosInt = -nCols;
+	    }
+            if (j!=kInt) {
+              // treat as continuous
+              if (value > 0.0) {
+                if (colUpper[j] >= 1e15) {
+                  dmaxup = 1e31;
+                  ++iflagu;
+                } else {
+                  dmaxup += colUpper[j] * value;
+                }
+                if (colLower[j] <= -1e15) {
+                  dmaxdown = -1e31;
+                  ++iflagl;
+                } else {
+                  dmaxdown += colLower[j] * value;
+                }
+              } else if (value<0.0) {
+                if (colUpper[j] >= 1e15) {
+                  dmaxdown = -1e31;
+                  ++iflagl;
+                } else {
+                  dmaxdown += colUpper[j] * value;
+                }
+                if (colLower[j] <= -1e15) {
+                  dmaxup = 1e31;
+                  ++iflagu;
+                } else {
+                  dmaxup += colLower[j] * value;
+                }
+              }
+	    } else {
+              // Chosen variable
+              if (value > 0.0) {
+                if (colUpper[j] >= 1e15) {
+                  upAdjust = 1e31;
+                } else {
+                  upAdjust = colUpper[j] * value;
+                }
+                if (colLower[j] <= -1e15) {
+                  downAdjust = -1e31;
+                } else {
+                  downAdjust = colLower[j] * value;
+                }
+              } else if (value<0.0) {
+                if (colUpper[j] >= 1e15) {
+                  downAdjust = -1e31;
+                } else {
+                  downAdjust = colUpper[j] * value;
+                }
+                if (colLower[j] <= -1e15) {
+                  upAdjust = 1e31;
+                } else {
+                  upAdjust = colLower[j] * value;
+                }
+              }
+            }
+          }
+	  dmaxup += rhsAdjustment;
+	  dmaxdown += rhsAdjustment;
+          // end of row
+          if (iflagu)
+            dmaxup=1.0e31;
+          if (iflagl)
+            dmaxdown=-1.0e31;
+	  // See if redundant
+	  if (dmaxdown+downAdjust>rowLower[i]-tolerance&&
+	      dmaxup+upAdjust<rowUpper[i]+tolerance) 
+	    continue;
+          if (dmaxdown+valueInteger*upperBound>rowLower[i]&&
+              dmaxup+valueInteger*upperBound<rowUpper[i]) {
+            // check to see if always feasible at 1 but not always at 0
+            if (dmaxdown+valueInteger>rowLower[i]&&dmaxup+valueInteger<rowUpper[i]&&
+                (dmaxdown<rowLower[i]-primalTolerance_||dmaxup>rowUpper[i]+primalTolerance_)) {
+              // can tighten (maybe)
+              double saveValue = valueInteger;
+              if (valueInteger>0.0) {
+                assert (dmaxdown<rowLower[i]);
+                valueInteger = rowLower[i]-dmaxdown;
+              } else {
+                assert (dmaxup>rowUpper[i]);
+                valueInteger = rowUpper[i]-dmaxup;
+              }
+              if (fabs(saveValue-valueInteger)>1.0e-12) {
+                // take
+                OsiRowCut rc;
+                rc.setLb(rowLower[i]);
+                rc.setUb(rowUpper[i]);
+                int n=0;
+                double sum=0.0;
+                for (int kk=rowStart[i];kk<rowStart[i+1];kk++) {
+                  int j=column[kk];
+                  if (j!=kInt) {
+                    sum += colsol[j]*rowElements[kk];
+                    index[n]=j;
+                    element[n++]=rowElements[kk];
+                  } else {
+                    sum += colsol[j]*valueInteger;
+                    assert (rowElements[kk]*valueInteger>=0.0);
+#if 0
+                    if (fabs(rowElements[kk])>1.01*fabs(valueInteger)) {
+                      printf("row %d changing coefficient of %d from %g to %g\n",
+                             i,kInt,rowElements[kk],valueInteger);
+                    }
+#endif
+                    if (fabs(valueInteger)>1.0e-12) {
+                      index[n]=column[kk];
+                      element[n++]=valueInteger;
+                    }
+                  }
+                }
+                double gap = 0.0;
+                if (sum<rowLower[i])
+                  gap=rowLower[i]-sum;
+                else if (sum>rowUpper[i])
+                  gap=sum-rowUpper[i];
+                if (gap>1.0e-4||info->strengthenRow!=NULL) {
+		  gap += 1.0e5;
+                  rc.setEffectiveness(gap);
+                  rc.setRow(n,index,element,false);
+#ifdef STRENGTHEN_PRINT
+		  {
+		    printf("1aCut %g <= ",rc.lb());
+		    int irow =i;
+		    int k;
+		    for ( k=0;k<n;k++) {
+		      int iColumn = index[k];
+		      printf("%g*",element[k]);
+		      if (si.isInteger(iColumn))
+			printf("i%d ",iColumn);
+		      else
+			printf("x%d ",iColumn);
+		    }
+		    printf("<= %g\n",rc.ub());
+		    printf("Row %g <= ",rowLower[irow]);
+		    for (k=rowStart[irow];k<rowStart[irow+1];k++) {
+		      int iColumn = column[k];
+		      printf("%g*",rowElements[k]);
+		      if (si.isInteger(iColumn))
+			printf("i%d ",iColumn);
+		      else
+			printf("x%d ",iColumn);
+		    }
+		    printf("<= %g\n",rowUpper[irow]);
+		  }
+#endif
+                  int returnCode=rowCut.addCutIfNotDuplicate(rc,i);
+                  if (returnCode<0)
+                    break; // out of space
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+#ifndef ONE_ARRAY
+  delete [] stackC0;
+  delete [] lo0;
+  delete [] up0;
+  delete [] columnGap;
+  delete [] markC;
+  delete [] stackC;
+  delete [] stackR;
+  delete [] saveL;
+  delete [] saveU;
+  delete [] saveMin;
+  delete [] saveMax;
+  delete [] index;
+  delete [] element;
+  delete [] djs;
+  delete [] largestPositiveInRow;
+  delete [] largestNegativeInRow;
+#endif
+  delete [] colsol;
+  // Add in row cuts
+  if (!ninfeas) {
+    if (!justReplace) {
+      rowCut.addCuts(cs,info->strengthenRow,info->pass);
+    } else {
+      for (int i=0;i<nRows;i++) {
+	int realRow=realRows[i];
+	if (realRow>=0) {
+	  OsiRowCut * cut = info->strengthenRow[realRow];
+	  if (cut) {
+#ifdef CLP_INVESTIGATE
+	    printf("Row %d, real row %d effectiveness %g\n",i,realRow,cut->effectiveness());
+#endif
+	    cs.insert(cut);
+	  }
+	}
+      }
+    }
+  }
+#if 0
+  {
+    int numberRowCutsAfter = cs.sizeRowCuts() ;
+    int k ;
+    for (k = 0;k<numberRowCutsAfter;k++) {
+      OsiRowCut thisCut = cs.rowCut(k) ;
+      printf("Cut %d is %g <=",k,thisCut.lb());
+      int n=thisCut.row().getNumElements();
+      const int * column = thisCut.row().getIndices();
+      const double * element = thisCut.row().getElements();
+      assert (n);
+      for (int i=0;i<n;i++) {
+	printf(" %g*x%d",element[i],column[i]);
+      }
+      printf(" <= %g\n",thisCut.ub());
+    }
+  }
+#endif
+  return (ninfeas);
+}
+// Probes candidates firstLook to lastLook-1 in lookedAt_ (one pass of probe)
+void
+CglProbing::probeCandidates(ProbeState & state, int firstLook,
+			    int lastLook) const
+{
+#ifdef STRENGTHEN_PRINT
+  const OsiSolverInterface & si = *state.si;
+#endif
+#ifdef CGL_DEBUG
+  const OsiRowCutDebugger * debugger = state.debugger;
+#endif
+  int nCols=state.rowCopy->getNumCols();
+  const int * column = state.rowCopy->getIndices();
+  const CoinBigIndex * rowStart = state.rowCopy->getVectorStarts();
+  const double * rowElements = state.rowCopy->getElements();
+  const int * row = state.columnCopy->getIndices();
+  const CoinBigIndex * columnStart = state.columnCopy->getVectorStarts();
+  const int * columnLength = state.columnCopy->getVectorLengths(); 
+  const double * columnElements = state.columnCopy->getElements();
+  const CoinBigIndex * rowStartPos = state.rowStartPos;
+  const int * realRows = state.realRows;
+  const double * rowLower = state.rowLower;
+  const double * rowUpper = state.rowUpper;
+  const char * intVar = state.intVar;
+  const double * currentColLower = state.currentColLower;
+  const double * currentColUpper = state.currentColUpper;
+#ifdef MOVE_SINGLETONS
+  const double * objective = state.objective;
+  const int * columnLength2 = state.columnLength2;
+#endif
+  const double * colsol = state.colsol;
+  const double * djs = state.djs;
+  const double * largestPositiveInRow = state.largestPositiveInRow;
+  const double * largestNegativeInRow = state.largestNegativeInRow;
+#if PROBING100
+  const int * backward = state.backward;
+#endif
+  int maxStack = state.maxStack;
+#ifdef COIN_DEVELOP
+  int maxProbe = state.maxProbe;
+#endif
+  bool justReplace = state.justReplace;
+  double direction = state.direction;
+  double cutoff = state.cutoff;
+  double current = state.current;
+  double tolerance = state.tolerance;
+  double * colLower = state.colLower;
+  double * colUpper = state.colUpper;
+  double * minR = state.minR;
+  double * maxR = state.maxR;
+  int * markR = state.markR;
+  int * markC = state.markC;
+  double * columnGap = state.columnGap;
+  double * saveL = state.saveL;
+  double * saveU = state.saveU;
+  double * saveMin = state.saveMin;
+  double * saveMax = state.saveMax;
+  double * element = state.element;
+  double * lo0 = state.lo0;
+  double * up0 = state.up0;
+  int * stackC = state.stackC;
+  int * stackR = state.stackR;
+  int * index = state.index;
+  int * stackC0 = state.stackC0;
+  row_cut & rowCut = *state.rowCut;
+  OsiCuts & cs = *state.cs;
+  CglTreeInfo * info = state.info;
+  int & ipass = state.ipass;
+  int & maxPass = state.maxPass;
+  int & nfixed = state.nfixed;
+  int & ninfeas = state.ninfeas;
+  int & justFix = state.justFix;
+  int & rowCuts = state.rowCuts;
+  int & leftTotalStack = state.leftTotalStack;
+  double & disaggEffectiveness = state.disaggEffectiveness;
+  double & needEffectiveness = state.needEffectiveness;
+  bool & anyColumnCuts = state.anyColumnCuts;
+  bool & saveFixingInfo = state.saveFixingInfo;
+  /* for both way coding */
+  int nstackC0=-1;
+  int nstackR=0,nstackC=0;
+  int iLook;
+    for (iLook=firstLook;iLook<lastLook;iLook++) {
+      double solval;
+      double down;
+      double up;
+      if (rowCut.outOfSpace()||leftTotalStack<=0) {
+	if (!justFix&&(!nfixed||info->inTree)) {
+#ifdef COIN_DEVELOP
+	  if (!info->inTree)
+	    printf("Exiting a on pass %d, maxProbe %d\n",
+		   ipass,maxProbe);
+#endif	  
+	  break;
+	} else if (justFix<=0) {
+	  if (!info->inTree) {
+	    rowCuts=0;
+	    justFix=1;
+	    disaggEffectiveness=COIN_DBL_MAX;
+	    needEffectiveness=COIN_DBL_MAX;
+	    //maxStack=10;
+	    maxPass=1;
+	  } else if (!nfixed) {
+#ifdef COIN_DEVELOP
+	    printf("Exiting b on pass %d, maxProbe %d\n",
+		   ipass,maxProbe);
+#endif	  
+	    break;
+	  }
+	}
+      }
+      int j=lookedAt_[iLook];
+      state.touch(&j,1,NULL,0);
+      //if (j==231||j==226)
+      //printf("size %d %d j is %d\n",rowCut.numberCuts(),cs.sizeRowCuts(),j);//printf("looking at %d (%d out of %d)\n",j,iLook,numberThisTime_); 
+      solval=colsol[j];
+      down = floor(solval+tolerance);
+      up = ceil(solval-tolerance);
+      if(columnGap[j]<0.0) markC[j]=3;
+      if ((markC[j]&3)!=0||!intVar[j]) continue;
+      double saveSolval = solval;
+      if (solval>=colUpper[j]-tolerance||solval<=colLower[j]+tolerance||up==down) {
+	if (solval<=colLower[j]+2.0*tolerance) {
+	  solval = colLower[j]+1.0e-1;
+	  down=colLower[j];
+	  up=down+1.0;
+	} else if (solval>=colUpper[j]-2.0*tolerance) {
+	  solval = colUpper[j]-1.0e-1;
+	  up=colUpper[j];
+	  down=up-1;
+	} else {
+          // odd
+          up=down+1.0;
+          solval = down+1.0e-1;
+        }
+      }
+      assert (up<=colUpper[j]);
+      assert (down>=colLower[j]);
+      assert (up>down);
+      int istackC,iway, istackR;
+      int way[]={1,2,1};
+      int feas[]={1,2,4};
+      int feasible=0;
+      int notFeasible;
+      for (iway=0;iway<3;iway ++) {
+        int fixThis=0;
+        double objVal=current;
+        int goingToTrueBound=0;
+        // anything changed by last probe is on stacks
+        state.touch(stackC,nstackC,stackR,nstackR);
+        stackC[0]=j;
+        markC[j]=way[iway];
+        double solMovement;
+        double movement;
+        if (way[iway]==1) {
+          movement=down-colUpper[j];
+          solMovement = down-colsol[j];
+          assert(movement<-0.99999);
+          if (fabs(down-colLower[j])<1.0e-7) {
+            goingToTrueBound=2;
+            down=colLower[j];
+          }
+        } else {
+          movement=up-colLower[j];
+          solMovement = up-colsol[j];
+          assert(movement>0.99999);
+          if (fabs(up-colUpper[j])<1.0e-7) {
+            goingToTrueBound=2;
+            up=colUpper[j];
+          }
+        }
+        if (goingToTrueBound&&(colUpper[j]-colLower[j]>1.5||colLower[j]))
+          goingToTrueBound=1;
+        // switch off disaggregation if not wanted
+        if ((rowCuts&1)==0)
+          goingToTrueBound=0;
+	bool canReplace = info->strengthenRow&&(goingToTrueBound==2);
+#ifdef PRINT_DEBUG
+        if (fabs(movement)>1.01) {
+          printf("big %d %g %g %g\n",j,colLower[j],solval,colUpper[j]);
+        }
+#endif
+        if (solMovement*djs[j]>0.0)
+          objVal += solMovement*djs[j];
+        nstackC=1;
+        nstackR=0;
+        saveL[0]=colLower[j];
+        saveU[0]=colUpper[j];
+        assert (saveU[0]>saveL[0]);
+        notFeasible=0;
+        if (movement<0.0) {
+          colUpper[j] += movement;
+          colUpper[j] = floor(colUpper[j]+0.5);
+	  columnGap[j] = colUpper[j]-colLower[j]-primalTolerance_;
+#ifdef PRINT_DEBUG
+          printf("** Trying %d down to 0\n",j);
+#endif
+        } else {
+          colLower[j] += movement;
+          colLower[j] = floor(colLower[j]+0.5);
+	  columnGap[j] = colUpper[j]-colLower[j]-primalTolerance_;
+#ifdef PRINT_DEBUG
+          printf("** Trying %d up to 1\n",j);
+#endif
+        }
+        if (fabs(colUpper[j]-colLower[j])<1.0e-6)
+          markC[j]=3; // say fixed
+	markC[j] &= ~12;
+	if (colUpper[j]>1.0e10)
+	  markC[j] |= 8;
+	if (colLower[j]<-1.0e10)
+	  markC[j] |= 4;
+        istackC=0;
+        /* update immediately */
+	int k;
+        for ( k=columnStart[j];k<columnStart[j]+columnLength[j];k++) {
+          int irow = row[k];
+          double value = columnElements[k];
+          assert (markR[irow]!=-2);
+          if (markR[irow]==-1) {
+            stackR[nstackR]=irow;
+            markR[irow]=nstackR;
+            saveMin[nstackR]=minR[irow];
+            saveMax[nstackR]=maxR[irow];
+            nstackR++;
+#if 0
+          } else if (markR[irow]==-2) {
+            continue;
+#endif
+          }
+          /* could check immediately if violation */
+          if (movement>0.0) {
+            /* up */
+            if (value>0.0) {
+              /* up does not change - down does */
+              if (minR[irow]>-1.0e10)
+                minR[irow] += value;
+              if (minR[irow]>rowUpper[irow]+1.0e-5) {
+                notFeasible=1;
+                istackC=1;
+                break;
+              }
             } else {
               /* down does not change - up does */
               if (maxR[irow]<1.0e10)
@@ -5308,139 +6259,36 @@ int CglProbing::probe( const OsiSolverInterface & si,
                   }
                 }
               }
-              colUpper[icol]=oldU;
-              colLower[icol]=oldL;
-	      columnGap[icol] = oldU-oldL-primalTolerance_;
-              if (oldU>oldL+1.0e-4) {
-                markC[icol]=0;
-		if (oldU>1.0e10)
-		  markC[icol] |= 8;
-		if (oldL<-1.0e10)
-		  markC[icol] |= 4;
-              } else {
-                markC[icol]=3;
-	      }
-            }
-            for (istackR=0;istackR<nstackR;istackR++) {
-              int irow=stackR[istackR];
-              // switch off strengthening if not wanted
-              if ((rowCuts&2)!=0&&goingToTrueBound) {
-		bool canReplace = info->strengthenRow&&(goingToTrueBound==2);
-                bool ifCut=anyColumnCuts;
-                double gap = rowUpper[irow]-maxR[irow];
-                double sum=0.0;
-                if (!ifCut&&(gap>primalTolerance_&&gap<1.0e8)) {
-                  // see if the strengthened row is a cut
-                  for (int kk =rowStart[irow];kk<rowStart[irow+1];
-                       kk++) {
-                    sum += rowElements[kk]*colsol[column[kk]];
-                  }
-                  if (sum+gap*colsol[j]>rowUpper[irow]+primalTolerance_||(canReplace&&rowLower[irow]<-1.e20)) {
-                    // can be a cut
-                    // add gap to integer coefficient
-                    // saveU and saveL spare
-                    int * index = reinterpret_cast<int *>(saveL);
-                    double * element = saveU;
-                    int n=0;
-                    bool coefficientExists=false;
-		    double sum2=0.0;
-                    for (int kk =rowStart[irow];kk<rowStart[irow+1];
-                         kk++) {
-		      int kColumn = column[kk];
-		      double el = rowElements[kk];
-                      if (kColumn!=j) {
-                        index[n]=kColumn;
-                        element[n++]=el;
-                      } else {
-                        el=el+gap;
-                        if (fabs(el)>1.0e-12) {
-                          index[n]=kColumn;
-                          element[n++]=el;
-                        }
-                        coefficientExists=true;
-                      }
-		      sum2 += colsol[kColumn]*el;
-                    }
-                    if (!coefficientExists) {
-                      index[n]=j;
-                      element[n++]=gap;
-		      sum2 += colsol[j]*gap;
-                    }
-                    OsiRowCut rc;
-                    rc.setLb(-COIN_DBL_MAX);
-		    double ub = rowUpper[irow]+gap*(colUpper[j]-1.0);
-                    rc.setUb(ub);
-                    // effectiveness
-                    double effectiveness=sum2-ub;
-                    effectiveness = CoinMax(effectiveness,
-					    (sum+gap*colsol[j]-
-					     rowUpper[irow])/gap);
-		    if (!coefficientExists)
-		      effectiveness=CoinMax(1.0e-7,
-					    effectiveness);
-                    rc.setEffectiveness(effectiveness);
-                    if (rc.effectiveness()>needEffectiveness) {
-                      rc.setRow(n,index,element,false);
-#ifdef CGL_DEBUG
-                      if (debugger) assert(!debugger->invalidCut(rc)); 
-#endif
-                      //if(canReplace)
-                      //printf("c point to row %d\n",irow);
-#ifdef STRENGTHEN_PRINT
-		      if (canReplace&&rowLower[irow]<-1.0e20) {
-			printf("3Cut %g <= ",rc.lb());
-			int k;
-			for ( k=0;k<n;k++) {
-			  int iColumn = index[k];
-			  printf("%g*",element[k]);
-			  if (si.isInteger(iColumn))
-			    printf("i%d ",iColumn);
-			  else
-			    printf("x%d ",iColumn);
-			}
-			printf("<= %g\n",rc.ub());
-			printf("Row %g <= ",rowLower[irow]);
-			for (k=rowStart[irow];k<rowStart[irow+1];k++) {
-			  int iColumn = column[k];
-			  printf("%g*",rowElements[k]);
-			  if (si.isInteger(iColumn))
-			    printf("i%d ",iColumn);
-			  else
-			    printf("x%d ",iColumn);
-			}
-			printf("<= %g\n",rowUpper[irow]);
-		      }
-#endif
-		      int realRow = (canReplace&&rowLower[irow]<-1.0e20) ? irow : -1;
-		      if (realRows&&realRow>=0)
-			realRow=realRows[realRow];
-		      if (!justReplace) {
-			rowCut.addCutIfNotDuplicate(rc,realRow);
-		      } else if (realRow>=0) {
-			double effectiveness=0.0;
-			for (int i=0;i<n;i++)
-			  effectiveness+=fabs(element[i]);
-			if (!info->strengthenRow[realRow]||info->strengthenRow[realRow]->effectiveness()>effectiveness) {
-			  delete info->strengthenRow[realRow];
-			  rc.setEffectiveness(effectiveness);
-			  info->strengthenRow[realRow]=rc.clone();
-			}
-		      }
-                    }
-                  }
-                }
-                gap = minR[irow]-rowLower[irow];
+              colUpper[icol]=oldU;
+              colLower[icol]=oldL;
+	      columnGap[icol] = oldU-oldL-primalTolerance_;
+              if (oldU>oldL+1.0e-4) {
+                markC[icol]=0;
+		if (oldU>1.0e10)
+		  markC[icol] |= 8;
+		if (oldL<-1.0e10)
+		  markC[icol] |= 4;
+              } else {
+                markC[icol]=3;
+	      }
+            }
+            for (istackR=0;istackR<nstackR;istackR++) {
+              int irow=stackR[istackR];
+              // switch off strengthening if not wanted
+              if ((rowCuts&2)!=0&&goingToTrueBound) {
+		bool canReplace = info->strengthenRow&&(goingToTrueBound==2);
+                bool ifCut=anyColumnCuts;
+                double gap = rowUpper[irow]-maxR[irow];
+                double sum=0.0;
                 if (!ifCut&&(gap>primalTolerance_&&gap<1.0e8)) {
                   // see if the strengthened row is a cut
-                  if (!sum) {
-                    for (int kk =rowStart[irow];kk<rowStart[irow+1];
-                         kk++) {
-                      sum += rowElements[kk]*colsol[column[kk]];
-                    }
+                  for (int kk =rowStart[irow];kk<rowStart[irow+1];
+                       kk++) {
+                    sum += rowElements[kk]*colsol[column[kk]];
                   }
-                  if (sum-gap*colsol[j]<rowLower[irow]-primalTolerance_||(canReplace&&rowUpper[irow]>1.0e20)) {
+                  if (sum+gap*colsol[j]>rowUpper[irow]+primalTolerance_||(canReplace&&rowLower[irow]<-1.e20)) {
                     // can be a cut
-                    // subtract gap from integer coefficient
+                    // add gap to integer coefficient
                     // saveU and saveL spare
                     int * index = reinterpret_cast<int *>(saveL);
                     double * element = saveU;
@@ -5455,7 +6303,7 @@ int CglProbing::probe( const OsiSolverInterface & si,
                         index[n]=kColumn;
                         element[n++]=el;
                       } else {
-                        el=el-gap;
+                        el=el+gap;
                         if (fabs(el)>1.0e-12) {
                           index[n]=kColumn;
                           element[n++]=el;
@@ -5466,17 +6314,18 @@ int CglProbing::probe( const OsiSolverInterface & si,
                     }
                     if (!coefficientExists) {
                       index[n]=j;
-                      element[n++]=-gap;
-		      sum2 -= colsol[j]*gap;
+                      element[n++]=gap;
+		      sum2 += colsol[j]*gap;
                     }
                     OsiRowCut rc;
-                    double lb = rowLower[irow]-gap*(colUpper[j]-1);
-                    rc.setLb(lb);
-                    rc.setUb(COIN_DBL_MAX);
-		    double effectiveness=lb-sum2;
+                    rc.setLb(-COIN_DBL_MAX);
+		    double ub = rowUpper[irow]+gap*(colUpper[j]-1.0);
+                    rc.setUb(ub);
+                    // effectiveness
+                    double effectiveness=sum2-ub;
                     effectiveness = CoinMax(effectiveness,
-					    (rowLower[irow]-
-					     sum+gap*colsol[j])/gap);
+					    (sum+gap*colsol[j]-
+					     rowUpper[irow])/gap);
 		    if (!coefficientExists)
 		      effectiveness=CoinMax(1.0e-7,
 					    effectiveness);
@@ -5487,321 +6336,162 @@ int CglProbing::probe( const OsiSolverInterface & si,
                       if (debugger) assert(!debugger->invalidCut(rc)); 
 #endif
                       //if(canReplace)
-                      //printf("d point to row %d\n",irow);
+                      //printf("c point to row %d\n",irow);
 #ifdef STRENGTHEN_PRINT
-		      if (canReplace&&rowUpper[irow]>1.0e20) {
-			printf("4Cut %g <= ",rc.lb());
+		      if (canReplace&&rowLower[irow]<-1.0e20) {
+			printf("3Cut %g <= ",rc.lb());
 			int k;
 			for ( k=0;k<n;k++) {
 			  int iColumn = index[k];
-			  printf("%g*",element[k]);
-			  if (si.isInteger(iColumn))
-			    printf("i%d ",iColumn);
-			  else
-			    printf("x%d ",iColumn);
-			}
-			printf("<= %g\n",rc.ub());
-			printf("Row %g <= ",rowLower[irow]);
-			for (k=rowStart[irow];k<rowStart[irow+1];k++) {
-			  int iColumn = column[k];
-			  printf("%g*",rowElements[k]);
-			  if (si.isInteger(iColumn))
-			    printf("i%d ",iColumn);
-			  else
-			    printf("x%d ",iColumn);
-			}
-			printf("<= %g\n",rowUpper[irow]);
-		      }
-#endif
-		      int realRow = (canReplace&&rowUpper[irow]>1.0e20) ? irow : -1;
-		      if (realRows&&realRow>=0)
-			realRow=realRows[realRow];
-		      if (!justReplace) {
-			rowCut.addCutIfNotDuplicate(rc,realRow);
-		      } else if (realRow>=0) {
-			double effectiveness=0.0;
-			for (int i=0;i<n;i++)
-			  effectiveness+=fabs(element[i]);
-			if (!info->strengthenRow[realRow]||info->strengthenRow[realRow]->effectiveness()>effectiveness) {
-			  delete info->strengthenRow[realRow];
-			  rc.setEffectiveness(effectiveness);
-			  info->strengthenRow[realRow]=rc.clone();
-			}
-		      }
-                    }
-                  }
-                }
-              }
-              minR[irow]=saveMin[istackR];
-              maxR[irow]=saveMax[istackR];
-              markR[irow]=-1;
-            }
-          }
-        }
-      }
-    }
-  }
-  if ((!ninfeas&&!rowCut.outOfSpace())&&(info->strengthenRow||
-                 !rowCut.numberCuts())&&rowCuts) {
-    // Try and find ALL big M's
-    for (int i = 0; i < nRowsSafe; ++i) {
-      if ((rowLower[i]>-1.0e20||rowUpper[i]<1.0e20)&&
-          (!info->strengthenRow||!info->strengthenRow[i])) {
-	int iflagu = 0;
-	int iflagl = 0;
-	double dmaxup = 0.0;
-	double dmaxdown = 0.0;
-	int krs = rowStart[i];
-	int kre = rowStart[i+1];
-        int kInt = -1;
-	double rhsAdjustment=0.0;
-	int nPosInt=0;
-	int nNegInt=0;
-        double valueInteger=0.0;
-        // Find largest integer coefficient
-	int k;
-        for ( k = krs; k < kre; ++k) {
-          int j = column[k];
-          if (intVar[j]) {
-            double value=rowElements[k];
-            if (colUpper[j]>colLower[j]&&!colLower[j]&&
-                fabs(value)>fabs(valueInteger)) {
-              kInt=j;
-              valueInteger=value;
-            }
-          }
-        }
-        if (kInt>=0) {
-          double upperBound = CoinMin(colUpper[kInt],static_cast<double>(COIN_INT_MAX));
-	  double upAdjust=0.0;
-	  double downAdjust=0.0;
-          for (k = krs; k < kre; ++k) {
-            double value=rowElements[k];
-            int j = column[k];
-            if (colUpper[j]==colLower[j]) {
-	      rhsAdjustment += colUpper[j]*value;
-              continue;
-            }
-	    if (intVar[j]) {
-	      if (value>0.0)
-		nPosInt++;
-	      else
-		nNegInt++;
-	    } else {
-	      nPosInt = -nCols;
-	    }
-            if (j!=kInt) {
-              // treat as continuous
-              if (value > 0.0) {
-                if (colUpper[j] >= 1e15) {
-                  dmaxup = 1e31;
-                  ++iflagu;
-                } else {
-                  dmaxup += colUpper[j] * value;
-                }
-                if (colLower[j] <= -1e15) {
-                  dmaxdown = -1e31;
-                  ++iflagl;
-                } else {
-                  dmaxdown += colLower[j] * value;
-                }
-              } else if (value<0.0) {
-                if (colUpper[j] >= 1e15) {
-                  dmaxdown = -1e31;
-                  ++iflagl;
-                } else {
-                  dmaxdown += colUpper[j] * value;
-                }
-                if (colLower[j] <= -1e15) {
-                  dmaxup = 1e31;
-                  ++iflagu;
-                } else {
-                  dmaxup += colLower[j] * value;
-                }
-              }
-	    } else {
-              // Chosen variable
-              if (value > 0.0) {
-                if (colUpper[j] >= 1e15) {
-                  upAdjust = 1e31;
-                } else {
-                  upAdjust = colUpper[j] * value;
-                }
-                if (colLower[j] <= -1e15) {
-                  downAdjust = -1e31;
-                } else {
-                  downAdjust = colLower[j] * value;
-                }
-              } else if (value<0.0) {
-                if (colUpper[j] >= 1e15) {
-                  downAdjust = -1e31;
-                } else {
-                  downAdjust = colUpper[j] * value;
-                }
-                if (colLower[j] <= -1e15) {
-                  upAdjust = 1e31;
-                } else {
-                  upAdjust = colLower[j] * value;
-                }
-              }
-            }
-          }
-	  dmaxup += rhsAdjustment;
-	  dmaxdown += rhsAdjustment;
-          // end of row
-          if (iflagu)
-            dmaxup=1.0e31;
-          if (iflagl)
-            dmaxdown=-1.0e31;
-	  // See if redundant
-	  if (dmaxdown+downAdjust>rowLower[i]-tolerance&&
-	      dmaxup+upAdjust<rowUpper[i]+tolerance) 
-	    continue;
-          if (dmaxdown+valueInteger*upperBound>rowLower[i]&&
-              dmaxup+valueInteger*upperBound<rowUpper[i]) {
-            // check to see if always feasible at 1 but not always at 0
-            if (dmaxdown+valueInteger>rowLower[i]&&dmaxup+valueInteger<rowUpper[i]&&
-                (dmaxdown<rowLower[i]-primalTolerance_||dmaxup>rowUpper[i]+primalTolerance_)) {
-              // can tighten (maybe)
-              double saveValue = valueInteger;
-              if (valueInteger>0.0) {
-                assert (dmaxdown<rowLower[i]);
-                valueInteger = rowLower[i]-dmaxdown;
-              } else {
-                assert (dmaxup>rowUpper[i]);
-                valueInteger = rowUpper[i]-dmaxup;
-              }
-              if (fabs(saveValue-valueInteger)>1.0e-12) {
-                // take
-                OsiRowCut rc;
-                rc.setLb(rowLower[i]);
-                rc.setUb(rowUpper[i]);
-                int n=0;
-                double sum=0.0;
-                for (int kk=rowStart[i];kk<rowStart[i+1];kk++) {
-                  int j=column[kk];
-                  if (j!=kInt) {
-                    sum += colsol[j]*rowElements[kk];
-                    index[n]=j;
-                    element[n++]=rowElements[kk];
-                  } else {
-                    sum += colsol[j]*valueInteger;
-                    assert (rowElements[kk]*valueInteger>=0.0);
-#if 0
-                    if (fabs(rowElements[kk])>1.01*fabs(valueInteger)) {
-                      printf("row %d changing coefficient of %d from %g to %g\n",
-                             i,kInt,rowElements[kk],valueInteger);
-                    }
+			  printf("%g*",element[k]);
+			  if (si.isInteger(iColumn))
+			    printf("i%d ",iColumn);
+			  else
+			    printf("x%d ",iColumn);
+			}
+			printf("<= %g\n",rc.ub());
+			printf("Row %g <= ",rowLower[irow]);
+			for (k=rowStart[irow];k<rowStart[irow+1];k++) {
+			  int iColumn = column[k];
+			  printf("%g*",rowElements[k]);
+			  if (si.isInteger(iColumn))
+			    printf("i%d ",iColumn);
+			  else
+			    printf("x%d ",iColumn);
+			}
+			printf("<= %g\n",rowUpper[irow]);
+		      }
 #endif
-                    if (fabs(valueInteger)>1.0e-12) {
-                      index[n]=column[kk];
-                      element[n++]=valueInteger;
+		      int realRow = (canReplace&&rowLower[irow]<-1.0e20) ? irow : -1;
+		      if (realRows&&realRow>=0)
+			realRow=realRows[realRow];
+		      if (!justReplace) {
+			rowCut.addCutIfNotDuplicate(rc,realRow);
+		      } else if (realRow>=0) {
+			double effectiveness=0.0;
+			for (int i=0;i<n;i++)
+			  effectiveness+=fabs(element[i]);
+			if (!info->strengthenRow[realRow]||info->strengthenRow[realRow]->effectiveness()>effectiveness) {
+			  delete info->strengthenRow[realRow];
+			  rc.setEffectiveness(effectiveness);
+			  info->strengthenRow[realRow]=rc.clone();
+			}
+		      }
                     }
                   }
                 }
-                double gap = 0.0;
-                if (sum<rowLower[i])
-                  gap=rowLower[i]-sum;
-                else if (sum>rowUpper[i])
-                  gap=sum-rowUpper[i];
-                if (gap>1.0e-4||info->strengthenRow!=NULL) {
-		  gap += 1.0e5;
-                  rc.setEffectiveness(gap);
-                  rc.setRow(n,index,element,false);
+                gap = minR[irow]-rowLower[irow];
+                if (!ifCut&&(gap>primalTolerance_&&gap<1.0e8)) {
+                  // see if the strengthened row is a cut
+                  if (!sum) {
+                    for (int kk =rowStart[irow];kk<rowStart[irow+1];
+                         kk++) {
+                      sum += rowElements[kk]*colsol[column[kk]];
+                    }
+                  }
+                  if (sum-gap*colsol[j]<rowLower[irow]-primalTolerance_||(canReplace&&rowUpper[irow]>1.0e20)) {
+                    // can be a cut
+                    // subtract gap from integer coefficient
+                    // saveU and saveL spare
+                    int * index = reinterpret_cast<int *>(saveL);
+                    double * element = saveU;
+                    int n=0;
+                    bool coefficientExists=false;
+		    double sum2=0.0;
+                    for (int kk =rowStart[irow];kk<rowStart[irow+1];
+                         kk++) {
+		      int kColumn = column[kk];
+		      double el = rowElements[kk];
+                      if (kColumn!=j) {
+                        index[n]=kColumn;
+                        element[n++]=el;
+                      } else {
+                        el=el-gap;
+                        if (fabs(el)>1.0e-12) {
+                          index[n]=kColumn;
+                          element[n++]=el;
+                        }
+                        coefficientExists=true;
+                      }
+		      sum2 += colsol[kColumn]*el;
+                    }
+                    if (!coefficientExists) {
+                      index[n]=j;
+                      element[n++]=-gap;
+		      sum2 -= colsol[j]*gap;
+                    }
+                    OsiRowCut rc;
+                    double lb = rowLower[irow]-gap*(colUpper[j]-1);
+                    rc.setLb(lb);
+                    rc.setUb(COIN_DBL_MAX);
+		    double effectiveness=lb-sum2;
+                    effectiveness = CoinMax(effectiveness,
+					    (rowLower[irow]-
+					     sum+gap*colsol[j])/gap);
+		    if (!coefficientExists)
+		      effectiveness=CoinMax(1.0e-7,
+					    effectiveness);
+                    rc.setEffectiveness(effectiveness);
+                    if (rc.effectiveness()>needEffectiveness) {
+                      rc.setRow(n,index,element,false);
+#ifdef CGL_DEBUG
+                      if (debugger) assert(!debugger->invalidCut(rc)); 
+#endif
+                      //if(canReplace)
+                      //printf("d point to row %d\n",irow);
 #ifdef STRENGTHEN_PRINT
-		  {
-		    printf("1aCut %g <= ",rc.lb());
-		    int irow =i;
-		    int k;
-		    for ( k=0;k<n;k++) {
-		      int iColumn = index[k];
-		      printf("%g*",element[k]);
-		      if (si.isInteger(iColumn))
-			printf("i%d ",iColumn);
-		      else
-			printf("x%d ",iColumn);
-		    }
-		    printf("<= %g\n",rc.ub());
-		    printf("Row %g <= ",rowLower[irow]);
-		    for (k=rowStart[irow];k<rowStart[irow+1];k++) {
-		      int iColumn = column[k];
-		      printf("%g*",rowElements[k]);
-		      if (si.isInteger(iColumn))
-			printf("i%d ",iColumn);
-		      else
-			printf("x%d ",iColumn);
-		    }
-		    printf("<= %g\n",rowUpper[irow]);
-		  }
+		      if (canReplace&&rowUpper[irow]>1.0e20) {
+			printf("4Cut %g <= ",rc.lb());
+			int k;
+			for ( k=0;k<n;k++) {
+			  int iColumn = index[k];
+			  printf("%g*",element[k]);
+			  if (si.isInteger(iColumn))
+			    printf("i%d ",iColumn);
+			  else
+			    printf("x%d ",iColumn);
+			}
+			printf("<= %g\n",rc.ub());
+			printf("Row %g <= ",rowLower[irow]);
+			for (k=rowStart[irow];k<rowStart[irow+1];k++) {
+			  int iColumn = column[k];
+			  printf("%g*",rowElements[k]);
+			  if (si.isInteger(iColumn))
+			    printf("i%d ",iColumn);
+			  else
+			    printf("x%d ",iColumn);
+			}
+			printf("<= %g\n",rowUpper[irow]);
+		      }
 #endif
-                  int returnCode=rowCut.addCutIfNotDuplicate(rc,i);
-                  if (returnCode<0)
-                    break; // out of space
+		      int realRow = (canReplace&&rowUpper[irow]>1.0e20) ? irow : -1;
+		      if (realRows&&realRow>=0)
+			realRow=realRows[realRow];
+		      if (!justReplace) {
+			rowCut.addCutIfNotDuplicate(rc,realRow);
+		      } else if (realRow>=0) {
+			double effectiveness=0.0;
+			for (int i=0;i<n;i++)
+			  effectiveness+=fabs(element[i]);
+			if (!info->strengthenRow[realRow]||info->strengthenRow[realRow]->effectiveness()>effectiveness) {
+			  delete info->strengthenRow[realRow];
+			  rc.setEffectiveness(effectiveness);
+			  info->strengthenRow[realRow]=rc.clone();
+			}
+		      }
+                    }
+                  }
                 }
               }
+              minR[irow]=saveMin[istackR];
+              maxR[irow]=saveMax[istackR];
+              markR[irow]=-1;
             }
           }
         }
       }
     }
-  }
-#ifndef ONE_ARRAY
-  delete [] stackC0;
-  delete [] lo0;
-  delete [] up0;
-  delete [] columnGap;
-  delete [] markC;
-  delete [] stackC;
-  delete [] stackR;
-  delete [] saveL;
-  delete [] saveU;
-  delete [] saveMin;
-  delete [] saveMax;
-  delete [] index;
-  delete [] element;
-  delete [] djs;
-  delete [] largestPositiveInRow;
-  delete [] largestNegativeInRow;
-#endif
-  delete [] colsol;
-  // Add in row cuts
-  if (!ninfeas) {
-    if (!justReplace) {
-      rowCut.addCuts(cs,info->strengthenRow,info->pass);
-    } else {
-      for (int i=0;i<nRows;i++) {
-	int realRow=realRows[i];
-	if (realRow>=0) {
-	  OsiRowCut * cut = info->strengthenRow[realRow];
-	  if (cut) {
-#ifdef CLP_INVESTIGATE
-	    printf("Row %d, real row %d effectiveness %g\n",i,realRow,cut->effectiveness());
-#endif
-	    cs.insert(cut);
-	  }
-	}
-      }
-    }
-  }
-#if 0
-  {
-    int numberRowCutsAfter = cs.sizeRowCuts() ;
-    int k ;
-    for (k = 0;k<numberRowCutsAfter;k++) {
-      OsiRowCut thisCut = cs.rowCut(k) ;
-      printf("Cut %d is %g <=",k,thisCut.lb());
-      int n=thisCut.row().getNumElements();
-      const int * column = thisCut.row().getIndices();
-      const double * element = thisCut.row().getElements();
-      assert (n);
-      for (int i=0;i<n;i++) {
-	printf(" %g*x%d",element[i],column[i]);
-      }
-      printf(" <= %g\n",thisCut.ub());
-    }
-  }
-#endif
-  return (ninfeas);
+    state.touch(stackC,nstackC,stackR,nstackR);
 }
 // Does probing and adding cuts
 int CglProbing::probeCliques( const OsiSolverInterface & si, 
@@ -8550,6 +9240,7 @@ int CglProbing::snapshot ( const OsiSolverInterface & si,
   
   numberColumns_=si.getNumCols(); 
   numberRows_=si.getNumRows();
+  numberSolverRows_=numberRows_;
   colLower_ = new double[numberColumns_];
   colUpper_ = new double[numberColumns_];
   CoinMemcpyN(si.getColLower(),numberColumns_,colLower_);
@@ -8585,6 +9276,8 @@ int CglProbing::snapshot ( const OsiSolverInterface & si,
   }
     
   rowCopy_ = new CoinPackedMatrix(*si.getMatrixByRow());
+  matrixUsers_ = new int [1];
+  matrixUsers_[0]=1;
 
   int * column = rowCopy_->getMutableIndices();
   const CoinBigIndex * rowStart = rowCopy_->getVectorStarts();
@@ -8593,7 +9286,6 @@ int CglProbing::snapshot ( const OsiSolverInterface & si,
   // Put negative first
   int * column2 = new int[numberColumns_];
   double * elements2 = new double[numberColumns_];
-  CoinBigIndex * rowStartPos = new CoinBigIndex [numberRows_];
   for (int i=0;i<numberRows_;i++) {
     CoinBigIndex start = rowStart[i];
     CoinBigIndex end = start + rowLength[i];
@@ -8609,7 +9301,6 @@ int CglProbing::snapshot ( const OsiSolverInterface & si,
 	column2[nOther++]=iColumn;
       }
     }
-    rowStartPos[i] = start;
     for (int k=0;k<nOther;k++) {
       rowElements[start]=elements2[k];
       column[start++]=column2[k];
@@ -8620,10 +9311,8 @@ int CglProbing::snapshot ( const OsiSolverInterface & si,
   
   int returnCode=0;
   int ninfeas= 
-    tighten(colLower_, colUpper_, column, rowElements,
-	    rowStart, NULL,rowLength, rowLower_, rowUpper_,
-	    numberRows_, numberColumns_, intVar, 5, primalTolerance_);
-  delete [] rowStartPos;
+    tighten(colLower_, colUpper_, *rowCopy_, rowLower_, rowUpper_,
+	    intVar, 5, primalTolerance_);
   if (ninfeas) {
     // let someone else find out
     returnCode = 1;
@@ -8700,10 +9389,7 @@ void CglProbing::deleteSnapshot()
   delete [] rowUpper_;
   delete [] colLower_;
   delete [] colUpper_;
-  delete rowCopy_;
-  delete columnCopy_;
-  rowCopy_=NULL;
-  columnCopy_=NULL;
+  releaseMatrices();
   rowLower_=NULL;
   rowUpper_=NULL;
   colLower_=NULL;
@@ -8717,6 +9403,20 @@ void CglProbing::deleteSnapshot()
   number01Integers_=0;
   cutVector_=NULL;
 }
+// Drop share of snapshot matrices
+void CglProbing::releaseMatrices()
+{
+  // kept probing copies may have been made from snapshot
+  releaseProbingCopies();
+  if (matrixUsers_&&!changeUsers(matrixUsers_,-1)) {
+    delete rowCopy_;
+    delete columnCopy_;
+    delete [] matrixUsers_;
+  }
+  rowCopy_=NULL;
+  columnCopy_=NULL;
+  matrixUsers_=NULL;
+}
 // Mode stuff
 void CglProbing::setMode(int mode)
 {
@@ -8894,9 +9594,18 @@ usingObjective_(0)
 {
 
   numberRows_=0;
+  numberSolverRows_=0;
   numberColumns_=0;
   rowCopy_=NULL;
   columnCopy_=NULL;
+  matrixUsers_=NULL;
+  probingRowCopy_=NULL;
+  probingColumnCopy_=NULL;
+  probingRowStartPos_=NULL;
+  probingKey_=NULL;
+  probingBase_=NULL;
+  probingColumnLength_=NULL;
+  probingUsers_=NULL;
   rowLower_=NULL;
   rowUpper_=NULL;
   colLower_=NULL;
@@ -8918,6 +9627,8 @@ usingObjective_(0)
   cliqueRow_=NULL;
   cliqueRowStart_=NULL;
   tightenBounds_=NULL;
+  numberThreads_=1;
+  deterministic_=true;
 }
 
 //-------------------------------------------------------------------
@@ -8941,19 +9652,20 @@ CglProbing::CglProbing (  const CglProbing & rhs)
   usingObjective_(rhs.usingObjective_)
 {  
   numberRows_=rhs.numberRows_;
+  numberSolverRows_=rhs.numberSolverRows_;
   numberColumns_=rhs.numberColumns_;
   numberCliques_=rhs.numberCliques_;
   if (rhs.rowCopy_) {
-    rowCopy_= new CoinPackedMatrix(*(rhs.rowCopy_));
-    columnCopy_= new CoinPackedMatrix(*(rhs.columnCopy_));
-    rowLower_=new double[numberRows_];
-    CoinMemcpyN(rhs.rowLower_,numberRows_,rowLower_);
-    rowUpper_=new double[numberRows_];
-    CoinMemcpyN(rhs.rowUpper_,numberRows_,rowUpper_);
-    colLower_=new double[numberColumns_];
-    CoinMemcpyN(rhs.colLower_,numberColumns_,colLower_);
-    colUpper_=new double[numberColumns_];
-    CoinMemcpyN(rhs.colUpper_,numberColumns_,colUpper_);
+    // matrices are shared
+    rowCopy_= rhs.rowCopy_;
+    columnCopy_= rhs.columnCopy_;
+    matrixUsers_ = rhs.matrixUsers_;
+    changeUsers(matrixUsers_,1);
+    shareProbingCopies(rhs);
+    rowLower_=CoinCopyOfArray(rhs.rowLower_,numberRows_);
+    rowUpper_=CoinCopyOfArray(rhs.rowUpper_,numberRows_);
+    colLower_=CoinCopyOfArray(rhs.colLower_,numberColumns_);
+    colUpper_=CoinCopyOfArray(rhs.colUpper_,numberColumns_);
     int i;
     numberIntegers_=rhs.numberIntegers_;
     number01Integers_=rhs.number01Integers_;
@@ -8967,6 +9679,14 @@ CglProbing::CglProbing (  const CglProbing & rhs)
   } else {
     rowCopy_=NULL;
     columnCopy_=NULL;
+    matrixUsers_=NULL;
+    probingRowCopy_=NULL;
+    probingColumnCopy_=NULL;
+    probingRowStartPos_=NULL;
+    probingKey_=NULL;
+    probingBase_=NULL;
+    probingColumnLength_=NULL;
+    probingUsers_=NULL;
     rowLower_=NULL;
     rowUpper_=NULL;
     colLower_=NULL;
@@ -9032,6 +9752,8 @@ CglProbing::CglProbing (  const CglProbing & rhs)
   } else {
     tightenBounds_=NULL;
   }
+  numberThreads_=rhs.numberThreads_;
+  deterministic_=rhs.deterministic_;
 }
 
 //-------------------------------------------------------------------
@@ -9053,8 +9775,7 @@ CglProbing::~CglProbing ()
   delete [] rowUpper_;
   delete [] colLower_;
   delete [] colUpper_;
-  delete rowCopy_;
-  delete columnCopy_;
+  releaseMatrices();
   delete [] lookedAt_;
   delete [] cliqueType_;
   delete [] cliqueStart_;
@@ -9085,13 +9806,19 @@ CglProbing::operator=(
     CglCutGenerator::operator=(rhs);
     primalTolerance_=rhs.primalTolerance_;
     numberRows_=rhs.numberRows_;
+    numberSolverRows_=rhs.numberSolverRows_;
     numberColumns_=rhs.numberColumns_;
     delete [] rowLower_;
     delete [] rowUpper_;
     delete [] colLower_;
     delete [] colUpper_;
-    delete rowCopy_;
-    delete columnCopy_;
+    releaseMatrices();
+    if (cutVector_) {
+      for (int i=0;i<number01Integers_;i++) {
+        delete [] cutVector_[i].index;
+      }
+      delete [] cutVector_;
+    }
     delete [] lookedAt_;
     delete [] cliqueType_;
     delete [] cliqueStart_;
@@ -9117,23 +9844,19 @@ CglProbing::operator=(
     usingObjective_=rhs.usingObjective_;
     numberCliques_=rhs.numberCliques_;
     if (rhs.rowCopy_) {
-      rowCopy_= new CoinPackedMatrix(*(rhs.rowCopy_));
-      columnCopy_= new CoinPackedMatrix(*(rhs.columnCopy_));
-      rowLower_=new double[numberRows_];
-      CoinMemcpyN(rhs.rowLower_,numberRows_,rowLower_);
-      rowUpper_=new double[numberRows_];
-      CoinMemcpyN(rhs.rowUpper_,numberRows_,rowUpper_);
-      colLower_=new double[numberColumns_];
-      CoinMemcpyN(rhs.colLower_,numberColumns_,colLower_);
-      colUpper_=new double[numberColumns_];
-      CoinMemcpyN(rhs.colUpper_,numberColumns_,colUpper_);
+      // matrices are shared
+      rowCopy_= rhs.rowCopy_;
+      columnCopy_= rhs.columnCopy_;
+      matrixUsers_ = rhs.matrixUsers_;
+      changeUsers(matrixUsers_,1);
+      shareProbingCopies(rhs);
+      rowLower_=CoinCopyOfArray(rhs.rowLower_,numberRows_);
+      rowUpper_=CoinCopyOfArray(rhs.rowUpper_,numberRows_);
+      colLower_=CoinCopyOfArray(rhs.colLower_,numberColumns_);
+      colUpper_=CoinCopyOfArray(rhs.colUpper_,numberColumns_);
       int i;
       numberIntegers_=rhs.numberIntegers_;
       number01Integers_=rhs.number01Integers_;
-      for (i=0;i<number01Integers_;i++) {
-        delete [] cutVector_[i].index;
-      }
-      delete [] cutVector_;
       cutVector_=new disaggregation [number01Integers_];
       CoinMemcpyN(rhs.cutVector_,number01Integers_,cutVector_);
       for (i=0;i<number01Integers_;i++) {
@@ -9209,6 +9932,8 @@ CglProbing::operator=(
     } else {
       tightenBounds_=NULL;
     }
+    numberThreads_=rhs.numberThreads_;
+    deterministic_=rhs.deterministic_;
   }
   return *this;
 }
@@ -9573,12 +10298,12 @@ CglProbing::setupRowCliqueInformation(const OsiSolverInterface & si)
 {
   if (!numberCliques_)
     return;
-  CoinPackedMatrix * rowCopy;
+  const CoinPackedMatrix * rowCopy;
   if (!rowCopy_) {
-    // create from current
+    // use current (only read)
     numberRows_=si.getNumRows(); 
     numberColumns_=si.getNumCols(); 
-    rowCopy = new CoinPackedMatrix(*si.getMatrixByRow());
+    rowCopy = si.getMatrixByRow();
   } else {
     rowCopy = rowCopy_;
     assert(numberRows_<=si.getNumRows()); 
@@ -9706,8 +10431,6 @@ CglProbing::setupRowCliqueInformation(const OsiSolverInterface & si)
     }
   }
   delete [] array;
-  if (rowCopy!=rowCopy_)
-    delete rowCopy;
 }
 // Mark variables to be tightened
 void 
@@ -9784,6 +10507,14 @@ CglProbing::generateCpp( FILE * fp)
     fprintf(fp,"3  probing.setAggressiveness(%d);\n",getAggressiveness());
   else
     fprintf(fp,"4  probing.setAggressiveness(%d);\n",getAggressiveness());
+  if (numberThreads()!=other.numberThreads())
+    fprintf(fp,"3  probing.setNumberThreads(%d);\n",numberThreads());
+  else
+    fprintf(fp,"4  probing.setNumberThreads(%d);\n",numberThreads());
+  if (deterministic()!=other.deterministic())
+    fprintf(fp,"3  probing.setDeterministic(%s);\n",deterministic() ? "true" : "false");
+  else
+    fprintf(fp,"4  probing.setDeterministic(%s);\n",deterministic() ? "true" : "false");
   return "probing";
 }
 //-------------------------------------------------------------
@@ -234,6 +234,33 @@ public:
   int getUsingObjective() const;
   //@}
 
+  /**@name Threads */
+  //@{
+  /** Set number of threads used to probe candidates (<=1 means serial).
+      Consecutive parts of the candidates are then probed at the same
+      time, each with its own copy of bounds and row activities.  Parts
+      are taken in order up to the first one which tightens anything and
+      probing goes on after it, so cuts, tightenings and implications are
+      exactly as from serial probing.  Not done with cliques, with
+      strengthenRow or in preprocessing.
+  */
+  inline void setNumberThreads(int value)
+  { numberThreads_ = value;}
+  /// Get number of threads
+  inline int numberThreads() const
+  { return numberThreads_;}
+  /** Set deterministic (default true).  The number of parts probed at
+      the same time is then fixed so the work done does not depend on the
+      number of threads.  Otherwise there is one part per thread.  Results
+      are the same either way.
+  */
+  inline void setDeterministic(bool yesNo)
+  { deterministic_ = yesNo;}
+  /// Get deterministic
+  inline bool deterministic() const
+  { return deterministic_;}
+  //@}
+
   /**@name Mark which continuous variables are to be tightened */
   //@{
   /// Mark variables to be tightened
@@ -290,6 +317,19 @@ private:
 	     double * rowLower, double * rowUpper,
 	     char * intVar, double * minR, double * maxR, int * markR, 
              CglTreeInfo * info);
+  /// What probe works with while going through candidates
+  struct ProbeState;
+  /// Probes candidates firstLook to lastLook-1 (one pass of probe)
+  void probeCandidates(ProbeState & state, int firstLook, int lastLook) const;
+  /// Number of parts to split candidates into for threads (1 serial)
+  int probingParts(const CglTreeInfo * info) const;
+  /** Does one pass of probe with parts of lookedAt_ probed at the same
+      time (see setNumberThreads) */
+  void probeInParallel(int numberParts, ProbeState & state) const;
+  /// Data for probing one part
+  struct ProbingTask;
+  /// Probes one part (CglTaskFunction)
+  static void probeTask(int task, int thread, void * data);
   /// Does probing and adding cuts for clique slacks
   int probeSlacks( const OsiSolverInterface & si, 
                     const OsiRowCutDebugger * debugger, 
@@ -308,23 +348,44 @@ private:
                            CglTreeInfo * info);
   /// Sets up clique information for each row
   void setupRowCliqueInformation(const OsiSolverInterface & si);
+  /** Builds the row copy probing works on from read only views of
+      snapshotRows (if given) and solverRows (plus objective row if
+      given) in one pass, leaving out deleted rows, fixed columns and
+      zeros together with its column copy.  These are kept for next call
+      and rows added to solver since are put in spare room at end.
+      See gutsOfGenerateCuts */
+  CoinPackedMatrix * probingRowCopy(const CoinPackedMatrix * snapshotRows,
+				    const CoinPackedMatrix & solverRows,
+				    int numberObjective,
+				    const int * objectiveColumn,
+				    const double * objectiveElement,
+				    const double * colLower,
+				    const double * colUpper,
+				    const char * intVar, int maxElements,
+				    double * rowLower, double * rowUpper,
+				    CoinBigIndex *& rowStartPos,
+				    int *& realRows,
+				    CoinPackedMatrix *& columnCopy,
+				    CglTreeInfo * info);
+  /// Drops this generator's share of snapshot matrices (and kept copies)
+  void releaseMatrices();
+  /// Drops this generator's share of kept probing copies
+  void releaseProbingCopies();
+  /// Shares kept probing copies of rhs
+  void shareProbingCopies(const CglProbing & rhs);
   /** This tightens column bounds (and can declare infeasibility)
-      It may also declare rows to be redundant */
+      It may also declare rows to be redundant.
+      Without row cliques a CglPropagator does the work */
   int tighten(double *colLower, double * colUpper,
-              const int *column, const double *rowElements, 
-              const CoinBigIndex *rowStart,const CoinBigIndex * rowStartPos,
-	      const int * rowLength,
+              const CoinPackedMatrix & rowCopy,
               double *rowLower, double *rowUpper, 
-              int nRows,int nCols,char * intVar,int maxpass,
+              char * intVar,int maxpass,
               double tolerance);
-  /// This just sets minima and maxima on rows
-  void tighten2(double *colLower, double * colUpper,
-                const int *column, const double *rowElements, 
-                const CoinBigIndex *rowStart,
-		const int * rowLength,
-                double *rowLower, double *rowUpper, 
-                double * minR, double * maxR, int * markR,
-                int nRows);
+  /// This just sets minima and maxima on rows (from a CglPropagator)
+  void tighten2(const double *colLower, const double * colUpper,
+                const CoinPackedMatrix & rowCopy,
+                const double *rowLower, const double *rowUpper, 
+                double * minR, double * maxR, int * markR);
   //@}
 
   // Private member data
@@ -338,6 +399,27 @@ private:
   CoinPackedMatrix * rowCopy_;
   /// Column copy (only if snapshot)
   CoinPackedMatrix * columnCopy_;
+  /** Number of generators sharing rowCopy_ and columnCopy_ (clones
+      share the snapshot matrices as they are never changed) */
+  int * matrixUsers_;
+  /** Probing row copy kept from last call - base rows (snapshot or
+      unchanged rows of solver) then rows added after them */
+  CoinPackedMatrix * probingRowCopy_;
+  /// Column copy of probingRowCopy_ (with room at end of each column)
+  CoinPackedMatrix * probingColumnCopy_;
+  /// First positive element in each row of probingRowCopy_
+  CoinBigIndex * probingRowStartPos_;
+  /** Base rows kept and columns fixed when probingRowCopy_ made
+      (each list preceded by its length) */
+  int * probingKey_;
+  /// Base rows of solver when probingRowCopy_ made (only if no snapshot)
+  CoinPackedMatrix * probingBase_;
+  /// Length of each column of probingColumnCopy_ from base rows
+  int * probingColumnLength_;
+  /** Number of generators sharing probingRowCopy_, probingColumnCopy_,
+      probingRowStartPos_, probingKey_, probingBase_ and
+      probingColumnLength_ */
+  int * probingUsers_;
   /// Lower bounds on rows
   double * rowLower_;
   /// Upper bounds on rows
@@ -348,6 +430,8 @@ private:
   double * colUpper_;
   /// Number of rows in snapshot (or when cliqueRow stuff computed)
   int numberRows_;
+  /// Number of rows in solver when snapshot made
+  int numberSolverRows_;
   /// Number of columns in problem ( must == current)
   int numberColumns_;
   /// Tolerance to see if infeasible
@@ -430,6 +514,10 @@ private:
   int * cliqueRowStart_;
   /// If not null and [i] !=0 then also tighten even if continuous
   char * tightenBounds_;
+  /// Number of threads for probing
+  int numberThreads_;
+  /// Whether results must not depend on number of threads
+  bool deterministic_;
   //@}
 };
 inline int affectedInDisaggregation(const disaggregationAction & dis)
@@ -4,6 +4,7 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include <cstdio>
+#include <vector>
 
 #ifdef NDEBUG
 #undef NDEBUG
@@ -13,6 +14,7 @@
 #include "CoinPragma.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CglProbing.hpp"
+#include "CglTreeInfo.hpp"
 
 
 //--------------------------------------------------------------------------
@@ -215,5 +217,284 @@ CglProbingUnitTest(
     delete siP;
   }
 
+  // Test implications added after conversion, pruning and violated query
+  {
+    OsiSolverInterface  * siP = baseSiP->clone();
+    std::string fn = mpsDir+"p0033";
+    siP->readMps(fn.c_str(),"mps");
+    // variable, way (+1 up), fixed variable, to lower
+    int fix[][4] = {{0,1,1,0},{1,1,2,0},{0,1,2,0},  // 0 to 1 fixes 2 anyway
+		    {3,1,4,0},{4,1,3,0},{3,1,5,0},{4,1,5,0}, // cycle
+		    {6,-1,7,1},{6,1,8,1},{8,-1,6,0},{9,1,6,0}};
+    int numberFixes = static_cast<int>(sizeof(fix)/sizeof(fix[0]));
+    // all at once
+    CglTreeProbingInfo all(siP);
+    all.initializeFixing(siP);
+    for (int i=0;i<numberFixes;i++)
+      assert (all.fixes(fix[i][0],fix[i][1],fix[i][2],fix[i][3]!=0));
+    // half then rest after conversion
+    CglTreeProbingInfo incremental(siP);
+    incremental.initializeFixing(siP);
+    for (int i=0;i<numberFixes/2;i++)
+      incremental.fixes(fix[i][0],fix[i][1],fix[i][2],fix[i][3]!=0);
+    assert (incremental.toZero()[incremental.numberIntegers()]==numberFixes/2);
+    for (int i=numberFixes/2;i<numberFixes;i++)
+      incremental.fixes(fix[i][0],fix[i][1],fix[i][2],fix[i][3]!=0);
+    assert (incremental.numberPending()==numberFixes-numberFixes/2);
+    // a duplicate is dropped when merged
+    incremental.fixes(fix[0][0],fix[0][1],fix[0][2],fix[0][3]!=0);
+    int numberIntegers = all.numberIntegers();
+    const int * toZero = all.toZero();
+    const int * toOne = all.toOne();
+    const cliqueEntry * entry = all.fixEntries();
+    assert (toZero[numberIntegers]==numberFixes);
+    assert (incremental.toZero()[numberIntegers]==numberFixes);
+    assert (!incremental.numberPending());
+    for (int i=0;i<numberIntegers;i++) {
+      assert (incremental.toZero()[i]==toZero[i]);
+      assert (incremental.toOne()[i]==toOne[i]);
+    }
+    for (int j=0;j<numberFixes;j++) 
+      assert (incremental.fixEntries()[j].fixes==entry[j].fixes);
+    // only 0 to 1 fixes 2 follows from others
+    CglTreeProbingInfo pruned(all);
+    assert (pruned.pruneImplications()==1);
+    assert (pruned.toZero()[numberIntegers]==numberFixes-1);
+    assert (!pruned.pruneImplications());
+    // violated implications against looking at every one
+    int numberColumns = siP->getNumCols();
+    double * solution = new double [numberColumns];
+    for (int i=0;i<numberColumns;i++)
+      solution[i] = (i%3) ? 0.5 : 1.0;
+    solution[9] = 0.0;
+    const double * lower = siP->getColLower();
+    const double * upper = siP->getColUpper();
+    int * variable = new int [numberFixes];
+    int * position = new int [numberFixes];
+    double * violation = new double [numberFixes];
+    int numberViolated = 
+      all.violatedImplications(solution,lower,upper,1.0e-5,
+			       variable,position,violation);
+    const int * integerVariable = all.integerVariable();
+    int n=0;
+    for (int i=0;i<numberIntegers;i++) {
+      double value1 = solution[integerVariable[i]];
+      for (int j=toZero[i];j<toZero[i+1];j++) {
+	double value2 = 
+	  solution[integerVariable[sequenceInCliqueEntry(entry[j])]];
+	bool oneFixes = oneFixesInCliqueEntry(entry[j]);
+	double thisViolation;
+	if (j<toOne[i])
+	  thisViolation = oneFixes ? 1.0-value1-value2 : value2-value1;
+	else
+	  thisViolation = oneFixes ? value1-value2 : value1+value2-1.0;
+	if (thisViolation>1.0e-5) {
+	  assert (n<numberViolated);
+	  assert (variable[n]==i&&position[n]==j);
+	  assert (eq(violation[n],thisViolation));
+	  n++;
+	}
+      }
+    }
+    assert (n==numberViolated);
+    assert (numberViolated>0);
+    delete [] solution;
+    delete [] variable;
+    delete [] position;
+    delete [] violation;
+    delete siP;
+  }
+
+  // Snapshot copies share matrices and give same cuts
+  {
+    OsiSolverInterface  * siP = baseSiP->clone();
+    std::string fn = mpsDir+"p0548";
+    siP->readMps(fn.c_str(),"mps");
+    siP->initialSolve();
+    CglTreeInfo info;
+    info.inTree=true;
+    CglProbing * original = new CglProbing();
+    original->snapshot(*siP,NULL,true);
+    OsiCuts cs;
+    original->generateCuts(*siP,cs,info);
+    // probing copies kept and shared with their column copy
+    assert (original->probingRowCopy_&&original->probingColumnCopy_);
+    const CoinPackedMatrix * kept = original->probingRowCopy_;
+    CglProbing copy(*original);
+    CglProbing assigned;
+    assigned=*original;
+    assert (copy.probingRowCopy_==kept&&assigned.probingRowCopy_==kept);
+    assert (copy.probingColumnCopy_==original->probingColumnCopy_);
+    // copies must still work after original has gone
+    delete original;
+    OsiCuts csCopy;
+    copy.generateCuts(*siP,csCopy,info);
+    // same bounds so kept copies used
+    assert (copy.probingRowCopy_==kept);
+    OsiCuts csAssigned;
+    assigned.generateCuts(*siP,csAssigned,info);
+    assert (cs.sizeRowCuts()>0);
+    assert (csCopy.sizeRowCuts()==cs.sizeRowCuts());
+    assert (csAssigned.sizeRowCuts()==cs.sizeRowCuts());
+    assert (csCopy.sizeColCuts()==cs.sizeColCuts());
+    for (int i=0;i<cs.sizeRowCuts();i++) {
+      assert (csCopy.rowCut(i)==cs.rowCut(i));
+      assert (csAssigned.rowCut(i)==cs.rowCut(i));
+    }
+    assigned.deleteSnapshot();
+    assert (!assigned.probingRowCopy_);
+    OsiCuts csAfter;
+    copy.generateCuts(*siP,csAfter,info);
+    assert (csAfter.sizeRowCuts()==cs.sizeRowCuts());
+    // fixing columns means new copies - same cuts as from scratch
+    OsiSolverInterface * siP2 = siP->clone();
+    int numberFixed=0;
+    for (int i=0;i<siP2->getNumCols()&&numberFixed<10;i++) {
+      if (siP2->isBinary(i)&&siP2->getColSolution()[i]<1.0e-6) {
+	siP2->setColUpper(i,0.0);
+	numberFixed++;
+      }
+    }
+    siP2->resolve();
+    OsiCuts csFixed;
+    copy.generateCuts(*siP2,csFixed,info);
+    assert (copy.probingRowCopy_!=kept);
+    assert (copy.probingRowCopy_->getNumElements()<kept->getNumElements());
+    CglProbing fresh;
+    fresh.snapshot(*siP,NULL,true);
+    OsiCuts csFresh;
+    fresh.generateCuts(*siP2,csFresh,info);
+    assert (csFixed.sizeRowCuts()==csFresh.sizeRowCuts());
+    assert (csFixed.sizeColCuts()==csFresh.sizeColCuts());
+    for (int i=0;i<csFresh.sizeRowCuts();i++) 
+      assert (csFixed.rowCut(i)==csFresh.rowCut(i));
+    // and back
+    OsiCuts csBack;
+    copy.generateCuts(*siP,csBack,info);
+    assert (csBack.sizeRowCuts()==cs.sizeRowCuts());
+    for (int i=0;i<cs.sizeRowCuts();i++) 
+      assert (csBack.rowCut(i)==cs.rowCut(i));
+    delete siP2;
+    delete siP;
+  }
+
+  // Rows added to solver go in after rows of kept copies
+  {
+    OsiSolverInterface  * siP = baseSiP->clone();
+    std::string fn = mpsDir+"p0548";
+    siP->readMps(fn.c_str(),"mps");
+    siP->initialSolve();
+    CglTreeInfo info;
+    info.inTree=true;
+    // with snapshot and with solver rows as base
+    for (int iMode=0;iMode<2;iMode++) {
+      OsiSolverInterface * siP2 = siP->clone();
+      int numberRows = siP2->getNumRows();
+      CglProbing probing;
+      if (!iMode)
+	probing.snapshot(*siP,NULL,true);
+      OsiCuts cs;
+      probing.generateCuts(*siP2,cs,info);
+      const CoinPackedMatrix * kept = probing.probingRowCopy_;
+      assert (kept);
+      int numberKept = kept->getNumRows();
+      assert (cs.sizeRowCuts()>0);
+      // twice - second time with different rows added
+      for (int iPass=0;iPass<2;iPass++) {
+	if (iPass) {
+	  int numberAdded = siP2->getNumRows()-numberRows;
+	  int * which = new int [numberAdded];
+	  for (int i=0;i<numberAdded;i++)
+	    which[i]=numberRows+i;
+	  siP2->deleteRows(numberAdded,which);
+	  delete [] which;
+	}
+	OsiCuts add;
+	const CoinPackedMatrix * matrix = siP->getMatrixByRow();
+	// not too many so they fit in spare room
+	for (int i=iPass;i<numberRows;i+=25) {
+	  if (siP->getRowUpper()[i]<1.0e30) {
+	    OsiRowCut rc;
+	    rc.setLb(-COIN_DBL_MAX);
+	    rc.setUb(siP->getRowUpper()[i]+iPass);
+	    rc.setRow(matrix->getVector(i));
+	    add.insert(rc);
+	  }
+	}
+	for (int i=0;i<cs.sizeRowCuts()&&i<5;i++)
+	  add.insert(cs.rowCut(i));
+	siP2->applyCuts(add);
+	int numberAdded = siP2->getNumRows()-numberRows;
+	assert (numberAdded>0);
+	OsiCuts csAdded;
+	probing.generateCuts(*siP2,csAdded,info);
+	// same copies with added rows put in
+	assert (probing.probingRowCopy_==kept);
+	assert (kept->getNumRows()==numberKept+numberAdded);
+	CglProbing fresh;
+	if (!iMode)
+	  fresh.snapshot(*siP,NULL,true);
+	OsiCuts csFresh;
+	fresh.generateCuts(*siP2,csFresh,info);
+	assert (csAdded.sizeRowCuts()==csFresh.sizeRowCuts());
+	assert (csAdded.sizeColCuts()==csFresh.sizeColCuts());
+	for (int i=0;i<csFresh.sizeRowCuts();i++)
+	  assert (csAdded.rowCut(i)==csFresh.rowCut(i));
+      }
+      delete siP2;
+    }
+    delete siP;
+  }
+
+  // Probing on threads gives same cuts and implications as serial probing
+  {
+    const char * models[] = {"p0201","p0548","lseu"};
+    for (int iModel=0;iModel<3;iModel++) {
+      OsiSolverInterface  * siP = baseSiP->clone();
+      std::string fn = mpsDir+models[iModel];
+      siP->readMps(fn.c_str(),"mps");
+      siP->initialSolve();
+      // at root first pass, root later pass and in tree
+      for (int iType=0;iType<3;iType++) {
+	// serial, deterministic on 2, 4 and 8 threads, one part per thread
+	OsiCuts cs[5];
+	std::vector<int> implications[5];
+	for (int iRun=0;iRun<5;iRun++) {
+	  CglProbing probing;
+	  if (iRun) 
+	    probing.setNumberThreads(iRun<4 ? 1<<iRun : 3);
+	  probing.setDeterministic(iRun<4);
+	  CglTreeProbingInfo info(siP);
+	  info.pass = iType ? 1 : 0;
+	  info.inTree = iType==2;
+	  probing.generateCutsAndModify(*siP,cs[iRun],&info);
+	  int numberIntegers = info.numberIntegers();
+	  if (numberIntegers) {
+	    const int * toZero = info.toZero();
+	    const int * toOne = info.toOne();
+	    const cliqueEntry * entry = info.fixEntries();
+	    implications[iRun].assign(toZero,toZero+numberIntegers+1);
+	    implications[iRun].insert(implications[iRun].end(),
+				      toOne,toOne+numberIntegers);
+	    for (int j=0;j<toZero[numberIntegers];j++)
+	      implications[iRun].push_back(entry[j].fixes);
+	  }
+	}
+	for (int iRun=1;iRun<5;iRun++) {
+	  assert (cs[iRun].sizeRowCuts()==cs[0].sizeRowCuts());
+	  assert (cs[iRun].sizeColCuts()==cs[0].sizeColCuts());
+	  for (int j=0;j<cs[0].sizeRowCuts();j++)
+	    assert (cs[iRun].rowCut(j)==cs[0].rowCut(j));
+	  for (int j=0;j<cs[0].sizeColCuts();j++)
+	    assert (cs[iRun].colCut(j)==cs[0].colCut(j));
+	  assert (implications[iRun]==implications[0]);
+	}
+	if (iModel==1&&!iType) 
+	  assert (cs[0].sizeRowCuts()>0&&cs[0].sizeColCuts()>0);
+      }
+      delete siP;
+    }
+  }
+
 }
 
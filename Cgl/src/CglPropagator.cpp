@@ -0,0 +1,529 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cmath>
+#include <cstring>
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinFinite.hpp"
+#include "CglPropagator.hpp"
+
+// Tighten lower bound of column
+bool
+CglPropagator::changeLower(int iColumn, double value)
+{
+  if (integerType_&&integerType_[iColumn])
+    value = ceil(value-1.0e-5);
+  double oldValue = colLower_[iColumn];
+  if (value<=oldValue+1.0e-12||value<=-large_)
+    return !infeasible_;
+  trailColumn_.push_back(2*iColumn);
+  trailValue_.push_back(oldValue);
+  setBound(iColumn,false,value);
+  double infeasibility = 100.0*primalTolerance_;
+  if (value>colUpper_[iColumn]+infeasibility)
+    infeasible_=true;
+  for (CoinBigIndex j=columnStart_[iColumn];j<columnStart_[iColumn+1];j++) {
+    int iRow = row_[j];
+    // activity going up so check against upper
+    double activity = minActivity_[iRow];
+    if (!infiniteMin_[iRow]&&
+	activity-1.0e-8*fabs(activity)>rowUpper_[iRow]+infeasibility)
+      infeasible_=true;
+    activity = maxActivity_[iRow];
+    if (!infiniteMax_[iRow]&&
+	activity+1.0e-8*fabs(activity)<rowLower_[iRow]-infeasibility)
+      infeasible_=true;
+    queueRow(iRow);
+  }
+  return !infeasible_;
+}
+
+// Tighten upper bound of column
+bool
+CglPropagator::changeUpper(int iColumn, double value)
+{
+  if (integerType_&&integerType_[iColumn])
+    value = floor(value+1.0e-5);
+  double oldValue = colUpper_[iColumn];
+  if (value>=oldValue-1.0e-12||value>=large_)
+    return !infeasible_;
+  trailColumn_.push_back(2*iColumn+1);
+  trailValue_.push_back(oldValue);
+  setBound(iColumn,true,value);
+  double infeasibility = 100.0*primalTolerance_;
+  if (value<colLower_[iColumn]-infeasibility)
+    infeasible_=true;
+  for (CoinBigIndex j=columnStart_[iColumn];j<columnStart_[iColumn+1];j++) {
+    int iRow = row_[j];
+    double activity = minActivity_[iRow];
+    if (!infiniteMin_[iRow]&&
+	activity-1.0e-8*fabs(activity)>rowUpper_[iRow]+infeasibility)
+      infeasible_=true;
+    activity = maxActivity_[iRow];
+    if (!infiniteMax_[iRow]&&
+	activity+1.0e-8*fabs(activity)<rowLower_[iRow]-infeasibility)
+      infeasible_=true;
+    queueRow(iRow);
+  }
+  return !infeasible_;
+}
+
+// Change a bound keeping activities (no trail or queue)
+void
+CglPropagator::setBound(int iColumn, bool upper, double value)
+{
+  double oldValue;
+  bool oldInfinite;
+  bool newInfinite;
+  if (upper) {
+    oldValue = colUpper_[iColumn];
+    oldInfinite = oldValue>=large_;
+    newInfinite = value>=large_;
+    colUpper_[iColumn]=value;
+  } else {
+    oldValue = colLower_[iColumn];
+    oldInfinite = oldValue<=-large_;
+    newInfinite = value<=-large_;
+    colLower_[iColumn]=value;
+  }
+  for (CoinBigIndex j=columnStart_[iColumn];j<columnStart_[iColumn+1];j++) {
+    int iRow = row_[j];
+    double element = columnElement_[j];
+    // upper bound of positive element (or lower of negative) is in maximum
+    bool maximum = (element>0.0)==upper;
+    double & activity = maximum ? maxActivity_[iRow] : minActivity_[iRow];
+    int & numberInfinite = maximum ? infiniteMax_[iRow] : infiniteMin_[iRow];
+    if (oldInfinite)
+      numberInfinite--;
+    else
+      activity -= element*oldValue;
+    if (newInfinite)
+      numberInfinite++;
+    else
+      activity += element*value;
+  }
+}
+
+// Puts row on queue if it might imply something
+void
+CglPropagator::queueRow(int iRow)
+{
+  if (onQueue_[iRow]||iRow==currentRow_)
+    return;
+  double lower = rowLower_[iRow];
+  double upper = rowUpper_[iRow];
+  // bounds from upper need minimum with at most one infinite
+  bool useUpper = upper<large_&&infiniteMin_[iRow]<=1;
+  bool useLower = lower>-large_&&infiniteMax_[iRow]<=1;
+  if (!useUpper&&!useLower)
+    return;
+  if (!infiniteMax_[iRow]&&!infiniteMin_[iRow]&&
+      maxActivity_[iRow]<=upper+primalTolerance_&&
+      minActivity_[iRow]>=lower-primalTolerance_)
+    return; // redundant
+  int put = queueFirst_+queueNumber_;
+  if (put>=numberRows_)
+    put -= numberRows_;
+  queue_[put]=iRow;
+  queueNumber_++;
+  onQueue_[iRow]=1;
+}
+
+// Put all rows which might imply something on queue
+void
+CglPropagator::queueAllRows()
+{
+  for (int iRow=0;iRow<numberRows_;iRow++)
+    queueRow(iRow);
+}
+
+// Recomputes activities of row from scratch
+void
+CglPropagator::computeActivity(int iRow)
+{
+  double minimum=0.0;
+  double maximum=0.0;
+  int numberInfiniteMin=0;
+  int numberInfiniteMax=0;
+  for (CoinBigIndex j=rowStart_[iRow];j<rowStart_[iRow+1];j++) {
+    int iColumn = column_[j];
+    double element = rowElement_[j];
+    double lower = colLower_[iColumn];
+    double upper = colUpper_[iColumn];
+    if (element>0.0) {
+      if (lower<=-large_)
+	numberInfiniteMin++;
+      else
+	minimum += element*lower;
+      if (upper>=large_)
+	numberInfiniteMax++;
+      else
+	maximum += element*upper;
+    } else {
+      if (upper>=large_)
+	numberInfiniteMin++;
+      else
+	minimum += element*upper;
+      if (lower<=-large_)
+	numberInfiniteMax++;
+      else
+	maximum += element*lower;
+    }
+  }
+  minActivity_[iRow]=minimum;
+  maxActivity_[iRow]=maximum;
+  infiniteMin_[iRow]=numberInfiniteMin;
+  infiniteMax_[iRow]=numberInfiniteMax;
+}
+
+/* Tightens columns in row (as CglPreProcess::tightenPrimalBounds
+   used to) - returns false if infeasible */
+bool
+CglPropagator::tightenRow(int iRow)
+{
+  computeActivity(iRow);
+  double lower = rowLower_[iRow];
+  double upper = rowUpper_[iRow];
+  double infeasibility = 100.0*primalTolerance_;
+  for (CoinBigIndex j=rowStart_[iRow];j<rowStart_[iRow+1];j++) {
+    int iColumn = column_[j];
+    double element = rowElement_[j];
+    // activities change as columns are tightened
+    int infiniteUpper = infiniteMax_[iRow];
+    int infiniteLower = infiniteMin_[iRow];
+    // Build in a margin of error
+    double maximumUp = maxActivity_[iRow];
+    maximumUp += 1.0e-8*fabs(maximumUp);
+    double maximumDown = minActivity_[iRow];
+    maximumDown -= 1.0e-8*fabs(maximumDown);
+    if ((!infiniteUpper&&maximumUp<lower-infeasibility)||
+	(!infiniteLower&&maximumDown>upper+infeasibility))
+      return false;
+    if (!infiniteUpper&&!infiniteLower&&
+	maximumUp<=upper+primalTolerance_&&
+	maximumDown>=lower-primalTolerance_)
+      return true; // redundant
+    double nowLower = colLower_[iColumn];
+    double nowUpper = colUpper_[iColumn];
+    double newBound;
+    if (element>0.0) {
+      if (lower>-large_) {
+	if (!infiniteUpper) {
+	  newBound = nowUpper + (lower-maximumUp)/element;
+	} else if (infiniteUpper==1&&nowUpper>=large_) {
+	  newBound = (lower-maximumUp)/element;
+	} else {
+	  newBound = -COIN_DBL_MAX;
+	}
+	// relax if large
+	if (fabs(maximumUp)>1.0e8)
+	  newBound -= 1.0e-12*fabs(maximumUp);
+	if (newBound>nowLower+1.0e-12&&newBound>-large_) {
+	  if (!changeLower(iColumn,newBound))
+	    return false;
+	  nowLower = colLower_[iColumn];
+	  infiniteLower = infiniteMin_[iRow];
+	  maximumDown = minActivity_[iRow];
+	  maximumDown -= 1.0e-8*fabs(maximumDown);
+	}
+      }
+      if (upper<large_) {
+	if (!infiniteLower) {
+	  newBound = nowLower + (upper-maximumDown)/element;
+	} else if (infiniteLower==1&&nowLower<=-large_) {
+	  newBound = (upper-maximumDown)/element;
+	} else {
+	  newBound = COIN_DBL_MAX;
+	}
+	if (fabs(maximumDown)>1.0e8)
+	  newBound += 1.0e-12*fabs(maximumDown);
+	if (newBound<nowUpper-1.0e-12&&newBound<large_) {
+	  if (!changeUpper(iColumn,newBound))
+	    return false;
+	}
+      }
+    } else {
+      if (lower>-large_) {
+	if (!infiniteUpper) {
+	  newBound = nowLower + (lower-maximumUp)/element;
+	} else if (infiniteUpper==1&&nowLower<=-large_) {
+	  newBound = (lower-maximumUp)/element;
+	} else {
+	  newBound = COIN_DBL_MAX;
+	}
+	if (fabs(maximumUp)>1.0e8)
+	  newBound += 1.0e-12*fabs(maximumUp);
+	if (newBound<nowUpper-1.0e-12&&newBound<large_) {
+	  if (!changeUpper(iColumn,newBound))
+	    return false;
+	  nowUpper = colUpper_[iColumn];
+	  infiniteLower = infiniteMin_[iRow];
+	  maximumDown = minActivity_[iRow];
+	  maximumDown -= 1.0e-8*fabs(maximumDown);
+	}
+      }
+      if (upper<large_) {
+	if (!infiniteLower) {
+	  newBound = nowUpper + (upper-maximumDown)/element;
+	} else if (infiniteLower==1&&nowUpper>=large_) {
+	  newBound = (upper-maximumDown)/element;
+	} else {
+	  newBound = -COIN_DBL_MAX;
+	}
+	if (fabs(maximumDown)>1.0e8)
+	  newBound -= 1.0e-12*fabs(maximumDown);
+	if (newBound>nowLower+1.0e-12&&newBound>-large_) {
+	  if (!changeLower(iColumn,newBound))
+	    return false;
+	}
+      }
+    }
+  }
+  return true;
+}
+
+//-------------------------------------------------------------------
+// Tighten bounds from rows on queue
+//-------------------------------------------------------------------
+int
+CglPropagator::propagate(int maximumRows)
+{
+  if (infeasible_)
+    return -1;
+  if (maximumRows<0)
+    maximumRows = 10*numberRows_;
+  int start = mark();
+  int numberLooked=0;
+  while (queueNumber_&&numberLooked<maximumRows) {
+    int iRow = queue_[queueFirst_];
+    queueFirst_++;
+    if (queueFirst_==numberRows_)
+      queueFirst_=0;
+    queueNumber_--;
+    onQueue_[iRow]=0;
+    numberLooked++;
+    currentRow_=iRow;
+    bool feasible = tightenRow(iRow);
+    currentRow_=-1;
+    if (!feasible||infeasible_) {
+      infeasible_=true;
+      break;
+    }
+  }
+  numberRowsLookedAt_ += numberLooked;
+  return infeasible_ ? -1 : mark()-start;
+}
+
+// Undo all bound changes since mark
+void
+CglPropagator::undo(int mark)
+{
+  for (int i=static_cast<int>(trailColumn_.size())-1;i>=mark;i--) {
+    int which = trailColumn_[i];
+    setBound(which>>1,(which&1)!=0,trailValue_[i]);
+  }
+  trailColumn_.resize(mark);
+  trailValue_.resize(mark);
+  while (queueNumber_) {
+    onQueue_[queue_[queueFirst_]]=0;
+    queueFirst_++;
+    if (queueFirst_==numberRows_)
+      queueFirst_=0;
+    queueNumber_--;
+  }
+  queueFirst_=0;
+  infeasible_=false;
+}
+
+// Minimum activity of row
+double
+CglPropagator::minimumActivity(int iRow) const
+{
+  return infiniteMin_[iRow] ? -COIN_DBL_MAX : minActivity_[iRow];
+}
+
+// Maximum activity of row
+double
+CglPropagator::maximumActivity(int iRow) const
+{
+  return infiniteMax_[iRow] ? COIN_DBL_MAX : maxActivity_[iRow];
+}
+
+//-------------------------------------------------------------------
+// Constructor from row copy and bounds
+//-------------------------------------------------------------------
+CglPropagator::CglPropagator (const CoinPackedMatrix & rowCopy,
+			      const double * rowLower,
+			      const double * rowUpper,
+			      const double * colLower,
+			      const double * colUpper,
+			      const char * integerType, double large)
+  : trailColumn_(),
+    trailValue_(),
+    large_(large),
+    primalTolerance_(1.0e-7),
+    currentRow_(-1),
+    numberRowsLookedAt_(0),
+    infeasible_(false)
+{
+  CoinPackedMatrix byRow;
+  const CoinPackedMatrix * matrix = &rowCopy;
+  if (rowCopy.isColOrdered()) {
+    byRow.reverseOrderedCopyOf(rowCopy);
+    matrix = &byRow;
+  }
+  numberRows_ = matrix->getNumRows();
+  numberColumns_ = matrix->getNumCols();
+  const int * column = matrix->getIndices();
+  const CoinBigIndex * rowStart = matrix->getVectorStarts();
+  const int * rowLength = matrix->getVectorLengths();
+  const double * element = matrix->getElements();
+  // packed row copy without zeros
+  rowStart_ = new CoinBigIndex [numberRows_+1];
+  CoinBigIndex numberElements = 0;
+  for (int iRow=0;iRow<numberRows_;iRow++) {
+    for (CoinBigIndex j=rowStart[iRow];j<rowStart[iRow]+rowLength[iRow];j++) {
+      if (element[j])
+	numberElements++;
+    }
+  }
+  column_ = new int [numberElements];
+  rowElement_ = new double [numberElements];
+  columnStart_ = new CoinBigIndex [numberColumns_+1];
+  row_ = new int [numberElements];
+  columnElement_ = new double [numberElements];
+  CoinZeroN(columnStart_,numberColumns_+1);
+  numberElements=0;
+  for (int iRow=0;iRow<numberRows_;iRow++) {
+    rowStart_[iRow]=numberElements;
+    for (CoinBigIndex j=rowStart[iRow];j<rowStart[iRow]+rowLength[iRow];j++) {
+      if (element[j]) {
+	column_[numberElements]=column[j];
+	rowElement_[numberElements++]=element[j];
+	columnStart_[column[j]+1]++;
+      }
+    }
+  }
+  rowStart_[numberRows_]=numberElements;
+  // column copy
+  for (int iColumn=0;iColumn<numberColumns_;iColumn++)
+    columnStart_[iColumn+1] += columnStart_[iColumn];
+  CoinBigIndex * put = CoinCopyOfArray(columnStart_,numberColumns_);
+  for (int iRow=0;iRow<numberRows_;iRow++) {
+    for (CoinBigIndex j=rowStart_[iRow];j<rowStart_[iRow+1];j++) {
+      CoinBigIndex k = put[column_[j]]++;
+      row_[k]=iRow;
+      columnElement_[k]=rowElement_[j];
+    }
+  }
+  delete [] put;
+  rowLower_ = CoinCopyOfArray(rowLower,numberRows_);
+  rowUpper_ = CoinCopyOfArray(rowUpper,numberRows_);
+  colLower_ = CoinCopyOfArray(colLower,numberColumns_);
+  colUpper_ = CoinCopyOfArray(colUpper,numberColumns_);
+  integerType_ = CoinCopyOfArray(integerType,numberColumns_);
+  minActivity_ = new double [numberRows_];
+  maxActivity_ = new double [numberRows_];
+  infiniteMin_ = new int [numberRows_];
+  infiniteMax_ = new int [numberRows_];
+  for (int iRow=0;iRow<numberRows_;iRow++)
+    computeActivity(iRow);
+  queue_ = new int [numberRows_];
+  onQueue_ = new char [numberRows_];
+  CoinZeroN(onQueue_,numberRows_);
+  queueFirst_=0;
+  queueNumber_=0;
+  queueAllRows();
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+CglPropagator::CglPropagator (const CglPropagator & rhs)
+{
+  gutsOfCopy(rhs);
+}
+
+//----------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+CglPropagator &
+CglPropagator::operator=(const CglPropagator & rhs)
+{
+  if (this != &rhs) {
+    gutsOfDelete();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+CglPropagator::~CglPropagator ()
+{
+  gutsOfDelete();
+}
+
+// Copies in rhs
+void
+CglPropagator::gutsOfCopy(const CglPropagator & rhs)
+{
+  numberRows_ = rhs.numberRows_;
+  numberColumns_ = rhs.numberColumns_;
+  CoinBigIndex numberElements = rhs.rowStart_[numberRows_];
+  rowStart_ = CoinCopyOfArray(rhs.rowStart_,numberRows_+1);
+  column_ = CoinCopyOfArray(rhs.column_,numberElements);
+  rowElement_ = CoinCopyOfArray(rhs.rowElement_,numberElements);
+  columnStart_ = CoinCopyOfArray(rhs.columnStart_,numberColumns_+1);
+  row_ = CoinCopyOfArray(rhs.row_,numberElements);
+  columnElement_ = CoinCopyOfArray(rhs.columnElement_,numberElements);
+  rowLower_ = CoinCopyOfArray(rhs.rowLower_,numberRows_);
+  rowUpper_ = CoinCopyOfArray(rhs.rowUpper_,numberRows_);
+  colLower_ = CoinCopyOfArray(rhs.colLower_,numberColumns_);
+  colUpper_ = CoinCopyOfArray(rhs.colUpper_,numberColumns_);
+  integerType_ = CoinCopyOfArray(rhs.integerType_,numberColumns_);
+  minActivity_ = CoinCopyOfArray(rhs.minActivity_,numberRows_);
+  maxActivity_ = CoinCopyOfArray(rhs.maxActivity_,numberRows_);
+  infiniteMin_ = CoinCopyOfArray(rhs.infiniteMin_,numberRows_);
+  infiniteMax_ = CoinCopyOfArray(rhs.infiniteMax_,numberRows_);
+  queue_ = CoinCopyOfArray(rhs.queue_,numberRows_);
+  onQueue_ = CoinCopyOfArray(rhs.onQueue_,numberRows_);
+  queueFirst_ = rhs.queueFirst_;
+  queueNumber_ = rhs.queueNumber_;
+  trailColumn_ = rhs.trailColumn_;
+  trailValue_ = rhs.trailValue_;
+  large_ = rhs.large_;
+  primalTolerance_ = rhs.primalTolerance_;
+  currentRow_ = -1;
+  numberRowsLookedAt_ = rhs.numberRowsLookedAt_;
+  infeasible_ = rhs.infeasible_;
+}
+
+// Frees arrays
+void
+CglPropagator::gutsOfDelete()
+{
+  delete [] rowStart_;
+  delete [] column_;
+  delete [] rowElement_;
+  delete [] columnStart_;
+  delete [] row_;
+  delete [] columnElement_;
+  delete [] rowLower_;
+  delete [] rowUpper_;
+  delete [] colLower_;
+  delete [] colUpper_;
+  delete [] integerType_;
+  delete [] minActivity_;
+  delete [] maxActivity_;
+  delete [] infiniteMin_;
+  delete [] infiniteMax_;
+  delete [] queue_;
+  delete [] onQueue_;
+}
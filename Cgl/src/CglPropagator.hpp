@@ -0,0 +1,212 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglPropagator_H
+#define CglPropagator_H
+
+#include <string>
+#include <vector>
+
+#include "CoinTypes.hpp"
+
+class CoinPackedMatrix;
+class OsiSolverInterface;
+
+/** Bound propagation through rows with incrementally kept activities.
+
+    For each row the finite parts of the minimum and maximum activity
+    are kept together with the number of infinite contributions to each.
+    When a column bound changes only the rows in that column are updated
+    and those which could now imply something are put on a queue.
+    propagate() then goes through the queue tightening column bounds,
+    which may queue more rows.  So work depends on what changes rather
+    than on the size of the model.
+
+    Every bound change goes on a trail so a caller probing a variable
+    can fix it, propagate, look at the bounds and then undo back to a
+    mark.  Bounds of integer variables (if types given) are rounded.
+
+    A row being worked on is recomputed from scratch so rounding errors
+    in the incremental activities do not build up.
+*/
+class CglPropagator {
+
+public:
+
+  /**@name Changing bounds */
+  //@{
+  /** Tighten lower bound of column (ignored unless tighter).
+      Returns false if column or a row is now infeasible. */
+  bool changeLower(int iColumn, double value);
+  /** Tighten upper bound of column (ignored unless tighter).
+      Returns false if column or a row is now infeasible. */
+  bool changeUpper(int iColumn, double value);
+  /// Fix column (both bounds tightened to value)
+  inline bool fix(int iColumn, double value)
+  { return changeLower(iColumn,value)&&changeUpper(iColumn,value);}
+  /** Tighten bounds from rows on queue until queue empty or
+      maximumRows rows looked at (default 10 times number of rows).
+      Returns number of bounds changed or -1 if infeasible. */
+  int propagate(int maximumRows=-1);
+  /// Put all rows which might imply something on queue
+  void queueAllRows();
+  //@}
+
+  /**@name Undoing */
+  //@{
+  /// Mark for undo (position on trail)
+  inline int mark() const
+  { return static_cast<int>(trailColumn_.size());}
+  /** Undo all bound changes since mark, empty queue and
+      clear infeasibility */
+  void undo(int mark);
+  /** Forget trail so current bounds cannot be undone
+      (keeps memory down if undo not wanted) */
+  inline void clearTrail()
+  { trailColumn_.clear();trailValue_.clear();}
+  //@}
+
+  /**@name Results */
+  //@{
+  /// Number of rows
+  inline int numberRows() const
+  { return numberRows_;}
+  /// Number of columns
+  inline int numberColumns() const
+  { return numberColumns_;}
+  /// Current column lower bounds
+  inline const double * colLower() const
+  { return colLower_;}
+  /// Current column upper bounds
+  inline const double * colUpper() const
+  { return colUpper_;}
+  /// Minimum activity of row (-COIN_DBL_MAX if unbounded)
+  double minimumActivity(int iRow) const;
+  /// Maximum activity of row (COIN_DBL_MAX if unbounded)
+  double maximumActivity(int iRow) const;
+  /// True if infeasibility found (until undo)
+  inline bool infeasible() const
+  { return infeasible_;}
+  /// Number of rows looked at by propagate (in all calls)
+  inline int numberRowsLookedAt() const
+  { return numberRowsLookedAt_;}
+  //@}
+
+  /**@name Tolerances */
+  //@{
+  /** Primal tolerance (default 1.0e-7).  Rows are redundant within
+      this and infeasibility is declared at 100 times this. */
+  inline void setPrimalTolerance(double value)
+  { primalTolerance_ = value;}
+  inline double primalTolerance() const
+  { return primalTolerance_;}
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /** Sets up from a row ordered matrix and bounds (all copied).
+      Bounds at or beyond large are treated as infinite.
+      If integerType is given integer bounds are rounded.
+      All rows start on queue. */
+  CglPropagator (const CoinPackedMatrix & rowCopy,
+		 const double * rowLower, const double * rowUpper,
+		 const double * colLower, const double * colUpper,
+		 const char * integerType=NULL, double large=1.0e20);
+  /// Copy constructor
+  CglPropagator (const CglPropagator & rhs);
+  /// Assignment operator
+  CglPropagator & operator=(const CglPropagator & rhs);
+  /// Destructor
+  ~CglPropagator ();
+  //@}
+
+private:
+
+  /**@name Private methods */
+  //@{
+  /// Change a bound keeping activities (no trail or queue)
+  void setBound(int iColumn, bool upper, double value);
+  /// Puts row on queue if it might imply something
+  void queueRow(int iRow);
+  /// Recomputes activities of row from scratch
+  void computeActivity(int iRow);
+  /// Tightens columns in row - returns false if infeasible
+  bool tightenRow(int iRow);
+  /// Copies in rhs
+  void gutsOfCopy(const CglPropagator & rhs);
+  /// Frees arrays
+  void gutsOfDelete();
+  //@}
+
+  /**@name Private member data */
+  //@{
+  /// Number of rows
+  int numberRows_;
+  /// Number of columns
+  int numberColumns_;
+  /// Row starts (numberRows_+1)
+  CoinBigIndex * rowStart_;
+  /// Column indices by row
+  int * column_;
+  /// Elements by row
+  double * rowElement_;
+  /// Column starts (numberColumns_+1)
+  CoinBigIndex * columnStart_;
+  /// Row indices by column
+  int * row_;
+  /// Elements by column
+  double * columnElement_;
+  /// Row lower bounds
+  double * rowLower_;
+  /// Row upper bounds
+  double * rowUpper_;
+  /// Column lower bounds
+  double * colLower_;
+  /// Column upper bounds
+  double * colUpper_;
+  /// Nonzero if integer (may be NULL)
+  char * integerType_;
+  /// Finite part of minimum activity
+  double * minActivity_;
+  /// Finite part of maximum activity
+  double * maxActivity_;
+  /// Number of infinite contributions to minimum activity
+  int * infiniteMin_;
+  /// Number of infinite contributions to maximum activity
+  int * infiniteMax_;
+  /// Queue of rows (circular)
+  int * queue_;
+  /// Nonzero if row on queue
+  char * onQueue_;
+  /// First on queue
+  int queueFirst_;
+  /// Number on queue
+  int queueNumber_;
+  /// Column (2*column+1 for upper) for each bound change
+  std::vector<int> trailColumn_;
+  /// Old value for each bound change
+  std::vector<double> trailValue_;
+  /// Bounds at or beyond this are infinite
+  double large_;
+  /// Primal tolerance
+  double primalTolerance_;
+  /// Row being tightened (not queued again) or -1
+  int currentRow_;
+  /// Number of rows looked at
+  int numberRowsLookedAt_;
+  /// True if infeasible
+  bool infeasible_;
+  //@}
+};
+
+//#############################################################################
+/** A function that tests the methods in the CglPropagator class. The
+    only reason for it not to be a member method is that this way it doesn't
+    have to be compiled into the library. And that's a gain, because the
+    library should be compiled with optimization on, but this method should be
+    compiled with debugging. */
+void CglPropagatorUnitTest(const OsiSolverInterface * siP,
+			   const std::string mpdDir );
+#endif
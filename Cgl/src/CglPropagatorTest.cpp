@@ -0,0 +1,122 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdio>
+#include <cmath>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CglPropagator.hpp"
+#include "CglTreeInfo.hpp"
+
+//--------------------------------------------------------------------------
+// test CglPropagator
+void
+CglPropagatorUnitTest(
+  const OsiSolverInterface * baseSiP,
+  const std::string mpsDir )
+{
+  // Propagation keeps activities right and undoes exactly
+  {
+    OsiSolverInterface  * siP = baseSiP->clone();
+    std::string fn = mpsDir+"p0033";
+    siP->readMps(fn.c_str(),"mps");
+    int numberColumns = siP->getNumCols();
+    int numberRows = siP->getNumRows();
+    const CoinPackedMatrix * matrix = siP->getMatrixByRow();
+    const int * column = matrix->getIndices();
+    const CoinBigIndex * rowStart = matrix->getVectorStarts();
+    const int * rowLength = matrix->getVectorLengths();
+    const double * element = matrix->getElements();
+    char * integerType = new char [numberColumns];
+    for (int i=0;i<numberColumns;i++)
+      integerType[i] = siP->isInteger(i) ? 1 : 0;
+    CglPropagator propagator(*matrix,siP->getRowLower(),siP->getRowUpper(),
+			     siP->getColLower(),siP->getColUpper(),
+			     integerType);
+    assert (propagator.propagate()>=0);
+    // nothing to do until something changes
+    int numberLooked = propagator.numberRowsLookedAt();
+    assert (!propagator.propagate());
+    assert (propagator.numberRowsLookedAt()==numberLooked);
+    double * saveLower = CoinCopyOfArray(propagator.colLower(),numberColumns);
+    double * saveUpper = CoinCopyOfArray(propagator.colUpper(),numberColumns);
+    int numberInfeasible=0;
+    int numberFixed=0;
+    for (int iColumn=0;iColumn<numberColumns;iColumn++) {
+      for (int way=0;way<2;way++) {
+	if (saveLower[iColumn]==saveUpper[iColumn])
+	  continue;
+	int mark = propagator.mark();
+	double value = way ? saveUpper[iColumn] : saveLower[iColumn];
+	if (!propagator.fix(iColumn,value)||propagator.propagate()<0) {
+	  numberInfeasible++;
+	} else {
+	  const double * lower = propagator.colLower();
+	  const double * upper = propagator.colUpper();
+	  for (int j=0;j<numberColumns;j++) {
+	    assert (lower[j]>=saveLower[j]&&upper[j]<=saveUpper[j]);
+	    if (j!=iColumn&&lower[j]==upper[j]&&saveLower[j]<saveUpper[j])
+	      numberFixed++;
+	  }
+	  for (int iRow=0;iRow<numberRows;iRow++) {
+	    double minimum=0.0;
+	    double maximum=0.0;
+	    for (CoinBigIndex k=rowStart[iRow];k<rowStart[iRow]+rowLength[iRow];k++) {
+	      int j = column[k];
+	      double value = element[k];
+	      minimum += value*(value>0.0 ? lower[j] : upper[j]);
+	      maximum += value*(value>0.0 ? upper[j] : lower[j]);
+	    }
+	    assert (fabs(propagator.minimumActivity(iRow)-minimum)<1.0e-7);
+	    assert (fabs(propagator.maximumActivity(iRow)-maximum)<1.0e-7);
+	  }
+	}
+	propagator.undo(mark);
+	assert (!propagator.infeasible());
+	for (int j=0;j<numberColumns;j++) 
+	  assert (propagator.colLower()[j]==saveLower[j]&&
+		  propagator.colUpper()[j]==saveUpper[j]);
+      }
+    }
+    assert (numberFixed>0);
+    // implications then rows
+    CglTreeProbingInfo info(siP);
+    info.initializeFixing(siP);
+    int iColumn=-1;
+    int jColumn=-1;
+    for (int i=0;i<numberColumns;i++) {
+      if (saveLower[i]<saveUpper[i]) {
+	if (iColumn<0)
+	  iColumn=i;
+	else if (jColumn<0)
+	  jColumn=i;
+      }
+    }
+    // iColumn at one fixes jColumn at zero
+    info.fixes(iColumn,1,jColumn,true);
+    info.toZero();
+    int mark = propagator.mark();
+    propagator.fix(iColumn,1.0);
+    int nFix = info.fixColumns(propagator);
+    // rows may have fixed it first
+    if (nFix>=0) 
+      assert (propagator.colUpper()[jColumn]==0.0);
+    propagator.undo(mark);
+    CglPropagator copy(propagator);
+    assert (copy.colUpper()[jColumn]==saveUpper[jColumn]);
+    delete [] saveLower;
+    delete [] saveUpper;
+    delete [] integerType;
+    delete siP;
+  }
+}
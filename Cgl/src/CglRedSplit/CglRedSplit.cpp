@@ -33,6 +33,7 @@
 #include "CoinFactorization.hpp"
 #include "CoinWarmStartBasis.hpp"
 #include "CglRedSplit.hpp"
+#include "CglTableauCache.hpp"
 #include "CoinFinite.hpp"
 
 //-------------------------------------------------------------------
@@ -50,34 +51,49 @@ inline double CglRedSplit::rs_above_integer(double value)
   return value-value2;
 } /* rs_above_integer */
 
+/**********************************************************/
+/* Matrices are one zeroed block, rows padded to a multiple of
+   RS_ALIGN bytes and starting on an RS_ALIGN boundary, so a row is a
+   contiguous aligned vector and rows follow each other in memory.
+   The block as allocated is kept in row pointer m. */
+#define RS_ALIGN 64
+static char *rs_allocblock(const int m, const int n, const size_t size,
+			   size_t *stride, char **block)
+{
+  *stride = ((n*size+RS_ALIGN-1)/RS_ALIGN)*RS_ALIGN;
+  *block = reinterpret_cast<char *> (calloc (m*(*stride)+RS_ALIGN, 1));
+  if (*block == NULL) {
+    printf("###ERROR: matrix allocation failed\n");
+    exit(1);
+  }
+  size_t offset = reinterpret_cast<size_t> (*block)%RS_ALIGN;
+  return (*block) + (offset ? RS_ALIGN-offset : 0);
+} /* rs_allocblock */
+
 /**********************************************************/
 void rs_allocmatINT(int ***v, const int m, const int n)
 {
   int i;
 
-  *v = reinterpret_cast<int **> (calloc (m, sizeof(int *)));
+  *v = reinterpret_cast<int **> (calloc (m+1, sizeof(int *)));
   if (*v == NULL) {
     printf("###ERROR: INTEGER matrix allocation failed\n");
     exit(1);
   }
 
+  size_t stride;
+  char *block;
+  char *first = rs_allocblock(m, n, sizeof(int), &stride, &block);
   for(i=0; i<m; i++) {
-    (*v)[i] = reinterpret_cast<int *> (calloc (n, sizeof(int)));
-    if ((*v)[i] == NULL) {
-      printf("###ERROR: INTEGER matrix allocation failed\n");
-      exit(1);
-    }
+    (*v)[i] = reinterpret_cast<int *> (first + i*stride);
   }
+  (*v)[m] = reinterpret_cast<int *> (block);
 } /* rs_allocmatINT */
 
 /**********************************************************/
 void rs_deallocmatINT(int ***v, const int m, const int /*n*/)
 {
-  int i;
-
-  for(i=0; i<m; i++) {
-    free(reinterpret_cast<void *> ((*v)[i]));
-  }
+  free(reinterpret_cast<void *> ((*v)[m]));
   free(reinterpret_cast<void *> (*v));
 } /* rs_deallocmatINT */
 
@@ -86,29 +102,25 @@ void rs_allocmatDBL(double ***v, const int m, const int n)
 {
   int i;
 
-  *v = reinterpret_cast<double **> (calloc (m, sizeof(double *)));
+  *v = reinterpret_cast<double **> (calloc (m+1, sizeof(double *)));
   if (*v == NULL) {
     printf("###ERROR: DOUBLE matrix allocation failed\n");
     exit(1);
   }
 
+  size_t stride;
+  char *block;
+  char *first = rs_allocblock(m, n, sizeof(double), &stride, &block);
   for(i=0; i<m; i++) {
-    (*v)[i] = reinterpret_cast<double *> (calloc (n, sizeof(double)));
-    if ((*v)[i] == NULL) {
-      printf("###ERROR: DOUBLE matrix allocation failed\n");
-      exit(1);
-    }
+    (*v)[i] = reinterpret_cast<double *> (first + i*stride);
   }
+  (*v)[m] = reinterpret_cast<double *> (block);
 } /* rs_allocmatDBL */
 
 /**********************************************************/
 void rs_deallocmatDBL(double ***v, const int m, const int /*n*/)
 {
-  int i;
-
-  for(i=0; i<m; i++) {
-    free(reinterpret_cast<void *> ((*v)[i]));
-  }
+  free(reinterpret_cast<void *> ((*v)[m]));
   free(reinterpret_cast<void *> (*v));
 } /* rs_deallocmatDBL */
 
@@ -220,6 +232,28 @@ double rs_dotProd(const int *u, const double *v, const int dim) {
   return(result);
 } /* rs_dotProd */
 
+/***************************************************************************/
+/* u -= step * v; rows of a matrix never overlap */
+static inline void rs_axpy(double * COIN_RESTRICT u, 
+			   const double * COIN_RESTRICT v, 
+			   const int step, const int dim) {
+
+  const double dstep = step;
+  for(int i=0; i<dim; i++) {
+    u[i] -= dstep * v[i];
+  }
+} /* rs_axpy */
+
+/***************************************************************************/
+static inline void rs_axpy(int * COIN_RESTRICT u, 
+			   const int * COIN_RESTRICT v, 
+			   const int step, const int dim) {
+
+  for(int i=0; i<dim; i++) {
+    u[i] -= step * v[i];
+  }
+} /* rs_axpy */
+
 /***************************************************************************/
 double rs_genalea (int *x0)
 {
@@ -240,20 +274,13 @@ double rs_genalea (int *x0)
 /***********************************************************************/
 void CglRedSplit::update_pi_mat(int r1, int r2, int step) {
 
-  int j;
-  for(j=0; j<mTab; j++) {
-    pi_mat[r1][j] = pi_mat[r1][j] - step * pi_mat[r2][j];
-  }
+  rs_axpy(pi_mat[r1], pi_mat[r2], step, mTab);
 } /* update_pi_mat */
 
 /***********************************************************************/
 void CglRedSplit::update_redTab(int r1, int r2, int step) {
 
-  int j;
-  for(j=0; j<nTab; j++) {
-    contNonBasicTab[r1][j] = 
-                  contNonBasicTab[r1][j] - step * contNonBasicTab[r2][j];
-  }
+  rs_axpy(contNonBasicTab[r1], contNonBasicTab[r2], step, nTab);
 } /* update_redTab */
 
 /***********************************************************************/
@@ -1162,7 +1189,7 @@ bool CglRedSplit::rs_are_different_matrices(const CoinPackedMatrix *mat1,
 
 /************************************************************************/
 void CglRedSplit::generateCuts(const OsiSolverInterface &si, OsiCuts & cs,
-			       const CglTreeInfo )
+			       const CglTreeInfo info)
 {
   solver = const_cast<OsiSolverInterface *>(&si);
   if(solver == NULL) {
@@ -1196,9 +1223,19 @@ void CglRedSplit::generateCuts(const OsiSolverInterface &si, OsiCuts & cs,
   colType = NULL;
   byRow = solver->getMatrixByRow();
 
+  // Use shared tableau rows if there are any for this basis
+  tableauCache = info.tableauCache;
+  if (tableauCache) {
+    if (tableauCache->update(*solver))
+      tableauCache->computeIntegerRows(*solver, param.getAway());
+    else
+      tableauCache = NULL;
+  }
+
   solver->enableFactorization();
   generateCuts(cs);
   solver->disableFactorization();
+  tableauCache = NULL;
 } /* generateCuts */
 
 /************************************************************************/
@@ -1416,9 +1453,6 @@ double *slack_val = new double[nrow];
   }
 #endif
 
-  double *z = new double[ncol];  // workspace to get row of the tableau
-  double *slack = new double[nrow];  // workspace to get row of the tableau
-
 #ifdef RS_TRACETAB
   printOptTab(solver);
 #endif
@@ -1434,6 +1468,9 @@ double *slack_val = new double[nrow];
 
   card_intBasicVar_frac = 0; // recompute in pivot order
 
+  // rows of the tableau used, in pivot order
+  int *tabRows = new int[mTab];
+
   for(i=0; i<nrow; i++) {
 
     if(mTab <= card_intBasicVar_frac) { 
@@ -1454,32 +1491,64 @@ double *slack_val = new double[nrow];
       intBasicVar_frac[card_intBasicVar_frac] = basis_index[ind_row];
       card_intBasicVar_frac++;
       rhsTab[card_rowTab] = xlp[basis_index[ind_row]];
-      solver->getBInvARow(ind_row, z, slack);
-      int ii;
+      tabRows[card_rowTab] = ind_row;
+      card_rowTab++;
+    }
+  }
+
+  // position of each nonbasic variable in contNonBasicTab/intNonBasicTab
+  int *contPosition = new int[ncol + nrow];
+  int *intPosition = new int[ncol + nrow];
+  CoinFillN(contPosition, ncol + nrow, -1);
+  CoinFillN(intPosition, ncol + nrow, -1);
+  for(i=0; i<card_contNonBasicVar; i++) {
+    contPosition[contNonBasicVar[i]] = i;
+  }
+  for(i=0; i<card_intNonBasicVar; i++) {
+    if(card_rowTab && intNonBasicVar[i] >= ncol) {
+      printf("### ERROR: CglRedSplit::generateCuts(): integer slack unexpected\n");
+      exit(1);
+    }
+    intPosition[intNonBasicVar[i]] = i;
+  }
+
+  // all rows at once (sparse) unless they come from cache
+  CoinPackedMatrix tableau;
+  if(!tableauCache) {
+    solver->getBInvARows(card_rowTab, tabRows, tableau);
+  }
+  for(i=0; i<card_rowTab; i++) {
+    int ii;
+    if (tableauCache) {
+      const double *tabRow = tableauCache->row(*solver, 
+					       basis_index[tabRows[i]]);
       for(ii=0; ii<card_contNonBasicVar; ii++) {
-	int locind = contNonBasicVar[ii];
-	if(locind < ncol) {
-	  contNonBasicTab[card_rowTab][ii] = z[locind];
-	}
-	else {
-	  contNonBasicTab[card_rowTab][ii] = slack[locind - ncol];
-	}
+	contNonBasicTab[i][ii] = tabRow[contNonBasicVar[ii]];
       }
-
       for(ii=0; ii<card_intNonBasicVar; ii++) {
-	int locind = intNonBasicVar[ii];
-	if(locind < ncol) {
-	  intNonBasicTab[card_rowTab][ii] = z[locind];
+	intNonBasicTab[i][ii] = tabRow[intNonBasicVar[ii]];
+      }
+    }
+    else {
+      CoinZeroN(contNonBasicTab[i], card_contNonBasicVar);
+      CoinZeroN(intNonBasicTab[i], card_intNonBasicVar);
+      const CoinShallowPackedVector tabRow = tableau.getVector(i);
+      const int *tabIndex = tabRow.getIndices();
+      const double *tabElement = tabRow.getElements();
+      for(ii=0; ii<tabRow.getNumElements(); ii++) {
+	int locind = tabIndex[ii];
+	if(contPosition[locind] >= 0) {
+	  contNonBasicTab[i][contPosition[locind]] = tabElement[ii];
 	}
-	else {
-	  printf("### ERROR: CglRedSplit::generateCuts(): integer slack unexpected\n");
-	  exit(1);
+	else if(intPosition[locind] >= 0) {
+	  intNonBasicTab[i][intPosition[locind]] = tabElement[ii];
 	}
       }
-
-      card_rowTab++;
     }
   }
+  delete[] tabRows;
+  delete[] contPosition;
+  delete[] intPosition;
 
   rs_allocmatINT(&pi_mat, mTab, mTab);
   for(i=0; i<mTab; i++) {
@@ -1581,8 +1650,6 @@ double *slack_val = new double[nrow];
   delete[] cstat;
   delete[] rstat;
   delete[] basis_index;
-  delete[] slack;
-  delete[] z;
   delete[] slack_val;
   delete[] row;
   delete[] rowind;
@@ -1790,7 +1857,8 @@ contNonBasicTab(0),
 intNonBasicTab(0),
 rhsTab(0),
 given_optsol(0),
-card_given_optsol(0)
+card_given_optsol(0),
+tableauCache(NULL)
 {}
 
 /*********************************************************************/
@@ -1816,7 +1884,8 @@ contNonBasicTab(0),
 intNonBasicTab(0),
 rhsTab(0),
 given_optsol(0),
-card_given_optsol(0)
+card_given_optsol(0),
+tableauCache(NULL)
 {
   param = RS_param;
 }
@@ -1845,7 +1914,8 @@ CglRedSplit::CglRedSplit (const CglRedSplit & source) :
   intNonBasicTab(NULL),
   rhsTab(NULL),
   given_optsol(source.given_optsol),
-  card_given_optsol(source.card_given_optsol)
+  card_given_optsol(source.card_given_optsol),
+  tableauCache(NULL)
 {}
 
 /*********************************************************************/
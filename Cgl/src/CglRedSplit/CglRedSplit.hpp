@@ -18,6 +18,8 @@
 #include "CglCutGenerator.hpp"
 #include "CglRedSplitParam.hpp"
 
+class CglTableauCache;
+
 /** Gomory Reduce-and-Split Cut Generator Class; See method generateCuts().
     Based on the paper by K. Anderson, G. Cornuejols, Yanjun Li, 
     "Reduce-and-Split Cuts: Improving the Performance of Mixed Integer 
@@ -419,6 +421,10 @@ private:
   /// Pointer on solver. Reset by each call to generateCuts().
   OsiSolverInterface *solver;
 
+  /// Pointer on shared tableau rows (may be NULL). 
+  /// Reset by each call to generateCuts().
+  CglTableauCache *tableauCache;
+
   /// Pointer on point to separate. Reset by each call to generateCuts().
   const double *xlp;
 
@@ -12,6 +12,7 @@
 
 #include <cstdlib>
 #include <cstdio>
+#include <cmath>
 
 #ifdef NDEBUG
 #undef NDEBUG
@@ -20,6 +21,7 @@
 #include <cassert>
 #include "CoinPragma.hpp"
 #include "CglRedSplit.hpp"
+#include "CglTableauCache.hpp"
 
 
 void
@@ -106,5 +108,89 @@ CglRedSplitUnitTest(const OsiSolverInterface *baseSiP,
     delete siP;
   }
 
+  // Test generateCuts with shared tableau rows
+  {
+    const char * models[] = {"p0033","p0201","p0548","lseu"};
+    for (int iModel = 0; iModel < 4; iModel++) {
+      OsiSolverInterface  *siP = baseSiP->clone();
+      siP->messageHandler()->setLogLevel(0);
+      std::string fn = mpsDir+models[iModel];
+      siP->readMps(fn.c_str(),"mps");
+      siP->initialSolve();
+
+      CglRedSplit gct;
+      OsiCuts cs;
+      gct.generateCuts(*siP, cs);
+      assert(cs.sizeRowCuts() > 0);
+
+      CglTableauCache cache(2);
+      CglTreeInfo info;
+      info.tableauCache = &cache;
+      OsiCuts csCached;
+      gct.generateCuts(*siP, csCached, info);
+      assert(csCached.sizeRowCuts() == cs.sizeRowCuts());
+      // same cuts up to rounding
+      for (int i = 0; i < cs.sizeRowCuts(); i++) {
+	const OsiRowCut & cut = cs.rowCut(i);
+	const OsiRowCut & cutCached = csCached.rowCut(i);
+	assert(cut.row().getNumElements() == cutCached.row().getNumElements());
+	assert(fabs(cut.ub() - cutCached.ub()) < 1.0e-7);
+	for (int j = 0; j < cut.row().getNumElements(); j++) {
+	  assert(cut.row().getIndices()[j] == cutCached.row().getIndices()[j]);
+	  assert(fabs(cut.row().getElements()[j] -
+		      cutCached.row().getElements()[j]) < 1.0e-7);
+	}
+      }
+      // all rows were computed up front
+      assert(cache.numberMisses() == 0);
+      assert(cache.numberHits() > 0);
+      delete siP;
+    }
+  }
+
+  // Test cuts are the same as before matrices were made contiguous
+  {
+    /* Number of cuts, a checksum of the cuts (sum of ub and of
+       (column+1)*element) and LP value after one round with default
+       parameters.  Expected values are from code with a separate
+       allocation for each row of each matrix. */
+    const char * models[] = {"p0033","p0201","p0548","lseu"};
+    const int expectedCuts[] = {5,12,16,7};
+    const double expectedSum[] = {2886.9327342606693,
+				  -90632.399999880043,
+				  19253.565121759504,
+				  -29260.627296427254};
+    const double expectedValue[] = {2590.564555423719,
+				    7124.9999949999992,
+				    571.81435587113845,
+				    977.8489186461843};
+    for (int iModel = 0; iModel < 4; iModel++) {
+      OsiSolverInterface  *siP = baseSiP->clone();
+      siP->messageHandler()->setLogLevel(0);
+      std::string fn = mpsDir+models[iModel];
+      siP->readMps(fn.c_str(),"mps");
+      siP->initialSolve();
+      CglRedSplit gct;
+      OsiCuts cs;
+      gct.generateCuts(*siP, cs);
+      assert(cs.sizeRowCuts() == expectedCuts[iModel]);
+      double sum = 0.0;
+      for (int i = 0; i < cs.sizeRowCuts(); i++) {
+	const OsiRowCut & cut = cs.rowCut(i);
+	sum += cut.ub();
+	for (int j = 0; j < cut.row().getNumElements(); j++)
+	  sum += (cut.row().getIndices()[j]+1)*cut.row().getElements()[j];
+      }
+      assert(fabs(sum-expectedSum[iModel]) <
+	     1.0e-7*CoinMax(1.0,fabs(expectedSum[iModel])));
+      siP->applyCuts(cs);
+      siP->resolve();
+      double value = siP->getObjValue();
+      assert(fabs(value-expectedValue[iModel]) <
+	     1.0e-7*fabs(expectedValue[iModel]));
+      delete siP;
+    }
+  }
+
 }
 
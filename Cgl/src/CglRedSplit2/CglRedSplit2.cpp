@@ -37,6 +37,7 @@
 #include "OsiSolverInterface.hpp"
 
 #include "CglRedSplit2.hpp"
+#include "CglTableauCache.hpp"
 #include "CoinPackedVector.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinIndexedVector.hpp"
@@ -93,57 +94,72 @@ inline double CglRedSplit2::rs_above_integer(const double value) const
   return value-value2;
 } /* rs_above_integer */
 
+/**********************************************************/
+/* Matrices are one zeroed block, rows padded to a multiple of
+   RS2_ALIGN bytes and starting on an RS2_ALIGN boundary, so a row is
+   a contiguous aligned vector and rows follow each other in memory.
+   The block as allocated is kept in row pointer m. */
+#define RS2_ALIGN 64
+static char *rs_allocblock(int m, int n, size_t size, 
+			   size_t *stride, char **block)
+{
+  *stride = ((n*size+RS2_ALIGN-1)/RS2_ALIGN)*RS2_ALIGN;
+  *block = reinterpret_cast<char *> (calloc (m*(*stride)+RS2_ALIGN, 1));
+  if (*block == NULL) {
+    printf("###ERROR: matrix allocation failed\n");
+    exit(1);
+  }
+  size_t offset = reinterpret_cast<size_t> (*block)%RS2_ALIGN;
+  return (*block) + (offset ? RS2_ALIGN-offset : 0);
+} /* rs_allocblock */
+
 /**********************************************************/
 void CglRedSplit2::rs_allocmatINT(int ***v, int m, int n)
 {
-  *v = reinterpret_cast<int **> (calloc (m, sizeof(int *)));
+  *v = reinterpret_cast<int **> (calloc (m+1, sizeof(int *)));
   if (*v == NULL) {
     printf("###ERROR: INTEGER matrix allocation failed\n");
     exit(1);
   }
 
+  size_t stride;
+  char *block;
+  char *first = rs_allocblock(m, n, sizeof(int), &stride, &block);
   for (int i = 0; i < m; ++i) {
-    (*v)[i] = reinterpret_cast<int *> (calloc (n, sizeof(int)));
-    if ((*v)[i] == NULL) {
-      printf("###ERROR: INTEGER matrix allocation failed\n");
-      exit(1);
-    }
+    (*v)[i] = reinterpret_cast<int *> (first + i*stride);
   }
+  (*v)[m] = reinterpret_cast<int *> (block);
 } /* rs_allocmatINT */
 
 /**********************************************************/
 void CglRedSplit2::rs_deallocmatINT(int ***v, int m)
 {
-  for (int i = 0; i < m; ++i) {
-    free(reinterpret_cast<void *> ((*v)[i]));
-  }
+  free(reinterpret_cast<void *> ((*v)[m]));
   free(reinterpret_cast<void *> (*v));
 } /* rs_deallocmatINT */
 
 /**********************************************************/
 void CglRedSplit2::rs_allocmatDBL(double ***v, int m, int n)
 {
-  *v = reinterpret_cast<double **> (calloc (m, sizeof(double *)));
+  *v = reinterpret_cast<double **> (calloc (m+1, sizeof(double *)));
   if (*v == NULL) {
     printf("###ERROR: DOUBLE matrix allocation failed\n");
     exit(1);
   }
 
+  size_t stride;
+  char *block;
+  char *first = rs_allocblock(m, n, sizeof(double), &stride, &block);
   for (int i = 0; i < m; ++i){
-    (*v)[i] = reinterpret_cast<double *> (calloc (n, sizeof(double)));
-    if ((*v)[i] == NULL) {
-      printf("###ERROR: DOUBLE matrix allocation failed\n");
-      exit(1);
-    }
+    (*v)[i] = reinterpret_cast<double *> (first + i*stride);
   }
+  (*v)[m] = reinterpret_cast<double *> (block);
 } /* rs_allocmatDBL */
 
 /**********************************************************/
 void CglRedSplit2::rs_deallocmatDBL(double ***v, int m)
 {
-  for (int i = 0; i < m; ++i){
-    free(reinterpret_cast<void *> ((*v)[i]));
-  }
+  free(reinterpret_cast<void *> ((*v)[m]));
   free(reinterpret_cast<void *> (*v));
 } /* rs_deallocmatDBL */
 
@@ -213,6 +229,7 @@ void CglRedSplit2::rs_printmatDBL(const char *vecstr, const double * const *x, i
 } /* rs_printmatDBL */
 
 /***************************************************************************/
+// Summed in order - reordering changes which multipliers are rounded
 double CglRedSplit2::rs_dotProd(const double *u, const double *v, int dim) const
 {
   double result = 0;
@@ -245,6 +262,47 @@ static double rs_sparseDotProd(const double *u, const double *v,
   return(result);
 } /* rs_sparseDotProd */
 
+/***************************************************************************/
+// Positions of nonbasic variables in contNonBasicVar/intNonBasicVar
+// (-1 if not there)
+static void rs_nonBasicPositions(int n, const int *contNonBasicVar, 
+				 int card_contNonBasicVar,
+				 const int *intNonBasicVar, 
+				 int card_intNonBasicVar,
+				 int *contPosition, int *intPosition)
+{
+  CoinFillN(contPosition, n, -1);
+  CoinFillN(intPosition, n, -1);
+  for (int i = 0; i < card_contNonBasicVar; ++i) {
+    contPosition[contNonBasicVar[i]] = i;
+  }
+  for (int i = 0; i < card_intNonBasicVar; ++i) {
+    intPosition[intNonBasicVar[i]] = i;
+  }
+} /* rs_nonBasicPositions */
+
+/***************************************************************************/
+// Fill rows of contNonBasicTab and intNonBasicTab from sparse tableau row
+static void rs_scatterTabRow(const CoinShallowPackedVector &tabRow,
+			     const int *contPosition, const int *intPosition,
+			     double *contRow, int card_contNonBasicVar,
+			     double *intRow, int card_intNonBasicVar)
+{
+  CoinZeroN(contRow, card_contNonBasicVar);
+  CoinZeroN(intRow, card_intNonBasicVar);
+  const int *tabIndex = tabRow.getIndices();
+  const double *tabElement = tabRow.getElements();
+  int n = tabRow.getNumElements();
+  for (int i = 0; i < n; ++i) {
+    int locind = tabIndex[i];
+    if (contPosition[locind] >= 0) {
+      contRow[contPosition[locind]] = tabElement[i];
+    } else if (intPosition[locind] >= 0) {
+      intRow[intPosition[locind]] = tabElement[i];
+    }
+  }
+} /* rs_scatterTabRow */
+
 /***************************************************************************/
 double CglRedSplit2::rs_dotProd(const int *u, const double *v, int dim) const {
   double result = 0;
@@ -1084,7 +1142,7 @@ void CglRedSplit2::reduce_workNonBasicTab(int numRowsReduction,
   if (maxRowsReduction == 1){
     return;
   }
-  int i, j, k, h;
+  int i, j, k;
 
   // Allocate space to store the matrix for the linear system
 #ifdef RS2_USE_LAPACK
@@ -1125,21 +1183,28 @@ void CglRedSplit2::reduce_workNonBasicTab(int numRowsReduction,
       }      
       // Note: the list must have size maxRowsReduction.
       // Now prepare the linear system according to the paper
+      // A is symmetric so only compute each product once
       for (i = 0; i < numUsedRows; ++i){
 	for (j = 0; j < numUsedRows; ++j){
+	  double value = 0;
+	  if (list[i] != k && list[j] != k){
+	    if (j < i) {
 #ifdef RS2_USE_LAPACK
-	  A[i*numUsedRows+j] = 0;
+	      value = A[j*numUsedRows+i];
 #else
-	  A[i][j] = 0;
+	      value = A[j][i];
 #endif
-	  if (list[i] != k && list[j] != k){
-	    for (h = 0; h < nTab; ++h){
+	    } else {
+	      value = rs_dotProd(workNonBasicTab[list[i]],
+				 workNonBasicTab[list[j]], nTab);
+	    }
+	  }
 #ifdef RS2_USE_LAPACK
-	      A[i*numUsedRows+j]+=workNonBasicTab[list[i]][h]*workNonBasicTab[list[j]][h];
+	  A[i*numUsedRows+j] = value;
 #else
-	      A[i][j]+=workNonBasicTab[list[i]][h]*workNonBasicTab[list[j]][h];
+	  A[i][j] = value;
 #endif
-	    }
+	  if (list[i] != k && list[j] != k){
 	    if (resolveWithNormalization && i == j){
 	      // Penalize the norm of lambda, i.e. the solution
 #ifdef RS2_USE_LAPACK
@@ -1159,10 +1224,8 @@ void CglRedSplit2::reduce_workNonBasicTab(int numRowsReduction,
 #endif
 	}
 	else{
-	  b[i] = 0;
-	  for (h = 0; h < nTab; ++h){
-	    b[i] -= workNonBasicTab[list[i]][h]*workNonBasicTab[k][h];
-	  }
+	  b[i] = -rs_dotProd(workNonBasicTab[list[i]], workNonBasicTab[k],
+			     nTab);
 	}
       }
       // Linear system has been written, now solve it
@@ -1615,9 +1678,19 @@ void CglRedSplit2::generateCuts(const OsiSolverInterface &si, OsiCuts & cs,
   rowActivity = solver->getRowActivity();
   byRow = solver->getMatrixByRow();
 
+  // Use shared tableau rows if there are any for this basis
+  tableauCache = info.tableauCache;
+  if (tableauCache) {
+    if (tableauCache->update(*solver))
+      tableauCache->computeIntegerRows(*solver, -1.0);
+    else
+      tableauCache = NULL;
+  }
+
   solver->enableFactorization();
   generateCuts(&cs, param.getMaxNumCuts());
   solver->disableFactorization();
+  tableauCache = NULL;
 } /* generateCuts */
 
 /************************************************************************/
@@ -1780,9 +1853,6 @@ int CglRedSplit2::generateCuts(OsiCuts* cs, int maxNumCuts, int* lambda)
     return 0; // no cuts can be generated
   }
 
-  double *z = new double[ncol];  // workspace to get row of the tableau
-  double *slack = new double[nrow];  // workspace to get row of the tableau
-
 #ifdef RS2_TRACETAB
   printOptTab(solver);
 #endif
@@ -1808,15 +1878,34 @@ int CglRedSplit2::generateCuts(OsiCuts* cs, int maxNumCuts, int* lambda)
   card_intBasicVar = 0; // recompute in pivot order
   card_intBasicVar_frac = 0;
 
+  // rows with integer basic variable - all at once (sparse) 
+  // unless they come from cache
+  int *tabRows = new int[mTab];
+  int numberTabRows = 0;
   for(i=0; i<nrow; i++) {
+    if(basis_index[i] < ncol && cv_intBasicVar[basis_index[i]] == 1) {
+      tabRows[numberTabRows++] = i;
+    }
+  }
+  int *contPosition = new int[ncol + nrow];
+  int *intPosition = new int[ncol + nrow];
+  rs_nonBasicPositions(ncol + nrow, contNonBasicVar, card_contNonBasicVar,
+		       intNonBasicVar, card_intNonBasicVar,
+		       contPosition, intPosition);
+  for(i=0; i<card_intNonBasicVar; i++) {
+    if(numberTabRows && intNonBasicVar[i] >= ncol) {
+      printf("### ERROR: CglRedSplit2::generateCuts(): integer slack unexpected\n");
+      exit(1);
+    }
+  }
+  CoinPackedMatrix tableau;
+  if (!tableauCache) {
+    solver->getBInvARows(numberTabRows, tabRows, tableau);
+  }
 
-    int ind_row = i;
+  for(i=0; i<numberTabRows; i++) {
 
-    if(basis_index[ind_row] >= ncol || 
-       cv_intBasicVar[basis_index[ind_row]] != 1) {
-      // If basic variable is not an integer variable, skip
-      continue;
-    } 
+    int ind_row = tabRows[i];
 
     origRow[card_intBasicVar] = ind_row;
 
@@ -1828,34 +1917,32 @@ int CglRedSplit2::generateCuts(OsiCuts* cs, int maxNumCuts, int* lambda)
       cv_fracRowsTab[card_intBasicVar] = 1;
     }
     // obtain row of simplex tableau
-    solver->getBInvARow(ind_row, z, slack);
+    int ii;
+    if (tableauCache) {
+      const double *tabRow = tableauCache->row(*solver, basis_index[ind_row]);
+      for(ii=0; ii<card_contNonBasicVar; ii++) {
+	contNonBasicTab[card_rowTab][ii] = tabRow[contNonBasicVar[ii]];
+      }
+      for(ii=0; ii<card_intNonBasicVar; ii++) {
+	intNonBasicTab[card_rowTab][ii] = tabRow[intNonBasicVar[ii]];
+      }
+    }
+    else {
+      rs_scatterTabRow(tableau.getVector(i), contPosition, intPosition,
+		       contNonBasicTab[card_rowTab], card_contNonBasicVar,
+		       intNonBasicTab[card_rowTab], card_intNonBasicVar);
+    }
 
     rhsTab[card_rowTab] = xlp[basis_index[ind_row]];
 
     int nonzeroes = 0;
-    int ii;
 
     for(ii=0; ii<card_contNonBasicVar; ii++) {
-      int locind = contNonBasicVar[ii];
-      if(locind < ncol) {
-	contNonBasicTab[card_rowTab][ii] = z[locind];
-      }
-      else {
-	contNonBasicTab[card_rowTab][ii] = slack[locind - ncol];
-      }
       if(fabs(contNonBasicTab[card_rowTab][ii]) > TINY)
 	nonzeroes++;
     }
 
     for(ii=0; ii<card_intNonBasicVar; ii++) {
-      int locind = intNonBasicVar[ii];
-      if(locind < ncol) {
-	intNonBasicTab[card_rowTab][ii] = z[locind];
-      }
-      else {
-	printf("### ERROR: CglRedSplit2::generateCuts(): integer slack unexpected\n");
-	exit(1);
-      }
       if(fabs(intNonBasicTab[card_rowTab][ii]) > TINY)
 	nonzeroes++;
     }
@@ -1872,6 +1959,9 @@ int CglRedSplit2::generateCuts(OsiCuts* cs, int maxNumCuts, int* lambda)
     }
 #endif
   }
+  delete[] tabRows;
+  delete[] contPosition;
+  delete[] intPosition;
 #if RS_FAST_INT == 0 && RS_FAST_CONT == 0 && RS_FAST_WORK == 0
   rs_allocmatINT(&pi_mat, mTab, mTab);
 #else
@@ -2142,8 +2232,6 @@ int CglRedSplit2::generateCuts(OsiCuts* cs, int maxNumCuts, int* lambda)
   delete[] cstat;
   delete[] rstat;
   delete[] basis_index;
-  delete[] slack;
-  delete[] z;
   delete[] effective_rhs;
   delete[] row;
   delete[] rowind;
@@ -2320,7 +2408,8 @@ CglRedSplit2::CglRedSplit2() :
   pi_mat(0),
   contNonBasicTab(0),
   intNonBasicTab(0),
-  rhsTab(0)
+  rhsTab(0),
+  tableauCache(NULL)
 {
 }
 
@@ -2349,7 +2438,8 @@ CglRedSplit2::CglRedSplit2(const CglRedSplit2Param &RS_param) :
   pi_mat(0),
   contNonBasicTab(0),
   intNonBasicTab(0),
-  rhsTab(0)
+  rhsTab(0),
+  tableauCache(NULL)
 {
   param = RS_param;
 }
@@ -2380,7 +2470,8 @@ CglRedSplit2::CglRedSplit2 (const CglRedSplit2 & source) :
   pi_mat(NULL),
   contNonBasicTab(NULL),
   intNonBasicTab(NULL),
-  rhsTab(NULL)
+  rhsTab(NULL),
+  tableauCache(NULL)
 {
 }
 
@@ -2665,9 +2756,6 @@ int CglRedSplit2::tiltLandPcut(const OsiSolverInterface* si,
     return 0; // no cuts can be generated
   }
 
-  double *z = new double[ncol];  // workspace to get row of the tableau
-  double *slack = new double[nrow];  // workspace to get row of the tableau
-
 #ifdef RS2_TRACETAB
   printOptTab(solver);
 #endif
@@ -2727,53 +2815,53 @@ int CglRedSplit2::tiltLandPcut(const OsiSolverInterface* si,
 
   card_rowTab++;
 
+  // other rows with integer basic variable - all at once (sparse)
+  int *tabRows = new int[mTab];
+  int numberTabRows = 0;
   for(i=0; i<nrow; i++) {
+    if(basis_index[i] < ncol && i != rownumber && 
+       cv_intBasicVar[basis_index[i]] == 1) {
+      tabRows[numberTabRows++] = i;
+    }
+  }
+  int *contPosition = new int[ncol + nrow];
+  int *intPosition = new int[ncol + nrow];
+  rs_nonBasicPositions(ncol + nrow, contNonBasicVar, card_contNonBasicVar,
+		       intNonBasicVar, card_intNonBasicVar,
+		       contPosition, intPosition);
+  for(i=0; i<card_intNonBasicVar; i++) {
+    if(numberTabRows && intNonBasicVar[i] >= ncol) {
+      printf("### ERROR: CglRedSplit2::generateCuts(): integer slack unexpected\n");
+      exit(1);
+    }
+  }
+  CoinPackedMatrix tableau;
+  solver->getBInvARows(numberTabRows, tabRows, tableau);
 
-    int ind_row = i;
+  for(i=0; i<numberTabRows; i++) {
 
-    if(basis_index[ind_row] >= ncol || ind_row == rownumber) {
-      continue;
-    } 
+    int ind_row = tabRows[i];
 
-    if(cv_intBasicVar[basis_index[ind_row]] == 1) { 
-      // row used in generation
-      intBasicVar[card_intBasicVar] = basis_index[ind_row];
-      if (cv_intBasicVar_frac[basis_index[ind_row]] == 1){
-	// row is fractional
-	intBasicVar_frac[card_intBasicVar_frac] = basis_index[ind_row];
-	card_intBasicVar_frac++;
-	cv_fracRowsTab[card_intBasicVar] = 1;
-      }
-      card_intBasicVar++;
-      int ii;
-
-      rhsTab[card_rowTab] = xlp[basis_index[ind_row]];
-      solver->getBInvARow(ind_row, z, slack);
-
-      for(ii=0; ii<card_contNonBasicVar; ii++) {
-	int locind = contNonBasicVar[ii];
-	if(locind < ncol) {
-	  contNonBasicTab[card_rowTab][ii] = z[locind];
-	}
-	else {
-	  contNonBasicTab[card_rowTab][ii] = slack[locind - ncol];
-	}
-      }
+    // row used in generation
+    intBasicVar[card_intBasicVar] = basis_index[ind_row];
+    if (cv_intBasicVar_frac[basis_index[ind_row]] == 1){
+      // row is fractional
+      intBasicVar_frac[card_intBasicVar_frac] = basis_index[ind_row];
+      card_intBasicVar_frac++;
+      cv_fracRowsTab[card_intBasicVar] = 1;
+    }
+    card_intBasicVar++;
 
-      for(ii=0; ii<card_intNonBasicVar; ii++) {
-	int locind = intNonBasicVar[ii];
-	if(locind < ncol) {
-	  intNonBasicTab[card_rowTab][ii] = z[locind];
-	}
-	else {
-	  printf("### ERROR: CglRedSplit2::generateCuts(): integer slack unexpected\n");
-	  exit(1);
-	}
-      }
+    rhsTab[card_rowTab] = xlp[basis_index[ind_row]];
+    rs_scatterTabRow(tableau.getVector(i), contPosition, intPosition,
+		     contNonBasicTab[card_rowTab], card_contNonBasicVar,
+		     intNonBasicTab[card_rowTab], card_intNonBasicVar);
 
-      card_rowTab++;
-    }
+    card_rowTab++;
   }
+  delete[] tabRows;
+  delete[] contPosition;
+  delete[] intPosition;
 
   int pi_mat_rows = 1;
   rs_allocmatINT(&pi_mat, pi_mat_rows, mTab);
@@ -2912,8 +3000,6 @@ int CglRedSplit2::tiltLandPcut(const OsiSolverInterface* si,
   delete[] cstat;
   delete[] rstat;
   delete[] basis_index;
-  delete[] slack;
-  delete[] z;
   delete[] effective_rhs;
   delete[] row;
   delete[] rowind;
@@ -19,6 +19,8 @@
 #include "CoinHelperFunctions.hpp"
 #include "CoinTime.hpp"
 
+class CglTableauCache;
+
 /** Reduce-and-Split Cut Generator Class; See method generateCuts().
     Based on the papers "Practical strategies for generating rank-1
     split cuts in mixed-integer linear programming" by G. Cornuejols
@@ -463,6 +465,10 @@ private:
   /// Pointer on solver. Reset by each call to generateCuts().
   OsiSolverInterface *solver;
 
+  /// Pointer on shared tableau rows (may be NULL). 
+  /// Reset by each call to generateCuts().
+  CglTableauCache *tableauCache;
+
   /// Pointer on point to separate. Reset by each call to generateCuts().
   const double *xlp;
 
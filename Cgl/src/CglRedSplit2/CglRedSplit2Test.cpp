@@ -1,5 +1,6 @@
 #include <cstdlib>
 #include <cstdio>
+#include <cmath>
 
 #ifdef NDEBUG
 #undef NDEBUG
@@ -8,6 +9,7 @@
 #include <cassert>
 #include "CoinPragma.hpp"
 #include "CglRedSplit2.hpp"
+#include "CglTableauCache.hpp"
 
 
 void
@@ -87,5 +89,97 @@ CglRedSplit2UnitTest(const OsiSolverInterface *baseSiP,
     delete siP;
   }
 
+  // Test generateCuts with shared tableau rows
+  {
+    OsiSolverInterface  *siP = baseSiP->clone();
+    std::string fn = mpsDir+"p0033";
+    std::string fn2 = mpsDir+"p0033.mps";
+    FILE *in_f = fopen(fn2.c_str(), "r");
+    if(in_f != NULL) {
+      fclose(in_f);
+      siP->readMps(fn.c_str(),"mps");
+      siP->initialSolve();
+
+      CglRedSplit2 gct;
+      gct.getParam().setMAX_SUPPORT(34);
+      OsiCuts cs;
+      gct.generateCuts(*siP, cs);
+
+      CglTableauCache cache(2);
+      CglTreeInfo info;
+      info.tableauCache = &cache;
+      OsiCuts csCached;
+      gct.generateCuts(*siP, csCached, info);
+      assert(csCached.sizeRowCuts() == cs.sizeRowCuts());
+      // same cuts up to rounding
+      for (int i = 0; i < cs.sizeRowCuts(); i++) {
+	const OsiRowCut & cut = cs.rowCut(i);
+	const OsiRowCut & cutCached = csCached.rowCut(i);
+	assert(cut.row().getNumElements() == cutCached.row().getNumElements());
+	assert(fabs(cut.ub() - cutCached.ub()) < 1.0e-7);
+	for (int j = 0; j < cut.row().getNumElements(); j++) {
+	  assert(cut.row().getIndices()[j] == cutCached.row().getIndices()[j]);
+	  assert(fabs(cut.row().getElements()[j] -
+		      cutCached.row().getElements()[j]) < 1.0e-7);
+	}
+      }
+      // all rows were computed up front
+      assert(cache.numberMisses() == 0);
+      assert(cache.numberHits() > 0);
+      int numberComputed = cache.numberComputed();
+
+      // same basis again - nothing new to compute
+      OsiCuts csAgain;
+      gct.generateCuts(*siP, csAgain, info);
+      assert(csAgain.sizeRowCuts() == cs.sizeRowCuts());
+      assert(cache.numberBases() == 1);
+      assert(cache.numberComputed() == numberComputed);
+      assert(cache.numberMisses() == 0);
+    }
+    delete siP;
+  }
+
+  // Test cuts are the same as before matrices were made contiguous
+  {
+    /* Number of cuts, a checksum of the cuts (sum of ub and of
+       (column+1)*element) and LP value after one round with default
+       parameters.  Expected values are from code with a separate
+       allocation for each row of each matrix. */
+    const char * models[] = {"p0033","p0201","lseu"};
+    const int expectedCuts[] = {13,42,39};
+    const double expectedSum[] = {597.71836956535003,
+				  -193619.09999999939,
+				  -16429.883421614319};
+    const double expectedValue[] = {2548.6510869520343,
+				    7117.4999999899637,
+				    846.84921700001371};
+    for (int iModel = 0; iModel < 3; iModel++) {
+      OsiSolverInterface  *siP = baseSiP->clone();
+      siP->messageHandler()->setLogLevel(0);
+      std::string fn = mpsDir+models[iModel];
+      siP->readMps(fn.c_str(),"mps");
+      siP->initialSolve();
+      CglRedSplit2 gct;
+      OsiCuts cs;
+      gct.generateCuts(*siP, cs);
+      assert(cs.sizeRowCuts() == expectedCuts[iModel]);
+      double sum = 0.0;
+      for (int i = 0; i < cs.sizeRowCuts(); i++) {
+	const OsiRowCut & cut = cs.rowCut(i);
+	sum += cut.ub();
+	for (int j = 0; j < cut.row().getNumElements(); j++)
+	  sum += (cut.row().getIndices()[j]+1)*cut.row().getElements()[j];
+      }
+      assert(fabs(sum-expectedSum[iModel]) <
+	     1.0e-7*CoinMax(1.0,fabs(expectedSum[iModel])));
+      siP->applyCuts(cs);
+      siP->resolve();
+      double value = siP->getObjValue();
+      assert(fabs(value-expectedValue[iModel]) <
+	     1.0e-7*fabs(expectedValue[iModel]));
+      delete siP;
+    }
+  }
+
 }
 
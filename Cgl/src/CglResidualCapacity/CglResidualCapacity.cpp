@@ -19,6 +19,7 @@
 #include "CoinPackedVector.hpp"
 
 #include "CglResidualCapacity.hpp"
+#include "CglModelStructure.hpp"
 //#define CGL_DEBUG 1
 //-----------------------------------------------------------------------------
 // Generate Mixed Integer Rounding inequality
@@ -31,6 +32,9 @@ CglResidualCapacity::generateCuts(const OsiSolverInterface& si,
 
   // If the LP or integer presolve is used, then need to redo preprocessing
   // everytime this function is called. Otherwise, just do once.
+  // Row types depend on bounds so only row copy can be shared
+  if (modelStructure_)
+    modelStructure_->update(si);
   bool preInit = false;
   bool preReso = false;
   si.getHintParam(OsiDoPresolveInInitial, preInit);
@@ -58,7 +62,8 @@ CglResidualCapacity::generateCuts(const OsiSolverInterface& si,
   const double* colLowerBound = si.getColLower();  // vector of lower bounds
 
   // get matrix by row
-  const CoinPackedMatrix & tempMatrixByRow = *si.getMatrixByRow();
+  const CoinPackedMatrix & tempMatrixByRow = modelStructure_ ?
+    *modelStructure_->rowCopy() : *si.getMatrixByRow();
   CoinPackedMatrix matrixByRow;
   matrixByRow.submatrixOf(tempMatrixByRow, numRows_, indRows_);
 
@@ -236,7 +241,9 @@ CglResidualCapacity::
 resCapPreprocess(const OsiSolverInterface& si)
 {
     // get matrix stored by row
-    const CoinPackedMatrix & matrixByRow = *si.getMatrixByRow();
+    const CoinPackedMatrix & matrixByRow = modelStructure_&&
+      modelStructure_->valid() ? *modelStructure_->rowCopy() :
+      *si.getMatrixByRow();
     numRows_ = si.getNumRows();
     numCols_ = si.getNumCols();
     const double* coefByRow  = matrixByRow.getElements();
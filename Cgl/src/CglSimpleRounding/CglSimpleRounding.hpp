@@ -52,6 +52,9 @@ public:
 
   /// Clone
   virtual CglCutGenerator * clone() const;
+  /// Can be run on a thread at same time as other generators
+  virtual bool threadSafe() const
+  { return true;}
 
   /// Assignment operator 
   CglSimpleRounding &
@@ -4,6 +4,7 @@
 
 #include <cstdlib>
 #include <cstdio>
+#include <cstring>
 #include <cmath>
 #include <cfloat>
 #include <cassert>
@@ -15,6 +16,7 @@
 #include "OsiRowCutDebugger.hpp"
 #include "CoinWarmStartBasis.hpp"
 #include "CglStored.hpp"
+#include "CglStoredFile.hpp"
 #include "CglTreeInfo.hpp"
 #include "CoinFinite.hpp"
 //-------------------------------------------------------------------
@@ -27,173 +29,218 @@ CglStored::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
   // Get basic problem information
   const double * solution = si.getColSolution();
   int numberRowCuts = cuts_.sizeRowCuts();
-  for (int i=0;i<numberRowCuts;i++) {
-    const OsiRowCut * rowCutPointer = cuts_.rowCutPtr(i);
-    double violation = rowCutPointer->violated(solution);
-    if (violation>=requiredViolation_)
-      cs.insert(*rowCutPointer);
+  if (packedScan_&&numberRowCuts) {
+    extendPacked();
+    // All activities in one pass - same summation order as violated()
+    const CoinBigIndex * start = packedStart_;
+    const int * index = packedIndex_;
+    const double * element = packedElement_;
+    double * activity = packedActivity_;
+    for (int i=0;i<numberRowCuts;i++) {
+      double sum=0.0;
+      CoinBigIndex end = start[i+1];
+      for (CoinBigIndex j=start[i];j<end;j++) 
+	sum += solution[index[j]]*element[j];
+      activity[i]=sum;
+    }
+    const double * bounds = packedBounds_;
+    for (int i=0;i<numberRowCuts;i++) {
+      double sum = activity[i];
+      double violation;
+      if (sum>bounds[2*i+1])
+	violation = sum-bounds[2*i+1];
+      else if (sum<bounds[2*i])
+	violation = bounds[2*i]-sum;
+      else
+	violation = 0.0;
+      if (violation>=requiredViolation_)
+	cs.insert(*cuts_.rowCutPtr(i));
+    }
+  } else {
+    for (int i=0;i<numberRowCuts;i++) {
+      const OsiRowCut * rowCutPointer = cuts_.rowCutPtr(i);
+      double violation = rowCutPointer->violated(solution);
+      if (violation>=requiredViolation_)
+	cs.insert(*rowCutPointer);
+    }
   }
+  if (file_)
+    file_->insertViolated(solution,si.getNumCols(),requiredViolation_,cs);
   if (probingInfo_) {
     int number01 = probingInfo_->numberIntegers();
-    const cliqueEntry * entry = probingInfo_->fixEntries();
     const int * toZero = probingInfo_->toZero();
+    if (!number01||!toZero)
+      return;
+    const cliqueEntry * entry = probingInfo_->fixEntries();
     const int * toOne = probingInfo_->toOne();
     const int * integerVariable = probingInfo_->integerVariable();
     const double * lower = si.getColLower();
     const double * upper = si.getColUpper();
+    int numberEntries = toZero[number01];
+    int * variable = new int [2*numberEntries];
+    int * position = variable+numberEntries;
+    double * violations = new double [numberEntries];
+    int numberViolated = 
+      probingInfo_->violatedImplications(solution,lower,upper,
+					 requiredViolation_,variable,
+					 position,violations);
     OsiRowCut cut;
     int column[2];
     double element[2];
-    for (int i=0;i<number01;i++) {
+    for (int k=0;k<numberViolated;k++) {
+      int i=variable[k];
+      int j=position[k];
+      double violation=violations[k];
       int iColumn=integerVariable[i];
-      if (upper[iColumn]==lower[iColumn])
-	continue;
-      double value1 = solution[iColumn];
-      for (int j=toZero[i];j<toOne[i];j++) {
-	int jColumn=sequenceInCliqueEntry(entry[j]);
-	if (jColumn<number01) {
-	  jColumn=integerVariable[jColumn];
-	  assert (jColumn>=0);
-	  double value2 = solution[jColumn];
+      int jColumn=sequenceInCliqueEntry(entry[j]);
+      bool goingToZero = j<toOne[i];
+      column[0]=iColumn;
+      element[0]=1.0;
+      if (jColumn<number01) {
+	jColumn=integerVariable[jColumn];
+	assert (jColumn>=0);
+	column[1]=jColumn;
+	if (goingToZero) {
 	  if (oneFixesInCliqueEntry(entry[j])) {
-	    double violation = 1.0-value1-value2;
-	    if (violation>requiredViolation_) {
-	      //printf("XXX can do %d + %d >=1\n",iColumn,jColumn);
-	      cut.setLb(1.0);
-	      cut.setUb(COIN_DBL_MAX);
-	      column[0]=iColumn;
-	      element[0]=1.0;
-	      column[1]=jColumn;
-	      element[1]= 1.0;
-	      cut.setEffectiveness(violation);
-	      cut.setRow(2,column,element,false);
-	      cs.insert(cut);
-	    }
+	    //printf("XXX can do %d + %d >=1\n",iColumn,jColumn);
+	    cut.setLb(1.0);
+	    cut.setUb(COIN_DBL_MAX);
+	    element[1]= 1.0;
 	  } else {
-	    double violation = value2-value1;
-	    if (violation>requiredViolation_) {
-	      //printf("XXX can do %d >= %d\n",iColumn,jColumn);
-	      cut.setLb(0.0);
-	      cut.setUb(COIN_DBL_MAX);
-	      column[0]=iColumn;
-	      element[0]=1.0;
-	      column[1]=jColumn;
-	      element[1]= -1.0;
-	      cut.setEffectiveness(violation);
-	      cut.setRow(2,column,element,false);
-	      cs.insert(cut);
-	    }
+	    //printf("XXX can do %d >= %d\n",iColumn,jColumn);
+	    cut.setLb(0.0);
+	    cut.setUb(COIN_DBL_MAX);
+	    element[1]= -1.0;
 	  }
 	} else {
-	  jColumn -= number01; // not 0-1
-	  double value2 = solution[jColumn];
-	  double lowerValue = lower[jColumn];
-	  double upperValue = upper[jColumn];
 	  if (oneFixesInCliqueEntry(entry[j])) {
-	    double violation = upperValue-value1*(upperValue-lowerValue)-value2;
-	    if (violation>requiredViolation_) {
-	      //printf("XXX can do %g*%d + %d >=%g\n",(upperValue-lowerValue),iColumn,jColumn,upperValue);
-	      cut.setLb(upperValue);
-	      cut.setUb(COIN_DBL_MAX);
-	      column[0]=iColumn;
-	      element[0]=upperValue-lowerValue;
-	      column[1]=jColumn;
-	      element[1]= 1.0;
-	      cut.setEffectiveness(violation);
-	      cut.setRow(2,column,element,false);
-	      cs.insert(cut);
-	    }
+	    //printf("XXX can do %d <= %d\n",iColumn,jColumn);
+	    cut.setLb(-COIN_DBL_MAX);
+	    cut.setUb(0.0);
+	    element[1]= -1.0;
 	  } else {
-	    double violation = value2-value1*(upperValue-lowerValue)-lowerValue;
-	    if (violation>requiredViolation_) {
-	      //printf("XXX can do %g*%d >= %d -%g\n",(upperValue-lowerValue),iColumn,jColumn,lowerValue);
-	      cut.setLb(-lowerValue);
-	      cut.setUb(COIN_DBL_MAX);
-	      column[0]=iColumn;
-	      element[0]=upperValue-lowerValue;
-	      column[1]=jColumn;
-	      element[1]= -1.0;
-	      cut.setEffectiveness(violation);
-	      cut.setRow(2,column,element,false);
-	      cs.insert(cut);
-	    }
+	    //printf("XXX can do %d + %d <=1\n",iColumn,jColumn);
+	    cut.setLb(-COIN_DBL_MAX);
+	    cut.setUb(1.0);
+	    element[1]= 1.0;
 	  }
 	}
-      }
-      for (int j=toOne[i];j<toZero[i+1];j++) {
-	int jColumn=sequenceInCliqueEntry(entry[j]);
-	if (jColumn<number01) {
-	  jColumn=integerVariable[jColumn];
-	  assert (jColumn>=0);
-	  double value2 = solution[jColumn];
+      } else {
+	jColumn -= number01; // not 0-1
+	double lowerValue = lower[jColumn];
+	double upperValue = upper[jColumn];
+	column[1]=jColumn;
+	element[0]=upperValue-lowerValue;
+	if (goingToZero) {
 	  if (oneFixesInCliqueEntry(entry[j])) {
-	    double violation = value1-value2;
-	    if (violation>requiredViolation_) {
-	      //printf("XXX can do %d <= %d\n",iColumn,jColumn);
-	      cut.setLb(-COIN_DBL_MAX);
-	      cut.setUb(0.0);
-	      column[0]=iColumn;
-	      element[0]=1.0;
-	      column[1]=jColumn;
-	      element[1]= -1.0;
-	      cut.setEffectiveness(violation);
-	      cut.setRow(2,column,element,false);
-	      cs.insert(cut);
-	    }
+	    //printf("XXX can do %g*%d + %d >=%g\n",(upperValue-lowerValue),iColumn,jColumn,upperValue);
+	    cut.setLb(upperValue);
+	    cut.setUb(COIN_DBL_MAX);
+	    element[1]= 1.0;
 	  } else {
-	    double violation = value1+value2-1.0;
-	    if (violation>requiredViolation_) {
-	      //printf("XXX can do %d + %d <=1\n",iColumn,jColumn);
-	      cut.setLb(-COIN_DBL_MAX);
-	      cut.setUb(1.0);
-	      column[0]=iColumn;
-	      element[0]=1.0;
-	      column[1]=jColumn;
-	      element[1]= 1.0;
-	      cut.setEffectiveness(violation);
-	      cut.setRow(2,column,element,false);
-	      cs.insert(cut);
-	    }
+	    //printf("XXX can do %g*%d >= %d -%g\n",(upperValue-lowerValue),iColumn,jColumn,lowerValue);
+	    cut.setLb(-lowerValue);
+	    cut.setUb(COIN_DBL_MAX);
+	    element[1]= -1.0;
 	  }
 	} else {
-	  jColumn -= number01; // not 0-1
-	  double value2 = solution[jColumn];
-	  double lowerValue = lower[jColumn];
-	  double upperValue = upper[jColumn];
 	  if (oneFixesInCliqueEntry(entry[j])) {
-	    double violation = lowerValue +(upperValue-lowerValue)*value1-value2;
-	    if (violation>requiredViolation_) {
-	      //printf("XXX can do %g*%d <= %d -%g\n",(upperValue-lowerValue),iColumn,jColumn,lowerValue);
-	      cut.setLb(-COIN_DBL_MAX);
-	      cut.setUb(-lowerValue);
-	      column[0]=iColumn;
-	      element[0]=upperValue-lowerValue;
-	      column[1]=jColumn;
-	      element[1]= -1.0;
-	      cut.setEffectiveness(violation);
-	      cut.setRow(2,column,element,false);
-	      cs.insert(cut);
-	    }
+	    //printf("XXX can do %g*%d <= %d -%g\n",(upperValue-lowerValue),iColumn,jColumn,lowerValue);
+	    cut.setLb(-COIN_DBL_MAX);
+	    cut.setUb(-lowerValue);
+	    element[1]= -1.0;
 	  } else {
-	    double violation = (upperValue-lowerValue)*value1+value2-upperValue;
-	    if (violation>requiredViolation_) {
-	      //printf("XXX can do %g*%d + %d <=%g\n",(upperValue-lowerValue),iColumn,jColumn,upperValue);
-	      cut.setLb(-COIN_DBL_MAX);
-	      cut.setUb(upperValue);
-	      column[0]=iColumn;
-	      element[0]=upperValue-lowerValue;
-	      column[1]=jColumn;
-	      element[1]= 1.0;
-	      cut.setEffectiveness(violation);
-	      cut.setRow(2,column,element,false);
-	      cs.insert(cut);
-	    }
+	    //printf("XXX can do %g*%d + %d <=%g\n",(upperValue-lowerValue),iColumn,jColumn,upperValue);
+	    cut.setLb(-COIN_DBL_MAX);
+	    cut.setUb(upperValue);
+	    element[1]= 1.0;
 	  }
 	}
       }
+      cut.setEffectiveness(violation);
+      cut.setRow(2,column,element,false);
+      cs.insert(cut);
     }
+    delete [] variable;
+    delete [] violations;
   }
 }
+// Bring packed mirror up to date with cuts_
+void 
+CglStored::extendPacked()
+{
+  int numberRowCuts = cuts_.sizeRowCuts();
+  if (numberRowCuts<numberPacked_) {
+    // cuts have gone - start again
+    numberPacked_=0;
+  }
+  if (numberRowCuts==numberPacked_)
+    return;
+  CoinBigIndex numberElements = packedStart_ ? packedStart_[numberPacked_] : 0;
+  CoinBigIndex needed = numberElements;
+  for (int i=numberPacked_;i<numberRowCuts;i++) 
+    needed += cuts_.rowCutPtr(i)->row().getNumElements();
+  if (numberRowCuts>maximumPacked_) {
+    int newMaximum = CoinMax(numberRowCuts,2*maximumPacked_+100);
+    CoinBigIndex * newStart = new CoinBigIndex [newMaximum+1];
+    double * newBounds = new double [2*newMaximum];
+    if (packedStart_) {
+      CoinMemcpyN(packedStart_,numberPacked_+1,newStart);
+      CoinMemcpyN(packedBounds_,2*numberPacked_,newBounds);
+    } else {
+      newStart[0]=0;
+    }
+    delete [] packedStart_;
+    delete [] packedBounds_;
+    delete [] packedActivity_;
+    packedStart_ = newStart;
+    packedBounds_ = newBounds;
+    packedActivity_ = new double [newMaximum];
+    maximumPacked_ = newMaximum;
+  }
+  if (needed>maximumPackedElements_) {
+    CoinBigIndex newMaximum = CoinMax(needed,2*maximumPackedElements_+1000);
+    int * newIndex = new int [newMaximum];
+    double * newElement = new double [newMaximum];
+    CoinMemcpyN(packedIndex_,numberElements,newIndex);
+    CoinMemcpyN(packedElement_,numberElements,newElement);
+    delete [] packedIndex_;
+    delete [] packedElement_;
+    packedIndex_ = newIndex;
+    packedElement_ = newElement;
+    maximumPackedElements_ = newMaximum;
+  }
+  for (int i=numberPacked_;i<numberRowCuts;i++) {
+    const OsiRowCut * cut = cuts_.rowCutPtr(i);
+    const CoinPackedVector & row = cut->row();
+    int n = row.getNumElements();
+    CoinMemcpyN(row.getIndices(),n,packedIndex_+numberElements);
+    CoinMemcpyN(row.getElements(),n,packedElement_+numberElements);
+    numberElements += n;
+    packedStart_[i+1]=numberElements;
+    packedBounds_[2*i]=cut->lb();
+    packedBounds_[2*i+1]=cut->ub();
+  }
+  numberPacked_=numberRowCuts;
+}
+// Free packed mirror
+void 
+CglStored::freePacked()
+{
+  delete [] packedStart_;
+  delete [] packedIndex_;
+  delete [] packedElement_;
+  delete [] packedBounds_;
+  delete [] packedActivity_;
+  packedStart_=NULL;
+  packedIndex_=NULL;
+  packedElement_=NULL;
+  packedBounds_=NULL;
+  packedActivity_=NULL;
+  numberPacked_=0;
+  maximumPacked_=0;
+  maximumPackedElements_=0;
+}
 // Add cuts
 void 
 CglStored::addCut(const OsiCuts & cs)
@@ -241,7 +288,17 @@ CglStored::CglStored (int numberColumns)
   probingInfo_(NULL),
   numberColumns_(numberColumns),
   bestSolution_(NULL),
-  bounds_(NULL)
+  bounds_(NULL),
+  packedScan_(true),
+  numberPacked_(0),
+  maximumPacked_(0),
+  maximumPackedElements_(0),
+  packedStart_(NULL),
+  packedIndex_(NULL),
+  packedElement_(NULL),
+  packedBounds_(NULL),
+  packedActivity_(NULL),
+  file_(NULL)
 {
 }
 
@@ -255,10 +312,22 @@ CglStored::CglStored (const CglStored & source) :
   cuts_(source.cuts_),
   numberColumns_(source.numberColumns_),
   bestSolution_(NULL),
-  bounds_(NULL)
+  bounds_(NULL),
+  packedScan_(source.packedScan_),
+  numberPacked_(0),
+  maximumPacked_(0),
+  maximumPackedElements_(0),
+  packedStart_(NULL),
+  packedIndex_(NULL),
+  packedElement_(NULL),
+  packedBounds_(NULL),
+  packedActivity_(NULL),
+  file_(NULL)
 {  
   if (source.probingInfo_)
     probingInfo_ = new CglTreeProbingInfo(*source.probingInfo_);
+  if (source.file_)
+    file_ = new CglStoredFile(*source.file_);
   if (numberColumns_) {
     bestSolution_ = CoinCopyOfArray(source.bestSolution_,numberColumns_+1);
     bounds_ = CoinCopyOfArray(source.bounds_,2*numberColumns_);
@@ -273,8 +342,26 @@ CglStored::CglStored (const char * fileName) :
   probingInfo_(NULL),
   numberColumns_(0),
   bestSolution_(NULL),
-  bounds_(NULL)
+  bounds_(NULL),
+  packedScan_(true),
+  numberPacked_(0),
+  maximumPacked_(0),
+  maximumPackedElements_(0),
+  packedStart_(NULL),
+  packedIndex_(NULL),
+  packedElement_(NULL),
+  packedBounds_(NULL),
+  packedActivity_(NULL),
+  file_(NULL)
 {  
+  if (CglStoredFile::isCutFile(fileName)) {
+    file_ = new CglStoredFile();
+    if (file_->open(fileName)) {
+      delete file_;
+      file_ = NULL;
+    }
+    return;
+  }
   FILE * fp = fopen(fileName,"rb");
   if (fp) {
 #ifndef NDEBUG
@@ -338,6 +425,8 @@ CglStored::~CglStored ()
   delete  probingInfo_;
   delete [] bestSolution_;
   delete [] bounds_;
+  freePacked();
+  delete file_;
 }
 
 //----------------------------------------------------------------
@@ -350,6 +439,11 @@ CglStored::operator=(const CglStored& rhs)
     CglCutGenerator::operator=(rhs);
     requiredViolation_=rhs.requiredViolation_;
     cuts_=rhs.cuts_;
+    packedScan_=rhs.packedScan_;
+    // mirror is rebuilt on next use
+    freePacked();
+    delete file_;
+    file_ = rhs.file_ ? new CglStoredFile(*rhs.file_) : NULL;
     delete probingInfo_;
     if (rhs.probingInfo_)
       probingInfo_ = new CglTreeProbingInfo(*rhs.probingInfo_);
@@ -367,6 +461,24 @@ CglStored::operator=(const CglStored& rhs)
   }
   return *this;
 }
+// Write all cuts to fileName as a CglStoredFile
+int 
+CglStored::writeFile(const char * fileName, bool checksum) const
+{
+  // can not overwrite file in use
+  if (file_&&!strcmp(file_->fileName(),fileName))
+    return 1;
+  CglStoredFileWriter writer;
+  if (writer.open(fileName,checksum))
+    return 1;
+  writer.addCuts(cuts_);
+  if (file_) {
+    for (int i=0;i<file_->numberCuts();i++)
+      writer.addCut(file_->lb(i),file_->ub(i),file_->length(i),
+		    file_->indices(i),file_->elements(i));
+  }
+  return writer.close();
+}
 // Save stuff
 void 
 CglStored::saveStuff(double bestObjective, const double * bestSolution,
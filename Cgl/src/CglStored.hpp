@@ -12,6 +12,7 @@
 
 class CoinWarmStartBasis;
 class CglTreeProbingInfo;
+class CglStoredFile;
 /** Stored Cut Generator Class */
 class CglStored : public CglCutGenerator {
  
@@ -47,6 +48,21 @@ public:
   { probingInfo_ = info;}
   //@}
 
+  /**@name Packed scan.
+   If on (default) stored cuts are mirrored in contiguous row-ordered
+   arrays and all activities are computed in one pass; only cuts
+   violated by enough are then copied out.  The mirror is extended
+   lazily on the next generateCuts after cuts are added.  If off each
+   cut is tested with OsiRowCut::violated. */
+  //@{
+  /// Set
+  inline void setPackedScan(bool yesNo)
+  { packedScan_=yesNo;}
+  /// Get
+  inline bool packedScan() const
+  { return packedScan_;}
+  //@}
+
   /**@name Cut stuff */
   //@{
   /// Add cuts
@@ -57,6 +73,7 @@ public:
   void addCut(double lb, double ub, const CoinPackedVector & vector);
   /// Add a row cut from elements
   void addCut(double lb, double ub, int size, const int * colIndices, const double * elements);
+  /// Number of cuts held in memory (not counting any in mapped file)
   inline int sizeRowCuts() const
   { return cuts_.sizeRowCuts();}
   const OsiRowCut * rowCutPointer(int index) const
@@ -77,6 +94,17 @@ public:
   { return bounds_+numberColumns_;} 
   //@}
 
+  /**@name Cut files */
+  //@{
+  /** Write all cuts (in memory and in any mapped file) to fileName as
+      a CglStoredFile, one at a time.  Returns 0 if OK, 1 if file can
+      not be written (or is the mapped file). */
+  int writeFile(const char * fileName, bool checksum=true) const;
+  /// Mapped cut file (NULL if none)
+  inline const CglStoredFile * file() const
+  { return file_;}
+  //@}
+
   /**@name Constructors and destructors */
   //@{
   /// Default constructor 
@@ -85,7 +113,11 @@ public:
   /// Copy constructor 
   CglStored (const CglStored & rhs);
 
-  /// Constructor from file
+  /** Constructor from file.  A CglStoredFile is mapped and left on
+      disk - its cuts are tested in place and only copied when violated.
+      Otherwise the file is read in the old format (number of elements,
+      lower and upper bound, indices, elements for each cut, ended by
+      a negative number). */
   CglStored (const char * fileName);
 
   /// Clone
@@ -104,6 +136,14 @@ protected:
   
  // Protected member methods
 
+  /**@name Protected member methods */
+  //@{
+  /// Bring packed mirror up to date with cuts_
+  void extendPacked();
+  /// Free packed mirror
+  void freePacked();
+  //@}
+
   // Protected member data
 
   /**@name Protected member data */
@@ -120,6 +160,36 @@ protected:
   double * bestSolution_;
   /// Tight bounds
   double * bounds_;
+  /// Whether to use packed mirror
+  bool packedScan_;
+  /// Number of cuts in packed mirror
+  int numberPacked_;
+  /// Room for cuts in packed mirror
+  int maximumPacked_;
+  /// Room for elements in packed mirror
+  CoinBigIndex maximumPackedElements_;
+  /// Starts of cuts in packed mirror
+  CoinBigIndex * packedStart_;
+  /// Column indices in packed mirror
+  int * packedIndex_;
+  /// Elements in packed mirror
+  double * packedElement_;
+  /// Lower and upper bounds in packed mirror (lb,ub interleaved)
+  double * packedBounds_;
+  /// Work array for activities
+  double * packedActivity_;
+  /// Mapped cut file (or NULL)
+  CglStoredFile * file_;
   //@}
 };
+
+//#############################################################################
+/** A function that tests the methods in the CglStored and CglStoredFile
+    classes. The only reason for it not to be a member method is that this
+    way it doesn't have to be compiled into the library. And that's a gain,
+    because the library should be compiled with optimization on, but this
+    method should be compiled with debugging. */
+void CglStoredUnitTest(const OsiSolverInterface * siP,
+		       const std::string mpdDir );
+
 #endif
@@ -0,0 +1,479 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstring>
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "OsiRowCut.hpp"
+#include "OsiCuts.hpp"
+#include "CglConfig.h"
+#include "CglStoredFile.hpp"
+
+/* Files are memory mapped if configure found mmap and CGL_NO_MMAP is
+   not defined, otherwise they are read into memory. */
+#if !defined(CGL_NO_MMAP) && defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+#define CGL_HAS_MMAP 1
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// Size of header
+#define CGL_CUT_FILE_HEADER 64
+// Version written
+#define CGL_CUT_FILE_VERSION 1
+
+namespace {
+  const char cutFileMagic[8] = {'C','g','l','C','u','t','s','\0'};
+  const int cutFileEndian = 0x01020304;
+  const CoinUInt64 fnvOffset = 14695981039346656037ULL;
+  const CoinUInt64 fnvPrime = 1099511628211ULL;
+  // Adds bytes to FNV-1a checksum
+  inline CoinUInt64 checksum(CoinUInt64 hash, const void * data, size_t number)
+  {
+    const unsigned char * bytes = static_cast<const unsigned char *>(data);
+    for (size_t i=0;i<number;i++) {
+      hash ^= bytes[i];
+      hash *= fnvPrime;
+    }
+    return hash;
+  }
+  // Header layout
+  struct CutFileHeader {
+    int version;
+    CoinInt64 numberCuts;
+    CoinInt64 numberElements;
+    CoinInt64 offsetsPosition;
+    CoinUInt64 checksum;
+    int flags;
+    int maximumLength;
+  };
+  void packHeader(const CutFileHeader & header, char * buffer)
+  {
+    memset(buffer,0,CGL_CUT_FILE_HEADER);
+    memcpy(buffer,cutFileMagic,8);
+    memcpy(buffer+8,&header.version,4);
+    memcpy(buffer+12,&cutFileEndian,4);
+    memcpy(buffer+16,&header.numberCuts,8);
+    memcpy(buffer+24,&header.numberElements,8);
+    memcpy(buffer+32,&header.offsetsPosition,8);
+    memcpy(buffer+40,&header.checksum,8);
+    memcpy(buffer+48,&header.flags,4);
+    memcpy(buffer+52,&header.maximumLength,4);
+  }
+  // Returns false if not a cut file of a version we can read
+  bool unpackHeader(const char * buffer, CutFileHeader & header)
+  {
+    int endian;
+    memcpy(&header.version,buffer+8,4);
+    memcpy(&endian,buffer+12,4);
+    if (memcmp(buffer,cutFileMagic,8)||endian!=cutFileEndian||
+	header.version<1||header.version>CGL_CUT_FILE_VERSION)
+      return false;
+    memcpy(&header.numberCuts,buffer+16,8);
+    memcpy(&header.numberElements,buffer+24,8);
+    memcpy(&header.offsetsPosition,buffer+32,8);
+    memcpy(&header.checksum,buffer+40,8);
+    memcpy(&header.flags,buffer+48,4);
+    memcpy(&header.maximumLength,buffer+52,4);
+    return true;
+  }
+}
+
+//-------------------------------------------------------------------
+// Open (map) file
+//-------------------------------------------------------------------
+int
+CglStoredFile::open(const char * fileName, bool verify)
+{
+  close();
+#ifdef CGL_HAS_MMAP
+  int fd = ::open(fileName,O_RDONLY);
+  if (fd<0)
+    return 1;
+  struct stat buffer;
+  if (fstat(fd,&buffer)) {
+    ::close(fd);
+    return 1;
+  }
+  size_t size = static_cast<size_t>(buffer.st_size);
+  if (size<CGL_CUT_FILE_HEADER) {
+    ::close(fd);
+    return 2;
+  }
+  void * address = mmap(NULL,size,PROT_READ,MAP_PRIVATE,fd,0);
+  ::close(fd);
+  if (address==MAP_FAILED)
+    return 1;
+  data_ = static_cast<const char *>(address);
+  mapped_ = true;
+#else
+  FILE * fp = fopen(fileName,"rb");
+  if (!fp)
+    return 1;
+  // 64 bit positions as long may only be 32 bits
+#ifdef _MSC_VER
+  _fseeki64(fp,0,SEEK_END);
+  __int64 position = _ftelli64(fp);
+  _fseeki64(fp,0,SEEK_SET);
+#else
+  fseeko(fp,0,SEEK_END);
+  off_t position = ftello(fp);
+  fseeko(fp,0,SEEK_SET);
+#endif
+  if (position<0) {
+    fclose(fp);
+    return 1;
+  }
+  size_t size = static_cast<size_t>(position);
+  if (size<CGL_CUT_FILE_HEADER) {
+    fclose(fp);
+    return 2;
+  }
+  // doubles so aligned
+  double * temp = new double [(size+7)/8];
+  size_t numberRead = fread(temp,1,size,fp);
+  fclose(fp);
+  data_ = reinterpret_cast<const char *>(temp);
+  mapped_ = false;
+  if (numberRead!=size) {
+    close();
+    return 3;
+  }
+#endif
+  size_ = size;
+  CutFileHeader header;
+  if (!unpackHeader(data_,header)) {
+    close();
+    return 2;
+  }
+  CoinInt64 tableEnd = header.offsetsPosition+
+    8*(header.numberCuts+1);
+  if (header.numberCuts<0||header.numberCuts>COIN_INT_MAX||
+      header.offsetsPosition<CGL_CUT_FILE_HEADER||
+      (header.offsetsPosition&7)!=0||
+      tableEnd>static_cast<CoinInt64>(size_)) {
+    close();
+    return 3;
+  }
+  offsets_ = reinterpret_cast<const CoinInt64 *>(data_+header.offsetsPosition);
+  numberCuts_ = static_cast<int>(header.numberCuts);
+  numberElements_ = header.numberElements;
+  if (offsets_[numberCuts_]!=header.offsetsPosition||
+      (numberCuts_&&offsets_[0]!=CGL_CUT_FILE_HEADER)) {
+    close();
+    return 3;
+  }
+  // each record must fit before next one
+  CoinInt64 numberElements=0;
+  for (int i=0;i<numberCuts_;i++) {
+    CoinInt64 start = offsets_[i];
+    CoinInt64 end = offsets_[i+1];
+    if (start<CGL_CUT_FILE_HEADER||(start&7)!=0||end<=start||
+	end>header.offsetsPosition) {
+      close();
+      return 3;
+    }
+    CoinInt64 n = length(i);
+    if (n<0||((24+12*n+7)&~static_cast<CoinInt64>(7))>end-start) {
+      close();
+      return 3;
+    }
+    numberElements += n;
+  }
+  if (numberElements!=numberElements_) {
+    close();
+    return 3;
+  }
+  if (verify&&(header.flags&1)!=0) {
+    CoinUInt64 sum = checksum(fnvOffset,data_+CGL_CUT_FILE_HEADER,
+			      static_cast<size_t>(header.offsetsPosition-
+						  CGL_CUT_FILE_HEADER));
+    if (sum!=header.checksum) {
+      close();
+      return 3;
+    }
+  }
+  fileName_ = fileName;
+  return 0;
+}
+
+// Unmap file
+void
+CglStoredFile::close()
+{
+  if (data_) {
+#ifdef CGL_HAS_MMAP
+    if (mapped_)
+      munmap(const_cast<char *>(data_),size_);
+    else
+#endif
+      delete [] reinterpret_cast<const double *>(data_);
+  }
+  data_=NULL;
+  offsets_=NULL;
+  size_=0;
+  numberElements_=0;
+  numberCuts_=0;
+  mapped_=false;
+  fileName_="";
+}
+
+// True if file starts like a cut file
+bool
+CglStoredFile::isCutFile(const char * fileName)
+{
+  FILE * fp = fopen(fileName,"rb");
+  if (!fp)
+    return false;
+  char buffer[CGL_CUT_FILE_HEADER];
+  size_t numberRead = fread(buffer,1,CGL_CUT_FILE_HEADER,fp);
+  fclose(fp);
+  CutFileHeader header;
+  return numberRead==CGL_CUT_FILE_HEADER&&unpackHeader(buffer,header);
+}
+
+//-------------------------------------------------------------------
+// Cuts
+//-------------------------------------------------------------------
+double
+CglStoredFile::violation(int i, const double * solution) const
+{
+  int n = length(i);
+  const double * element = elements(i);
+  const int * index = indices(i);
+  // same summation order as OsiRowCut::violated
+  double sum=0.0;
+  for (int j=0;j<n;j++)
+    sum += solution[index[j]]*element[j];
+  if (sum>ub(i))
+    return sum-ub(i);
+  else if (sum<lb(i))
+    return lb(i)-sum;
+  else
+    return 0.0;
+}
+
+// Makes cut i
+void
+CglStoredFile::cut(int i, OsiRowCut & rowCut) const
+{
+  rowCut.setRow(length(i),indices(i),elements(i),false);
+  rowCut.setLb(lb(i));
+  rowCut.setUb(ub(i));
+}
+
+// Inserts violated cuts into cs
+int
+CglStoredFile::insertViolated(const double * solution, int numberColumns,
+			      double requiredViolation, OsiCuts & cs) const
+{
+  int numberInserted=0;
+  for (int i=0;i<numberCuts_;i++) {
+    // file may be for another problem
+    int n = length(i);
+    const int * index = indices(i);
+    int j;
+    for (j=0;j<n;j++) {
+      if (index[j]<0||index[j]>=numberColumns)
+	break;
+    }
+    if (j<n)
+      continue;
+    if (violation(i,solution)>=requiredViolation) {
+      OsiRowCut rowCut;
+      cut(i,rowCut);
+      cs.insert(rowCut);
+      numberInserted++;
+    }
+  }
+  return numberInserted;
+}
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+CglStoredFile::CglStoredFile ()
+  : data_(NULL),
+    offsets_(NULL),
+    size_(0),
+    numberElements_(0),
+    numberCuts_(0),
+    mapped_(false)
+{
+}
+
+//-------------------------------------------------------------------
+// Copy constructor (opens same file)
+//-------------------------------------------------------------------
+CglStoredFile::CglStoredFile (const CglStoredFile & rhs)
+  : data_(NULL),
+    offsets_(NULL),
+    size_(0),
+    numberElements_(0),
+    numberCuts_(0),
+    mapped_(false)
+{
+  if (rhs.data_)
+    open(rhs.fileName_.c_str());
+}
+
+//-------------------------------------------------------------------
+// Assignment operator (opens same file)
+//-------------------------------------------------------------------
+CglStoredFile &
+CglStoredFile::operator=(const CglStoredFile & rhs)
+{
+  if (this != &rhs) {
+    std::string fileName = rhs.fileName_;
+    close();
+    if (rhs.data_)
+      open(fileName.c_str());
+  }
+  return *this;
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+CglStoredFile::~CglStoredFile ()
+{
+  close();
+}
+
+//-------------------------------------------------------------------
+// Writer
+//-------------------------------------------------------------------
+int
+CglStoredFileWriter::open(const char * fileName, bool checksum)
+{
+  close();
+  fp_ = fopen(fileName,"wb");
+  if (!fp_)
+    return 1;
+  offsets_.clear();
+  numberElements_=0;
+  checksum_=fnvOffset;
+  maximumLength_=0;
+  doChecksum_=checksum;
+  failed_=false;
+  // header written at end
+  char header[CGL_CUT_FILE_HEADER];
+  memset(header,0,CGL_CUT_FILE_HEADER);
+  if (fwrite(header,1,CGL_CUT_FILE_HEADER,fp_)!=CGL_CUT_FILE_HEADER)
+    failed_=true;
+  position_=CGL_CUT_FILE_HEADER;
+  return 0;
+}
+
+// Writes bytes (and adds to checksum)
+void
+CglStoredFileWriter::write(const void * data, size_t number)
+{
+  if (fwrite(data,1,number,fp_)!=number)
+    failed_=true;
+  if (doChecksum_)
+    checksum_ = checksum(checksum_,data,number);
+  position_ += number;
+}
+
+// Add a cut
+void
+CglStoredFileWriter::addCut(double lb, double ub, int n, const int * index,
+			    const double * element)
+{
+  assert (fp_);
+  offsets_.push_back(position_);
+  int length[2];
+  length[0]=n;
+  length[1]=0;
+  double bounds[2];
+  bounds[0]=lb;
+  bounds[1]=ub;
+  write(length,sizeof(length));
+  write(bounds,sizeof(bounds));
+  write(element,n*sizeof(double));
+  write(index,n*sizeof(int));
+  if ((n&1)!=0) {
+    int zero=0;
+    write(&zero,sizeof(int));
+  }
+  numberElements_ += n;
+  if (n>maximumLength_)
+    maximumLength_=n;
+}
+
+// Add a row cut
+void
+CglStoredFileWriter::addCut(const OsiRowCut & cut)
+{
+  const CoinPackedVector & row = cut.row();
+  addCut(cut.lb(),cut.ub(),row.getNumElements(),row.getIndices(),
+	 row.getElements());
+}
+
+// Add row cuts
+void
+CglStoredFileWriter::addCuts(const OsiCuts & cs)
+{
+  int n = cs.sizeRowCuts();
+  for (int i=0;i<n;i++)
+    addCut(*cs.rowCutPtr(i));
+}
+
+// Write offsets table and header and close file
+int
+CglStoredFileWriter::close()
+{
+  if (!fp_)
+    return 1;
+  CutFileHeader header;
+  header.version = CGL_CUT_FILE_VERSION;
+  header.numberCuts = static_cast<CoinInt64>(offsets_.size());
+  header.numberElements = numberElements_;
+  header.offsetsPosition = position_;
+  header.checksum = doChecksum_ ? checksum_ : 0;
+  header.flags = doChecksum_ ? 1 : 0;
+  header.maximumLength = maximumLength_;
+  offsets_.push_back(position_);
+  size_t number = offsets_.size();
+  if (fwrite(&offsets_[0],sizeof(CoinInt64),number,fp_)!=number)
+    failed_=true;
+  char buffer[CGL_CUT_FILE_HEADER];
+  packHeader(header,buffer);
+  if (fseek(fp_,0,SEEK_SET)||
+      fwrite(buffer,1,CGL_CUT_FILE_HEADER,fp_)!=CGL_CUT_FILE_HEADER)
+    failed_=true;
+  if (fclose(fp_))
+    failed_=true;
+  fp_=NULL;
+  offsets_.clear();
+  return failed_ ? 1 : 0;
+}
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+CglStoredFileWriter::CglStoredFileWriter ()
+  : fp_(NULL),
+    position_(0),
+    numberElements_(0),
+    checksum_(0),
+    maximumLength_(0),
+    doChecksum_(true),
+    failed_(false)
+{
+}
+
+//-------------------------------------------------------------------
+// Destructor (closes)
+//-------------------------------------------------------------------
+CglStoredFileWriter::~CglStoredFileWriter ()
+{
+  if (fp_)
+    close();
+}
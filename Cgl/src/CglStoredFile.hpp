@@ -0,0 +1,196 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglStoredFile_H
+#define CglStoredFile_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "CoinTypes.hpp"
+
+class OsiRowCut;
+class OsiCuts;
+
+/** Indexed binary file of row cuts.
+
+    Version 1 layout (native byte order, checked by header):
+
+    - header of 64 bytes - "CglCuts" and a zero byte, version (int),
+      0x01020304 (int), number of cuts, number of elements, position of
+      offsets table (all 64 bit), checksum (64 bit, zero if none), flags
+      (int, 1 if checksum), longest cut (int) and 8 bytes padding.
+    - one record per cut, each starting on an 8 byte boundary - number
+      of elements and a zero (ints), lower and upper bound, elements
+      (doubles), column indices (ints) and padding to 8 bytes.
+    - offsets table - position of each record then position of table
+      (64 bit).
+
+    The checksum is 64 bit FNV-1a over the records.
+
+    The file is mapped (if the system has mmap, otherwise read into
+    memory).  Opening checks the offsets table and reads the length of
+    every record, so costs time in proportion to the number of cuts but
+    does not touch the elements unless verifying the checksum.
+    Violations are computed straight from the records and OsiRowCut
+    objects are only made for cuts which are wanted.
+*/
+class CglStoredFile {
+
+public:
+
+  /**@name Opening */
+  //@{
+  /** Open (map) file.  Extent of every record is always checked and
+      if verify the checksum (if any) as well.
+      Returns 0 if OK, 1 if can not be opened, 2 if not a cut file
+      (could be the old format), 3 if truncated or checksum wrong. */
+  int open(const char * fileName, bool verify=false);
+  /// Unmap file
+  void close();
+  /// True if file starts like a cut file
+  static bool isCutFile(const char * fileName);
+  /// True if a file is open
+  inline bool isOpen() const
+  { return data_!=NULL;}
+  /// Name of file open
+  inline const char * fileName() const
+  { return fileName_.c_str();}
+  //@}
+
+  /**@name Cuts */
+  //@{
+  /// Number of cuts
+  inline int numberCuts() const
+  { return numberCuts_;}
+  /// Number of elements in all cuts
+  inline CoinInt64 numberElements() const
+  { return numberElements_;}
+  /// Number of elements in cut
+  inline int length(int i) const
+  { return *reinterpret_cast<const int *>(record(i));}
+  /// Lower bound of cut
+  inline double lb(int i) const
+  { return reinterpret_cast<const double *>(record(i))[1];}
+  /// Upper bound of cut
+  inline double ub(int i) const
+  { return reinterpret_cast<const double *>(record(i))[2];}
+  /// Elements of cut
+  inline const double * elements(int i) const
+  { return reinterpret_cast<const double *>(record(i))+3;}
+  /// Column indices of cut
+  inline const int * indices(int i) const
+  { return reinterpret_cast<const int *>(elements(i)+length(i));}
+  /// Violation of cut at solution (0.0 if satisfied)
+  double violation(int i, const double * solution) const;
+  /// Makes cut i
+  void cut(int i, OsiRowCut & rowCut) const;
+  /** Inserts cuts violated by at least requiredViolation into cs.
+      Cuts with a column index outside 0 to numberColumns-1 are skipped.
+      Returns number inserted. */
+  int insertViolated(const double * solution, int numberColumns,
+		     double requiredViolation, OsiCuts & cs) const;
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor
+  CglStoredFile ();
+  /// Copy constructor (opens same file)
+  CglStoredFile (const CglStoredFile & rhs);
+  /// Assignment operator (opens same file)
+  CglStoredFile & operator=(const CglStoredFile & rhs);
+  /// Destructor
+  ~CglStoredFile ();
+  //@}
+
+private:
+
+  /// Start of record for cut i
+  inline const char * record(int i) const
+  { return data_+offsets_[i];}
+
+  /**@name Private member data */
+  //@{
+  /// Name of file
+  std::string fileName_;
+  /// File contents
+  const char * data_;
+  /// Offsets table (in data_)
+  const CoinInt64 * offsets_;
+  /// Number of bytes
+  size_t size_;
+  /// Number of elements
+  CoinInt64 numberElements_;
+  /// Number of cuts
+  int numberCuts_;
+  /// True if data_ mapped (otherwise allocated)
+  bool mapped_;
+  //@}
+};
+
+/** Writes a CglStoredFile one cut at a time.
+
+    Only the offset of each cut (8 bytes) is kept in memory so large
+    pools can be written without making a copy.  close() writes the
+    offsets table and header.
+*/
+class CglStoredFileWriter {
+
+public:
+
+  /** Open file.  Returns 0 if OK, 1 if can not be opened. */
+  int open(const char * fileName, bool checksum=true);
+  /// Add a cut
+  void addCut(double lb, double ub, int n, const int * index,
+	      const double * element);
+  /// Add a row cut
+  void addCut(const OsiRowCut & cut);
+  /// Add row cuts
+  void addCuts(const OsiCuts & cs);
+  /** Write offsets table and header and close file.  Returns 0 if OK,
+      1 if a write failed (or nothing open). */
+  int close();
+  /// Number of cuts added
+  inline int numberCuts() const
+  { return static_cast<int>(offsets_.size());}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor
+  CglStoredFileWriter ();
+  /// Destructor (closes)
+  ~CglStoredFileWriter ();
+  //@}
+
+private:
+  /// Not copyable
+  CglStoredFileWriter (const CglStoredFileWriter &);
+  CglStoredFileWriter & operator=(const CglStoredFileWriter &);
+  /// Writes bytes (and adds to checksum)
+  void write(const void * data, size_t number);
+
+  /**@name Private member data */
+  //@{
+  /// File
+  FILE * fp_;
+  /// Offsets of cuts
+  std::vector<CoinInt64> offsets_;
+  /// Position in file
+  CoinInt64 position_;
+  /// Number of elements
+  CoinInt64 numberElements_;
+  /// Checksum so far
+  CoinUInt64 checksum_;
+  /// Longest cut
+  int maximumLength_;
+  /// Whether to do checksum
+  bool doChecksum_;
+  /// Whether a write failed
+  bool failed_;
+  //@}
+};
+#endif
@@ -0,0 +1,247 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CglStored.hpp"
+#include "CglStoredFile.hpp"
+
+// Writes contents to fileName
+static void
+writeContents(const char * fileName, const std::vector<char> & contents,
+	      size_t size)
+{
+  FILE * fp = fopen(fileName,"wb");
+  assert (fp);
+  assert (fwrite(&contents[0],1,size,fp)==size);
+  fclose(fp);
+}
+
+//--------------------------------------------------------------------------
+// test CglStored and CglStoredFile
+void
+CglStoredUnitTest(
+  const OsiSolverInterface * baseSiP,
+  const std::string mpsDir )
+{
+  // Test default constructor and copy & assignment
+  {
+    CglStored aGenerator;
+    CglStored rhs;
+    {
+      CglStored bGenerator;
+      CglStored cGenerator(bGenerator);
+      rhs=bGenerator;
+    }
+  }
+
+  // Packed scan inserts same cuts as testing each cut
+  {
+    const char * models[] = {"p0033","p0201","p0548"};
+    for (int iModel=0;iModel<3;iModel++) {
+      OsiSolverInterface  * siP = baseSiP->clone();
+      std::string fn = mpsDir+models[iModel];
+      siP->readMps(fn.c_str(),"mps");
+      siP->initialSolve();
+      int numberColumns = siP->getNumCols();
+      const double * solution = siP->getColSolution();
+      CglStored packed;
+      CglStored each;
+      each.setPackedScan(false);
+      assert (packed.packedScan()&&!each.packedScan());
+      int index[10];
+      double element[10];
+      int nCuts=0;
+      // cuts added in batches so packed copy is extended between scans
+      for (int iBatch=0;iBatch<3;iBatch++) {
+	for (int i=0;i<100;i++,nCuts++) {
+	  int n = 1+(nCuts%10);
+	  double sum=0.0;
+	  for (int j=0;j<n;j++) {
+	    index[j]=(11*nCuts+17*j)%numberColumns;
+	    element[j]=((nCuts+j)%4)-1.5;
+	    sum += element[j]*solution[index[j]];
+	  }
+	  double rhs = sum+0.01*((nCuts%7)-3);
+	  if (nCuts%2) {
+	    packed.addCut(-COIN_DBL_MAX,rhs,n,index,element);
+	    each.addCut(-COIN_DBL_MAX,rhs,n,index,element);
+	  } else {
+	    packed.addCut(rhs,COIN_DBL_MAX,n,index,element);
+	    each.addCut(rhs,COIN_DBL_MAX,n,index,element);
+	  }
+	}
+	for (int iPass=0;iPass<2;iPass++) {
+	  packed.setRequiredViolation(iPass ? 0.02 : 1.0e-5);
+	  each.setRequiredViolation(iPass ? 0.02 : 1.0e-5);
+	  OsiCuts cuts;
+	  packed.generateCuts(*siP,cuts);
+	  OsiCuts cuts2;
+	  each.generateCuts(*siP,cuts2);
+	  int nRowCuts = cuts.sizeRowCuts();
+	  assert (nRowCuts>0&&nRowCuts<nCuts);
+	  assert (cuts2.sizeRowCuts()==nRowCuts);
+	  for (int i=0;i<nRowCuts;i++)
+	    assert (cuts.rowCut(i)==cuts2.rowCut(i));
+	}
+      }
+      delete siP;
+    }
+  }
+
+  // Stored cuts in mapped file
+  {
+    OsiSolverInterface  * siP = baseSiP->clone();
+    std::string fn = mpsDir+"p0033";
+    siP->readMps(fn.c_str(),"mps");
+    siP->initialSolve();
+    int numberColumns = siP->getNumCols();
+    const double * solution = siP->getColSolution();
+    // cuts through columns at random - some violated some not
+    CglStored stored;
+    int index[5];
+    double element[5];
+    int nCuts=200;
+    for (int i=0;i<nCuts;i++) {
+      int n = 1+(i%5);
+      double sum=0.0;
+      for (int j=0;j<n;j++) {
+	index[j]=(7*i+13*j)%numberColumns;
+	element[j]=1.0+((i+j)%3);
+	sum += element[j]*solution[index[j]];
+      }
+      if (i%2)
+	stored.addCut(-COIN_DBL_MAX,floor(sum-0.5*(i%3)),n,index,element);
+      else
+	stored.addCut(ceil(sum+0.5*(i%3)),COIN_DBL_MAX,n,index,element);
+    }
+    const char * fileName = "CglStored.cuts";
+    assert (!stored.writeFile(fileName));
+    assert (CglStoredFile::isCutFile(fileName));
+    CglStoredFile file;
+    assert (!file.open(fileName,true));
+    assert (file.numberCuts()==nCuts);
+    for (int i=0;i<nCuts;i++) {
+      const OsiRowCut * cut = stored.rowCutPointer(i);
+      const CoinPackedVector & row = cut->row();
+      int n = row.getNumElements();
+      assert (file.length(i)==n);
+      assert (file.lb(i)==cut->lb()&&file.ub(i)==cut->ub());
+      assert (!memcmp(file.indices(i),row.getIndices(),n*sizeof(int)));
+      assert (!memcmp(file.elements(i),row.getElements(),n*sizeof(double)));
+      assert (file.violation(i,solution)==cut->violated(solution));
+    }
+    // same cuts from file
+    CglStored fromFile(fileName);
+    assert (!fromFile.sizeRowCuts());
+    assert (fromFile.file()->numberCuts()==nCuts);
+    OsiCuts cuts;
+    stored.generateCuts(*siP,cuts);
+    OsiCuts cuts2;
+    CglStored copy(fromFile);
+    copy.generateCuts(*siP,cuts2);
+    int nRowCuts = cuts.sizeRowCuts();
+    assert (nRowCuts>0&&nRowCuts<nCuts);
+    assert (cuts2.sizeRowCuts()==nRowCuts);
+    for (int i=0;i<nRowCuts;i++)
+      assert (cuts.rowCut(i)==cuts2.rowCut(i));
+    // cuts on columns not in problem are not inserted
+    int smaller = numberColumns/2;
+    int nExpected=0;
+    for (int i=0;i<nCuts;i++) {
+      const OsiRowCut * cut = stored.rowCutPointer(i);
+      const CoinPackedVector & row = cut->row();
+      bool inProblem=true;
+      for (int j=0;j<row.getNumElements();j++) {
+	if (row.getIndices()[j]>=smaller)
+	  inProblem=false;
+      }
+      if (inProblem&&cut->violated(solution)>=1.0e-5)
+	nExpected++;
+    }
+    OsiCuts cuts3;
+    assert (file.insertViolated(solution,smaller,1.0e-5,cuts3)==nExpected);
+    assert (nExpected<nRowCuts);
+    for (int i=0;i<cuts3.sizeRowCuts();i++) {
+      const CoinPackedVector & row = cuts3.rowCut(i).row();
+      for (int j=0;j<row.getNumElements();j++)
+	assert (row.getIndices()[j]<smaller);
+    }
+    // can not overwrite file in use
+    assert (fromFile.writeFile(fileName));
+    file.close();
+    // damaged files
+    FILE * fp = fopen(fileName,"rb");
+    assert (fp);
+    fseek(fp,0,SEEK_END);
+    size_t size = static_cast<size_t>(ftell(fp));
+    fseek(fp,0,SEEK_SET);
+    std::vector<char> contents(size);
+    assert (fread(&contents[0],1,size,fp)==size);
+    fclose(fp);
+    CoinInt64 offsetsPosition;
+    memcpy(&offsetsPosition,&contents[32],8);
+    std::vector<CoinInt64> offsets(nCuts+1);
+    memcpy(&offsets[0],&contents[offsetsPosition],(nCuts+1)*8);
+    CglStoredFile damaged;
+    // an element changed - only checksum can find it
+    {
+      std::vector<char> bad(contents);
+      bad[offsets[0]+24] ^= 1;
+      writeContents(fileName,bad,size);
+      assert (damaged.open(fileName,true)==3);
+    }
+    // record longer than space before next record
+    {
+      std::vector<char> bad(contents);
+      int length = 1000;
+      memcpy(&bad[offsets[1]],&length,4);
+      writeContents(fileName,bad,size);
+      assert (damaged.open(fileName)==3);
+      assert (damaged.open(fileName,true)==3);
+      length = -1;
+      memcpy(&bad[offsets[1]],&length,4);
+      writeContents(fileName,bad,size);
+      assert (damaged.open(fileName)==3);
+    }
+    // offsets out of order or outside records
+    {
+      std::vector<char> bad(contents);
+      memcpy(&bad[offsetsPosition+8],&offsets[2],8);
+      memcpy(&bad[offsetsPosition+16],&offsets[1],8);
+      writeContents(fileName,bad,size);
+      assert (damaged.open(fileName)==3);
+      CoinInt64 outside = offsetsPosition+8;
+      bad = contents;
+      memcpy(&bad[offsetsPosition+8*(nCuts-1)],&outside,8);
+      writeContents(fileName,bad,size);
+      assert (damaged.open(fileName)==3);
+      CoinInt64 header = 16;
+      bad = contents;
+      memcpy(&bad[offsetsPosition+8],&header,8);
+      writeContents(fileName,bad,size);
+      assert (damaged.open(fileName)==3);
+    }
+    // truncated
+    writeContents(fileName,contents,size-8);
+    assert (damaged.open(fileName)==3);
+    // and good again
+    writeContents(fileName,contents,size);
+    assert (!damaged.open(fileName,true));
+    damaged.close();
+    remove(fileName);
+    delete siP;
+  }
+}
@@ -0,0 +1,299 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CglTableauCache.hpp"
+#include "CglThread.hpp"
+
+namespace {
+  // What one call of computeRows passes to the tasks
+  typedef struct {
+    const OsiSolverInterface * solver;
+    OsiSolverInterface ** clone;
+    int numberTasks;
+    int number;
+    const int * variables;
+    double ** rows;
+    int numberColumns;
+    int numberRows;
+  } CglTableauData;
+
+  /* Each task does a contiguous block of variables.  Task 0 uses the
+     given solver, others a clone made before any task started, so each
+     has its own factorization. */
+  void computeBlock(int task, int , void * voidData)
+  {
+    CglTableauData * data = reinterpret_cast<CglTableauData *>(voidData);
+    int numberColumns = data->numberColumns;
+    int numberRows = data->numberRows;
+    int first = (data->number*task)/data->numberTasks;
+    int last = (data->number*(task+1))/data->numberTasks;
+    const OsiSolverInterface * solver = task ? data->clone[task] :
+      data->solver;
+    solver->enableFactorization();
+    // basis position of each variable
+    int * basics = new int [numberRows];
+    int * position = new int [numberColumns+numberRows];
+    solver->getBasics(basics);
+    for (int i=0;i<numberRows;i++)
+      position[basics[i]]=i;
+    for (int i=first;i<last;i++) {
+      int iVariable = data->variables[i];
+      double * row = data->rows[iVariable];
+      solver->getBInvARow(position[iVariable],row,row+numberColumns);
+    }
+    solver->disableFactorization();
+    delete [] basics;
+    delete [] position;
+  }
+}
+
+//-------------------------------------------------------------------
+// Point cache at current basis
+//-------------------------------------------------------------------
+bool
+CglTableauCache::update(const OsiSolverInterface & si)
+{
+  if (!si.canDoSimplexInterface()||!si.optimalBasisIsAvailable())
+    return false;
+  int numberColumns = si.getNumCols();
+  int numberRows = si.getNumRows();
+  int numberElements = si.getNumElements();
+  int numberTotal = numberColumns+numberRows;
+  int * status = new int [numberTotal];
+  si.getBasisStatus(status,status+numberColumns);
+  // only which variables are basic matters
+  bool same = (status_&&numberColumns==numberColumns_&&
+	       numberRows==numberRows_&&numberElements==numberElements_);
+  if (same) {
+    for (int i=0;i<numberTotal;i++) {
+      if ((status[i]==1)!=(status_[i]==1)) {
+	same=false;
+	break;
+      }
+    }
+  }
+  if (!same) {
+    gutsOfDelete();
+    numberColumns_ = numberColumns;
+    numberRows_ = numberRows;
+    numberElements_ = numberElements;
+    status_ = status;
+    rows_ = new double * [numberTotal];
+    memset(rows_,0,numberTotal*sizeof(double *));
+    numberBases_++;
+  } else {
+    delete [] status;
+  }
+  return true;
+}
+
+//-------------------------------------------------------------------
+// Row in which variable is basic
+//-------------------------------------------------------------------
+const double *
+CglTableauCache::row(const OsiSolverInterface & si, int variable)
+{
+  assert (status_);
+  if (status_[variable]!=1)
+    return NULL;
+  if (rows_[variable]) {
+    numberHits_++;
+  } else {
+    numberMisses_++;
+    int * basics = new int [numberRows_];
+    si.getBasics(basics);
+    int iRow;
+    for (iRow=0;iRow<numberRows_;iRow++) {
+      if (basics[iRow]==variable)
+	break;
+    }
+    delete [] basics;
+    assert (iRow<numberRows_);
+    double * row = new double [numberColumns_+numberRows_];
+    si.getBInvARow(iRow,row,row+numberColumns_);
+    rows_[variable]=row;
+  }
+  return rows_[variable];
+}
+
+//-------------------------------------------------------------------
+// Compute rows for a set of basic variables
+//-------------------------------------------------------------------
+void
+CglTableauCache::computeRows(const OsiSolverInterface & si, int number,
+			     const int * variables)
+{
+  assert (status_);
+  int numberTotal = numberColumns_+numberRows_;
+  int * which = new int [number];
+  int numberWanted=0;
+  for (int i=0;i<number;i++) {
+    int iVariable = variables[i];
+    if (status_[iVariable]==1&&!rows_[iVariable]) {
+      // allocate here so tasks do not touch rows_
+      rows_[iVariable] = new double [numberTotal];
+      which[numberWanted++]=iVariable;
+    }
+  }
+  if (numberWanted) {
+    // each extra thread costs a clone and a factorization
+    int numberTasks = CoinMax(1,CoinMin(numberThreads_,numberWanted/16));
+    OsiSolverInterface ** clone = new OsiSolverInterface * [numberTasks];
+    clone[0] = NULL;
+    for (int i=1;i<numberTasks;i++)
+      clone[i] = si.clone();
+    CglTableauData data;
+    data.solver = &si;
+    data.clone = clone;
+    data.numberTasks = numberTasks;
+    data.number = numberWanted;
+    data.variables = which;
+    data.rows = rows_;
+    data.numberColumns = numberColumns_;
+    data.numberRows = numberRows_;
+    CglRunTasks(numberTasks,numberTasks,computeBlock,&data);
+    for (int i=1;i<numberTasks;i++)
+      delete clone[i];
+    delete [] clone;
+    numberComputed_ += numberWanted;
+  }
+  delete [] which;
+}
+
+// Compute rows for fractional basic integers
+void
+CglTableauCache::computeIntegerRows(const OsiSolverInterface & si,
+				    double away)
+{
+  assert (status_);
+  const double * solution = si.getColSolution();
+  int * which = new int [numberColumns_];
+  int number=0;
+  for (int i=0;i<numberColumns_;i++) {
+    if (status_[i]==1&&si.isInteger(i)) {
+      double value = solution[i];
+      double fraction = value-floor(value);
+      if (CoinMin(fraction,1.0-fraction)>away)
+	which[number++]=i;
+    }
+  }
+  computeRows(si,number,which);
+  delete [] which;
+}
+
+//-------------------------------------------------------------------
+// Discard all rows
+//-------------------------------------------------------------------
+void
+CglTableauCache::clear()
+{
+  if (rows_) {
+    int numberTotal = numberColumns_+numberRows_;
+    for (int i=0;i<numberTotal;i++) {
+      delete [] rows_[i];
+      rows_[i]=NULL;
+    }
+  }
+}
+
+// Zero statistics
+void
+CglTableauCache::resetCounters()
+{
+  numberHits_=0;
+  numberMisses_=0;
+  numberComputed_=0;
+  numberBases_=0;
+}
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+CglTableauCache::CglTableauCache (int numberThreads)
+:
+  numberColumns_(0),
+  numberRows_(0),
+  numberElements_(0),
+  status_(NULL),
+  rows_(NULL),
+  numberThreads_(numberThreads),
+  numberHits_(0),
+  numberMisses_(0),
+  numberComputed_(0),
+  numberBases_(0)
+{
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+CglTableauCache::CglTableauCache (const CglTableauCache & rhs)
+:
+  status_(NULL),
+  rows_(NULL)
+{
+  gutsOfCopy(rhs);
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+CglTableauCache::~CglTableauCache ()
+{
+  gutsOfDelete();
+}
+
+//----------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+CglTableauCache &
+CglTableauCache::operator=(const CglTableauCache& rhs)
+{
+  if (this != &rhs) {
+    gutsOfDelete();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+
+// Free everything
+void
+CglTableauCache::gutsOfDelete()
+{
+  clear();
+  delete [] rows_;
+  delete [] status_;
+  rows_ = NULL;
+  status_ = NULL;
+}
+
+// Copy everything
+void
+CglTableauCache::gutsOfCopy(const CglTableauCache & rhs)
+{
+  numberColumns_ = rhs.numberColumns_;
+  numberRows_ = rhs.numberRows_;
+  numberElements_ = rhs.numberElements_;
+  numberThreads_ = rhs.numberThreads_;
+  numberHits_ = rhs.numberHits_;
+  numberMisses_ = rhs.numberMisses_;
+  numberComputed_ = rhs.numberComputed_;
+  numberBases_ = rhs.numberBases_;
+  if (rhs.status_) {
+    int numberTotal = numberColumns_+numberRows_;
+    status_ = CoinCopyOfArray(rhs.status_,numberTotal);
+    rows_ = new double * [numberTotal];
+    for (int i=0;i<numberTotal;i++)
+      rows_[i] = CoinCopyOfArray(rhs.rows_[i],numberTotal);
+  }
+}
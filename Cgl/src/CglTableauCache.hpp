@@ -0,0 +1,147 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglTableauCache_H
+#define CglTableauCache_H
+
+class OsiSolverInterface;
+
+/** Rows of the simplex tableau for one basis, shared between generators.
+
+    Tableau based generators (GMI, reduce and split, lift and project)
+    all ask the solver for rows of B^-1 [A I] at the same optimal basis.
+    If a CglTableauCache is passed in CglTreeInfo::tableauCache they
+    get the rows from here so each row is only computed once per basis.
+
+    Rows are stored by the variable which is basic in them (slacks
+    numbered from numberColumns) as basis positions may change each
+    time a solver factorizes.  Each row is dense with numberColumns
+    structural entries followed by numberRows slack entries, exactly
+    as given by OsiSolverInterface::getBInvARow.
+
+    update() must be called with the solver before rows are used; it
+    empties the cache if the basis or the dimensions have changed.
+    If the matrix is changed in place without changing the basis or
+    dimensions call clear().  The cache itself is not thread safe but
+    computeRows() may use several threads, each with its own clone of
+    the solver.
+*/
+class CglTableauCache {
+
+public:
+
+  /**@name Use */
+  //@{
+  /** Point cache at current basis of si.  If basis is not the one rows
+      were computed for then all rows are discarded.
+      Returns false if si can not give tableau rows (in which case the
+      cache must not be used). */
+  bool update(const OsiSolverInterface & si);
+  /** Row in which variable is basic.  If not there it is computed which
+      needs factorization to be enabled in si.  Returns NULL if variable
+      is not basic. */
+  const double * row(const OsiSolverInterface & si, int variable);
+  /** Make sure rows for a set of basic variables are there, computing
+      missing ones with up to numberThreads() threads.  Factorization must
+      not be enabled in si.  Variables which are not basic are ignored.
+      Does not count as hits or misses. */
+  void computeRows(const OsiSolverInterface & si, int number,
+		   const int * variables);
+  /** computeRows for all basic integer variables whose value is more
+      than away from an integer (all basic integers if away is negative) */
+  void computeIntegerRows(const OsiSolverInterface & si, double away);
+  /// Whether row for variable is there
+  inline bool haveRow(int variable) const
+  { return rows_ && rows_[variable] != NULL;}
+  /// Whether variable is basic in current basis
+  inline bool isBasic(int variable) const
+  { return status_[variable] == 1;}
+  /// Discard all rows
+  void clear();
+  //@}
+
+  /**@name Statistics */
+  //@{
+  /// Number of calls to row() which found row
+  inline int numberHits() const
+  { return numberHits_;}
+  /// Number of calls to row() which had to compute row
+  inline int numberMisses() const
+  { return numberMisses_;}
+  /// Number of rows computed by computeRows()
+  inline int numberComputed() const
+  { return numberComputed_;}
+  /// Number of times update() found a new basis
+  inline int numberBases() const
+  { return numberBases_;}
+  /// Zero statistics
+  void resetCounters();
+  //@}
+
+  /**@name Sizes and threads */
+  //@{
+  /// Number of columns in basis
+  inline int numberColumns() const
+  { return numberColumns_;}
+  /// Number of rows in basis
+  inline int numberRows() const
+  { return numberRows_;}
+  /// Set number of threads used by computeRows (<=1 serial)
+  inline void setNumberThreads(int value)
+  { numberThreads_ = value;}
+  /// Number of threads used by computeRows
+  inline int numberThreads() const
+  { return numberThreads_;}
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor
+  CglTableauCache (int numberThreads=1);
+
+  /// Copy constructor (rows are copied)
+  CglTableauCache (const CglTableauCache & rhs);
+
+  /// Assignment operator
+  CglTableauCache &
+    operator=(const CglTableauCache& rhs);
+
+  /// Destructor
+  ~CglTableauCache ();
+  //@}
+
+private:
+
+  /// Free everything
+  void gutsOfDelete();
+  /// Copy everything
+  void gutsOfCopy(const CglTableauCache & rhs);
+
+  /**@name Private member data */
+  //@{
+  /// Number of columns
+  int numberColumns_;
+  /// Number of rows
+  int numberRows_;
+  /// Number of elements in matrix when basis loaded
+  int numberElements_;
+  /// Basis status (columns then rows, 1 is basic) - as getBasisStatus
+  int * status_;
+  /// Rows by basic variable (NULL if not computed)
+  double ** rows_;
+  /// Number of threads
+  int numberThreads_;
+  /// Hits
+  int numberHits_;
+  /// Misses
+  int numberMisses_;
+  /// Rows computed by computeRows
+  int numberComputed_;
+  /// Bases seen
+  int numberBases_;
+  //@}
+};
+
+#endif
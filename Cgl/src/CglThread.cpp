@@ -0,0 +1,100 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "CglThread.hpp"
+#ifdef CGL_HAS_THREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#ifdef CGL_HAS_THREADS
+namespace {
+  // Shared between all threads of one CglRunTasks call
+  typedef struct {
+    CglTaskFunction function;
+    void * data;
+    int numberTasks;
+    int nextTask;
+    pthread_mutex_t mutex;
+  } CglTaskQueue;
+  typedef struct {
+    CglTaskQueue * queue;
+    int thread;
+  } CglTaskThread;
+  // Keep taking tasks until none left
+  void runQueue(CglTaskQueue * queue, int thread)
+  {
+    while (true) {
+      pthread_mutex_lock(&queue->mutex);
+      int task = queue->nextTask;
+      if (task<queue->numberTasks)
+	queue->nextTask++;
+      pthread_mutex_unlock(&queue->mutex);
+      if (task>=queue->numberTasks)
+	break;
+      (*queue->function)(task,thread,queue->data);
+    }
+  }
+  void * threadStart(void * arg)
+  {
+    CglTaskThread * info = reinterpret_cast<CglTaskThread *>(arg);
+    runQueue(info->queue,info->thread);
+    return NULL;
+  }
+}
+#endif
+
+int
+CglRunTasks(int numberTasks, int numberThreads,
+	    CglTaskFunction function, void * data)
+{
+  if (numberThreads>numberTasks)
+    numberThreads=numberTasks;
+#ifdef CGL_HAS_THREADS
+  if (numberThreads>1) {
+    CglTaskQueue queue;
+    queue.function = function;
+    queue.data = data;
+    queue.numberTasks = numberTasks;
+    queue.nextTask = 0;
+    pthread_mutex_init(&queue.mutex,NULL);
+    pthread_t * threadId = new pthread_t [numberThreads];
+    CglTaskThread * info = new CglTaskThread [numberThreads];
+    int numberStarted=1;
+    for (int i=1;i<numberThreads;i++) {
+      info[i].queue = &queue;
+      info[i].thread = numberStarted;
+      if (pthread_create(threadId+numberStarted,NULL,threadStart,info+i))
+	break; // can't get thread - make do with what we have
+      numberStarted++;
+    }
+    runQueue(&queue,0);
+    for (int i=1;i<numberStarted;i++)
+      pthread_join(threadId[i],NULL);
+    pthread_mutex_destroy(&queue.mutex);
+    delete [] threadId;
+    delete [] info;
+    return numberStarted;
+  }
+#endif
+  for (int i=0;i<numberTasks;i++)
+    (*function)(i,0,data);
+  return numberTasks ? 1 : 0;
+}
+
+int
+CglNumberProcessors()
+{
+#if defined(CGL_HAS_THREADS) && defined(_SC_NPROCESSORS_ONLN)
+  long number = sysconf(_SC_NPROCESSORS_ONLN);
+  if (number>0)
+    return static_cast<int>(number);
+#endif
+  return 1;
+}
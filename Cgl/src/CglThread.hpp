@@ -0,0 +1,37 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglThread_H
+#define CglThread_H
+
+#include "CglConfig.h"
+
+/* Threads are used unless CGL_NO_THREADS is defined (configure does
+   so if there is no -lpthread).  Windows builds (no pthreads) always
+   run serially. */
+#if !defined(CGL_NO_THREADS) && !defined(_MSC_VER)
+#define CGL_HAS_THREADS 1
+#endif
+
+/** Function run for each task.
+    task is in 0..numberTasks-1 and thread in 0..numberThreads-1.
+    Tasks running on the same thread number never overlap, so thread
+    may be used to index per-thread workspace. */
+typedef void (*CglTaskFunction)(int task, int thread, void * data);
+
+/** Run numberTasks independent tasks on at most numberThreads threads
+    (the calling thread is thread 0).  Tasks are handed out in order
+    from a shared counter and the call returns when all have finished.
+    With numberThreads<=1, or if threads are not available, tasks are
+    simply run in order on the calling thread.
+    Returns number of threads actually used.
+*/
+int CglRunTasks(int numberTasks, int numberThreads,
+		CglTaskFunction function, void * data);
+
+/// Number of processors available (1 if not known)
+int CglNumberProcessors();
+
+#endif
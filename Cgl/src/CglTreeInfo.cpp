@@ -16,12 +16,13 @@
 #include "CoinSort.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CglStored.hpp"
+#include "CglPropagator.hpp"
 #include "OsiRowCut.hpp"
 
 // Default constructor 
 CglTreeInfo::CglTreeInfo ()
   : level(-1), pass(-1), formulation_rows(-1), options(0), inTree(false),
-    strengthenRow(NULL),randomNumberGenerator(NULL) {}
+    strengthenRow(NULL),randomNumberGenerator(NULL),tableauCache(NULL) {}
 
 // Copy constructor 
 CglTreeInfo::CglTreeInfo (const CglTreeInfo & rhs)
@@ -31,7 +32,8 @@ CglTreeInfo::CglTreeInfo (const CglTreeInfo & rhs)
     options(rhs.options),
     inTree(rhs.inTree),
     strengthenRow(rhs.strengthenRow),
-    randomNumberGenerator(rhs.randomNumberGenerator)
+    randomNumberGenerator(rhs.randomNumberGenerator),
+    tableauCache(rhs.tableauCache)
 {
 }
 // Clone
@@ -54,6 +56,7 @@ CglTreeInfo::operator=(const CglTreeInfo& rhs)
     inTree = rhs.inTree;
     strengthenRow = rhs.strengthenRow;
     randomNumberGenerator = rhs.randomNumberGenerator;
+    tableauCache = rhs.tableauCache;
   }
   return *this;
 }
@@ -75,7 +78,11 @@ CglTreeProbingInfo::CglTreeProbingInfo ()
     numberVariables_(0),
     numberIntegers_(0),
     maximumEntries_(0),
-    numberEntries_(-1)
+    numberEntries_(-1),
+    pendingEntry_(NULL),
+    pendingFixing_(NULL),
+    numberPending_(0),
+    maximumPending_(0)
 {
 }
 // Constructor from model
@@ -90,7 +97,11 @@ CglTreeProbingInfo::CglTreeProbingInfo (const OsiSolverInterface * model)
     numberVariables_(0),
     numberIntegers_(0),
     maximumEntries_(0),
-    numberEntries_(-1)
+    numberEntries_(-1),
+    pendingEntry_(NULL),
+    pendingFixing_(NULL),
+    numberPending_(0),
+    maximumPending_(0)
 {
   numberVariables_=model->getNumCols(); 
   // Too many ... but
@@ -130,7 +141,11 @@ CglTreeProbingInfo::CglTreeProbingInfo (const CglTreeProbingInfo & rhs)
     numberVariables_(rhs.numberVariables_),
     numberIntegers_(rhs.numberIntegers_),
     maximumEntries_(rhs.maximumEntries_),
-    numberEntries_(rhs.numberEntries_)
+    numberEntries_(rhs.numberEntries_),
+    pendingEntry_(NULL),
+    pendingFixing_(NULL),
+    numberPending_(rhs.numberPending_),
+    maximumPending_(rhs.maximumPending_)
 {
   if (numberVariables_) {
     fixEntry_ = new cliqueEntry [maximumEntries_];
@@ -145,6 +160,8 @@ CglTreeProbingInfo::CglTreeProbingInfo (const CglTreeProbingInfo & rhs)
     }
     integerVariable_ = CoinCopyOfArray(rhs.integerVariable_,numberIntegers_);
     backward_ = CoinCopyOfArray(rhs.backward_,numberVariables_);
+    pendingEntry_ = CoinCopyOfArray(rhs.pendingEntry_,maximumPending_);
+    pendingFixing_ = CoinCopyOfArray(rhs.pendingFixing_,maximumPending_);
   }
 }
 // Clone
@@ -166,10 +183,14 @@ CglTreeProbingInfo::operator=(const CglTreeProbingInfo& rhs)
     delete [] integerVariable_;
     delete [] backward_;
     delete [] fixingEntry_;
+    delete [] pendingEntry_;
+    delete [] pendingFixing_;
     numberVariables_ = rhs.numberVariables_;
     numberIntegers_ = rhs.numberIntegers_;
     maximumEntries_ = rhs.maximumEntries_;
     numberEntries_ = rhs.numberEntries_;
+    numberPending_ = rhs.numberPending_;
+    maximumPending_ = rhs.maximumPending_;
     if (numberVariables_) {
       fixEntry_ = new cliqueEntry [maximumEntries_];
       memcpy(fixEntry_,rhs.fixEntry_,maximumEntries_*sizeof(cliqueEntry));
@@ -188,6 +209,8 @@ CglTreeProbingInfo::operator=(const CglTreeProbingInfo& rhs)
       toOne_ = CoinCopyOfArray(rhs.toOne_,numberIntegers_);
       integerVariable_ = CoinCopyOfArray(rhs.integerVariable_,numberIntegers_);
       backward_ = CoinCopyOfArray(rhs.backward_,numberVariables_);
+      pendingEntry_ = CoinCopyOfArray(rhs.pendingEntry_,maximumPending_);
+      pendingFixing_ = CoinCopyOfArray(rhs.pendingFixing_,maximumPending_);
     } else {
       fixEntry_ = NULL;
       toZero_ = NULL;
@@ -195,6 +218,8 @@ CglTreeProbingInfo::operator=(const CglTreeProbingInfo& rhs)
       integerVariable_ = NULL;
       backward_ = NULL;
       fixingEntry_ = NULL;
+      pendingEntry_ = NULL;
+      pendingFixing_ = NULL;
     }
   }
   return *this;
@@ -209,6 +234,8 @@ CglTreeProbingInfo::~CglTreeProbingInfo ()
   delete [] integerVariable_;
   delete [] backward_;
   delete [] fixingEntry_;
+  delete [] pendingEntry_;
+  delete [] pendingFixing_;
 }
 static int outDupsEtc(int numberIntegers, int & numberCliques, int & numberMatrixCliques,
 		      int * & cliqueStart, char * & cliqueType, cliqueEntry *& entry, 
@@ -1208,6 +1235,37 @@ CglTreeProbingInfo::fixes(int variable, int toValue, int fixedVariable,bool fixe
   if (intFix<0)
     intFix = numberIntegers_+fixedVariable; // not 0-1
   int fixedTo = fixedToLower ? 0 : 1;
+  if (numberEntries_<0) {
+    // already in order - keep to one side until next wanted
+    if (!toZero_)
+      return false;
+    if (numberPending_==maximumPending_) {
+      // See if taking too much memory
+      if (toZero_[numberIntegers_]+numberPending_>=
+	  CoinMax(1000000,10*numberIntegers_))
+	return false;
+      maximumPending_ += 100 +maximumPending_/2;
+      cliqueEntry * temp1 = new cliqueEntry [maximumPending_];
+      memcpy(temp1,pendingEntry_,numberPending_*sizeof(cliqueEntry));
+      delete [] pendingEntry_;
+      pendingEntry_ = temp1;
+      int * temp2 = new int [maximumPending_];
+      memcpy(temp2,pendingFixing_,numberPending_*sizeof(int));
+      delete [] pendingFixing_;
+      pendingFixing_ = temp2;
+    }
+    cliqueEntry entry1;
+    entry1.fixes=0;
+    setOneFixesInCliqueEntry(entry1,fixedTo!=0);
+    setSequenceInCliqueEntry(entry1,intFix);
+    pendingEntry_[numberPending_] = entry1;
+    assert (toValue==-1||toValue==1);
+    if (toValue<0)
+      pendingFixing_[numberPending_++] = intVariable << 1;
+    else
+      pendingFixing_[numberPending_++] = (intVariable << 1) | 1;
+    return true;
+  }
   if (numberEntries_==maximumEntries_) {
     // See if taking too much memory
     if (maximumEntries_>=CoinMax(1000000,10*numberIntegers_))
@@ -1249,6 +1307,12 @@ CglTreeProbingInfo::initializeFixing(const OsiSolverInterface * model)
   delete [] integerVariable_;
   delete [] backward_;
   delete [] fixingEntry_;
+  delete [] pendingEntry_;
+  delete [] pendingFixing_;
+  pendingEntry_ = NULL;
+  pendingFixing_ = NULL;
+  numberPending_ = 0;
+  maximumPending_ = 0;
   numberVariables_=model->getNumCols(); 
   // Too many ... but
   integerVariable_ = new int [numberVariables_];
@@ -1341,7 +1405,61 @@ CglTreeProbingInfo::convert()
     delete [] fixingEntry_;
     fixingEntry_ = NULL;
     numberEntries_ = -2;
+  } else if (numberPending_) {
+    mergePending();
+  }
+}
+/* Merges pending entries into ordered entries.  Each list is already
+   sorted so only the pending entries need sorting. */
+void 
+CglTreeProbingInfo::mergePending()
+{
+  CoinSort_2(pendingFixing_, pendingFixing_+numberPending_, pendingEntry_);
+  int numberOld = toZero_[numberIntegers_];
+  cliqueEntry * newEntry = new cliqueEntry [numberOld+numberPending_];
+  const unsigned int * oldEntry = 
+    reinterpret_cast<const unsigned int *> (fixEntry_);
+  unsigned int * pending = reinterpret_cast<unsigned int *> (pendingEntry_);
+  unsigned int * put = reinterpret_cast<unsigned int *> (newEntry);
+  int nPut=0;
+  int n=0;
+  int oldStart = toZero_[0];
+  for (int intVariable = 0;intVariable<numberIntegers_;intVariable++) {
+    int oldOne = toOne_[intVariable];
+    int oldEnd = toZero_[intVariable+1];
+    for (int way=0;way<2;way++) {
+      int fixing = (intVariable<<1)|way;
+      int last = n;
+      while (n<numberPending_&&pendingFixing_[n]==fixing)
+	n++;
+      std::sort(pending+last,pending+n);
+      int iOld = way ? oldOne : oldStart;
+      int endOld = way ? oldEnd : oldOne;
+      int iNew = last;
+      int start = nPut;
+      // merge taking out duplicates
+      while (iOld<endOld||iNew<n) {
+	unsigned int value;
+	if (iNew==n||(iOld<endOld&&oldEntry[iOld]<=pending[iNew]))
+	  value = oldEntry[iOld++];
+	else
+	  value = pending[iNew++];
+	if (nPut==start||put[nPut-1]!=value)
+	  put[nPut++]=value;
+      }
+      if (!way)
+	toOne_[intVariable]=nPut;
+      else
+	toZero_[intVariable+1]=nPut;
+    }
+    oldStart = oldEnd;
   }
+  assert (n==numberPending_);
+  delete [] fixEntry_;
+  fixEntry_ = newEntry;
+  maximumEntries_ = numberOld+numberPending_;
+  numberPending_ = 0;
+  numberEntries_ = -2;
 }
 // Fix entries in a solver using implications
 int 
@@ -1495,6 +1613,63 @@ CglTreeProbingInfo::fixColumns(int iColumn,int value, OsiSolverInterface & si) c
   }
   return nFix;
 }
+// Fix entries in propagator using implications and propagate
+int 
+CglTreeProbingInfo::fixColumns(CglPropagator & propagator) const
+{
+  int nFix=0;
+  const double * lower = propagator.colLower();
+  const double * upper = propagator.colUpper();
+  bool feasible = propagator.propagate()>=0;
+  while (feasible) {
+    int nFixBefore=nFix;
+    for (int jColumn=0;jColumn<static_cast<int> (numberIntegers_);jColumn++) {
+      int iColumn = integerVariable_[jColumn];
+      int start;
+      int end;
+      if (upper[iColumn]==0.0) {
+	start=toZero_[jColumn];
+	end=toOne_[jColumn];
+      } else if (lower[iColumn]==1.0) {
+	start=toOne_[jColumn];
+	end=toZero_[jColumn+1];
+      } else {
+	continue;
+      }
+      for (int j=start;j<end;j++) {
+	int kColumn=sequenceInCliqueEntry(fixEntry_[j]);
+	kColumn = integerVariable_[kColumn];
+	bool fixToOne = oneFixesInCliqueEntry(fixEntry_[j]);
+	if (fixToOne) {
+	  if (lower[kColumn]==0.0) {
+	    nFix++;
+	    feasible = propagator.changeLower(kColumn,1.0);
+	  }
+	} else {
+	  if (upper[kColumn]==1.0) {
+	    nFix++;
+	    feasible = propagator.changeUpper(kColumn,0.0);
+	  }
+	}
+	if (!feasible)
+	  break;
+      }
+      if (!feasible)
+	break;
+    }
+    if (nFix==nFixBefore||!feasible)
+      break;
+    // rows may fix more
+    feasible = propagator.propagate()>=0;
+  }
+  if (!feasible) {
+#ifdef COIN_DEVELOP
+    printf("treeprobing says infeasible!\n");
+#endif
+    nFix=-1;
+  }
+  return nFix;
+}
 // Packs down entries
 int 
 CglTreeProbingInfo::packDown()
@@ -1521,6 +1696,237 @@ CglTreeProbingInfo::packDown()
   }
   return iPut;
 }
+/* Takes out implications between 0-1 variables which follow from two
+   others.  A node is a 0-1 variable going to zero (2*i) or one (2*i+1)
+   and its list of fixes gives the arcs out.  An arc u->k is taken out
+   if there is u->j->k with u, j and k in different strongly connected
+   components - then j comes strictly between u and k in the ordering of
+   components so whatever is taken out there is still a path. */
+int 
+CglTreeProbingInfo::pruneImplications()
+{
+  convert();
+  if (numberEntries_!=-2||!numberIntegers_)
+    return 0;
+  int numberNodes = 2*numberIntegers_;
+  int numberArcs = toZero_[numberIntegers_];
+  // start of arcs for each node
+  int * start = new int [numberNodes+1];
+  for (int i=0;i<numberIntegers_;i++) {
+    start[2*i]=toZero_[i];
+    start[2*i+1]=toOne_[i];
+  }
+  start[numberNodes]=numberArcs;
+  // node at end of each arc (-1 if not 0-1)
+  int * head = new int [numberArcs];
+  for (int j=0;j<numberArcs;j++) {
+    int kColumn = sequenceInCliqueEntry(fixEntry_[j]);
+    if (kColumn<numberIntegers_)
+      head[j] = 2*kColumn+(oneFixesInCliqueEntry(fixEntry_[j]) ? 1 : 0);
+    else
+      head[j] = -1;
+  }
+  // Strongly connected components (Tarjan without recursion)
+  int * component = new int [numberNodes];
+  int * order = new int [numberNodes];
+  int * low = new int [numberNodes];
+  int * stack = new int [numberNodes];
+  int * callNode = new int [numberNodes];
+  int * callArc = new int [numberNodes];
+  char * onStack = new char [numberNodes];
+  for (int i=0;i<numberNodes;i++) {
+    order[i]=-1;
+    onStack[i]=0;
+  }
+  int numberOrdered=0;
+  int numberComponents=0;
+  int nStack=0;
+  for (int root=0;root<numberNodes;root++) {
+    if (order[root]>=0)
+      continue;
+    int nCall=0;
+    callNode[nCall]=root;
+    callArc[nCall++]=start[root];
+    order[root]=low[root]=numberOrdered++;
+    stack[nStack++]=root;
+    onStack[root]=1;
+    while (nCall) {
+      int u = callNode[nCall-1];
+      int & arc = callArc[nCall-1];
+      if (arc<start[u+1]) {
+	int k = head[arc++];
+	if (k<0)
+	  continue;
+	if (order[k]<0) {
+	  order[k]=low[k]=numberOrdered++;
+	  stack[nStack++]=k;
+	  onStack[k]=1;
+	  callNode[nCall]=k;
+	  callArc[nCall++]=start[k];
+	} else if (onStack[k]) {
+	  low[u]=CoinMin(low[u],order[k]);
+	}
+      } else {
+	if (low[u]==order[u]) {
+	  int k;
+	  do {
+	    k = stack[--nStack];
+	    onStack[k]=0;
+	    component[k]=numberComponents;
+	  } while (k!=u);
+	  numberComponents++;
+	}
+	nCall--;
+	if (nCall) {
+	  int parent = callNode[nCall-1];
+	  low[parent]=CoinMin(low[parent],low[u]);
+	}
+      }
+    }
+  }
+  delete [] order;
+  delete [] low;
+  delete [] stack;
+  delete [] callNode;
+  delete [] callArc;
+  delete [] onStack;
+  // mark arcs which follow from two others
+  int * mark = new int [numberNodes];
+  int * markArc = new int [numberNodes];
+  char * redundant = new char [numberArcs];
+  CoinFillN(mark,numberNodes,-1);
+  memset(redundant,0,numberArcs);
+  int numberRedundant=0;
+  for (int u=0;u<numberNodes;u++) {
+    int uComponent = component[u];
+    for (int j=start[u];j<start[u+1];j++) {
+      int k = head[j];
+      if (k>=0&&component[k]!=uComponent) {
+	mark[k]=u;
+	markArc[k]=j;
+      }
+    }
+    for (int j=start[u];j<start[u+1];j++) {
+      int middle = head[j];
+      if (middle<0||component[middle]==uComponent)
+	continue;
+      int middleComponent = component[middle];
+      for (int jj=start[middle];jj<start[middle+1];jj++) {
+	int k = head[jj];
+	if (k>=0&&mark[k]==u&&component[k]!=middleComponent&&
+	    !redundant[markArc[k]]) {
+	  redundant[markArc[k]]=1;
+	  numberRedundant++;
+	}
+      }
+    }
+  }
+  delete [] mark;
+  delete [] markArc;
+  delete [] component;
+  delete [] head;
+  delete [] start;
+  if (numberRedundant) {
+    // pack down
+    int iPut=0;
+    int iLast=0;
+    for (int jColumn=0;jColumn<numberIntegers_;jColumn++) {
+      int j;
+      for ( j=iLast;j<toOne_[jColumn];j++) {
+	if (!redundant[j]) 
+	  fixEntry_[iPut++]=fixEntry_[j];
+      }
+      iLast=toOne_[jColumn];
+      toOne_[jColumn]=iPut;
+      for ( j=iLast;j<toZero_[jColumn+1];j++) {
+	if (!redundant[j]) 
+	  fixEntry_[iPut++]=fixEntry_[j];
+      }
+      iLast=toZero_[jColumn+1];
+      toZero_[jColumn+1]=iPut;
+    }
+  }
+  delete [] redundant;
+  return numberRedundant;
+}
+/* Finds all implications violated by solution.  The violation of an
+   implication when variable is going to zero is at most one minus value
+   (times range of other variable) and going to one at most value, so
+   lists can be skipped when variable is at a bound. */
+int 
+CglTreeProbingInfo::violatedImplications(const double * solution, 
+					 const double * lower,
+					 const double * upper, 
+					 double tolerance,
+					 int * variable, int * position,
+					 double * violation)
+{
+  convert();
+  if (!toZero_)
+    return 0;
+  int number=0;
+  for (int i=0;i<numberIntegers_;i++) {
+    int iColumn=integerVariable_[i];
+    if (upper[iColumn]==lower[iColumn])
+      continue;
+    double value1 = solution[iColumn];
+    if (value1<1.0) {
+      for (int j=toZero_[i];j<toOne_[i];j++) {
+	int jColumn=sequenceInCliqueEntry(fixEntry_[j]);
+	double thisViolation;
+	if (jColumn<numberIntegers_) {
+	  double value2 = solution[integerVariable_[jColumn]];
+	  if (oneFixesInCliqueEntry(fixEntry_[j])) 
+	    thisViolation = 1.0-value1-value2;
+	  else
+	    thisViolation = value2-value1;
+	} else {
+	  jColumn -= numberIntegers_; // not 0-1
+	  double value2 = solution[jColumn];
+	  double lowerValue = lower[jColumn];
+	  double upperValue = upper[jColumn];
+	  if (oneFixesInCliqueEntry(fixEntry_[j])) 
+	    thisViolation = upperValue-value1*(upperValue-lowerValue)-value2;
+	  else
+	    thisViolation = value2-value1*(upperValue-lowerValue)-lowerValue;
+	}
+	if (thisViolation>tolerance) {
+	  variable[number]=i;
+	  position[number]=j;
+	  violation[number++]=thisViolation;
+	}
+      }
+    }
+    if (value1>0.0) {
+      for (int j=toOne_[i];j<toZero_[i+1];j++) {
+	int jColumn=sequenceInCliqueEntry(fixEntry_[j]);
+	double thisViolation;
+	if (jColumn<numberIntegers_) {
+	  double value2 = solution[integerVariable_[jColumn]];
+	  if (oneFixesInCliqueEntry(fixEntry_[j])) 
+	    thisViolation = value1-value2;
+	  else
+	    thisViolation = value1+value2-1.0;
+	} else {
+	  jColumn -= numberIntegers_; // not 0-1
+	  double value2 = solution[jColumn];
+	  double lowerValue = lower[jColumn];
+	  double upperValue = upper[jColumn];
+	  if (oneFixesInCliqueEntry(fixEntry_[j])) 
+	    thisViolation = lowerValue +(upperValue-lowerValue)*value1-value2;
+	  else
+	    thisViolation = (upperValue-lowerValue)*value1+value2-upperValue;
+	}
+	if (thisViolation>tolerance) {
+	  variable[number]=i;
+	  position[number]=j;
+	  violation[number++]=thisViolation;
+	}
+      }
+    }
+  }
+  return number;
+}
 void
 CglTreeProbingInfo::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 				 const CglTreeInfo /*info*/) const
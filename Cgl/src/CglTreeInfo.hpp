@@ -10,6 +10,8 @@
 #include "OsiSolverInterface.hpp"
 #include "CoinHelperFunctions.hpp"
 class CglStored;
+class CglTableauCache;
+class CglPropagator;
 /** Information about where the cut generator is invoked from. */
 
 class CglTreeInfo {
@@ -50,6 +52,10 @@ public:
   OsiRowCut ** strengthenRow;
   /// Optional pointer to thread specific random number generator
   CoinThreadRandom * randomNumberGenerator;
+  /** Optional pointer to tableau rows for current basis (not owned).
+      If not NULL tableau based generators take rows from here and add
+      any they compute so later generators can reuse them. */
+  CglTableauCache * tableauCache;
   /// Default constructor 
   CglTreeInfo ();
  
@@ -106,7 +112,9 @@ public:
   OsiSolverInterface * analyze(const OsiSolverInterface & si, int createSolver=0);
   /** Take action if cut generator can fix a variable 
       (toValue -1 for down, +1 for up)
-      Returns true if still room, false if not  */
+      Returns true if still room, false if not.
+      Once entries are in order new ones are kept to one side and
+      merged in next time they are asked for. */
   virtual bool fixes(int variable, int toValue, int fixedVariable,bool fixedToLower);
   /** Initalizes fixing arrays etc - returns >0 if we want to save info
       0 if we don't and -1 if is to be used */
@@ -115,8 +123,29 @@ public:
   int fixColumns(OsiSolverInterface & si) const;
   /// Fix entries in a solver using implications for one variable
   int fixColumns(int iColumn, int value, OsiSolverInterface & si) const;
+  /** Fix entries in propagator using implications, propagating
+      through rows after each round until nothing more is fixed.
+      Returns number fixed by implications or -1 if infeasible */
+  int fixColumns(CglPropagator & propagator) const;
   /// Packs down entries
   int packDown();
+  /** Takes out implications between 0-1 variables which follow from two
+      others (x going to a fixes y to b and y to b fixes z to c so no need
+      for x going to a fixes z to c).  Implications inside a cycle of
+      implications are kept so everything which could be fixed before
+      still can be.  Returns number taken out. */
+  int pruneImplications();
+  /** Finds all implications violated by more than tolerance as two
+      variable cuts (as generated by CglStored) by solution.  Variables
+      fixed by bounds are skipped as are lists which can not be violated
+      as variable is at zero (for going to one) or one (for going to zero).
+      For each violated implication puts 0-1 variable into variable,
+      position in fixEntries() into position and violation into violation
+      (each must be of size toZero()[numberIntegers()]).
+      Returns number found. */
+  int violatedImplications(const double * solution, const double * lower,
+			   const double * upper, double tolerance,
+			   int * variable, int * position, double * violation);
   /// Generate cuts from implications
   void generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 		    const CglTreeInfo info) const;
@@ -129,6 +158,9 @@ public:
   /// Starts of integer variable going to one
   inline int * toOne()
   { convert(); return toOne_;}
+  /// Number of entries waiting to be merged into ordered entries
+  inline int numberPending() const
+  { return numberPending_;}
   /// List of 0-1 integer variables
   inline int * integerVariable() const
   { return integerVariable_;}
@@ -142,8 +174,10 @@ public:
   inline int numberIntegers() const
   { return numberIntegers_;}
 private:
-  /// Converts to ordered
+  /// Converts to ordered (or merges in pending entries)
   void convert();
+  /// Merges pending entries into ordered entries
+  void mergePending();
 protected:
   /// Entries for fixing variables
   cliqueEntry * fixEntry_;
@@ -165,6 +199,14 @@ protected:
   int maximumEntries_;
   /// Number entries in fixingEntry_ (and fixEntry_) or -2 if correct style
   int numberEntries_;
+  /// Entries added after conversion to ordered
+  cliqueEntry * pendingEntry_;
+  /// Which variable and way for each pending entry (as fixingEntry_)
+  int * pendingFixing_;
+  /// Number of pending entries
+  int numberPending_;
+  /// Maximum number of pending entries
+  int maximumPending_;
 };
 inline int sequenceInCliqueEntry(const cliqueEntry & cEntry)
 { return cEntry.fixes&0x7fffffff;}
@@ -0,0 +1,170 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "CglWorkspace.hpp"
+
+// All arrays start on this boundary
+#define CGL_WORKSPACE_ALIGN 16
+
+namespace {
+  // Rounded up to alignment (never nothing so pointers are distinct)
+  inline size_t roundUp(size_t n)
+  {
+    if (!n)
+      n=1;
+    return (n+CGL_WORKSPACE_ALIGN-1)&~static_cast<size_t>(CGL_WORKSPACE_ALIGN-1);
+  }
+}
+
+// Bytes taken by an array of number items of size (with alignment)
+size_t
+CglWorkspace::bytes(int number, size_t size)
+{
+  return roundUp(number>0 ? static_cast<size_t>(number)*size : 0);
+}
+
+//-------------------------------------------------------------------
+// Start of a call
+//-------------------------------------------------------------------
+void
+CglWorkspace::reset(size_t bytesWanted)
+{
+  freeExtra(0);
+  used_=0;
+  bytesAllocated_=0;
+  numberAllocations_=0;
+  if (peak_>bytesWanted)
+    bytesWanted=peak_;
+  if (bytesWanted>size_) {
+    delete [] block_;
+    // a bit extra so a slowly growing model does not grow every time
+    size_ = roundUp(bytesWanted+bytesWanted/8);
+    block_ = new double [size_/sizeof(double)];
+    bytesAllocated_ += size_;
+    numberAllocations_++;
+    totalBytesAllocated_ += size_;
+  }
+}
+
+//-------------------------------------------------------------------
+// Space for number bytes
+//-------------------------------------------------------------------
+void *
+CglWorkspace::allocate(size_t number)
+{
+  number = roundUp(number);
+  void * array;
+  if (used_+number<=size_) {
+    array = reinterpret_cast<char *>(block_)+used_;
+    used_ += number;
+  } else {
+    // full - this will go in block next time
+    double * temp = new double [number/sizeof(double)];
+    extra_.push_back(temp);
+    extraSize_.push_back(number);
+    extraBytes_ += number;
+    bytesAllocated_ += number;
+    numberAllocations_++;
+    totalBytesAllocated_ += number;
+    array = temp;
+  }
+  if (used_+extraBytes_>peak_)
+    peak_ = used_+extraBytes_;
+  return array;
+}
+
+// Current position
+CglWorkspace::Mark
+CglWorkspace::mark() const
+{
+  Mark position;
+  position.used = used_;
+  position.numberExtra = static_cast<int>(extra_.size());
+  return position;
+}
+
+// Give back everything handed out since mark
+void
+CglWorkspace::release(const Mark & mark)
+{
+  assert (mark.used<=used_);
+  used_ = mark.used;
+  freeExtra(mark.numberExtra);
+}
+
+// Free all space
+void
+CglWorkspace::clear()
+{
+  freeExtra(0);
+  delete [] block_;
+  block_=NULL;
+  size_=0;
+  used_=0;
+  peak_=0;
+}
+
+// Frees separate allocations after first
+void
+CglWorkspace::freeExtra(int first)
+{
+  for (int i=static_cast<int>(extra_.size())-1;i>=first;i--) {
+    delete [] extra_[i];
+    extraBytes_ -= extraSize_[i];
+  }
+  extra_.resize(first);
+  extraSize_.resize(first);
+}
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+CglWorkspace::CglWorkspace ()
+  : block_(NULL),
+    size_(0),
+    used_(0),
+    extraBytes_(0),
+    peak_(0),
+    bytesAllocated_(0),
+    numberAllocations_(0),
+    totalBytesAllocated_(0.0)
+{
+}
+
+//-------------------------------------------------------------------
+// Copy constructor (starts empty)
+//-------------------------------------------------------------------
+CglWorkspace::CglWorkspace (const CglWorkspace &)
+  : block_(NULL),
+    size_(0),
+    used_(0),
+    extraBytes_(0),
+    peak_(0),
+    bytesAllocated_(0),
+    numberAllocations_(0),
+    totalBytesAllocated_(0.0)
+{
+}
+
+//-------------------------------------------------------------------
+// Assignment operator (keeps own space)
+//-------------------------------------------------------------------
+CglWorkspace &
+CglWorkspace::operator=(const CglWorkspace &)
+{
+  return *this;
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+CglWorkspace::~CglWorkspace ()
+{
+  freeExtra(0);
+  delete [] block_;
+}
@@ -0,0 +1,147 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglWorkspace_H
+#define CglWorkspace_H
+
+#include <cstddef>
+#include <vector>
+
+#include "CoinTypes.hpp"
+
+/** Scratch space kept by a cut generator from one call to the next.
+
+    Arrays are carved out of one block.  reset() at the start of a call
+    makes the whole block available again, so once the block is big
+    enough a call needs no allocation at all.  If a call wants more than
+    the block holds the extra is allocated separately and the block is
+    made big enough for all of it at the next reset().
+
+    Arrays are aligned to 16 bytes and are not initialized.  A routine
+    which may be called from inside another one using the same workspace
+    takes mark() on entry and release()s it on exit instead of calling
+    reset().
+
+    bytesAllocated() and numberAllocations() say how much had to be
+    allocated since the last reset() - zero in the steady state.
+
+    A copy starts empty (nothing is shared) and assignment keeps the
+    space already there.  Not thread safe - each generator owns its own.
+*/
+class CglWorkspace {
+
+public:
+
+  /// Position in workspace (see mark and release)
+  struct Mark {
+    /// Bytes used in block
+    size_t used;
+    /// Number of separate allocations
+    int numberExtra;
+  };
+
+  /**@name Getting space */
+  //@{
+  /** Start of a call - everything handed out before is finished with.
+      Block is made at least bytesWanted (and big enough for the
+      largest call so far). */
+  void reset(size_t bytesWanted=0);
+  /// Space for number bytes
+  void * allocate(size_t number);
+  /// Space for number ints
+  inline int * intArray(int number)
+  { return static_cast<int *>(allocate(number*sizeof(int)));}
+  /// Space for number doubles
+  inline double * doubleArray(int number)
+  { return static_cast<double *>(allocate(number*sizeof(double)));}
+  /// Space for number chars
+  inline char * charArray(int number)
+  { return static_cast<char *>(allocate(number));}
+  /// Space for number bools
+  inline bool * boolArray(int number)
+  { return static_cast<bool *>(allocate(number*sizeof(bool)));}
+  /// Space for number CoinBigIndexes
+  inline CoinBigIndex * bigIndexArray(int number)
+  { return static_cast<CoinBigIndex *>(allocate(number*sizeof(CoinBigIndex)));}
+  /// Bytes taken by an array of number items of size (with alignment)
+  static size_t bytes(int number, size_t size);
+  /// Current position
+  Mark mark() const;
+  /// Give back everything handed out since mark
+  void release(const Mark & mark);
+  /// Free all space
+  void clear();
+  //@}
+
+  /**@name Statistics */
+  //@{
+  /// Bytes allocated since last reset
+  inline size_t bytesAllocated() const
+  { return bytesAllocated_;}
+  /// Number of allocations since last reset
+  inline int numberAllocations() const
+  { return numberAllocations_;}
+  /// Bytes allocated ever
+  inline double totalBytesAllocated() const
+  { return totalBytesAllocated_;}
+  /// Size of block
+  inline size_t capacity() const
+  { return size_;}
+  /// Most bytes in use at once since created or cleared
+  inline size_t peak() const
+  { return peak_;}
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor
+  CglWorkspace ();
+  /// Copy constructor (starts empty)
+  CglWorkspace (const CglWorkspace &);
+  /// Assignment operator (keeps own space)
+  CglWorkspace & operator=(const CglWorkspace &);
+  /// Destructor
+  ~CglWorkspace ();
+  //@}
+
+private:
+
+  /// Frees separate allocations after first
+  void freeExtra(int first);
+
+  /**@name Private member data */
+  //@{
+  /// Block
+  double * block_;
+  /// Size of block in bytes
+  size_t size_;
+  /// Bytes used in block
+  size_t used_;
+  /// Separate allocations when block full
+  std::vector<double *> extra_;
+  /// Sizes of separate allocations
+  std::vector<size_t> extraSize_;
+  /// Bytes in separate allocations
+  size_t extraBytes_;
+  /// Most bytes in use at once
+  size_t peak_;
+  /// Bytes allocated since reset
+  size_t bytesAllocated_;
+  /// Number of allocations since reset
+  int numberAllocations_;
+  /// Bytes allocated ever
+  double totalBytesAllocated_;
+  //@}
+};
+
+//#############################################################################
+/** A function that tests the methods in the CglWorkspace class. The
+    only reason for it not to be a member method is that this way it doesn't
+    have to be compiled into the library. And that's a gain, because the
+    library should be compiled with optimization on, but this method should be
+    compiled with debugging. */
+void CglWorkspaceUnitTest();
+
+#endif
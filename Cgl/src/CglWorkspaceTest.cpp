@@ -0,0 +1,48 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstddef>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "CglWorkspace.hpp"
+
+//--------------------------------------------------------------------------
+// test CglWorkspace
+void
+CglWorkspaceUnitTest()
+{
+  // Test default constructor
+  {
+    CglWorkspace workspace;
+    assert (!workspace.capacity());
+  }
+
+  // Work arrays are kept between calls
+  {
+    CglWorkspace workspace;
+    workspace.reset();
+    double * first = workspace.doubleArray(100);
+    CglWorkspace::Mark mark = workspace.mark();
+    int * second = workspace.intArray(51);
+    assert (workspace.numberAllocations()==2);
+    assert ((reinterpret_cast<size_t>(second)&15)==0);
+    workspace.release(mark);
+    workspace.reset();
+    // now one block big enough for both
+    assert (workspace.numberAllocations()==1);
+    first = workspace.doubleArray(100);
+    second = workspace.intArray(51);
+    assert (second>=reinterpret_cast<int *>(first+100));
+    workspace.reset();
+    first = workspace.doubleArray(100);
+    second = workspace.intArray(51);
+    assert (!workspace.bytesAllocated());
+  }
+}
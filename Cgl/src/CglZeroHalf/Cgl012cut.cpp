@@ -3,11 +3,12 @@
 // Corporation and others.  All Rights Reserved.
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 /** @file 012cut.c Definition file for C coded 0-1/2 separator */
+#include <cstring>
 #include "CoinFinite.hpp"
 #include "CoinTime.hpp"
 #include "Cgl012cut.hpp"
 #include "CglZeroHalf.hpp"
-int MAX_CUTS = 1000;
+static const int MAX_CUTS = 1000;
 //#define PRINT_TABU
 //#define PRINT_CUTS
 //#define PRINT_TIME
@@ -62,32 +63,7 @@ int MAX_CUTS = 1000;
 
 #ifdef TIME
 
-static float tot_basic_sep_time = 0.0; /* total time spent for basic 
-					  separation */
-static float avg_basic_sep_time; /* average time per iteration spent for basic
-				    separation */
-static float total_time = 0.0; /* total time spent in the separation */
-static float prep_time = 0.0; /* time spent for the definition of the
-				 parity ILP data structure */
-static float weak_time = 0.0; /* time spent for the construction of the
-				 separation graph by weakening */
-static float aux_time = 0.0; /* time spent for the definition of the 
-				auxiliary graph */
-static float path_time = 0.0; /* time spent in the computation of the
-				 shortest paths */ 
-static float cycle_time = 0.0; /* time spent in the determination of the
-				  shortest cycles */ 
-static float cut_time = 0.0; /* time spent in the determination of the
-				violated cuts */
-static float bw_time = 0.0; /* time spent in best_weakening */
-static float coef_time = 0.0; /* time spent in the initial computation
-				 of coef in get_cut */
-static float pool_time = 0.0; /* time spent for the addition and
-				 extraction of cuts from the pool */
-static int cut_ncalls = 0; /* number of calls to get_cut */
-static float tabu_time = 0.0; /* time spent within tabu search */
-float ti, tf, td, tti, ttf, tsi, tsf, tii, tff, tpi, tpf, ttabi, ttabf;
-void 
+static void 
 second_(float *t) {*t=CoinCpuTime();}
 #endif
 
@@ -95,11 +71,6 @@ second_(float *t) {*t=CoinCpuTime();}
 
 /* global data structures */
 
-#define CGGGGG
-#ifndef CGGGGG
-static ilp *inp_ilp; /* input ILP data structure */
-static parity_ilp *p_ilp; /* parity ILP data structure */
-#endif
 
 #ifdef PRINT_CUTS
 /* utility subroutines */
@@ -1156,7 +1127,7 @@ void print_cycle_list(cycle_list *s_cycle_list)
    for the shortest path computation - all the cycles in the list are
    different from each other */
 
-cycle_list *get_shortest_odd_cycle_list(
+cycle_list *Cgl012Cut::get_shortest_odd_cycle_list(
 					int j, /* first node to be visited by the odd cycle */
 					separation_graph *s_graph, /* current separation graph */
 					auxiliary_graph *a_graph /* auxiliary graph for the shortest path computation */
@@ -1235,9 +1206,15 @@ cycle_list *get_shortest_odd_cycle_list(
   second_(&tf);
   path_time += tf - ti;
 #endif
-  forw_arb = 
-    reinterpret_cast<short_path_node *> (calloc(a_graph->nnodes,sizeof(short_path_node)));
-  if ( forw_arb == NULL ) alloc_error(const_cast<char*>("forw_arb"));
+  if ( a_graph->nnodes > path_work_size ) {
+    /* both arborescences live in one block kept between calls */
+    free(path_work);
+    path_work_size = a_graph->nnodes;
+    path_work = 
+      reinterpret_cast<short_path_node *> (calloc(2*path_work_size,sizeof(short_path_node)));
+    if ( path_work == NULL ) alloc_error(const_cast<char*>("path_work"));
+  }
+  forw_arb = path_work;
   for ( k = 0; k < a_graph->nnodes; k++ ) { 
 #ifndef CGL_NEW_SHORT
     if ( a_graph->nodes[k].parent != NULL ) {
@@ -1255,9 +1232,7 @@ cycle_list *get_shortest_odd_cycle_list(
       forw_arb[k].pred = NONE;
     }
   }
-  backw_arb = 
-    reinterpret_cast<short_path_node *> (calloc(a_graph->nnodes,sizeof(short_path_node)));
-  if ( backw_arb == NULL ) alloc_error(const_cast<char*>("backw_arb"));
+  backw_arb = path_work + path_work_size;
   for ( k = 0; k < a_graph->nnodes; k++ ) { 
 #ifndef CGL_NEW_SHORT
     if ( a_graph->nodes[k].parent != NULL ) {
@@ -1374,9 +1349,6 @@ cycle_list *get_shortest_odd_cycle_list(
       }
     }
   }
-  free(forw_arb);
-  free(backw_arb);
-
 #ifdef TIME
   second_(&tsf);
   cycle_time += tsf - tsi;
@@ -1651,10 +1623,6 @@ cut *Cgl012Cut::get_cut(
   int ncomb;
   int *comb;
   short int *flag_comb;
-#ifndef CGGGGG
-  static int iter = 0;
-  static double gap, maxgap = 0.0;
-#endif
 
 #ifdef TIME
   second_(&tsi);
@@ -1668,8 +1636,14 @@ cut *Cgl012Cut::get_cut(
   second_(&tii);
 #endif
   
-  ccoef = reinterpret_cast<int *> (calloc(inp_ilp->mc,sizeof(int)));
-  if ( ccoef == NULL ) alloc_error(const_cast<char*>("ccoef"));
+  if ( inp_ilp->mc > coef_work_size ) {
+    free(coef_work);
+    coef_work_size = inp_ilp->mc;
+    coef_work = reinterpret_cast<int *> (malloc(coef_work_size*sizeof(int)));
+    if ( coef_work == NULL ) alloc_error(const_cast<char*>("coef_work"));
+  }
+  ccoef = coef_work;
+  memset(ccoef,0,inp_ilp->mc*sizeof(int));
   ncomb = 0;
   comb = reinterpret_cast<int *> (calloc(inp_ilp->mr,sizeof(int)));
   if ( comb == NULL ) alloc_error(const_cast<char*>("comb"));
@@ -1699,7 +1673,6 @@ cut *Cgl012Cut::get_cut(
   
   ok = ok && best_cut(ccoef,&crhs,&violation,TRUE,TRUE); 
   if ( ! ok ) {
-    free(ccoef);
     free(comb);
     free(flag_comb);
 #ifdef TIME
@@ -1719,7 +1692,6 @@ iter++;
     //printf("iter %d\n",iter);
     //exit(0);
     free_cut(v_cut);
-    free(ccoef);
     free(comb);
     free(flag_comb);
     errorNo=1;
@@ -1732,8 +1704,6 @@ if ( gap > maxgap ) maxgap = gap;
   v_cut->constr_list = comb;
   v_cut->in_constr_list = flag_comb;
 
-  free(ccoef);
-
 #ifdef TIME
   second_(&tsf);
   cut_time += tsf - tsi;
@@ -2285,23 +2255,6 @@ EXIT_CUTS:
   last revision: Jun 10 1997
 */  
 
-/* static data structures for log information about separation */
-
-#ifndef CGGGGG
-static int sep_iter = 0; /* number of the current separation iteration */
-//#define POOL 
-#ifdef POOL 
-static pool_cut_list *pool = NULL; /* information about the cuts separated
-				      so far, used to decide when they should 
-				      be added to the current LP */
-#endif
-static log_var **vlog = NULL; /* information about the value attained
-				  by the variables in the last iterations,
-				  used to possibly set to 0 some coefficient
-				  > 0 in a cut to be added */ 
-static bool aggr; /* flag saying whether as many cuts as possible are required
-		   from the separation procedure (TRUE) or not (FALSE) */
-#endif
 /* include the reactive local search heuristic */
 
 //was #include "Cgltabu_012.c"
@@ -2313,60 +2266,9 @@ static bool aggr; /* flag saying whether as many cuts as possible are required
 #define IN_PROHIB_PERIOD 3
 #define MAX_TIME_FACTOR 3
 
-/* data structure for the current local search solution */
-
-typedef struct {
-int n_of_constr; /* number of constraints in the current cut */
-short int *in_constr_list; /* flag saying whether a given constraint is
-			      in the list of constraints of the cut (IN)
-			      or not (OUT) */
-int *non_weak_coef; /* coefficients of the cut before weakening */
-int non_weak_rhs; /* coefficient of the rhs before weakening */
-double slack_sum; /* sum of the slacks of the constraints in the cut */
-double min_weak_loss; /* minimum loss by weakening the non even 
-			 coefficients */
-int one_norm; /* 1-norm of the lhs, i.e. sum of the absolute values of
-		 the coefficients */
-short int ok; /* logical flag telling whether the cut could be weakened
-		 to a 0-1/2 cut or not - if false the two fields below
-		 have no meaning */
-int *coef; /* actual coefficients of the cut */
-int rhs; /* actual rhs of the cut */
-double violation; /* violation of the cut */
-} tabu_cut;
-
-/* data structure for the hash table used in memory reaction */
-
-typedef struct h_e {
-int n_of_el; /* number of components to be considered */
-short int *flag_vect; /* vector of flags for the components */
-int last_vis; /* last iteration when this element was visited */
-struct h_e *next; /* pointer to the next element in the hash chain */
-} hash_element;
-
-typedef hash_element **hash_table;
-
-/* global variables for local search */
-
-int n; /* number of variables in the ILP */
-int m; /* number of constraints in the ILP */
-int it; /* number of tabu search iterations so far */
-tabu_cut *cur_cut; /* information about the current cut in local search */
-int *last_moved; /* last iteration when a given constraint was added/
-		    deleted from the list of constraints of the cut */
-int last_it_add; /* last iteration when a cut was added to the list */
-int last_it_restart; /* last iteration when a restart was performed */
-int prohib_period; /* current prohibition period */
-int last_prohib_period_mod; /* last iteration where prohibition period was modified */
-hash_table hash_tab; /* hash table */
-int A; /* parameter A in Battiti and Protasi */
-int B; /* parameter B in Battiti and Protasi */
-float elapsed_time; /* time elapsed since the beginning of the current
-		       tabu search call */
-
 /* clear_cur_cut: clear the current solution (no constraint in the cut) */
 
-void clear_cur_cut()
+void Cgl012Cut::clear_cur_cut()
 {
   int i, j;
 
@@ -2389,7 +2291,7 @@ void clear_cur_cut()
 
 /* initialize_cur_cut: allocate the memory for cur_cut */
 
-void initialize_cur_cut() 
+void Cgl012Cut::initialize_cur_cut() 
 {
   cur_cut = reinterpret_cast<tabu_cut *> (calloc(1,sizeof(tabu_cut)));
   if ( cur_cut == NULL ) alloc_error(const_cast<char*>("cur_cut"));
@@ -2404,7 +2306,7 @@ void initialize_cur_cut()
 
 /* free_cur_cut: free the memory for cur_cut */
 
-void free_cur_cut()
+void Cgl012Cut::free_cur_cut()
 {
   free(cur_cut->coef);
   free(cur_cut->non_weak_coef);
@@ -2460,7 +2362,7 @@ short int same_short_vect(
 
 /* initialize_hash_table: allocate the memory for the hash table */
 
-void initialize_hash_table()
+void Cgl012Cut::initialize_hash_table()
 {
   int i;
   hash_tab = reinterpret_cast<hash_element **> (calloc(NUM_HASH_ENTRIES,sizeof(hash_element *)));
@@ -2470,7 +2372,7 @@ void initialize_hash_table()
 
 /* clear_hash_table: clear the current hash table */
 
-void clear_hash_table()
+void Cgl012Cut::clear_hash_table()
 {
   int i; 
   hash_element *hash_ptr, *hash_el;
@@ -2491,7 +2393,7 @@ void clear_hash_table()
 
 /* free_hash_table: deallocate the memory for the hash table */
 
-void free_hash_table()
+void Cgl012Cut::free_hash_table()
 {
   clear_hash_table();
   free(hash_tab);
@@ -2516,7 +2418,7 @@ int hash_addr(
 /* hash_search: search for the current cut in the hash list of all cuts -
    if found return TRUE and update the last iteration the cut was found */
 
-short int hash_search(int *cyc_len /* length of the cycle if the current cut is found */)
+short int Cgl012Cut::hash_search(int *cyc_len /* length of the cycle if the current cut is found */)
 { 
   int addr;
   hash_element *hash_el;
@@ -2536,7 +2438,7 @@ short int hash_search(int *cyc_len /* length of the cycle if the current cut is
 
 /* hash_insert: insert a new cut in the hash list of all cuts */
 
-void hash_insert()
+void Cgl012Cut::hash_insert()
 {
   int addr, i;
   hash_element *hash_el, *hash_ptr;
@@ -2571,7 +2473,7 @@ void hash_insert()
 
 /* increase_prohib_period: implemented as in Battiti and Protasi */
 
-void increase_prohib_period()
+void Cgl012Cut::increase_prohib_period()
 {
   if ( prohib_period * 1.1 > prohib_period + 1 ) 
     if ( prohib_period * 1.1 < m - 2 ) prohib_period = 
@@ -2585,7 +2487,7 @@ void increase_prohib_period()
 
 /* decrease_prohib_period: implemented as in Battiti and Protasi */
 
-void decrease_prohib_period()
+void Cgl012Cut::decrease_prohib_period()
 {
   if ( prohib_period * 0.9 < prohib_period - 1 ) 
     if ( prohib_period * 0.9 > IN_PROHIB_PERIOD ) prohib_period = static_cast<int> (prohib_period* 0.9);
@@ -2599,7 +2501,7 @@ void decrease_prohib_period()
 /* allowed: check if moving (adding/deleting) a given constraint 
    is not a tabu move */
 
-short int allowed(int i /* constraint to be checked */)
+short int Cgl012Cut::allowed(int i /* constraint to be checked */)
 {
   if ( last_moved[i]  < it - prohib_period ) {
     if ( cur_cut->in_constr_list[i] == IN ) {
@@ -2617,7 +2519,7 @@ short int allowed(int i /* constraint to be checked */)
 /* in_cur_cut: check whether a given constraint is in the list of
    constraints defining the current cut */
 
-short int in_cur_cut(int i /* constraint to be checked */)
+short int Cgl012Cut::in_cur_cut(int i /* constraint to be checked */)
 {
   if ( cur_cut->in_constr_list[i] == OUT ) return(FALSE);
   else return(TRUE);
@@ -2950,7 +2852,7 @@ short int Cgl012Cut::best_neighbour(cut_list *out_cuts /* list of the violated c
    current solution has already been visited or the best solution has not 
    been updated for too many iterations */
 
-void memory_reaction()
+void Cgl012Cut::memory_reaction()
 {
   int cycle_length;
 
@@ -3045,7 +2947,7 @@ void Cgl012Cut::restart(short int failure /* flag forcing the restart if some tr
 
 /* free_memory: free the memory used by local search */
 
-void free_memory()
+void Cgl012Cut::free_memory()
 {
   free_cur_cut();
   free(last_moved);
@@ -3112,7 +3014,7 @@ void free_pool_cut(pool_cut *p_cut)
 
 /* initialize_pool: initialize the pool data structure */
 
-void initialize_pool()
+void Cgl012Cut::initialize_pool()
 {
   pool = (pool_cut_list *) calloc(1,sizeof(pool_cut_list));
   if ( pool == NULL ) alloc_error(const_cast<char*>("pool"));
@@ -3125,7 +3027,7 @@ void initialize_pool()
 
 /* free_pool: free the memory used by the pool */
 
-void free_pool()
+void Cgl012Cut::free_pool()
 {
   int c;
 
@@ -3138,7 +3040,7 @@ void free_pool()
 /* clean_pool: remove form the pool the cuts which are inactive since a
    large number of iterations */
 
-void clean_pool()
+void Cgl012Cut::clean_pool()
 {
   int c, d;
 
@@ -3157,7 +3059,7 @@ void clean_pool()
 
 /* insert_cut_in_pool: add a cut to the pool if there is space */
 
-void insert_cut_in_pool(pool_cut *p_cut)
+void Cgl012Cut::insert_cut_in_pool(pool_cut *p_cut)
 {
 
   if ( pool->cnum == MAX_CUT_POOL ) {
@@ -3173,7 +3075,7 @@ void insert_cut_in_pool(pool_cut *p_cut)
 
 /* cut_is_in_pool: check whether a given cut is already in the pool */
 
-short int cut_is_in_pool(cut *v_cut)
+short int Cgl012Cut::cut_is_in_pool(cut *v_cut)
 {
   int c, i, cod;
   short int equal;
@@ -3226,7 +3128,7 @@ short int good_pool_cut(cut *v_cut)
 
 /* add_cuts_to_pool: add the cuts separated to the pool structure */
 
-void add_cuts_to_pool(cut_list *out_cuts)
+void Cgl012Cut::add_cuts_to_pool(cut_list *out_cuts)
 {
   int i, c;
   cut *v_cut;
@@ -3276,7 +3178,7 @@ void add_cuts_to_pool(cut_list *out_cuts)
 /* interesting_var: decides whether a variable is relevant in the
    separation or not */
 
-short int interesting_var(int j /* variable to be evaluated */)
+short int Cgl012Cut::interesting_var(int j /* variable to be evaluated */)
 {
   /* return ( vlog[j]->n_it_zero < MANY_IT_ZERO ); */
   /* if ( aggr ) return (TRUE); */
@@ -3286,13 +3188,13 @@ short int interesting_var(int j /* variable to be evaluated */)
 /* get_cuts_from_pool: select from the pool a convenient set of violated
    constraints to be added to the current LP */
 
-static double max_score_ever = ZERO; /* maximum score of a violated cut during
-					the whole cutting plane procedure */
+/* max_score_ever (a member) is the maximum score of a violated cut
+   during the whole cutting plane procedure */
 #define MIN_CUT_SCORE ( max_score_ever / MIN_SCORE_RANGE )
 #define MAX_CUT_SCORE ( max_score_ever / MAX_SCORE_RANGE )
 #define MIN_IT_VIOL 2
 
-cut_list *get_cuts_from_pool(
+cut_list *Cgl012Cut::get_cuts_from_pool(
 short int after_sep /* flag telling whether the pool is searched after
 			a new separation in which case only new cuts are
 			checked */
@@ -3711,7 +3613,7 @@ print_parity_ilp();
 #ifdef TIME
 /* print_times: print the timings of the separation procedure */
 
-void print_times()
+void Cgl012Cut::print_times()
 {
   printf("... separation timings \n");
   printf("times  total: %f  prep: %f  weak: %f  aux: %f  path: %f cycle: %f  cut: %f (%d calls)  bw: %f  coef: %f  pool: %f  tabu: %f\n",
@@ -3730,7 +3632,39 @@ Cgl012Cut::Cgl012Cut () :
   errorNo(0),
   sep_iter(0),
   vlog(NULL),
-  aggr(true)
+  aggr(true),
+  n(0),
+  m(0),
+  it(0),
+  cur_cut(NULL),
+  last_moved(NULL),
+  last_it_add(0),
+  last_it_restart(0),
+  prohib_period(0),
+  last_prohib_period_mod(0),
+  hash_tab(NULL),
+  A(0),
+  B(0),
+  coef_work_size(0),
+  coef_work(NULL),
+  path_work_size(0),
+  path_work(NULL),
+  pool(NULL),
+  max_score_ever(ZERO),
+  tot_basic_sep_time(0.0),
+  avg_basic_sep_time(0.0),
+  total_time(0.0),
+  prep_time(0.0),
+  weak_time(0.0),
+  aux_time(0.0),
+  path_time(0.0),
+  cycle_time(0.0),
+  cut_time(0.0),
+  bw_time(0.0),
+  coef_time(0.0),
+  pool_time(0.0),
+  cut_ncalls(0),
+  tabu_time(0.0)
 {
   // nothing to do here
 }
@@ -3746,7 +3680,39 @@ Cgl012Cut::Cgl012Cut (const Cgl012Cut & rhs) :
   errorNo(rhs.errorNo),
   sep_iter(rhs.sep_iter),
   vlog(NULL),
-  aggr(rhs.aggr)
+  aggr(rhs.aggr),
+  n(0),
+  m(0),
+  it(0),
+  cur_cut(NULL),
+  last_moved(NULL),
+  last_it_add(0),
+  last_it_restart(0),
+  prohib_period(0),
+  last_prohib_period_mod(0),
+  hash_tab(NULL),
+  A(0),
+  B(0),
+  coef_work_size(0),
+  coef_work(NULL),
+  path_work_size(0),
+  path_work(NULL),
+  pool(NULL),
+  max_score_ever(ZERO),
+  tot_basic_sep_time(0.0),
+  avg_basic_sep_time(0.0),
+  total_time(0.0),
+  prep_time(0.0),
+  weak_time(0.0),
+  aux_time(0.0),
+  path_time(0.0),
+  cycle_time(0.0),
+  cut_time(0.0),
+  bw_time(0.0),
+  coef_time(0.0),
+  pool_time(0.0),
+  cut_ncalls(0),
+  tabu_time(0.0)
 {
   if (rhs.p_ilp||rhs.vlog||inp_ilp)
     abort();  
@@ -3760,6 +3726,8 @@ Cgl012Cut::~Cgl012Cut ()
   free_log_var();
   free_parity_ilp();
   free_ilp();
+  free(coef_work);
+  free(path_work);
 }
 
 //----------------------------------------------------------------
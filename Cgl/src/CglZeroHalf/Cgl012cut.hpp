@@ -199,6 +199,39 @@ int n_it_zero; /* number of consecutive iterations (starting from the
                    last and going backward) in which each variable took
                    the value 0 in the LP solution */
 } log_var;
+/* data structure for the current local search solution */
+
+typedef struct {
+int n_of_constr; /* number of constraints in the current cut */
+short int *in_constr_list; /* flag saying whether a given constraint is
+			      in the list of constraints of the cut (IN)
+			      or not (OUT) */
+int *non_weak_coef; /* coefficients of the cut before weakening */
+int non_weak_rhs; /* coefficient of the rhs before weakening */
+double slack_sum; /* sum of the slacks of the constraints in the cut */
+double min_weak_loss; /* minimum loss by weakening the non even 
+			 coefficients */
+int one_norm; /* 1-norm of the lhs, i.e. sum of the absolute values of
+		 the coefficients */
+short int ok; /* logical flag telling whether the cut could be weakened
+		 to a 0-1/2 cut or not - if false the two fields below
+		 have no meaning */
+int *coef; /* actual coefficients of the cut */
+int rhs; /* actual rhs of the cut */
+double violation; /* violation of the cut */
+} tabu_cut;
+
+/* data structure for the hash table used in memory reaction */
+
+typedef struct h_e {
+int n_of_el; /* number of components to be considered */
+short int *flag_vect; /* vector of flags for the components */
+int last_vis; /* last iteration when this element was visited */
+struct h_e *next; /* pointer to the next element in the hash chain */
+} hash_element;
+
+typedef hash_element **hash_table;
+
 /** 012Cut Generator Class
 
  This class is to make Cgl01cut thread safe etc
@@ -414,6 +447,43 @@ double cut_score(
 
   void print_cur_cut();
   void print_cut_list(cut_list *cuts);
+/* local search helpers - they work on the tabu search state below */
+
+  void clear_cur_cut();
+  void initialize_cur_cut();
+  void free_cur_cut();
+  void initialize_hash_table();
+  void clear_hash_table();
+  void free_hash_table();
+  short int hash_search(int *cyc_len /* length of the cycle if the current cut is found */);
+  void hash_insert();
+  void increase_prohib_period();
+  void decrease_prohib_period();
+  short int allowed(int i /* constraint to be checked */);
+  short int in_cur_cut(int i /* constraint to be checked */);
+  void memory_reaction();
+  void free_memory();
+/* get_shortest_odd_cycle_list: computation of the shortest odd cycles
+   visiting node j */
+
+cycle_list *get_shortest_odd_cycle_list(
+					int j, /* first node to be visited by the odd cycle */
+					separation_graph *s_graph, /* current separation graph */
+					auxiliary_graph *a_graph /* auxiliary graph for the shortest path computation */
+					);
+/* cut pool management (only with POOL) */
+
+  void initialize_pool();
+  void free_pool();
+  void clean_pool();
+  void insert_cut_in_pool(pool_cut *p_cut);
+  short int cut_is_in_pool(cut *v_cut);
+  void add_cuts_to_pool(cut_list *out_cuts);
+  short int interesting_var(int j /* variable to be evaluated */);
+  cut_list *get_cuts_from_pool(short int after_sep);
+/* print_times: print the timings of the separation procedure (only with TIME) */
+
+  void print_times();
   //@}
 public:
   /**@name Constructors and destructors */
@@ -459,6 +529,51 @@ log_var **vlog; /* information about the value attained
 				  > 0 in a cut to be added */ 
 bool aggr; /* flag saying whether as many cuts as possible are required
 		   from the separation procedure (TRUE) or not (FALSE) */
+/* local search state - only meaningful inside tabu_012 */
+int n; /* number of variables in the ILP */
+int m; /* number of constraints in the ILP */
+int it; /* number of tabu search iterations so far */
+tabu_cut *cur_cut; /* information about the current cut in local search */
+int *last_moved; /* last iteration when a given constraint was added/
+		    deleted from the list of constraints of the cut */
+int last_it_add; /* last iteration when a cut was added to the list */
+int last_it_restart; /* last iteration when a restart was performed */
+int prohib_period; /* current prohibition period */
+int last_prohib_period_mod; /* last iteration where prohibition period was modified */
+hash_table hash_tab; /* hash table */
+int A; /* parameter A in Battiti and Protasi */
+int B; /* parameter B in Battiti and Protasi */
+/* scratch kept between calls to avoid allocating in inner loops */
+int coef_work_size; /* size of coef_work */
+int *coef_work; /* cut coefficients in get_cut */
+int path_work_size; /* number of nodes each arborescence in path_work can hold */
+short_path_node *path_work; /* forward and backward shortest path arborescences */
+/* cut pool (only with POOL) */
+pool_cut_list *pool; /* information about the cuts separated
+				      so far, used to decide when they should 
+				      be added to the current LP */
+double max_score_ever; /* maximum score of a violated cut during
+			  the whole cutting plane procedure */
+/* timings of the separation procedure (only with TIME) */
+float tot_basic_sep_time; /* total time spent for basic separation */
+float avg_basic_sep_time; /* average time per iteration spent for basic
+			     separation */
+float total_time; /* total time spent in the separation */
+float prep_time; /* time spent for the definition of the
+		    parity ILP data structure */
+float weak_time; /* time spent for the construction of the
+		    separation graph by weakening */
+float aux_time; /* time spent for the definition of the auxiliary graph */
+float path_time; /* time spent in the computation of the shortest paths */ 
+float cycle_time; /* time spent in the determination of the shortest cycles */ 
+float cut_time; /* time spent in the determination of the violated cuts */
+float bw_time; /* time spent in best_weakening */
+float coef_time; /* time spent in the initial computation of coef in get_cut */
+float pool_time; /* time spent for the addition and
+		    extraction of cuts from the pool */
+int cut_ncalls; /* number of calls to get_cut */
+float tabu_time; /* time spent within tabu search */
+float ti, tf, td, tti, ttf, tsi, tsf, tii, tff, tpi, tpf, ttabi, ttabf;
   //@}
 };
 #endif
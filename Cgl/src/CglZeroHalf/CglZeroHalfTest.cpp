@@ -10,6 +10,7 @@
 
 #include "CoinPragma.hpp"
 #include "CglZeroHalf.hpp" 
+#include "CglParallelCuts.hpp"
 //#include "CglKnapsackCover.hpp" 
 #include <stdio.h>
 
@@ -97,5 +98,38 @@ CglZeroHalfUnitTest(
 
   }
 
+  // Test several generators running at same time on lseu give
+  // exactly the cuts a single generator gives
+  {
+    OsiSolverInterface * siP = baseSiP->clone();
+    std::string fn = mpsDir+"lseu.mps";
+    siP->readMps(fn.c_str(),"");
+    siP->initialSolve();
+    CglZeroHalf serial;
+    serial.refreshSolver(siP);
+    OsiCuts serialCuts;
+    serial.generateCuts(*siP,serialCuts);
+    int nSerial = serialCuts.sizeRowCuts();
+
+    const int numberGenerators=8;
+    CglZeroHalf cg[numberGenerators];
+    CglParallelCuts parallel(4);
+    for (int i=0;i<numberGenerators;i++) {
+      cg[i].refreshSolver(siP);
+      parallel.addGenerator(cg+i);
+    }
+    for (int pass=0;pass<5;pass++) {
+      OsiCuts cuts;
+      parallel.generateCuts(*siP,cuts);
+      assert (cuts.sizeRowCuts()==numberGenerators*nSerial);
+      for (int i=0;i<numberGenerators;i++) {
+	assert (parallel.numberRowCuts(i)==nSerial);
+	for (int j=0;j<nSerial;j++) 
+	  assert (cuts.rowCut(i*nSerial+j)==serialCuts.rowCut(j));
+      }
+    }
+    delete siP;
+  }
+
 }
 
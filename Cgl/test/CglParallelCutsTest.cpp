@@ -0,0 +1,120 @@
+// $Id$
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdio>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "OsiSolverInterface.hpp"
+#include "OsiCuts.hpp"
+#include "CglParallelCuts.hpp"
+#include "CglKnapsackCover.hpp"
+#include "CglMixedIntegerRounding2.hpp"
+#include "CglTwomir.hpp"
+#include "CglClique.hpp"
+#include "CglProbing.hpp"
+
+//--------------------------------------------------------------------------
+// test CglParallelCuts
+void
+CglParallelCutsUnitTest(
+  const OsiSolverInterface * baseSiP,
+  const std::string mpsDir )
+{
+  // Test default constructor and copy & assignment
+  {
+    CglParallelCuts aGenerator;
+    CglParallelCuts rhs;
+    {
+      CglParallelCuts bGenerator(4);
+      CglKnapsackCover knapsack;
+      bGenerator.addGenerator(&knapsack);
+      CglParallelCuts cGenerator(bGenerator);
+      assert (cGenerator.numberGenerators()==1);
+      assert (cGenerator.generator(0)==&knapsack);
+      rhs=bGenerator;
+    }
+    assert (rhs.numberThreads()==4);
+  }
+
+  // Same cuts in same order as running generators one after another
+  {
+    const char * models[] = {"p0033","p0201","p0548"};
+    for (int iModel=0;iModel<3;iModel++) {
+      OsiSolverInterface  * siP = baseSiP->clone();
+      siP->messageHandler()->setLogLevel(0);
+      std::string fn = mpsDir+models[iModel];
+      siP->readMps(fn.c_str(),"mps");
+      siP->initialSolve();
+      /* probing is not thread safe so is run on calling thread
+	 between the others */
+      CglKnapsackCover knapsack;
+      CglMixedIntegerRounding2 mixed;
+      CglProbing probing;
+      CglTwomir twomir;
+      CglClique clique;
+      clique.setStarCliqueReport(false);
+      clique.setRowCliqueReport(false);
+      CglCutGenerator * prototype[] = {&knapsack,&mixed,&probing,
+				       &twomir,&clique};
+      int numberGenerators = 5;
+      // serial generation - each generator from a fresh copy
+      OsiCuts serial;
+      std::vector<int> numberRowCuts(numberGenerators);
+      std::vector<int> numberColumnCuts(numberGenerators);
+      {
+	OsiSolverInterface * solver = siP->clone();
+	solver->resolve();
+	for (int i=0;i<numberGenerators;i++) {
+	  CglCutGenerator * generator = prototype[i]->clone();
+	  OsiCuts cuts;
+	  generator->generateCuts(*solver,cuts);
+	  numberRowCuts[i] = cuts.sizeRowCuts();
+	  numberColumnCuts[i] = cuts.sizeColCuts();
+	  for (int j=0;j<numberRowCuts[i];j++)
+	    serial.insert(cuts.rowCut(j));
+	  for (int j=0;j<numberColumnCuts[i];j++)
+	    serial.insert(cuts.colCut(j));
+	  delete generator;
+	}
+	delete solver;
+      }
+      assert (serial.sizeRowCuts()>0);
+      for (int numberThreads=1;numberThreads<=4;numberThreads*=2) {
+	OsiSolverInterface * solver = siP->clone();
+	solver->resolve();
+	CglCutGenerator * generator[5];
+	CglParallelCuts parallel(numberThreads);
+	for (int i=0;i<numberGenerators;i++) {
+	  generator[i] = prototype[i]->clone();
+	  parallel.addGenerator(generator[i]);
+	}
+	OsiCuts cuts;
+	parallel.generateCuts(*solver,cuts);
+	assert (parallel.numberThreadsUsed()>=1);
+	assert (parallel.numberThreadsUsed()<=numberThreads);
+	for (int i=0;i<numberGenerators;i++) {
+	  assert (parallel.numberRowCuts(i)==numberRowCuts[i]);
+	  assert (parallel.numberColumnCuts(i)==numberColumnCuts[i]);
+	}
+	assert (cuts.sizeRowCuts()==serial.sizeRowCuts());
+	assert (cuts.sizeColCuts()==serial.sizeColCuts());
+	for (int i=0;i<serial.sizeRowCuts();i++)
+	  assert (cuts.rowCut(i)==serial.rowCut(i));
+	for (int i=0;i<serial.sizeColCuts();i++)
+	  assert (cuts.colCut(i)==serial.colCut(i));
+	for (int i=0;i<numberGenerators;i++)
+	  delete generator[i];
+	delete solver;
+      }
+      delete siP;
+    }
+  }
+}
@@ -39,6 +39,7 @@
 #include "CglOddHole.hpp"
 #include "CglProbing.hpp"
 #include "CglGomory.hpp"
+#include "CglGMI.hpp"
 #include "CglLandP.hpp"
 #include "CglMixedIntegerRounding.hpp"
 #include "CglMixedIntegerRounding2.hpp"
@@ -47,11 +48,22 @@
 #include "CglRedSplit2.hpp"
 #include "CglTwomir.hpp"
 #include "CglClique.hpp"
+#include "CglDuplicateRow.hpp"
 #include "CglFlowCover.hpp"
 #include "CglZeroHalf.hpp"
+#include "CglStored.hpp"
+#include "CglCutProfile.hpp"
+#include "CglCutPool.hpp"
+#include "CglPropagator.hpp"
+#include "CglParallelCuts.hpp"
+#include "CglWorkspace.hpp"
+#include "CglPreProcess.hpp"
 
 // Function Prototypes. Function definitions is in this file.
 void testingMessage( const char * const msg );
+// Tests generators run together against serial - in CglParallelCutsTest.cpp
+void CglParallelCutsUnitTest(const OsiSolverInterface * siP,
+			     const std::string mpsDir );
 
 // Command line parameters are directories containing data files.
 // You must specify both mpsDir and testDir, in order.
@@ -98,6 +110,11 @@ int main (int argc, const char *argv[])
     }
   }
 
+  {
+    testingMessage( "Testing CglWorkspace\n" );
+    CglWorkspaceUnitTest();
+  }
+
 #ifdef COIN_HAS_OSICPX
   {
     OsiCpxSolverInterface cpxSi;
@@ -284,6 +301,11 @@ int main (int argc, const char *argv[])
     testingMessage( "Testing CglRedSplit2 with OsiClpSolverInterface\n" );
     CglRedSplit2UnitTest(&clpSi, mpsDir);
   }
+  {
+    OsiClpSolverInterface clpSi;
+    testingMessage( "Testing CglGMI with OsiClpSolverInterface\n" );
+    CglGMIUnitTest(&clpSi, mpsDir);
+  }
   {
     OsiClpSolverInterface clpSi;
     testingMessage( "Testing CglTwomir with OsiClpSolverInterface\n" );
@@ -304,6 +326,41 @@ int main (int argc, const char *argv[])
     testingMessage( "Testing CglZeroHalf with OsiClpSolverInterface\n" );
     CglZeroHalfUnitTest(&clpSi, testDir);
   }
+  {
+    OsiClpSolverInterface clpSi;
+    testingMessage( "Testing CglDuplicateRow with OsiClpSolverInterface\n" );
+    CglDuplicateRowUnitTest(&clpSi,mpsDir);
+  }
+  {
+    OsiClpSolverInterface clpSi;
+    testingMessage( "Testing CglStored with OsiClpSolverInterface\n" );
+    CglStoredUnitTest(&clpSi,mpsDir);
+  }
+  {
+    OsiClpSolverInterface clpSi;
+    testingMessage( "Testing CglCutProfile with OsiClpSolverInterface\n" );
+    CglCutProfileUnitTest(&clpSi,mpsDir);
+  }
+  {
+    OsiClpSolverInterface clpSi;
+    testingMessage( "Testing CglCutPool with OsiClpSolverInterface\n" );
+    CglCutPoolUnitTest(&clpSi,mpsDir);
+  }
+  {
+    OsiClpSolverInterface clpSi;
+    testingMessage( "Testing CglPropagator with OsiClpSolverInterface\n" );
+    CglPropagatorUnitTest(&clpSi,mpsDir);
+  }
+  {
+    OsiClpSolverInterface clpSi;
+    testingMessage( "Testing CglParallelCuts with OsiClpSolverInterface\n" );
+    CglParallelCutsUnitTest(&clpSi,mpsDir);
+  }
+  {
+    OsiClpSolverInterface clpSi;
+    testingMessage( "Testing CglPreProcess with OsiClpSolverInterface\n" );
+    CglPreProcessUnitTest(&clpSi,mpsDir);
+  }
 
 #endif
 #ifdef COIN_HAS_OSIDYLP
@@ -0,0 +1,125 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/* Compares serial and parallel Abc dual simplex.
+   Needs Clp configured with --enable-aboca=2 (serial) or 4 (parallel).
+
+   abcDual [-threads n] [-repeat n] [model ...]
+
+   Models are MPS files (the .mps may be left off).  With no models a
+   few from Data/Sample are used.
+*/
+#include "ClpConfig.h"
+#include "ClpSimplex.hpp"
+#include "ClpSolve.hpp"
+#include "CoinTime.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#if CLP_HAS_ABC
+#include "AbcCommon.hpp"
+#endif
+
+int main(int argc, const char *argv[])
+{
+#ifdef ABC_INHERIT
+     int numberThreads = 4;
+     int numberRepeats = 3;
+     std::vector<std::string> names;
+     for (int i = 1; i < argc; i++) {
+          if (!strcmp(argv[i], "-threads") && i + 1 < argc)
+               numberThreads = atoi(argv[++i]);
+          else if (!strcmp(argv[i], "-repeat") && i + 1 < argc)
+               numberRepeats = atoi(argv[++i]);
+          else
+               names.push_back(argv[i]);
+     }
+     if (names.empty()) {
+#if defined(SAMPLEDIR)
+          const char * sample[] = {"e226", "brandy", "finnis", "p0548",
+                                   "retail3", "atm_5_10_1", "wedding_16"};
+          for (int i = 0; i < static_cast<int>(sizeof(sample) / sizeof(char *)); i++)
+               names.push_back(std::string(SAMPLEDIR "/") + sample[i]);
+#else
+          fprintf(stderr, "Do not know where to find sample MPS files.\n");
+          exit(1);
+#endif
+     }
+#if ABC_PARALLEL
+     const int numberModes = 2;
+#else
+     const int numberModes = 1;
+     printf("Abc was built serial - only serial times\n");
+#endif
+     printf("%-16s %6s %6s %8s %8s %20s\n", "model", "rows", "threads",
+            "iters", "seconds", "objective");
+     double totalTime[2] = {0.0, 0.0};
+     int numberDifferent = 0;
+     for (size_t iModel = 0; iModel < names.size(); iModel++) {
+          ClpSimplex model;
+          model.setLogLevel(0);
+          std::string fileName = names[iModel];
+          FILE * fp = fopen(fileName.c_str(), "r");
+          if (fp)
+               fclose(fp);
+          else
+               fileName += ".mps";
+          if (model.readMps(fileName.c_str(), true)) {
+               printf("Unable to read %s\n", names[iModel].c_str());
+               continue;
+          }
+          std::string shortName = names[iModel];
+          size_t slash = shortName.find_last_of("/\\");
+          if (slash != std::string::npos)
+               shortName = shortName.substr(slash + 1);
+          // dual from slack basis as "clp -abc n -dualS" would do
+          ClpSolve solveOptions;
+          solveOptions.setSolveType(ClpSolve::useDual);
+          solveOptions.setPresolveType(ClpSolve::presolveOff);
+          double objective[2];
+          for (int iMode = 0; iMode < numberModes; iMode++) {
+               int threads = iMode ? numberThreads : 1;
+               double best = COIN_DBL_MAX;
+               int iterations = 0;
+               for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+                    ClpSimplex solver(model);
+                    // low bits are number of cpus
+                    solver.setAbcState(threads);
+                    double time1 = CoinGetTimeOfDay();
+                    solver.initialSolve(solveOptions);
+                    double time2 = CoinGetTimeOfDay() - time1;
+                    if (time2 < best)
+                         best = time2;
+                    iterations = solver.numberIterations();
+                    objective[iMode] = solver.objectiveValue();
+                    if (solver.problemStatus())
+                         printf("%s status %d\n", shortName.c_str(),
+                                solver.problemStatus());
+               }
+               totalTime[iMode] += best;
+               printf("%-16s %6d %6d %8d %8.4f %20.10g\n", shortName.c_str(),
+                      model.numberRows(), threads, iterations, best,
+                      objective[iMode]);
+          }
+          if (numberModes == 2 &&
+                    fabs(objective[0] - objective[1]) > 1.0e-7 * (1.0 + fabs(objective[0]))) {
+               printf("%s objectives differ\n", shortName.c_str());
+               numberDifferent++;
+          }
+     }
+     if (numberModes == 2)
+          printf("Total seconds serial %.4f, %d threads %.4f\n", totalTime[0],
+                 numberThreads, totalTime[1]);
+     else
+          printf("Total seconds %.4f\n", totalTime[0]);
+     return numberDifferent ? 1 : 0;
+#else
+     printf("Clp was built without Abc - configure with --enable-aboca=4\n");
+     return 0;
+#endif
+}
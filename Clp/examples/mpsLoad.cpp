@@ -0,0 +1,156 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/* Load throughput of CoinMpsIO::readMps card by card and in blocks.
+
+   mpsLoad [-threads n] [-repeat n] [model ...]
+
+   Models are MPS files, possibly compressed (the .mps may be left off).
+   With no models a few from Data/Sample are used.  Each is read card by
+   card and then with n threads and the two problems are checked to be
+   identical.
+*/
+#include "CoinFinite.hpp"
+#include "CoinMpsIO.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinTime.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Returns true if both read same problem
+static bool sameProblem(CoinMpsIO & m1, CoinMpsIO & m2)
+{
+     int numberRows = m1.getNumRows();
+     int numberColumns = m1.getNumCols();
+     int numberElements = m1.getNumElements();
+     if (m2.getNumRows() != numberRows || m2.getNumCols() != numberColumns ||
+               m2.getNumElements() != numberElements ||
+               m2.objectiveOffset() != m1.objectiveOffset() ||
+               strcmp(m2.getProblemName(), m1.getProblemName()) ||
+               strcmp(m2.getObjectiveName(), m1.getObjectiveName()) ||
+               strcmp(m2.getRhsName(), m1.getRhsName()) ||
+               strcmp(m2.getRangeName(), m1.getRangeName()) ||
+               strcmp(m2.getBoundName(), m1.getBoundName()))
+          return false;
+     for (int i = 0; i < numberRows; i++) {
+          if (strcmp(m2.rowName(i), m1.rowName(i)) ||
+                    m2.getRowLower()[i] != m1.getRowLower()[i] ||
+                    m2.getRowUpper()[i] != m1.getRowUpper()[i])
+               return false;
+     }
+     for (int i = 0; i < numberColumns; i++) {
+          if (strcmp(m2.columnName(i), m1.columnName(i)) ||
+                    m2.getColLower()[i] != m1.getColLower()[i] ||
+                    m2.getColUpper()[i] != m1.getColUpper()[i] ||
+                    m2.getObjCoefficients()[i] != m1.getObjCoefficients()[i] ||
+                    m2.isInteger(i) != m1.isInteger(i))
+               return false;
+     }
+     const CoinPackedMatrix * matrix1 = m1.getMatrixByCol();
+     const CoinPackedMatrix * matrix2 = m2.getMatrixByCol();
+     return !memcmp(matrix1->getVectorStarts(), matrix2->getVectorStarts(),
+                    (numberColumns + 1) * sizeof(CoinBigIndex)) &&
+            !memcmp(matrix1->getIndices(), matrix2->getIndices(),
+                    numberElements * sizeof(int)) &&
+            !memcmp(matrix1->getElements(), matrix2->getElements(),
+                    numberElements * sizeof(double));
+}
+
+int main(int argc, const char *argv[])
+{
+     int numberThreads = 4;
+     int numberRepeats = 3;
+     std::vector<std::string> names;
+     for (int i = 1; i < argc; i++) {
+          if (!strcmp(argv[i], "-threads") && i + 1 < argc)
+               numberThreads = atoi(argv[++i]);
+          else if (!strcmp(argv[i], "-repeat") && i + 1 < argc)
+               numberRepeats = atoi(argv[++i]);
+          else
+               names.push_back(argv[i]);
+     }
+     if (names.empty()) {
+#if defined(SAMPLEDIR)
+          const char * sample[] = {"e226", "finnis", "p0548", "nw460",
+                                   "retail3", "atm_5_10_1", "wedding_16"};
+          for (int i = 0; i < static_cast<int>(sizeof(sample) / sizeof(char *)); i++)
+               names.push_back(std::string(SAMPLEDIR "/") + sample[i]);
+#else
+          fprintf(stderr, "Do not know where to find sample MPS files.\n");
+          exit(1);
+#endif
+     }
+     printf("%-16s %10s %8s %8s %10s\n", "model", "bytes", "threads",
+            "seconds", "MB/s");
+     double totalBytes = 0.0;
+     double totalTime[2] = {0.0, 0.0};
+     int numberDifferent = 0;
+     for (size_t iModel = 0; iModel < names.size(); iModel++) {
+          std::string fileName = names[iModel];
+          FILE * fp = fopen(fileName.c_str(), "r");
+          if (!fp) {
+               fileName += ".mps";
+               fp = fopen(fileName.c_str(), "r");
+          }
+          if (!fp) {
+               printf("Unable to open %s\n", names[iModel].c_str());
+               continue;
+          }
+          fseek(fp, 0, SEEK_END);
+          double bytes = static_cast<double>(ftell(fp));
+          fclose(fp);
+          std::string shortName = names[iModel];
+          size_t slash = shortName.find_last_of("/\\");
+          if (slash != std::string::npos)
+               shortName = shortName.substr(slash + 1);
+          CoinMpsIO models[2];
+          bool readOk = true;
+          for (int iMode = 0; iMode < 2; iMode++) {
+               int threads = iMode ? numberThreads : 0;
+               double best = COIN_DBL_MAX;
+               for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+                    CoinMpsIO m;
+                    m.messageHandler()->setLogLevel(0);
+                    m.setNumberReadThreads(threads);
+                    double time1 = CoinGetTimeOfDay();
+                    int numberErrors = m.readMps(fileName.c_str(), "");
+                    double time2 = CoinGetTimeOfDay() - time1;
+                    if (numberErrors) {
+                         printf("%s has %d errors\n", shortName.c_str(),
+                                numberErrors);
+                         readOk = false;
+                         break;
+                    }
+                    if (time2 < best)
+                         best = time2;
+                    if (!iRepeat) {
+                         models[iMode].messageHandler()->setLogLevel(0);
+                         models[iMode].setNumberReadThreads(threads);
+                         models[iMode].readMps(fileName.c_str(), "");
+                    }
+               }
+               if (!readOk)
+                    break;
+               totalTime[iMode] += best;
+               printf("%-16s %10.0f %8d %8.4f %10.2f\n", shortName.c_str(),
+                      bytes, threads, best, 1.0e-6 * bytes / best);
+          }
+          if (!readOk)
+               continue;
+          totalBytes += bytes;
+          if (!sameProblem(models[0], models[1])) {
+               printf("%s problems differ\n", shortName.c_str());
+               numberDifferent++;
+          }
+     }
+     if (totalTime[0] > 0.0 && totalTime[1] > 0.0)
+          printf("Total MB/s card by card %.2f, %d threads %.2f\n",
+                 1.0e-6 * totalBytes / totalTime[0], numberThreads,
+                 1.0e-6 * totalBytes / totalTime[1]);
+     return numberDifferent ? 1 : 0;
+}
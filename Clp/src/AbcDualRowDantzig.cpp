@@ -131,19 +131,53 @@ AbcDualRowDantzig::recomputeInfeasibilities()
   }
 }
 #if ABC_PARALLEL==2
-static void choose(CoinIndexedVector * infeasible,
+#define DO_REDUCE
+static void choose(const AbcSimplex * model,CoinIndexedVector * infeasible,
+		   int & chosenRowSave,double & largestSave, int first, int last,
+		   double tolerance);
+#ifdef ABC_TASK_POOL
+// First half of choose done by another thread
+class AbcChooseTask : public ClpTask {
+public:
+  AbcChooseTask(const AbcSimplex * model,CoinIndexedVector * infeasible,
+		int & chosenRow,double & largest, int first, int last,
+		double tolerance)
+    : model_(model), infeasible_(infeasible), chosenRow_(chosenRow),
+      largest_(largest), first_(first), last_(last), tolerance_(tolerance) {}
+  virtual void run()
+  { choose(model_,infeasible_,chosenRow_,largest_,first_,last_,tolerance_);}
+private:
+  const AbcSimplex * model_;
+  CoinIndexedVector * infeasible_;
+  int & chosenRow_;
+  double & largest_;
+  int first_;
+  int last_;
+  double tolerance_;
+};
+#endif
+static void choose(const AbcSimplex * model,CoinIndexedVector * infeasible,
 		   int & chosenRowSave,double & largestSave, int first, int last,
 		   double tolerance)
 {
-  if (last-first>256) {
+  if (last-first>ABC_SPAWN_SIZE) {
     int mid=(last+first)>>1;
     int chosenRow2=chosenRowSave;
     double largest2=largestSave;
-    cilk_spawn choose(infeasible,chosenRow2,largest2, first, mid,
+#ifndef ABC_TASK_POOL
+    cilk_spawn choose(model,infeasible,chosenRow2,largest2, first, mid,
 		      tolerance);
-    choose(infeasible,chosenRowSave,largestSave, mid, last,
+    choose(model,infeasible,chosenRowSave,largestSave, mid, last,
 	   tolerance);
     cilk_sync;
+#else
+    AbcChooseTask task(model,infeasible,chosenRow2,largest2,first,mid,
+		       tolerance);
+    model->spawn(&task);
+    choose(model,infeasible,chosenRowSave,largestSave, mid, last,
+	   tolerance);
+    model->sync(&task);
+#endif
     if (largest2>largestSave) {
       largestSave=largest2;
       chosenRowSave=chosenRow2;
@@ -210,7 +244,7 @@ AbcDualRowDantzig::pivotRow()
       int end = CoinMin(endThis,startThis+numberWanted);
 #ifdef DO_REDUCE 
       if (doReduce) {
-	choose(infeasible,chosenRow,largest,startThis,end,tolerance);
+	choose(model_,infeasible_,chosenRow,largest,startThis,end,tolerance);
 	if (chosenRow!=lastChosen) {
 	  assert (chosenRow>=0);
 	  if (model_->flagged(pivotVariable[chosenRow])||
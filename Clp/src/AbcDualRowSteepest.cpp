@@ -191,19 +191,51 @@ static void choose(int & chosenRow,double & largest, int n,
   largest=maximumIndex.get_value();
 }
 #else
+#ifdef ABC_TASK_POOL
+typedef void (*AbcChooseFunction)(AbcDualRowSteepest * steepest,
+				  int & chosenRow,double & largest,
+				  int first, int last, double tolerance);
+// First half of choose done by another thread
+class AbcChooseTask : public ClpTask {
+public:
+  AbcChooseTask(AbcChooseFunction function,AbcDualRowSteepest * steepest,
+		int & chosenRow,double & largest, int first, int last,
+		double tolerance)
+    : function_(function), steepest_(steepest), chosenRow_(chosenRow),
+      largest_(largest), first_(first), last_(last), tolerance_(tolerance) {}
+  virtual void run()
+  { function_(steepest_,chosenRow_,largest_,first_,last_,tolerance_);}
+private:
+  AbcChooseFunction function_;
+  AbcDualRowSteepest * steepest_;
+  int & chosenRow_;
+  double & largest_;
+  int first_;
+  int last_;
+  double tolerance_;
+};
+#endif
 static void choose(AbcDualRowSteepest * steepest,
 		   int & chosenRowSave,double & largestSave, int first, int last,
 		   double tolerance)
 {
-  if (last-first>256) {
+  if (last-first>ABC_SPAWN_SIZE) {
     int mid=(last+first)>>1;
     int chosenRow2=chosenRowSave;
     double largest2=largestSave;
+#ifndef ABC_TASK_POOL
     cilk_spawn choose(steepest,chosenRow2,largest2, first, mid,
 		      tolerance);
     choose(steepest,chosenRowSave,largestSave, mid, last,
 	   tolerance);
     cilk_sync;
+#else
+    AbcChooseTask task(choose,steepest,chosenRow2,largest2,first,mid,tolerance);
+    steepest->model()->spawn(&task);
+    choose(steepest,chosenRowSave,largestSave, mid, last,
+	   tolerance);
+    steepest->model()->sync(&task);
+#endif
     if (largest2>largestSave) {
       largestSave=largest2;
       chosenRowSave=chosenRow2;
@@ -258,15 +290,23 @@ static void choose2(AbcDualRowSteepest * steepest,
 		   int & chosenRowSave,double & largestSave, int first, int last,
 		   double tolerance)
 {
-  if (last-first>256) {
+  if (last-first>ABC_SPAWN_SIZE) {
     int mid=(last+first)>>1;
     int chosenRow2=chosenRowSave;
     double largest2=largestSave;
+#ifndef ABC_TASK_POOL
     cilk_spawn choose2(steepest,chosenRow2,largest2, first, mid,
 		      tolerance);
     choose2(steepest,chosenRowSave,largestSave, mid, last,
 	   tolerance);
     cilk_sync;
+#else
+    AbcChooseTask task(choose2,steepest,chosenRow2,largest2,first,mid,tolerance);
+    steepest->model()->spawn(&task);
+    choose2(steepest,chosenRowSave,largestSave, mid, last,
+	   tolerance);
+    steepest->model()->sync(&task);
+#endif
     if (largest2>largestSave) {
       largestSave=largest2;
       chosenRowSave=chosenRow2;
@@ -913,7 +953,52 @@ AbcDualRowSteepest::updatePrimalSolution(
   primalUpdate.setNumElements(0);
 }
 #if ABC_PARALLEL==2
-static void update(int first, int last,
+static void update(const AbcSimplex * model,int first, int last,
+		   const int * COIN_RESTRICT which, double * COIN_RESTRICT work, 
+		   const double * COIN_RESTRICT work2, double * COIN_RESTRICT weights,
+		   const double * COIN_RESTRICT lowerBasic,double * COIN_RESTRICT solutionBasic,
+		   const double * COIN_RESTRICT upperBasic,
+		   double multiplier,double multiplier2,
+		   double norm,double theta,double tolerance);
+#ifdef ABC_TASK_POOL
+// First half of update done by another thread
+class AbcUpdateTask : public ClpTask {
+public:
+  AbcUpdateTask(const AbcSimplex * model,int first, int last,
+		const int * which, double * work, 
+		const double * work2, double * weights,
+		const double * lowerBasic,double * solutionBasic,
+		const double * upperBasic,
+		double multiplier,double multiplier2,
+		double norm,double theta,double tolerance)
+    : model_(model), first_(first), last_(last), which_(which), work_(work),
+      work2_(work2), weights_(weights), lowerBasic_(lowerBasic),
+      solutionBasic_(solutionBasic), upperBasic_(upperBasic),
+      multiplier_(multiplier), multiplier2_(multiplier2), norm_(norm),
+      theta_(theta), tolerance_(tolerance) {}
+  virtual void run()
+  { update(model_,first_,last_,which_,work_,work2_,weights_,lowerBasic_,
+	   solutionBasic_,upperBasic_,multiplier_,multiplier2_,norm_,theta_,
+	   tolerance_);}
+private:
+  const AbcSimplex * model_;
+  int first_;
+  int last_;
+  const int * which_;
+  double * work_;
+  const double * work2_;
+  double * weights_;
+  const double * lowerBasic_;
+  double * solutionBasic_;
+  const double * upperBasic_;
+  double multiplier_;
+  double multiplier2_;
+  double norm_;
+  double theta_;
+  double tolerance_;
+};
+#endif
+static void update(const AbcSimplex * model,int first, int last,
 		   const int * COIN_RESTRICT which, double * COIN_RESTRICT work, 
 		   const double * COIN_RESTRICT work2, double * COIN_RESTRICT weights,
 		   const double * COIN_RESTRICT lowerBasic,double * COIN_RESTRICT solutionBasic,
@@ -921,13 +1006,23 @@ static void update(int first, int last,
 		   double multiplier,double multiplier2,
 		   double norm,double theta,double tolerance)
 {
-  if (last-first>256) {
+  if (last-first>ABC_SPAWN_SIZE) {
     int mid=(last+first)>>1;
-    cilk_spawn update(first,mid,which,work,work2,weights,lowerBasic,solutionBasic,
+#ifndef ABC_TASK_POOL
+    cilk_spawn update(model,first,mid,which,work,work2,weights,lowerBasic,solutionBasic,
 		      upperBasic,multiplier,multiplier2,norm,theta,tolerance);
-    update(mid,last,which,work,work2,weights,lowerBasic,solutionBasic,
+    update(model,mid,last,which,work,work2,weights,lowerBasic,solutionBasic,
 	   upperBasic,multiplier,multiplier2,norm,theta,tolerance);
     cilk_sync;
+#else
+    AbcUpdateTask task(model,first,mid,which,work,work2,weights,lowerBasic,
+		       solutionBasic,upperBasic,multiplier,multiplier2,norm,
+		       theta,tolerance);
+    model->spawn(&task);
+    update(model,mid,last,which,work,work2,weights,lowerBasic,solutionBasic,
+	   upperBasic,multiplier,multiplier2,norm,theta,tolerance);
+    model->sync(&task);
+#endif
   } else {
     for (int i = first; i < last; i++) {
       int iRow = which[i];
@@ -1021,7 +1116,7 @@ AbcDualRowSteepest::updatePrimalSolutionAndWeights(CoinIndexedVector & weightsVe
     multiplier2=-1.0;
   }
 #if ABC_PARALLEL==2
-  update(0,numberNonZero,which,work,work2,weights,
+  update(model_,0,numberNonZero,which,work,work2,weights,
 	 lowerBasic,solutionBasic,upperBasic,
 	 multiplier,multiplier2,norm_,theta,tolerance);
   for (int i = 0; i < numberNonZero; i++) {
@@ -1105,7 +1200,7 @@ AbcDualRowSteepest::updatePrimalSolutionAndWeights(CoinIndexedVector & weightsVe
     infeas[pivotRow] = COIN_INDEXED_REALLY_TINY_ELEMENT;
   // see 1/2 above primalUpdate.setNumElements(0);
 }
-extern void parallelDual5(AbcSimplexFactorization * factorization,
+extern void parallelDual5(AbcSimplex * model,
 			 CoinIndexedVector ** whichVector,
 			 int numberCpu,
 			 int whichCpu,
@@ -1251,7 +1346,7 @@ AbcDualRowSteepest::saveWeights(AbcSimplex * model, int mode)
 	    assert(!whichVector[i]->packedMode());
 	  }
 	  whichVector[numberCpuMinusOne]=savedWeights_;
-	  parallelDual5(model_->factorization(),whichVector,numberCpuMinusOne+1,numberCpuMinusOne,weights);
+	  parallelDual5(model_,whichVector,numberCpuMinusOne+1,numberCpuMinusOne,weights);
 	  for (int i=0;i<numberCpuMinusOne;i++) 
 	    model_->clearArrays(which[i]);
 	}
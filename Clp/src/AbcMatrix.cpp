@@ -2421,6 +2421,21 @@ AbcMatrix::primalColumnRow(int iBlock,bool doByRow,const CoinIndexedVector & upd
   tableauRow.setNumElementsPartition(iBlock,numberNonZero);
   return numberSlacks;
 }
+#ifdef ABC_TASK_POOL
+// Block of pivotColumnDantzig for another thread
+class AbcPivotColumnTask : public ClpTask {
+public:
+  virtual void run()
+  { sequence=matrix->pivotColumnDantzig(iBlock,doByRow,*updates,*spare,best);}
+  const AbcMatrix * matrix;
+  const CoinIndexedVector * updates;
+  CoinPartitionedVector * spare;
+  double best;
+  int iBlock;
+  int sequence;
+  bool doByRow;
+};
+#endif
 // Get sequenceIn when Dantzig
  int 
 AbcMatrix::pivotColumnDantzig(const CoinIndexedVector & updates,
@@ -2456,11 +2471,30 @@ AbcMatrix::pivotColumnDantzig(const CoinIndexedVector & updates,
    spare.setPartitions(numberBlocks,starts);
    int which[NUMBER_BLOCKS];
    double best[NUMBER_BLOCKS];
+#ifndef ABC_TASK_POOL
    for (int i=0;i<numberBlocks-1;i++) 
      which[i]=cilk_spawn pivotColumnDantzig(i,useRowCopy,updates,spare,best[i]); 
    which[numberBlocks-1]=pivotColumnDantzig(numberBlocks-1,useRowCopy,updates,
 						       spare,best[numberBlocks-1]);
    cilk_sync;
+#else
+   AbcPivotColumnTask task[NUMBER_BLOCKS];
+   for (int i=0;i<numberBlocks-1;i++) {
+     task[i].matrix=this;
+     task[i].updates=&updates;
+     task[i].spare=&spare;
+     task[i].iBlock=i;
+     task[i].doByRow=useRowCopy;
+     model_->spawn(task+i);
+   }
+   which[numberBlocks-1]=pivotColumnDantzig(numberBlocks-1,useRowCopy,updates,
+						       spare,best[numberBlocks-1]);
+   for (int i=0;i<numberBlocks-1;i++) {
+     model_->sync(task+i);
+     which[i]=task[i].sequence;
+     best[i]=task[i].best;
+   }
+#endif
    int bestSequence=-1;
    double bestValue=model_->dualTolerance();
    for (int i=0;i<numberBlocks;i++) {
@@ -3127,6 +3161,39 @@ AbcMatrix::chooseBestDj(int iBlock,const CoinIndexedVector & infeasibilities,
    otherwise use updateForDjs
    Returns best
 */
+#ifdef ABC_TASK_POOL
+// Block of primalColumnDouble for another thread
+class AbcPrimalColumnTask : public ClpTask {
+public:
+  virtual void run()
+  { 
+    if (sparse)
+      sequence=matrix->primalColumnSparseDouble(iBlock,*updateForTableauRow,*updateForDjs,
+				       *updateForWeights,*spareColumn1,
+				       infeasibilities,referenceIn,devex,
+				       reference,weights,scaleFactor);
+    else
+      sequence=matrix->primalColumnDouble(iBlock,*updateForTableauRow,*updateForDjs,
+				 *updateForWeights,*spareColumn1,
+				 infeasibilities,referenceIn,devex,
+				 reference,weights,scaleFactor);
+  }
+  const AbcMatrix * matrix;
+  CoinPartitionedVector * updateForTableauRow;
+  CoinPartitionedVector * updateForDjs;
+  const CoinIndexedVector * updateForWeights;
+  CoinPartitionedVector * spareColumn1;
+  double * infeasibilities;
+  double referenceIn;
+  double devex;
+  unsigned int * reference;
+  double * weights;
+  double scaleFactor;
+  int iBlock;
+  int sequence;
+  bool sparse;
+};
+#endif
 int
 AbcMatrix::primalColumnDouble(CoinPartitionedVector & updateForTableauRow,
 			      CoinPartitionedVector & updateForDjs,
@@ -3163,6 +3230,7 @@ AbcMatrix::primalColumnDouble(CoinPartitionedVector & updateForTableauRow,
      starts=startColumnBlock_;
      numberBlocks=numberColumnBlocks_;
    }
+#ifndef ABC_TASK_POOL
    if (useRowCopy) {
      for (int i=0;i<numberBlocks;i++) 
 #ifdef PRICE_IN_ABC_MATRIX
@@ -3182,6 +3250,33 @@ AbcMatrix::primalColumnDouble(CoinPartitionedVector & updateForTableauRow,
 				       infeasibilities,referenceIn,devex,reference,weights,scaleFactor);
      cilk_sync;
    }
+#else
+   AbcPrimalColumnTask task[NUMBER_BLOCKS];
+   for (int i=0;i<numberBlocks;i++) {
+     task[i].matrix=this;
+     task[i].updateForTableauRow=&updateForTableauRow;
+     task[i].updateForDjs=&updateForDjs;
+     task[i].updateForWeights=&updateForWeights;
+     task[i].spareColumn1=&spareColumn1;
+     task[i].infeasibilities=infeasibilities;
+     task[i].referenceIn=referenceIn;
+     task[i].devex=devex;
+     task[i].reference=reference;
+     task[i].weights=weights;
+     task[i].scaleFactor=scaleFactor;
+     task[i].iBlock=i;
+     task[i].sparse=useRowCopy;
+     if (i<numberBlocks-1)
+       model_->spawn(task+i);
+   }
+   task[numberBlocks-1].run();
+   for (int i=0;i<numberBlocks-1;i++) 
+     model_->sync(task+i);
+#ifdef PRICE_IN_ABC_MATRIX
+   for (int i=0;i<numberBlocks;i++) 
+     which[i]=task[i].sequence;
+#endif
+#endif
 #ifdef PRICE_IN_ABC_MATRIX
    double bestValue=model_->dualTolerance();
    int sequenceIn[8]={-1,-1,-1,-1,-1,-1,-1,-1};
@@ -59,6 +59,9 @@ class AbcTolerancesEtc;
 // Use pthreads
 #include <pthread.h>
 #endif
+#ifdef ABC_TASK_POOL
+#include "ClpTaskPool.hpp"
+#endif
 typedef struct {
   double result;
   //const CoinIndexedVector * constVector; // can get rid of
@@ -760,6 +763,17 @@ public:
   /// Number of cpus
   inline int numberCpus() const
   { return parallelMode_+1;}
+#ifdef ABC_TASK_POOL
+  /// Threads for spawned work (NULL if not solving in parallel)
+  inline ClpTaskPool * taskPool() const
+  { return taskPool_;}
+  /// Spawns task (or just runs it if no pool)
+  inline void spawn(ClpTask * task) const
+  { if (taskPool_) taskPool_->spawn(task); else task->run();}
+  /// Returns when spawned task has finished
+  inline void sync(ClpTask * task) const
+  { if (taskPool_) taskPool_->sync(task);}
+#endif
 #if ABC_PARALLEL==1
   /// set stop start
   inline void setStopStart(int value)
@@ -1232,6 +1246,10 @@ protected:
       analysis.  If it doesn't work it can easily be replaced.
   */
   AbcNonLinearCost * abcNonLinearCost_;
+#ifdef ABC_TASK_POOL
+  /// Threads for spawned work (only while solving)
+  ClpTaskPool * taskPool_;
+#endif
   /// Useful arrays (all of row+column+2 length)
   /* has secondary offset and counts so row goes first then column
      Probably back to CoinPartitionedVector as AbcMatrix has slacks
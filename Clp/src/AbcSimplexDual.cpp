@@ -560,15 +560,42 @@ static void updateDualsInDualBit2(CoinPartitionedVector & row,
   }
   row.setNumElementsPartition(iBlock,0);
 }
-static void updateDualsInDualBit(CoinPartitionedVector & row,
+#ifdef ABC_TASK_POOL
+// Block of updateDualsInDual for another thread
+class AbcUpdateDualsTask : public ClpTask {
+public:
+  virtual void run()
+  { updateDualsInDualBit2(*row,djs,theta,iBlock);}
+  CoinPartitionedVector * row;
+  double * djs;
+  double theta;
+  int iBlock;
+};
+#endif
+static void updateDualsInDualBit(const AbcSimplex * model,
+				 CoinPartitionedVector & row,
 				 double * djs,
 				 double theta, int numberBlocks)
 {
+#ifndef ABC_TASK_POOL
   for (int iBlock=1;iBlock<numberBlocks;iBlock++) {
     cilk_spawn updateDualsInDualBit2(row,djs,theta,iBlock);
   }
   updateDualsInDualBit2(row,djs,theta,0);
   cilk_sync;
+#else
+  AbcUpdateDualsTask task[NUMBER_ROW_BLOCKS];
+  for (int iBlock=1;iBlock<numberBlocks;iBlock++) {
+    task[iBlock].row=&row;
+    task[iBlock].djs=djs;
+    task[iBlock].theta=theta;
+    task[iBlock].iBlock=iBlock;
+    model->spawn(task+iBlock);
+  }
+  updateDualsInDualBit2(row,djs,theta,0);
+  for (int iBlock=1;iBlock<numberBlocks;iBlock++) 
+    model->sync(task+iBlock);
+#endif
 }
 /// The duals are updated by the given arrays.
    
@@ -582,7 +609,7 @@ AbcSimplexDual::updateDualsInDual()
   int number=array.getNumElements();
   if(numberBlocks) {
     if (number>100) {
-      updateDualsInDualBit(array,abcDj_,theta_,numberBlocks);
+      updateDualsInDualBit(this,array,abcDj_,theta_,numberBlocks);
     } else {
       for (int iBlock=0;iBlock<numberBlocks;iBlock++) {
 	updateDualsInDualBit2(array,abcDj_,theta_,iBlock);
@@ -1466,6 +1493,16 @@ static void dualColumn2Bit(AbcSimplexDual * dual,dualColumnResult * result,
   dual->dualColumn2First(result[0]);
   cilk_sync;
 }
+#ifdef ABC_TASK_POOL
+// Block of dualColumn2 for another thread
+class AbcDualColumnTask : public ClpTask {
+public:
+  virtual void run()
+  { dual->dualColumn2First(*result);}
+  AbcSimplexDual * dual;
+  dualColumnResult * result;
+};
+#endif
 void
 AbcSimplexDual::dualColumn2First(dualColumnResult & result)
 {
@@ -1633,11 +1670,23 @@ AbcSimplexDual::dualColumn2Most(dualColumnResult & result)
       //result2[iBlock].numberSwapped=numberSwapped;
       //result2[iBlock].numberLastSwapped=numberLastSwapped;
     }
+#ifndef ABC_TASK_POOL
     for (int iBlock=1;iBlock<numberBlocks;iBlock++) {
       cilk_spawn dualColumn2First(result2[iBlock]);
     }
     dualColumn2First(result2[0]);
     cilk_sync;
+#else
+    AbcDualColumnTask task[NUMBER_ROW_BLOCKS];
+    for (int iBlock=1;iBlock<numberBlocks;iBlock++) {
+      task[iBlock].dual=this;
+      task[iBlock].result=result2+iBlock;
+      spawn(task+iBlock);
+    }
+    dualColumn2First(result2[0]);
+    for (int iBlock=1;iBlock<numberBlocks;iBlock++) 
+      sync(task+iBlock);
+#endif
     //dualColumn2Bit(this,result2,numberBlocks);
     numberSwapped=0;
     numberRemaining=0;
@@ -2332,6 +2381,17 @@ static int computeDualsAndCheck(AbcSimplexDual * model,const int whichArray[2])
   model->checkDualSolutionPlusFake();
   return numberRefinements;
 }
+#ifdef ABC_TASK_POOL
+// computeDualsAndCheck for another thread
+class AbcDualsTask : public ClpTask {
+public:
+  virtual void run()
+  { numberRefinements=computeDualsAndCheck(dual,whichArray);}
+  AbcSimplexDual * dual;
+  int * whichArray;
+  int numberRefinements;
+};
+#endif
 // Computes solutions - 1 do duals, 2 do primals, 3 both
 int
 AbcSimplex::gutsOfSolution(int type)
@@ -2389,14 +2449,24 @@ AbcSimplex::gutsOfSolution(int type)
 	info.status=1;
 	info.stuff[0]=whichArray[1];
 	info.stuff[1]=whichArray[2];
+#ifndef ABC_TASK_POOL
 	int n=cilk_spawn computeDualsAndCheck(dual,whichArray+1);
+#else
+	AbcDualsTask task;
+	task.dual=dual;
+	task.whichArray=whichArray+1;
+	spawn(&task);
+#endif
 #endif
 	numberRefinements=computePrimalsAndCheck(dual,whichArray+3);
 #if ABC_PARALLEL==1
 	numberRefinements+=stopParallelStuff(1);
-#else
+#elif !defined(ABC_TASK_POOL)
 	cilk_sync;
 	numberRefinements+=n;
+#else
+	sync(&task);
+	numberRefinements+=task.numberRefinements;
 #endif
       }
       for (int i=1;i<5;i++)
@@ -6053,6 +6123,12 @@ AbcSimplexDual::dual()
 #endif
 #if ABC_PARALLEL==2
   abcFactorization_->setParallelMode(parallelMode_);
+#endif
+#ifdef ABC_TASK_POOL
+  // threads for spawned work (primal may already have them)
+  ClpTaskPool * savedTaskPool = taskPool_;
+  if (parallelMode_!=0&&!taskPool_)
+    taskPool_ = new ClpTaskPool(parallelMode_+1);
 #endif
   static_cast<AbcSimplexDual *>(this)->bounceTolerances(-1);
   int saveDont = dontFactorizePivots_;
@@ -6129,6 +6205,12 @@ AbcSimplexDual::dual()
       }
     }
   }
+#endif
+#ifdef ABC_TASK_POOL
+  if (taskPool_!=savedTaskPool) {
+    delete taskPool_;
+    taskPool_ = savedTaskPool;
+  }
 #endif
   return problemStatus_;
 }
@@ -1106,6 +1106,28 @@ AbcSimplexDual::whileIteratingCilk()
   return returnCode;
 }
 // Create dual pricing vector
+#ifdef ABC_TASK_POOL
+// Method of AbcSimplexDual for another thread
+class AbcDualTask : public ClpTask {
+public:
+  typedef void (AbcSimplexDual::*Method)();
+  AbcDualTask(AbcSimplexDual * dual, Method method)
+    : dual_(dual), method_(method) {}
+  virtual void run()
+  { (dual_->*method_)();}
+private:
+  AbcSimplexDual * dual_;
+  Method method_;
+};
+// updateWeightsOnly for another thread
+class AbcWeightsTask : public ClpTask {
+public:
+  virtual void run()
+  { pivot->updateWeightsOnly(*input);}
+  AbcDualRowPivot * pivot;
+  CoinIndexedVector * input;
+};
+#endif
 void 
 AbcSimplexDual::createDualPricingVectorCilk()
 {
@@ -1177,12 +1199,26 @@ AbcSimplexDual::getTableauColumnFlipAndStartReplaceCilk()
   //cilk
   getTableauColumnPart1Cilk();
 #if MOVE_REPLACE_PART1A <= 0
+#ifndef ABC_TASK_POOL
   cilk_spawn getTableauColumnPart2();
 #if MOVE_REPLACE_PART1A == 0
   cilk_spawn checkReplacePart1();
 #endif
   numberFlipped=flipBounds();
   cilk_sync;
+#else
+  AbcDualTask part2(this,&AbcSimplexDual::getTableauColumnPart2);
+  spawn(&part2);
+#if MOVE_REPLACE_PART1A == 0
+  AbcDualTask part1(this,&AbcSimplexDual::checkReplacePart1);
+  spawn(&part1);
+#endif
+  numberFlipped=flipBounds();
+#if MOVE_REPLACE_PART1A == 0
+  sync(&part1);
+#endif
+  sync(&part2);
+#endif
 #else
   if (abcFactorization_->usingFT()) {
     cilk_spawn getTableauColumnPart2();
@@ -1378,6 +1414,10 @@ AbcSimplexDual::whileIteratingParallel(int numberIterations)
     */
     stateOfIteration_=0;
     returnCode=-1;
+#ifdef ABC_TASK_POOL
+    AbcWeightsTask weightsTask;
+    bool weightsSpawned=false;
+#endif
     // put row of tableau in usefulArray[arrayForTableauRow_]
     /*
       Could
@@ -1409,7 +1449,14 @@ AbcSimplexDual::whileIteratingParallel(int numberIterations)
     }
     if (!stateOfIteration_) {
 #ifndef MOVE_UPDATE_WEIGHTS
+#ifndef ABC_TASK_POOL
       cilk_spawn abcDualRowPivot_->updateWeightsOnly(usefulArray_[arrayForBtran_]);;
+#else
+      weightsTask.pivot=abcDualRowPivot_;
+      weightsTask.input=&usefulArray_[arrayForBtran_];
+      spawn(&weightsTask);
+      weightsSpawned=true;
+#endif
 #endif
       // get sequenceIn_
       dualPivotColumn();
@@ -1424,7 +1471,12 @@ AbcSimplexDual::whileIteratingParallel(int numberIterations)
 	stateOfIteration_=2;
       }
     }
+#ifndef ABC_TASK_POOL
     cilk_sync;
+#else
+    if (weightsSpawned)
+      sync(&weightsTask);
+#endif
     // Check event
     {
       int status = eventHandler_->event(ClpEventHandler::endOfIteration);
@@ -1513,12 +1565,22 @@ AbcSimplexDual::whileIteratingParallel(int numberIterations)
       // can do these in parallel
       // No idea why I need this - but otherwise runs not repeatable (try again??)
       //usefulArray_[3].compact();
+#ifndef ABC_TASK_POOL
       cilk_spawn updateDualsInDual();
+#else
+      AbcDualTask dualsTask(this,&AbcSimplexDual::updateDualsInDual);
+      AbcDualTask replaceTask(this,&AbcSimplexDual::replaceColumnPart3);
+      spawn(&dualsTask);
+#endif
       int lastSequenceOut;
       int lastDirectionOut;
       if (firstFree_<0) {
 	// can do in parallel
+#ifndef ABC_TASK_POOL
 	cilk_spawn replaceColumnPart3();
+#else
+	spawn(&replaceTask);
+#endif
 	updatePrimalSolution();
 	swapPrimalStuff();
 	// dualRow will go to virtual row pivot choice algorithm
@@ -1527,10 +1589,19 @@ AbcSimplexDual::whileIteratingParallel(int numberIterations)
 	lastSequenceOut=sequenceOut_;
 	lastDirectionOut=directionOut_;
 	dualPivotRow();
+#ifndef ABC_TASK_POOL
 	cilk_sync;
+#else
+	sync(&replaceTask);
+	sync(&dualsTask);
+#endif
       } else {
 	// be more careful as dualPivotRow may do update
+#ifndef ABC_TASK_POOL
 	cilk_spawn replaceColumnPart3();
+#else
+	spawn(&replaceTask);
+#endif
 	updatePrimalSolution();
 	swapPrimalStuff();
 	// dualRow will go to virtual row pivot choice algorithm
@@ -1538,7 +1609,12 @@ AbcSimplexDual::whileIteratingParallel(int numberIterations)
 	// use Btran array and clear inside dualPivotRow (if used)
 	lastSequenceOut=sequenceOut_;
 	lastDirectionOut=directionOut_;
+#ifndef ABC_TASK_POOL
 	cilk_sync;
+#else
+	sync(&replaceTask);
+	sync(&dualsTask);
+#endif
 	dualPivotRow();
       }
       lastPivotRow_=pivotRow_;
@@ -1605,6 +1681,27 @@ AbcSimplexDual::updatePrimalSolution()
 #endif
 }
 int xxInfo[6][8];
+#ifdef ABC_TASK_POOL
+// Block of dualColumn1 for another thread
+class AbcDualColumn1Task : public ClpTask {
+public:
+  virtual void run()
+  { 
+    if (byRow)
+      info->result=matrix->dualColumn1Row(info->stuff[1],COIN_DBL_MAX,info->stuff[2],
+					  *update,*tableauRow,*candidateList);
+    else
+      matrix->dualColumn1Part(info->stuff[1],info->stuff[2],info->result,
+			      *update,*tableauRow,*candidateList);
+  }
+  AbcMatrix * matrix;
+  CoinAbcThreadInfo * info;
+  CoinIndexedVector * update;
+  CoinPartitionedVector * tableauRow;
+  CoinPartitionedVector * candidateList;
+  bool byRow;
+};
+#endif
 double parallelDual4(AbcSimplexDual * dual)
 {
   int maximumRows=dual->maximumAbcNumberRows();
@@ -1654,6 +1751,7 @@ double parallelDual4(AbcSimplexDual * dual)
 #if ABC_PARALLEL
     if (numberBlocks>1) {
 #if ABC_PARALLEL==2
+#ifndef ABC_TASK_POOL
     for (int i=0;i<numberBlocks;i++) {
       info[i].stuff[1]=i;
       info[i].stuff[2]=-1;
@@ -1663,6 +1761,26 @@ double parallelDual4(AbcSimplexDual * dual)
 			       update,tableauRow,candidateList);
     }
     cilk_sync;
+#else
+    AbcDualColumn1Task task[NUMBER_BLOCKS];
+    for (int i=0;i<numberBlocks;i++) {
+      info[i].stuff[1]=i;
+      info[i].stuff[2]=-1;
+      info[i].result=upperTheta;
+      task[i].matrix=matrix;
+      task[i].info=info+i;
+      task[i].update=&update;
+      task[i].tableauRow=&tableauRow;
+      task[i].candidateList=&candidateList;
+      task[i].byRow=true;
+      if (i<numberBlocks-1)
+	dual->spawn(task+i);
+      else
+	task[i].run();
+    }
+    for (int i=0;i<numberBlocks-1;i++) 
+      dual->sync(task+i);
+#endif
 #else
       // parallel 1
     for (int i=0;i<numberBlocks;i++) {
@@ -1707,6 +1825,7 @@ double parallelDual4(AbcSimplexDual * dual)
     if (numberBlocks>1) {
 #if ABC_PARALLEL==2
       // do by column
+#ifndef ABC_TASK_POOL
       for (int i=0;i<numberBlocks;i++) {
 	info[i].stuff[1]=i;
 	info[i].result=upperTheta;
@@ -1716,6 +1835,25 @@ double parallelDual4(AbcSimplexDual * dual)
 					     update,tableauRow,candidateList);
       }
       cilk_sync;
+#else
+      AbcDualColumn1Task task[NUMBER_BLOCKS];
+      for (int i=0;i<numberBlocks;i++) {
+	info[i].stuff[1]=i;
+	info[i].result=upperTheta;
+	task[i].matrix=matrix;
+	task[i].info=info+i;
+	task[i].update=&update;
+	task[i].tableauRow=&tableauRow;
+	task[i].candidateList=&candidateList;
+	task[i].byRow=false;
+	if (i<numberBlocks-1)
+	  dual->spawn(task+i);
+	else
+	  task[i].run();
+      }
+      for (int i=0;i<numberBlocks-1;i++) 
+	dual->sync(task+i);
+#endif
 #else
       // parallel 1
       // do by column
@@ -1852,17 +1990,49 @@ parallelDual5a(AbcSimplexFactorization * factorization,
 }
 #endif
 #if ABC_PARALLEL==2
+#ifdef ABC_TASK_POOL
+void
+parallelDual5(AbcSimplex * model,
+	      CoinIndexedVector ** whichVector,
+	      int numberCpu,
+	      int whichCpu,
+	      double * weights);
+// Rest of parallelDual5 for another thread
+class AbcDual5Task : public ClpTask {
+public:
+  virtual void run()
+  { parallelDual5(model,whichVector,numberCpu,whichCpu,weights);}
+  AbcSimplex * model;
+  CoinIndexedVector ** whichVector;
+  int numberCpu;
+  int whichCpu;
+  double * weights;
+};
+#endif
 void
-parallelDual5(AbcSimplexFactorization * factorization,
+parallelDual5(AbcSimplex * model,
 	      CoinIndexedVector ** whichVector,
 	      int numberCpu,
 	      int whichCpu,
 	      double * weights)
 {
+  AbcSimplexFactorization * factorization = model->factorization();
   if (whichCpu) {
-    cilk_spawn parallelDual5(factorization,whichVector,numberCpu,whichCpu-1,weights);
+#ifndef ABC_TASK_POOL
+    cilk_spawn parallelDual5(model,whichVector,numberCpu,whichCpu-1,weights);
     parallelDual5a(factorization,whichVector[whichCpu],numberCpu,whichCpu,weights);
     cilk_sync;
+#else
+    AbcDual5Task task;
+    task.model=model;
+    task.whichVector=whichVector;
+    task.numberCpu=numberCpu;
+    task.whichCpu=whichCpu-1;
+    task.weights=weights;
+    model->spawn(&task);
+    parallelDual5a(factorization,whichVector[whichCpu],numberCpu,whichCpu,weights);
+    model->sync(&task);
+#endif
   } else {
     parallelDual5a(factorization,whichVector[whichCpu],numberCpu,whichCpu,weights);
   }
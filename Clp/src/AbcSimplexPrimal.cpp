@@ -230,6 +230,12 @@ int AbcSimplexPrimal::primal (int ifValuesPass , int /*startFinishOptions*/)
       columnArray_[i]->reserve(length);
     }
   }
+#endif
+#ifdef ABC_TASK_POOL
+  // threads for spawned work (dual may already have them)
+  ClpTaskPool * savedTaskPool = taskPool_;
+  if (parallelMode_!=0&&!taskPool_)
+    taskPool_ = new ClpTaskPool(parallelMode_+1);
 #endif
   // save data
   ClpDataSave data = saveData();
@@ -453,6 +459,12 @@ int AbcSimplexPrimal::primal (int ifValuesPass , int /*startFinishOptions*/)
     abcNonLinearCost_->checkInfeasibilities(0.0);
   delete abcNonLinearCost_;
   abcNonLinearCost_=NULL;
+#ifdef ABC_TASK_POOL
+  if (taskPool_!=savedTaskPool) {
+    delete taskPool_;
+    taskPool_ = savedTaskPool;
+  }
+#endif
 #if 0
   if (numberRows_>80000&&numberRows_<90000) {
     FILE * fp = fopen("save.stuff", "wb");
@@ -13,17 +13,7 @@
 #include "ClpCholeskyDense.hpp"
 #include "ClpMessage.hpp"
 #include "ClpQuadraticObjective.hpp"
-#if CLP_HAS_ABC
-#include "CoinAbcCommon.hpp"
-#endif
-#if CLP_HAS_ABC<3
-#undef cilk_for 
-#undef cilk_spawn
-#undef cilk_sync
-#define cilk_for for 
-#define cilk_spawn
-#define cilk_sync
-#endif
+#include "ClpTaskPool.hpp"
 
 /*#############################################################################*/
 /* Constructors / Destructor / Assignment*/
@@ -94,6 +84,10 @@ ClpCholeskyBase * ClpCholeskyDense::clone() const
 #define number_blocks(x) (((x)+BLOCK-1)>>BLOCKSHIFT)
 #define number_rows(x) ((x)<<BLOCKSHIFT)
 #define number_entries(x) ((x)<<BLOCKSQSHIFT)
+/* Smallest piece of work (multiply adds) worth giving to another thread */
+#define SPAWN_WORK (64.0*64.0*64.0)
+/* Smallest number of blocks worth starting threads for */
+#define SPAWN_BLOCKS 8
 /* Gets space */
 int
 ClpCholeskyDense::reserveSpace(const ClpCholeskyBase * factor, int numberRows)
@@ -644,9 +638,18 @@ ClpCholeskyDense::factorizePart2( int * rowsDropped)
      info.diagonal_ = diagonal_;
      info.doubleParameters_[0] = doubleParameters_[10];
      info.integerParameters_[0] = integerParameters_[34];
+     info.pool = NULL;
 #ifndef CLP_CILK
+     /* recursive parts run as tasks if model wants more than one thread */
+     int numberThreads = model_ ? model_->numberThreads() : 0;
+     ClpTaskPool * pool = NULL;
+     if (numberThreads > 1 && numberBlocks >= SPAWN_BLOCKS) {
+          pool = new ClpTaskPool(numberThreads);
+          info.pool = pool;
+     }
      ClpCholeskyCfactor(&info, a, numberRows_, numberBlocks,
                         diagonal_, workDouble_, rowsDropped);
+     delete pool;
 #else
      info.a = a;
      info.n = numberRows_;
@@ -671,6 +674,103 @@ ClpCholeskyDense::factorizePart2( int * rowsDropped)
      doubleParameters_[4] = CoinMin(doubleParameters_[4], 1.0 / largest);
      integerParameters_[20] += numberDropped;
 }
+/* Recursive updates which can go to another thread.
+   start() spawns if there is a pool and enough work, otherwise
+   just runs, and finish() waits if it was spawned. */
+class ClpCholeskyTask : public ClpTask {
+public:
+     ClpCholeskyTask(ClpCholeskyDenseC * thisStruct)
+          : thisStruct_(thisStruct), spawned_(false) {}
+     inline void start(double work) {
+          ClpTaskPool * pool = static_cast<ClpTaskPool *>(thisStruct_->pool);
+          if (pool && work >= SPAWN_WORK) {
+               spawned_ = true;
+               pool->spawn(this);
+          } else {
+               run();
+          }
+     }
+     inline void finish() {
+          if (spawned_)
+               static_cast<ClpTaskPool *>(thisStruct_->pool)->sync(this);
+     }
+protected:
+     ClpCholeskyDenseC * thisStruct_;
+     bool spawned_;
+};
+/* ClpCholeskyCtriRec as task */
+class ClpCholeskyTriRecTask : public ClpCholeskyTask {
+public:
+     ClpCholeskyTriRecTask(ClpCholeskyDenseC * thisStruct, longDouble * aTri, int nThis,
+                           longDouble * aUnder, longDouble * diagonal, longDouble * work,
+                           int nLeft, int iBlock, int jBlock, int numberBlocks)
+          : ClpCholeskyTask(thisStruct), aTri_(aTri), aUnder_(aUnder),
+            diagonal_(diagonal), work_(work), nThis_(nThis), nLeft_(nLeft),
+            iBlock_(iBlock), jBlock_(jBlock), numberBlocks_(numberBlocks) {}
+     virtual void run() {
+          ClpCholeskyCtriRec(thisStruct_, aTri_, nThis_, aUnder_, diagonal_, work_,
+                             nLeft_, iBlock_, jBlock_, numberBlocks_);
+     }
+private:
+     longDouble * aTri_;
+     longDouble * aUnder_;
+     longDouble * diagonal_;
+     longDouble * work_;
+     int nThis_;
+     int nLeft_;
+     int iBlock_;
+     int jBlock_;
+     int numberBlocks_;
+};
+/* ClpCholeskyCrecTri as task */
+class ClpCholeskyRecTriTask : public ClpCholeskyTask {
+public:
+     ClpCholeskyRecTriTask(ClpCholeskyDenseC * thisStruct, longDouble * aUnder, int nTri,
+                           int nDo, int iBlock, int jBlock, longDouble * aTri,
+                           longDouble * diagonal, longDouble * work, int numberBlocks)
+          : ClpCholeskyTask(thisStruct), aUnder_(aUnder), aTri_(aTri),
+            diagonal_(diagonal), work_(work), nTri_(nTri), nDo_(nDo),
+            iBlock_(iBlock), jBlock_(jBlock), numberBlocks_(numberBlocks) {}
+     virtual void run() {
+          ClpCholeskyCrecTri(thisStruct_, aUnder_, nTri_, nDo_, iBlock_, jBlock_,
+                             aTri_, diagonal_, work_, numberBlocks_);
+     }
+private:
+     longDouble * aUnder_;
+     longDouble * aTri_;
+     longDouble * diagonal_;
+     longDouble * work_;
+     int nTri_;
+     int nDo_;
+     int iBlock_;
+     int jBlock_;
+     int numberBlocks_;
+};
+/* ClpCholeskyCrecRec as task */
+class ClpCholeskyRecRecTask : public ClpCholeskyTask {
+public:
+     ClpCholeskyRecRecTask(ClpCholeskyDenseC * thisStruct, longDouble * above, int nUnder,
+                           int nUnderK, int nDo, longDouble * aUnder, longDouble * aOther,
+                           longDouble * work, int iBlock, int jBlock, int numberBlocks)
+          : ClpCholeskyTask(thisStruct), above_(above), aUnder_(aUnder),
+            aOther_(aOther), work_(work), nUnder_(nUnder), nUnderK_(nUnderK),
+            nDo_(nDo), iBlock_(iBlock), jBlock_(jBlock), numberBlocks_(numberBlocks) {}
+     virtual void run() {
+          ClpCholeskyCrecRec(thisStruct_, above_, nUnder_, nUnderK_, nDo_, aUnder_,
+                             aOther_, work_, iBlock_, jBlock_, numberBlocks_);
+     }
+private:
+     longDouble * above_;
+     longDouble * aUnder_;
+     longDouble * aOther_;
+     longDouble * work_;
+     int nUnder_;
+     int nUnderK_;
+     int nDo_;
+     int iBlock_;
+     int jBlock_;
+     int numberBlocks_;
+};
 /* Non leaf recursive factor*/
 void
 ClpCholeskyCfactor(ClpCholeskyDenseC * thisStruct, longDouble * a, int n, int numberBlocks,
@@ -705,10 +805,11 @@ ClpCholeskyCtriRec(ClpCholeskyDenseC * thisStruct, longDouble * aTri, int nThis,
      } else if (nThis < nLeft) {
           int nb = number_blocks((nLeft + 1) >> 1);
           int nLeft2 = number_rows(nb);
-          cilk_spawn ClpCholeskyCtriRec(thisStruct, aTri, nThis, aUnder, diagonal, work, nLeft2, iBlock, jBlock, numberBlocks);
+          ClpCholeskyTriRecTask task(thisStruct, aTri, nThis, aUnder, diagonal, work, nLeft2, iBlock, jBlock, numberBlocks);
+          task.start(static_cast<double>(nThis) * nThis * nLeft2);
           ClpCholeskyCtriRec(thisStruct, aTri, nThis, aUnder + number_entries(nb), diagonal, work, nLeft - nLeft2,
                              iBlock + nb, jBlock, numberBlocks);
-	  cilk_sync;
+          task.finish();
      } else {
           int nb = number_blocks((nThis + 1) >> 1);
           int nThis2 = number_rows(nb);
@@ -754,7 +855,8 @@ ClpCholeskyCrecTri(ClpCholeskyDenseC * thisStruct, longDouble * aUnder, int nTri
           int nTri2 = number_rows(nb);
           longDouble * aother;
           int i;
-          cilk_spawn ClpCholeskyCrecTri(thisStruct, aUnder, nTri2, nDo, iBlock, jBlock, aTri, diagonal, work, numberBlocks);
+          ClpCholeskyRecTriTask task(thisStruct, aUnder, nTri2, nDo, iBlock, jBlock, aTri, diagonal, work, numberBlocks);
+          task.start(static_cast<double>(nTri2) * nTri2 * nDo);
           /* and rectangular update */
           i = ((numberBlocks - iBlock) * (numberBlocks - iBlock + 1) -
                (numberBlocks - iBlock - nb) * (numberBlocks - iBlock - nb + 1)) >> 1;
@@ -763,7 +865,7 @@ ClpCholeskyCrecTri(ClpCholeskyDenseC * thisStruct, longDouble * aUnder, int nTri
                              work, iBlock, jBlock, numberBlocks);
           ClpCholeskyCrecTri(thisStruct, aUnder + number_entries(nb), nTri - nTri2, nDo, iBlock + nb, jBlock,
                              aTri + number_entries(i), diagonal, work, numberBlocks);
-	  cilk_sync;
+          task.finish();
      }
 }
 /* Non leaf recursive rectangle rectangle update,
@@ -783,11 +885,12 @@ ClpCholeskyCrecRec(ClpCholeskyDenseC * thisStruct, longDouble * above, int nUnde
      } else if (nDo <= nUnderK && nUnder <= nUnderK) {
           int nb = number_blocks((nUnderK + 1) >> 1);
           int nUnder2 = number_rows(nb);
-          cilk_spawn ClpCholeskyCrecRec(thisStruct, above, nUnder, nUnder2, nDo, aUnder, aOther, work,
-                             iBlock, jBlock, numberBlocks);
+          ClpCholeskyRecRecTask task(thisStruct, above, nUnder, nUnder2, nDo, aUnder, aOther, work,
+                                     iBlock, jBlock, numberBlocks);
+          task.start(static_cast<double>(nUnder) * nUnder2 * nDo);
           ClpCholeskyCrecRec(thisStruct, above, nUnder, nUnderK - nUnder2, nDo, aUnder + number_entries(nb),
                              aOther + number_entries(nb), work, iBlock, jBlock, numberBlocks);
-	  cilk_sync;
+          task.finish();
      } else if (nUnderK <= nDo && nUnder <= nDo) {
           int nb = number_blocks((nDo + 1) >> 1);
           int nDo2 = number_rows(nb);
@@ -804,13 +907,14 @@ ClpCholeskyCrecRec(ClpCholeskyDenseC * thisStruct, longDouble * above, int nUnde
           int nb = number_blocks((nUnder + 1) >> 1);
           int nUnder2 = number_rows(nb);
           int i;
-          cilk_spawn ClpCholeskyCrecRec(thisStruct, above, nUnder2, nUnderK, nDo, aUnder, aOther, work,
-                             iBlock, jBlock, numberBlocks);
+          ClpCholeskyRecRecTask task(thisStruct, above, nUnder2, nUnderK, nDo, aUnder, aOther, work,
+                                     iBlock, jBlock, numberBlocks);
+          task.start(static_cast<double>(nUnder2) * nUnderK * nDo);
           i = ((numberBlocks - iBlock) * (numberBlocks - iBlock - 1) -
                (numberBlocks - iBlock - nb) * (numberBlocks - iBlock - nb - 1)) >> 1;
           ClpCholeskyCrecRec(thisStruct, above + number_entries(nb), nUnder - nUnder2, nUnderK, nDo, aUnder,
                              aOther + number_entries(i), work, iBlock + nb, jBlock, numberBlocks);
-	  cilk_sync;
+          task.finish();
      }
 }
 /* Leaf recursive factor*/
@@ -1091,68 +1195,47 @@ ClpCholeskyCrecRecLeaf(/*ClpCholeskyDenseC * thisStruct,*/
                }
           }
 #else
+          /* Columns of aUnder times work once, then four columns of
+             aOther at a time with unit stride inner loops so compiler
+             can vectorize (same arithmetic as scalar version) */
+          longDouble scaled[BLOCKSQ];
+          for (k = 0; k < BLOCK; k++) {
+               CoinWorkDouble multiplier = work[k];
+               const longDouble * COIN_RESTRICT aUnderNow = aUnder + k * BLOCK;
+               longDouble * COIN_RESTRICT scaledNow = scaled + k * BLOCK;
+               for (i = 0; i < BLOCK; i++)
+                    scaledNow[i] = aUnderNow[i] * multiplier;
+          }
           for (j = 0; j < BLOCK; j += 4) {
                aa += 4 * BLOCK;
-               for (i = 0; i < BLOCK; i += 4) {
-                    CoinWorkDouble t00 = aa[i+0+0*BLOCK];
-                    CoinWorkDouble t10 = aa[i+0+1*BLOCK];
-                    CoinWorkDouble t20 = aa[i+0+2*BLOCK];
-                    CoinWorkDouble t30 = aa[i+0+3*BLOCK];
-                    CoinWorkDouble t01 = aa[i+1+0*BLOCK];
-                    CoinWorkDouble t11 = aa[i+1+1*BLOCK];
-                    CoinWorkDouble t21 = aa[i+1+2*BLOCK];
-                    CoinWorkDouble t31 = aa[i+1+3*BLOCK];
-                    CoinWorkDouble t02 = aa[i+2+0*BLOCK];
-                    CoinWorkDouble t12 = aa[i+2+1*BLOCK];
-                    CoinWorkDouble t22 = aa[i+2+2*BLOCK];
-                    CoinWorkDouble t32 = aa[i+2+3*BLOCK];
-                    CoinWorkDouble t03 = aa[i+3+0*BLOCK];
-                    CoinWorkDouble t13 = aa[i+3+1*BLOCK];
-                    CoinWorkDouble t23 = aa[i+3+2*BLOCK];
-                    CoinWorkDouble t33 = aa[i+3+3*BLOCK];
-                    const longDouble * COIN_RESTRICT aUnderNow = aUnder + i;
-                    const longDouble * COIN_RESTRICT aboveNow = above + j;
-                    for (k = 0; k < BLOCK; k++) {
-                         CoinWorkDouble multiplier = work[k];
-                         CoinWorkDouble a00 = aUnderNow[0] * multiplier;
-                         CoinWorkDouble a01 = aUnderNow[1] * multiplier;
-                         CoinWorkDouble a02 = aUnderNow[2] * multiplier;
-                         CoinWorkDouble a03 = aUnderNow[3] * multiplier;
-                         t00 -= a00 * aboveNow[0];
-                         t10 -= a00 * aboveNow[1];
-                         t20 -= a00 * aboveNow[2];
-                         t30 -= a00 * aboveNow[3];
-                         t01 -= a01 * aboveNow[0];
-                         t11 -= a01 * aboveNow[1];
-                         t21 -= a01 * aboveNow[2];
-                         t31 -= a01 * aboveNow[3];
-                         t02 -= a02 * aboveNow[0];
-                         t12 -= a02 * aboveNow[1];
-                         t22 -= a02 * aboveNow[2];
-                         t32 -= a02 * aboveNow[3];
-                         t03 -= a03 * aboveNow[0];
-                         t13 -= a03 * aboveNow[1];
-                         t23 -= a03 * aboveNow[2];
-                         t33 -= a03 * aboveNow[3];
-                         aUnderNow += BLOCK;
-                         aboveNow += BLOCK;
+               CoinWorkDouble t0[BLOCK], t1[BLOCK], t2[BLOCK], t3[BLOCK];
+               for (i = 0; i < BLOCK; i++) {
+                    t0[i] = aa[i+0*BLOCK];
+                    t1[i] = aa[i+1*BLOCK];
+                    t2[i] = aa[i+2*BLOCK];
+                    t3[i] = aa[i+3*BLOCK];
+               }
+               const longDouble * COIN_RESTRICT aboveNow = above + j;
+               const longDouble * COIN_RESTRICT scaledNow = scaled;
+               for (k = 0; k < BLOCK; k++) {
+                    CoinWorkDouble above0 = aboveNow[0];
+                    CoinWorkDouble above1 = aboveNow[1];
+                    CoinWorkDouble above2 = aboveNow[2];
+                    CoinWorkDouble above3 = aboveNow[3];
+                    for (i = 0; i < BLOCK; i++) {
+                         t0[i] -= scaledNow[i] * above0;
+                         t1[i] -= scaledNow[i] * above1;
+                         t2[i] -= scaledNow[i] * above2;
+                         t3[i] -= scaledNow[i] * above3;
                     }
-                    aa[i+0+0*BLOCK] = t00;
-                    aa[i+0+1*BLOCK] = t10;
-                    aa[i+0+2*BLOCK] = t20;
-                    aa[i+0+3*BLOCK] = t30;
-                    aa[i+1+0*BLOCK] = t01;
-                    aa[i+1+1*BLOCK] = t11;
-                    aa[i+1+2*BLOCK] = t21;
-                    aa[i+1+3*BLOCK] = t31;
-                    aa[i+2+0*BLOCK] = t02;
-                    aa[i+2+1*BLOCK] = t12;
-                    aa[i+2+2*BLOCK] = t22;
-                    aa[i+2+3*BLOCK] = t32;
-                    aa[i+3+0*BLOCK] = t03;
-                    aa[i+3+1*BLOCK] = t13;
-                    aa[i+3+2*BLOCK] = t23;
-                    aa[i+3+3*BLOCK] = t33;
+                    scaledNow += BLOCK;
+                    aboveNow += BLOCK;
+               }
+               for (i = 0; i < BLOCK; i++) {
+                    aa[i+0*BLOCK] = t0[i];
+                    aa[i+1*BLOCK] = t1[i];
+                    aa[i+2*BLOCK] = t2[i];
+                    aa[i+3*BLOCK] = t3[i];
                }
           }
 #endif
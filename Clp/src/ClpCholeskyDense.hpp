@@ -90,6 +90,7 @@ typedef struct {
      longDouble * a;
      longDouble * work;
      int * rowsDropped;
+     void * pool; /* ClpTaskPool if parallel */
      double doubleParameters_[1]; /* corresponds to 10 */
      int integerParameters_[2]; /* corresponds to 34, nThreads */
      int n;
@@ -817,7 +817,7 @@ public:
      inline void setWhatsChanged(int value) {
           whatsChanged_ = value;
      }
-     /// Number of threads (not really being used)
+     /// Number of threads (used by dense Cholesky)
      inline int numberThreads() const {
           return numberThreads_;
      }
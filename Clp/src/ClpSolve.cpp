@@ -629,6 +629,10 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
 #ifndef FAKE_CILK
       if (number_cilk_workers>1)
       numberCpu=CoinMin(2*number_cilk_workers,8);
+#elif defined(ABC_TASK_POOL)
+      // one pool thread per processor
+      if (ClpTaskPool::numberProcessors()>1)
+	numberCpu=CoinMin(ClpTaskPool::numberProcessors(),8);
 #endif
 #endif
     } else if (numberCpu==10) {
@@ -642,6 +646,9 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
 #ifndef FAKE_CILK
       else if (number_cilk_workers>1)
 	numberCpu=CoinMin(2*number_cilk_workers,8);
+#elif defined(ABC_TASK_POOL)
+      else if (ClpTaskPool::numberProcessors()>1)
+	numberCpu=CoinMin(ClpTaskPool::numberProcessors(),8);
 #endif
 #endif
       else
@@ -0,0 +1,237 @@
+/* $Id$ */
+/*
+  Copyright (C) 2026, International Business Machines Corporation
+  and others.  All Rights Reserved.
+
+  This code is licensed under the terms of the Eclipse Public License (EPL).
+*/
+#include "CoinPragma.hpp"
+#include "ClpTaskPool.hpp"
+#include <cassert>
+#include <cstdlib>
+#ifdef CLP_HAS_THREADS
+#include <deque>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+/* What each thread has */
+typedef struct {
+     ClpTaskPool * pool;
+     pthread_t id;
+     int index;
+} ClpTaskThread;
+
+struct ClpTaskPool::Data {
+     /* Spawned tasks of each thread (newest at back) */
+     std::deque<ClpTask *> * deque;
+     /* Lock for each deque */
+     pthread_mutex_t * dequeMutex;
+     ClpTaskThread * thread;
+     /* For idle threads */
+     pthread_mutex_t mutex;
+     pthread_cond_t condition;
+     /* Gives index of thread in pool */
+     pthread_key_t key;
+     /* Tasks in all deques (changed atomically) */
+     volatile int numberQueued;
+     /* Threads waiting on condition (changed atomically with mutex held) */
+     volatile int numberSleeping;
+     bool stop;
+};
+
+// Index of calling thread (creator has no key set)
+int
+ClpTaskPool::threadIndex() const
+{
+     void * value = pthread_getspecific(data_->key);
+     return value ? static_cast<ClpTaskThread *>(value)->index : 0;
+}
+
+// Newest task of thread or oldest of another (NULL if none)
+ClpTask *
+ClpTaskPool::take(int thread)
+{
+     ClpTask * task = NULL;
+     if (!data_->numberQueued)
+          return NULL;
+     pthread_mutex_lock(data_->dequeMutex + thread);
+     std::deque<ClpTask *> & own = data_->deque[thread];
+     if (!own.empty()) {
+          task = own.back();
+          own.pop_back();
+     }
+     pthread_mutex_unlock(data_->dequeMutex + thread);
+     for (int i = 1; !task && i < numberThreads_; i++) {
+          int other = thread + i;
+          if (other >= numberThreads_)
+               other -= numberThreads_;
+          pthread_mutex_lock(data_->dequeMutex + other);
+          std::deque<ClpTask *> & victim = data_->deque[other];
+          if (!victim.empty()) {
+               task = victim.front();
+               victim.pop_front();
+          }
+          pthread_mutex_unlock(data_->dequeMutex + other);
+     }
+     if (task)
+          __sync_fetch_and_sub(&data_->numberQueued, 1);
+     return task;
+}
+
+// Runs task and marks it done
+void
+ClpTaskPool::runTask(ClpTask * task)
+{
+     task->run();
+     __sync_synchronize();
+     task->done_ = 1;
+}
+
+// Worker thread - takes tasks until told to stop
+void *
+ClpTaskPool::worker(void * info)
+{
+     ClpTaskThread * thread = static_cast<ClpTaskThread *>(info);
+     ClpTaskPool * pool = thread->pool;
+     Data * data = pool->data_;
+     pthread_setspecific(data->key, thread);
+     while (true) {
+          ClpTask * task = pool->take(thread->index);
+          if (task) {
+               runTask(task);
+               continue;
+          }
+          pthread_mutex_lock(&data->mutex);
+          // full barrier so spawn sees sleeper or this sees its task
+          __sync_fetch_and_add(&data->numberSleeping, 1);
+          while (!data->stop && !data->numberQueued)
+               pthread_cond_wait(&data->condition, &data->mutex);
+          __sync_fetch_and_sub(&data->numberSleeping, 1);
+          bool stop = data->stop;
+          pthread_mutex_unlock(&data->mutex);
+          if (stop)
+               break;
+     }
+     return NULL;
+}
+#endif
+
+ClpTaskPool::ClpTaskPool(int numberThreads)
+     : data_(NULL),
+       numberThreads_(numberThreads > 1 ? numberThreads : 1)
+{
+#ifdef CLP_HAS_THREADS
+     if (numberThreads_ == 1)
+          return;
+     data_ = new Data;
+     data_->deque = new std::deque<ClpTask *> [numberThreads_];
+     data_->dequeMutex = new pthread_mutex_t [numberThreads_];
+     data_->thread = new ClpTaskThread [numberThreads_];
+     for (int i = 0; i < numberThreads_; i++) {
+          pthread_mutex_init(data_->dequeMutex + i, NULL);
+          data_->thread[i].pool = this;
+          data_->thread[i].index = i;
+     }
+     pthread_mutex_init(&data_->mutex, NULL);
+     pthread_cond_init(&data_->condition, NULL);
+     pthread_key_create(&data_->key, NULL);
+     data_->numberQueued = 0;
+     data_->numberSleeping = 0;
+     data_->stop = false;
+     int numberStarted = 1;
+     for (int i = 1; i < numberThreads_; i++) {
+          if (pthread_create(&data_->thread[i].id, NULL, worker, data_->thread + i))
+               break; // can't get thread - make do with what we have
+          numberStarted++;
+     }
+     numberThreads_ = numberStarted;
+#else
+     numberThreads_ = 1;
+#endif
+}
+
+ClpTaskPool::~ClpTaskPool()
+{
+#ifdef CLP_HAS_THREADS
+     if (!data_)
+          return;
+     assert (!data_->numberQueued);
+     pthread_mutex_lock(&data_->mutex);
+     data_->stop = true;
+     pthread_cond_broadcast(&data_->condition);
+     pthread_mutex_unlock(&data_->mutex);
+     for (int i = 1; i < numberThreads_; i++)
+          pthread_join(data_->thread[i].id, NULL);
+     pthread_key_delete(data_->key);
+     pthread_cond_destroy(&data_->condition);
+     pthread_mutex_destroy(&data_->mutex);
+     for (int i = 0; i < numberThreads_; i++)
+          pthread_mutex_destroy(data_->dequeMutex + i);
+     delete [] data_->thread;
+     delete [] data_->dequeMutex;
+     delete [] data_->deque;
+     delete data_;
+#endif
+}
+
+// Make task available to other threads (or run it now if one thread)
+void
+ClpTaskPool::spawn(ClpTask * task)
+{
+     task->done_ = 0;
+#ifdef CLP_HAS_THREADS
+     if (data_) {
+          int thread = threadIndex();
+          pthread_mutex_lock(data_->dequeMutex + thread);
+          data_->deque[thread].push_back(task);
+          pthread_mutex_unlock(data_->dequeMutex + thread);
+          __sync_fetch_and_add(&data_->numberQueued, 1);
+          /* A thread going to sleep counts itself before it checks
+             numberQueued (both full barriers) so if none counted yet it
+             will see this task.  Only take mutex if one may be waiting -
+             it holds mutex until it waits so signal is not lost. */
+          if (data_->numberSleeping) {
+               pthread_mutex_lock(&data_->mutex);
+               pthread_cond_signal(&data_->condition);
+               pthread_mutex_unlock(&data_->mutex);
+          }
+          return;
+     }
+#endif
+     task->run();
+     task->done_ = 1;
+}
+
+// Return when task (spawned by this thread) has finished
+void
+ClpTaskPool::sync(ClpTask * task)
+{
+#ifdef CLP_HAS_THREADS
+     if (data_) {
+          int thread = threadIndex();
+          while (!task->done_) {
+               // task itself is newest in own deque unless stolen
+               ClpTask * other = take(thread);
+               if (other)
+                    runTask(other);
+               else
+                    sched_yield();
+          }
+          __sync_synchronize();
+     }
+#endif
+     assert (task->done_);
+}
+
+// Number of processors available (1 if not known)
+int
+ClpTaskPool::numberProcessors()
+{
+#if defined(CLP_HAS_THREADS) && defined(_SC_NPROCESSORS_ONLN)
+     long number = sysconf(_SC_NPROCESSORS_ONLN);
+     if (number > 0)
+          return static_cast<int>(number);
+#endif
+     return 1;
+}
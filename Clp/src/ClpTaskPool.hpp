@@ -0,0 +1,103 @@
+/* $Id$ */
+/*
+  Copyright (C) 2026, International Business Machines Corporation
+  and others.  All Rights Reserved.
+
+  This code is licensed under the terms of the Eclipse Public License (EPL).
+*/
+#ifndef ClpTaskPool_H
+#define ClpTaskPool_H
+
+#include "ClpConfig.h"
+
+/* Threads are used unless CLP_NO_THREADS is defined (configure does
+   so if there is no -lpthread).  Windows builds (no pthreads) always
+   run serially. */
+#if !defined(CLP_NO_THREADS) && !defined(_MSC_VER)
+#define CLP_HAS_THREADS 1
+#endif
+
+/** Piece of work for ClpTaskPool.
+    Derive from this and put arguments in derived class. */
+class ClpTask {
+
+public:
+     /// Does the work
+     virtual void run() = 0;
+     /// True when spawned task has finished
+     inline bool finished() const {
+          return done_ != 0;
+     }
+     ClpTask() : done_(0) {}
+     virtual ~ClpTask() {}
+
+private:
+     friend class ClpTaskPool;
+     /// Set when run has finished
+     volatile int done_;
+};
+
+/** Fork-join thread pool with work stealing.
+
+    This replaces cilk_spawn and cilk_sync.  The thread which creates the
+    pool is thread 0 and numberThreads-1 more are started.  Each thread
+    keeps a deque of the tasks it has spawned.  A thread takes its
+    newest task first.  When it has none, it steals the oldest task of
+    another thread.  So in a recursive split the big pieces get stolen
+    and the small ones stay local.  sync() does not block: it runs tasks
+    (its own or stolen ones) until the task it is waiting for is done.
+
+    Only the thread which made the pool, and tasks run by the pool, may
+    spawn.  With one thread, or if threads are not available, spawn()
+    just runs the task.
+*/
+class ClpTaskPool {
+
+public:
+     /**@name Fork and join */
+     //@{
+     /// Make task available to other threads (or run it now if one thread)
+     void spawn(ClpTask * task);
+     /// Return when task (spawned by this thread) has finished
+     void sync(ClpTask * task);
+     /// Number of threads (including creator)
+     inline int numberThreads() const {
+          return numberThreads_;
+     }
+     /// Number of processors available (1 if not known)
+     static int numberProcessors();
+     //@}
+
+     /**@name Constructors and destructor */
+     //@{
+     /// Starts numberThreads-1 threads
+     ClpTaskPool(int numberThreads);
+     /// Stops threads (all spawned tasks must have been synced)
+     ~ClpTaskPool();
+     //@}
+
+private:
+     /// Not copyable
+     ClpTaskPool(const ClpTaskPool &);
+     ClpTaskPool & operator=(const ClpTaskPool &);
+#ifdef CLP_HAS_THREADS
+     /// Index of calling thread
+     int threadIndex() const;
+     /// Newest task of thread or oldest of another (NULL if none)
+     ClpTask * take(int thread);
+     /// Runs task and marks it done
+     static void runTask(ClpTask * task);
+     /// Worker thread
+     static void * worker(void * info);
+#endif
+
+     /**@name Private member data */
+     //@{
+     /// Threads, deques and locks (in .cpp)
+     struct Data;
+     Data * data_;
+     /// Number of threads
+     int numberThreads_;
+     //@}
+};
+#endif
@@ -38,6 +38,19 @@ typedef unsigned int CoinSimplexUnsignedInt;
 #endif
 #if ABC_PARALLEL==2
 //#define EARLY_FACTORIZE
+#if !defined(FAKE_CILK) && !defined(HAS_CILK) && !defined(__cilk)
+/* No Cilk compiler - the main spawn points use a ClpTaskPool
+   (see AbcSimplex::taskPool) and the rest run serially */
+#define ABC_TASK_POOL
+#define FAKE_CILK
+#endif
+#ifndef ABC_TASK_POOL
+/* Loops are split in two until this size */
+#define ABC_SPAWN_SIZE 256
+#else
+/* Spawn on pool costs more than in Cilk */
+#define ABC_SPAWN_SIZE 4096
+#endif
 #ifndef FAKE_CILK
 #include <cilk/cilk.h>
 #else
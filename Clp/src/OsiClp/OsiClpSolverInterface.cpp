@@ -15,6 +15,7 @@ extern int osi_hot;
 #include "CoinIndexedVector.hpp"
 #include "CoinModel.hpp"
 #include "CoinMpsIO.hpp"
+#include "CoinModelFile.hpp"
 #include "CoinSort.hpp"
 #include "ClpDualRowSteepest.hpp"
 #include "ClpPrimalColumnSteepest.hpp"
@@ -4985,6 +4986,82 @@ OsiClpSolverInterface::readLp(const char *filename, const double epsilon )
   modelPtr_->copyNames(rowNames,columnNames);
   return(0);
 }
+// Read binary model file (with names)
+int 
+OsiClpSolverInterface::readModelFile(const char *filename, bool verify)
+{
+  // Get rid of integer stuff
+  delete [] integerInformation_;
+  integerInformation_=NULL;
+  freeCachedResults();
+  delete [] setInfo_;
+  setInfo_=NULL;
+  numberSOS_=0;
+
+  CoinModelFile m;
+  int returnCode = m.open(filename,verify);
+  handler_->message(COIN_SOLVER_MPS,messages_)
+    <<filename<< returnCode <<CoinMessageEol;
+  if (returnCode)
+    return returnCode;
+
+  // set objective function offest
+  setDblParam(OsiObjOffset,m.objectiveOffset());
+
+  // set problem name
+  setStrParam(OsiProbName,m.getProblemName());
+
+  // arrays straight from file
+  loadProblem(m.getNumCols(),m.getNumRows(),m.getColumnStarts(),
+	      m.getIndices(),m.getElements(),m.getColLower(),m.getColUpper(),
+	      m.getObjCoefficients(),m.getRowLower(),m.getRowUpper());
+  setObjSense(m.objectiveSense());
+  const char * integer = m.integerColumns();
+  int nCols=m.getNumCols();
+  int nRows=m.getNumRows();
+  if (integer) {
+    int i,n=0;
+    int * index = new int [nCols];
+    for (i=0;i<nCols;i++) {
+      if (integer[i]) {
+	index[n++]=i;
+      }
+    }
+    setInteger(index,n);
+    delete [] index;
+    if (n) 
+      modelPtr_->copyInIntegerInformation(integer);
+  }
+  if (m.hasNames()) {
+    // set objective name
+    setObjName(m.getObjectiveName());
+
+    // Always keep names
+    int nameDiscipline;
+    getIntParam(OsiNameDiscipline,nameDiscipline) ;
+    int iRow;
+    std::vector<std::string> rowNames = std::vector<std::string> ();
+    std::vector<std::string> columnNames = std::vector<std::string> ();
+    rowNames.reserve(nRows);
+    for (iRow=0;iRow<nRows;iRow++) {
+      const char * name = m.rowName(iRow);
+      rowNames.push_back(name);
+      if (nameDiscipline) 
+	OsiSolverInterface::setRowName(iRow,name) ;
+    }
+    
+    int iColumn;
+    columnNames.reserve(nCols);
+    for (iColumn=0;iColumn<nCols;iColumn++) {
+      const char * name = m.columnName(iColumn);
+      columnNames.push_back(name);
+      if (nameDiscipline) 
+	OsiSolverInterface::setColName(iColumn,name) ;
+    }
+    modelPtr_->copyNames(rowNames,columnNames);
+  }
+  return 0;
+}
 /* Write the problem into an Lp file of the given filename.
    If objSense is non zero then -1.0 forces the code to write a
    maximization objective and +1.0 to write a minimization one.
@@ -6096,6 +6173,94 @@ OsiClpSolverInterface::getBInvARow(int row, CoinIndexedVector * columnArray0, Co
   if (!slack)
     rowArray1->clear();
 }
+//Get several rows of the tableau (sparse)
+void 
+OsiClpSolverInterface::getBInvARows(int number, const int * rows,
+				    CoinPackedMatrix & result) const
+{
+  CoinIndexedVector * rowArray0 = modelPtr_->rowArray(0);
+  CoinIndexedVector * rowArray1 = modelPtr_->rowArray(1);
+  CoinIndexedVector * columnArray0 = modelPtr_->columnArray(0);
+  CoinIndexedVector * columnArray1 = modelPtr_->columnArray(1);
+  int numberRows = modelPtr_->numberRows();
+  int numberColumns = modelPtr_->numberColumns();
+  const int * pivotVariable = modelPtr_->pivotVariable();
+  const double * rowScale = modelPtr_->rowScale();
+  const double * columnScale = modelPtr_->columnScale();
+  ClpFactorization * factorization = modelPtr_->factorization();
+  ClpMatrixBase * matrix = modelPtr_->clpMatrix();
+  CoinBigIndex * start = new CoinBigIndex [number+1];
+  std::vector<int> index;
+  std::vector<double> element;
+  start[0]=0;
+  for (int i=0;i<number;i++) {
+    int row = rows[i];
+#ifndef NDEBUG
+    if (row<0||row>=numberRows) {
+      indexError(row,"getBInvARows");
+    }
+#endif
+    rowArray0->clear();
+    rowArray1->clear();
+    columnArray0->clear();
+    columnArray1->clear();
+    // put +1 in row (-1 if slack as clp stores slack as -1.0) and scale
+    int pivot = pivotVariable[row];
+    double value;
+    if (!rowScale) {
+      if (pivot<numberColumns)
+	value = 1.0;
+      else
+	value = -1.0;
+    } else {
+      if (pivot<numberColumns)
+	value = columnScale[pivot];
+      else
+	value = -1.0/rowScale[pivot-numberColumns];
+    }
+    rowArray1->insert(row,value);
+    factorization->updateColumnTranspose(rowArray0,rowArray1);
+    // row of tableau in rowArray1 and columnArray0
+    matrix->transposeTimes(modelPtr_,1.0,rowArray1,columnArray1,columnArray0);
+    int n = columnArray0->getNumElements();
+    const int * which = columnArray0->getIndices();
+    const double * array = columnArray0->denseVector();
+    bool packed = columnArray0->packedMode();
+    for (int j=0;j<n;j++) {
+      int k = which[j];
+      double entry = packed ? array[j] : array[k];
+      if (entry) {
+	if (rowScale)
+	  entry /= columnScale[k];
+	index.push_back(k);
+	element.push_back(entry);
+      }
+    }
+    n = rowArray1->getNumElements();
+    which = rowArray1->getIndices();
+    array = rowArray1->denseVector();
+    packed = rowArray1->packedMode();
+    for (int j=0;j<n;j++) {
+      int k = which[j];
+      double entry = packed ? array[j] : array[k];
+      if (entry) {
+	if (rowScale)
+	  entry *= rowScale[k];
+	index.push_back(k+numberColumns);
+	element.push_back(entry);
+      }
+    }
+    start[i+1]=static_cast<CoinBigIndex>(index.size());
+  }
+  rowArray0->clear();
+  rowArray1->clear();
+  columnArray0->clear();
+  columnArray1->clear();
+  result.copyOf(false,numberColumns+numberRows,number,start[number],
+		element.empty() ? NULL : &element[0],
+		index.empty() ? NULL : &index[0],start,NULL);
+  delete [] start;
+}
 
 //Get a row of the basis inverse
 void 
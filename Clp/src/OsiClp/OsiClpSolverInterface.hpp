@@ -145,6 +145,14 @@ public:
   virtual void getBInvARow(int row, CoinIndexedVector * z, CoinIndexedVector * slack=NULL,
 			   bool keepScaled=false) const;
   
+  /** Get several rows of the tableau in sparse form (see
+      OsiSolverInterface).  Each row is one sparse btran and a
+      transposeTimes which uses the row copy when that is sparse, so
+      nothing is done at the size of the model for each row.
+  */
+  virtual void getBInvARows(int number, const int * rows,
+			    CoinPackedMatrix & result) const;
+  
   ///Get a row of the basis inverse
   virtual void getBInvRow(int row, double* z) const;
   
@@ -957,6 +965,8 @@ public:
                              double objSense=0.0) const ;
   /// Read file in LP format (with names)
   virtual int readLp(const char *filename, const double epsilon = 1e-5);
+  /// Read binary model file (with names)
+  virtual int readModelFile(const char *filename, bool verify = false);
   /** Write the problem into an Lp file of the given filename.
       If objSense is non zero then -1.0 forces the code to write a
       maximization objective and +1.0 to write a minimization one.
@@ -36,6 +36,7 @@
 #include "ClpSimplexOther.hpp"
 #include "ClpSimplexNonlinear.hpp"
 #include "ClpInterior.hpp"
+#include "ClpCholeskyDense.hpp"
 #include "ClpLinearObjective.hpp"
 #include "ClpDualRowSteepest.hpp"
 #include "ClpDualRowDantzig.hpp"
@@ -2351,6 +2352,32 @@ ClpSimplexUnitTest(const std::string & dirSample)
                std::cerr << "Error reading exmip1 from sample data. Skipping test." << std::endl;
           }
      }
+     // Test dense Cholesky on more than one thread
+     {
+          CoinMpsIO m;
+          std::string fn = dirSample + "e226";
+          if (m.readMps(fn.c_str(), "mps") == 0) {
+               double objective[2];
+               int iterations[2];
+               for (int iPass = 0; iPass < 2; iPass++) {
+                    ClpInterior solution;
+                    solution.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+                                         m.getObjCoefficients(),
+                                         m.getRowLower(), m.getRowUpper());
+                    solution.setCholesky(new ClpCholeskyDense());
+                    solution.setNumberThreads(iPass ? 3 : 1);
+                    solution.setLogLevel(0);
+                    solution.primalDual();
+                    objective[iPass] = solution.objectiveValue();
+                    iterations[iPass] = solution.numberIterations();
+               }
+               // threads do same arithmetic so should be identical
+               assert (objective[0] == objective[1]);
+               assert (iterations[0] == iterations[1]);
+          } else {
+               std::cerr << "Error reading e226 from sample data. Skipping test." << std::endl;
+          }
+     }
 #endif
      // test network
 #define QUADRATIC
@@ -62,6 +62,8 @@ static Coin_message us_english[]=
 # endif
   {COIN_GENERAL_INFO,9,1,"%s"},
   {COIN_GENERAL_WARNING,3007,1,"%s"},
+  {COIN_SOLVER_MODEL_FILE,10,1,"Model file %s has %d rows, %d columns and %d elements"},
+  {COIN_SOLVER_MODEL_FILE_BAD,6006,0,"Unable to read model file %s - %s"},
   {COIN_DUMMY_END,999999,0,""}
 };
 // **** aiutami!
@@ -64,6 +64,8 @@ enum COIN_Message
 # endif
   COIN_GENERAL_INFO,
   COIN_GENERAL_WARNING,
+  COIN_SOLVER_MODEL_FILE,
+  COIN_SOLVER_MODEL_FILE_BAD,
   COIN_DUMMY_END
 };
 
@@ -0,0 +1,631 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+#include "CoinPragma.hpp"
+#include "CoinFinite.hpp"
+#include "CoinModelFile.hpp"
+
+/* Files are memory mapped if configure found mmap and COIN_NO_MMAP is
+   not defined, otherwise they are read into memory. */
+#if !defined(COIN_NO_MMAP) && defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+#define COIN_MODEL_FILE_HAS_MMAP 1
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// Size of header
+#define COIN_MODEL_FILE_HEADER 256
+// Version written
+#define COIN_MODEL_FILE_VERSION 1
+// Where section positions start in header
+#define COIN_MODEL_FILE_SECTIONS 80
+
+namespace {
+  const char modelFileMagic[8] = {'C','o','i','n','M','d','l','\0'};
+  const int modelFileEndian = 0x01020304;
+  const CoinUInt64 fnvOffset = 14695981039346656037ULL;
+  const CoinUInt64 fnvPrime = 1099511628211ULL;
+  // Adds bytes to FNV-1a checksum
+  inline CoinUInt64 checksum(CoinUInt64 hash, const void * data, size_t number)
+  {
+    const unsigned char * bytes = static_cast<const unsigned char *>(data);
+    for (size_t i=0;i<number;i++) {
+      hash ^= bytes[i];
+      hash *= fnvPrime;
+    }
+    return hash;
+  }
+  // Sections in order written
+  enum ModelFileSection {
+    sectionStarts=0,
+    sectionIndices,
+    sectionElements,
+    sectionColumnLower,
+    sectionColumnUpper,
+    sectionObjective,
+    sectionRowLower,
+    sectionRowUpper,
+    sectionInteger,
+    sectionNames,
+    sectionOriginalColumns,
+    sectionOriginalRows,
+    numberSections
+  };
+  // Header layout
+  struct ModelFileHeader {
+    int version;
+    int flags;
+    int bigIndexSize;
+    CoinInt64 numberRows;
+    CoinInt64 numberColumns;
+    CoinInt64 numberElements;
+    double objectiveOffset;
+    double objectiveSense;
+    CoinUInt64 checksum;
+    CoinInt64 fileSize;
+    CoinInt64 position[numberSections];
+  };
+  void packHeader(const ModelFileHeader & header, char * buffer)
+  {
+    memset(buffer,0,COIN_MODEL_FILE_HEADER);
+    memcpy(buffer,modelFileMagic,8);
+    memcpy(buffer+8,&header.version,4);
+    memcpy(buffer+12,&modelFileEndian,4);
+    memcpy(buffer+16,&header.flags,4);
+    memcpy(buffer+20,&header.bigIndexSize,4);
+    memcpy(buffer+24,&header.numberRows,8);
+    memcpy(buffer+32,&header.numberColumns,8);
+    memcpy(buffer+40,&header.numberElements,8);
+    memcpy(buffer+48,&header.objectiveOffset,8);
+    memcpy(buffer+56,&header.objectiveSense,8);
+    memcpy(buffer+64,&header.checksum,8);
+    memcpy(buffer+72,&header.fileSize,8);
+    memcpy(buffer+COIN_MODEL_FILE_SECTIONS,header.position,
+	   8*numberSections);
+  }
+  // Returns false if not a model file of a version we can read
+  bool unpackHeader(const char * buffer, ModelFileHeader & header)
+  {
+    int endian;
+    memcpy(&header.version,buffer+8,4);
+    memcpy(&endian,buffer+12,4);
+    if (memcmp(buffer,modelFileMagic,8)||endian!=modelFileEndian||
+	header.version<1||header.version>COIN_MODEL_FILE_VERSION)
+      return false;
+    memcpy(&header.flags,buffer+16,4);
+    memcpy(&header.bigIndexSize,buffer+20,4);
+    memcpy(&header.numberRows,buffer+24,8);
+    memcpy(&header.numberColumns,buffer+32,8);
+    memcpy(&header.numberElements,buffer+40,8);
+    memcpy(&header.objectiveOffset,buffer+48,8);
+    memcpy(&header.objectiveSense,buffer+56,8);
+    memcpy(&header.checksum,buffer+64,8);
+    memcpy(&header.fileSize,buffer+72,8);
+    memcpy(header.position,buffer+COIN_MODEL_FILE_SECTIONS,
+	   8*numberSections);
+    return header.bigIndexSize==4||header.bigIndexSize==8;
+  }
+  // Writes sections keeping position and checksum
+  class ModelFileOutput {
+  public:
+    ModelFileOutput(FILE * fp, bool doChecksum)
+      : fp_(fp), position_(COIN_MODEL_FILE_HEADER), checksum_(fnvOffset),
+	doChecksum_(doChecksum), failed_(false) {}
+    void write(const void * data, size_t number)
+    {
+      if (!number)
+	return;
+      if (fwrite(data,1,number,fp_)!=number)
+	failed_=true;
+      if (doChecksum_)
+	checksum_ = checksum(checksum_,data,number);
+      position_ += number;
+    }
+    // Pads to 8 bytes and returns position
+    CoinInt64 startSection()
+    {
+      static const char zero[8]={0,0,0,0,0,0,0,0};
+      write(zero,static_cast<size_t>((8-(position_&7))&7));
+      return position_;
+    }
+    FILE * fp_;
+    CoinInt64 position_;
+    CoinUInt64 checksum_;
+    bool doChecksum_;
+    bool failed_;
+  };
+}
+
+//-------------------------------------------------------------------
+// Open (map) file
+//-------------------------------------------------------------------
+int
+CoinModelFile::open(const char * fileName, bool verify)
+{
+  close();
+#ifdef COIN_MODEL_FILE_HAS_MMAP
+  int fd = ::open(fileName,O_RDONLY);
+  if (fd<0)
+    return 1;
+  struct stat buffer;
+  if (fstat(fd,&buffer)) {
+    ::close(fd);
+    return 1;
+  }
+  size_t size = static_cast<size_t>(buffer.st_size);
+  if (size<COIN_MODEL_FILE_HEADER) {
+    ::close(fd);
+    return 2;
+  }
+  void * address = mmap(NULL,size,PROT_READ,MAP_PRIVATE,fd,0);
+  ::close(fd);
+  if (address==MAP_FAILED)
+    return 1;
+  // arrays are read front to back
+  madvise(address,size,MADV_SEQUENTIAL);
+  data_ = static_cast<const char *>(address);
+  mapped_ = true;
+#else
+  FILE * fp = fopen(fileName,"rb");
+  if (!fp)
+    return 1;
+  // 64 bit positions as long may only be 32 bits
+#ifdef _MSC_VER
+  _fseeki64(fp,0,SEEK_END);
+  __int64 position = _ftelli64(fp);
+  _fseeki64(fp,0,SEEK_SET);
+#else
+  fseeko(fp,0,SEEK_END);
+  off_t position = ftello(fp);
+  fseeko(fp,0,SEEK_SET);
+#endif
+  if (position<0) {
+    fclose(fp);
+    return 1;
+  }
+  size_t size = static_cast<size_t>(position);
+  if (size<COIN_MODEL_FILE_HEADER) {
+    fclose(fp);
+    return 2;
+  }
+  // doubles so aligned
+  double * temp = new double [(size+7)/8];
+  size_t numberRead = fread(temp,1,size,fp);
+  fclose(fp);
+  data_ = reinterpret_cast<const char *>(temp);
+  mapped_ = false;
+  if (numberRead!=size) {
+    close();
+    return 3;
+  }
+#endif
+  size_ = size;
+  ModelFileHeader header;
+  if (!unpackHeader(data_,header)) {
+    close();
+    return 2;
+  }
+  if (header.bigIndexSize>static_cast<int>(sizeof(CoinBigIndex))&&
+      header.numberElements>COIN_INT_MAX) {
+    // can not be held
+    close();
+    return 2;
+  }
+  CoinInt64 numberRows = header.numberRows;
+  CoinInt64 numberColumns = header.numberColumns;
+  CoinInt64 numberElements = header.numberElements;
+  if (header.fileSize!=static_cast<CoinInt64>(size_)||
+      numberRows<0||numberRows>COIN_INT_MAX||
+      numberColumns<0||numberColumns>=COIN_INT_MAX||
+      numberElements<0) {
+    close();
+    return 3;
+  }
+  // Check every section lies in file
+  CoinInt64 length[numberSections];
+  length[sectionStarts]=(numberColumns+1)*header.bigIndexSize;
+  length[sectionIndices]=numberElements*sizeof(int);
+  length[sectionElements]=numberElements*sizeof(double);
+  length[sectionColumnLower]=numberColumns*sizeof(double);
+  length[sectionColumnUpper]=numberColumns*sizeof(double);
+  length[sectionObjective]=numberColumns*sizeof(double);
+  length[sectionRowLower]=numberRows*sizeof(double);
+  length[sectionRowUpper]=numberRows*sizeof(double);
+  length[sectionInteger]=numberColumns;
+  length[sectionNames]=(numberRows+numberColumns+3)*8;
+  length[sectionOriginalColumns]=numberColumns*sizeof(int);
+  length[sectionOriginalRows]=numberRows*sizeof(int);
+  for (int iSection=0;iSection<numberSections;iSection++) {
+    CoinInt64 position = header.position[iSection];
+    if (!position&&iSection>=sectionInteger)
+      continue; // optional
+    if (position<COIN_MODEL_FILE_HEADER||(position&7)!=0||
+	position+length[iSection]>static_cast<CoinInt64>(size_)) {
+      close();
+      return 3;
+    }
+  }
+  if (verify&&(header.flags&1)!=0) {
+    CoinUInt64 sum = checksum(fnvOffset,data_+COIN_MODEL_FILE_HEADER,
+			      size_-COIN_MODEL_FILE_HEADER);
+    if (sum!=header.checksum) {
+      close();
+      return 3;
+    }
+  }
+  numberRows_ = static_cast<int>(numberRows);
+  numberColumns_ = static_cast<int>(numberColumns);
+  const char * starts = data_+header.position[sectionStarts];
+  if (header.bigIndexSize==static_cast<int>(sizeof(CoinBigIndex))) {
+    columnStart_ = reinterpret_cast<const CoinBigIndex *>(starts);
+  } else {
+    startCopy_ = new CoinBigIndex [numberColumns_+1];
+    if (header.bigIndexSize==4) {
+      const int * start = reinterpret_cast<const int *>(starts);
+      for (int i=0;i<=numberColumns_;i++)
+	startCopy_[i]=start[i];
+    } else {
+      const CoinInt64 * start = reinterpret_cast<const CoinInt64 *>(starts);
+      for (int i=0;i<=numberColumns_;i++)
+	startCopy_[i]=static_cast<CoinBigIndex>(start[i]);
+    }
+    columnStart_ = startCopy_;
+  }
+  row_ = reinterpret_cast<const int *>(data_+header.position[sectionIndices]);
+  // starts must not go back and row indices must be in range
+  bool good = columnStart_[0]==0&&
+    static_cast<CoinInt64>(columnStart_[numberColumns_])==numberElements;
+  for (int i=0;i<numberColumns_&&good;i++) {
+    if (columnStart_[i+1]<columnStart_[i])
+      good=false;
+  }
+  for (CoinBigIndex j=0;j<columnStart_[numberColumns_]&&good;j++) {
+    if (row_[j]<0||row_[j]>=numberRows_)
+      good=false;
+  }
+  if (!good) {
+    close();
+    return 3;
+  }
+  element_ = reinterpret_cast<const double *>
+    (data_+header.position[sectionElements]);
+  columnLower_ = reinterpret_cast<const double *>
+    (data_+header.position[sectionColumnLower]);
+  columnUpper_ = reinterpret_cast<const double *>
+    (data_+header.position[sectionColumnUpper]);
+  objective_ = reinterpret_cast<const double *>
+    (data_+header.position[sectionObjective]);
+  rowLower_ = reinterpret_cast<const double *>
+    (data_+header.position[sectionRowLower]);
+  rowUpper_ = reinterpret_cast<const double *>
+    (data_+header.position[sectionRowUpper]);
+  if (header.position[sectionInteger])
+    integerType_ = data_+header.position[sectionInteger];
+  if (header.position[sectionNames]) {
+    names_ = data_+header.position[sectionNames];
+    nameOffsets_ = reinterpret_cast<const CoinInt64 *>(names_);
+    // all names must be in file and end in zero byte
+    int numberNames = numberRows_+numberColumns_+2;
+    CoinInt64 tableEnd = length[sectionNames];
+    CoinInt64 available = static_cast<CoinInt64>(size_)-
+      header.position[sectionNames];
+    CoinInt64 last = nameOffsets_[numberNames];
+    good = nameOffsets_[0]==tableEnd&&last<=available&&
+      last>tableEnd&&names_[last-1]=='\0';
+    for (int i=1;i<numberNames&&good;i++) {
+      if (nameOffsets_[i]<nameOffsets_[i-1]||nameOffsets_[i]>=last)
+	good=false;
+    }
+    if (!good) {
+      close();
+      return 3;
+    }
+  }
+  if (header.position[sectionOriginalColumns])
+    originalColumns_ = reinterpret_cast<const int *>
+      (data_+header.position[sectionOriginalColumns]);
+  if (header.position[sectionOriginalRows])
+    originalRows_ = reinterpret_cast<const int *>
+      (data_+header.position[sectionOriginalRows]);
+  objectiveOffset_ = header.objectiveOffset;
+  objectiveSense_ = header.objectiveSense;
+  fileName_ = fileName;
+  return 0;
+}
+
+// Unmap file (and forget anything passed in)
+void
+CoinModelFile::close()
+{
+  if (data_) {
+#ifdef COIN_MODEL_FILE_HAS_MMAP
+    if (mapped_)
+      munmap(const_cast<char *>(data_),size_);
+    else
+#endif
+      delete [] reinterpret_cast<const double *>(data_);
+  }
+  data_=NULL;
+  size_=0;
+  mapped_=false;
+  delete matrixCopy_;
+  matrixCopy_=NULL;
+  delete [] startCopy_;
+  startCopy_=NULL;
+  numberRows_=0;
+  numberColumns_=0;
+  columnStart_=NULL;
+  row_=NULL;
+  element_=NULL;
+  columnLower_=NULL;
+  columnUpper_=NULL;
+  objective_=NULL;
+  rowLower_=NULL;
+  rowUpper_=NULL;
+  integerType_=NULL;
+  names_=NULL;
+  nameOffsets_=NULL;
+  problemNames_[0]="";
+  problemNames_[1]="";
+  rowNames_.clear();
+  columnNames_.clear();
+  originalColumns_=NULL;
+  originalRows_=NULL;
+  objectiveOffset_=0.0;
+  objectiveSense_=1.0;
+  fileName_="";
+}
+
+// True if file starts like a model file
+bool
+CoinModelFile::isModelFile(const char * fileName)
+{
+  FILE * fp = fopen(fileName,"rb");
+  if (!fp)
+    return false;
+  char buffer[COIN_MODEL_FILE_HEADER];
+  size_t numberRead = fread(buffer,1,COIN_MODEL_FILE_HEADER,fp);
+  fclose(fp);
+  ModelFileHeader header;
+  return numberRead==COIN_MODEL_FILE_HEADER&&unpackHeader(buffer,header);
+}
+
+//-------------------------------------------------------------------
+// Names
+//-------------------------------------------------------------------
+const char *
+CoinModelFile::getProblemName() const
+{
+  if (names_)
+    return names_+nameOffsets_[0];
+  else
+    return problemNames_[0].c_str();
+}
+
+const char *
+CoinModelFile::getObjectiveName() const
+{
+  if (names_)
+    return names_+nameOffsets_[1];
+  else
+    return problemNames_[1].c_str();
+}
+
+const char *
+CoinModelFile::rowName(int i) const
+{
+  assert (i>=0&&i<numberRows_);
+  if (names_)
+    return names_+nameOffsets_[2+i];
+  else if (i<static_cast<int>(rowNames_.size()))
+    return rowNames_[i].c_str();
+  else if (hasNames())
+    return "";
+  else
+    return NULL;
+}
+
+const char *
+CoinModelFile::columnName(int i) const
+{
+  assert (i>=0&&i<numberColumns_);
+  if (names_)
+    return names_+nameOffsets_[2+numberRows_+i];
+  else if (i<static_cast<int>(columnNames_.size()))
+    return columnNames_[i].c_str();
+  else if (hasNames())
+    return "";
+  else
+    return NULL;
+}
+
+//-------------------------------------------------------------------
+// Writing
+//-------------------------------------------------------------------
+void
+CoinModelFile::setModel(const CoinPackedMatrix & matrix,
+			const double * columnLower, const double * columnUpper,
+			const double * objective, const char * integerType,
+			const double * rowLower, const double * rowUpper)
+{
+  close();
+  const CoinPackedMatrix * columnCopy = &matrix;
+  if (!matrix.isColOrdered()||matrix.hasGaps()) {
+    matrixCopy_ = new CoinPackedMatrix(matrix);
+    if (!matrixCopy_->isColOrdered())
+      matrixCopy_->reverseOrdering();
+    matrixCopy_->removeGaps();
+    columnCopy = matrixCopy_;
+  }
+  numberRows_ = columnCopy->getNumRows();
+  numberColumns_ = columnCopy->getNumCols();
+  columnStart_ = columnCopy->getVectorStarts();
+  row_ = columnCopy->getIndices();
+  element_ = columnCopy->getElements();
+  columnLower_ = columnLower;
+  columnUpper_ = columnUpper;
+  objective_ = objective;
+  rowLower_ = rowLower;
+  rowUpper_ = rowUpper;
+  integerType_ = NULL;
+  if (integerType) {
+    // only keep if any integer
+    for (int i=0;i<numberColumns_;i++) {
+      if (integerType[i]) {
+	integerType_ = integerType;
+	break;
+      }
+    }
+  }
+}
+
+void
+CoinModelFile::setNames(const char * problemName, const char * objectiveName,
+			const std::vector<std::string> & rowNames,
+			const std::vector<std::string> & columnNames)
+{
+  assert (!data_);
+  problemNames_[0] = problemName ? problemName : "";
+  problemNames_[1] = objectiveName ? objectiveName : "";
+  rowNames_ = rowNames;
+  columnNames_ = columnNames;
+}
+
+void
+CoinModelFile::setOriginalIndices(const int * originalColumns,
+				  const int * originalRows)
+{
+  assert (!data_);
+  originalColumns_ = originalColumns;
+  originalRows_ = originalRows;
+}
+
+int
+CoinModelFile::write(const char * fileName, bool doChecksum) const
+{
+  FILE * fp = fopen(fileName,"wb");
+  if (!fp)
+    return 1;
+  ModelFileOutput output(fp,doChecksum);
+  // header written at end
+  char buffer[COIN_MODEL_FILE_HEADER];
+  memset(buffer,0,COIN_MODEL_FILE_HEADER);
+  if (fwrite(buffer,1,COIN_MODEL_FILE_HEADER,fp)!=COIN_MODEL_FILE_HEADER)
+    output.failed_=true;
+  ModelFileHeader header;
+  memset(&header,0,sizeof(header));
+  header.version = COIN_MODEL_FILE_VERSION;
+  header.flags = doChecksum ? 1 : 0;
+  header.bigIndexSize = static_cast<int>(sizeof(CoinBigIndex));
+  header.numberRows = numberRows_;
+  header.numberColumns = numberColumns_;
+  CoinBigIndex numberElements = getNumElements();
+  header.numberElements = numberElements;
+  header.objectiveOffset = objectiveOffset_;
+  header.objectiveSense = objectiveSense_;
+  header.position[sectionStarts] = output.startSection();
+  if (columnStart_) {
+    output.write(columnStart_,(numberColumns_+1)*sizeof(CoinBigIndex));
+  } else {
+    CoinBigIndex zero=0;
+    output.write(&zero,sizeof(CoinBigIndex));
+  }
+  header.position[sectionIndices] = output.startSection();
+  output.write(row_,numberElements*sizeof(int));
+  header.position[sectionElements] = output.startSection();
+  output.write(element_,numberElements*sizeof(double));
+  header.position[sectionColumnLower] = output.startSection();
+  output.write(columnLower_,numberColumns_*sizeof(double));
+  header.position[sectionColumnUpper] = output.startSection();
+  output.write(columnUpper_,numberColumns_*sizeof(double));
+  header.position[sectionObjective] = output.startSection();
+  output.write(objective_,numberColumns_*sizeof(double));
+  header.position[sectionRowLower] = output.startSection();
+  output.write(rowLower_,numberRows_*sizeof(double));
+  header.position[sectionRowUpper] = output.startSection();
+  output.write(rowUpper_,numberRows_*sizeof(double));
+  if (integerType_) {
+    header.position[sectionInteger] = output.startSection();
+    output.write(integerType_,numberColumns_);
+  }
+  if (hasNames()) {
+    header.position[sectionNames] = output.startSection();
+    int numberNames = numberRows_+numberColumns_+2;
+    std::vector<const char *> name(numberNames);
+    name[0] = getProblemName();
+    name[1] = getObjectiveName();
+    for (int i=0;i<numberRows_;i++)
+      name[2+i] = rowName(i);
+    for (int i=0;i<numberColumns_;i++)
+      name[2+numberRows_+i] = columnName(i);
+    std::vector<CoinInt64> offset(numberNames+1);
+    offset[0] = 8*(numberNames+1);
+    for (int i=0;i<numberNames;i++)
+      offset[i+1] = offset[i]+strlen(name[i])+1;
+    output.write(&offset[0],offset.size()*sizeof(CoinInt64));
+    for (int i=0;i<numberNames;i++)
+      output.write(name[i],strlen(name[i])+1);
+  }
+  if (originalColumns_) {
+    header.position[sectionOriginalColumns] = output.startSection();
+    output.write(originalColumns_,numberColumns_*sizeof(int));
+  }
+  if (originalRows_) {
+    header.position[sectionOriginalRows] = output.startSection();
+    output.write(originalRows_,numberRows_*sizeof(int));
+  }
+  header.fileSize = output.position_;
+  header.checksum = doChecksum ? output.checksum_ : 0;
+  packHeader(header,buffer);
+  if (fseek(fp,0,SEEK_SET)||
+      fwrite(buffer,1,COIN_MODEL_FILE_HEADER,fp)!=COIN_MODEL_FILE_HEADER)
+    output.failed_=true;
+  if (fclose(fp))
+    output.failed_=true;
+  return output.failed_ ? 1 : 0;
+}
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+CoinModelFile::CoinModelFile ()
+  : data_(NULL),
+    size_(0),
+    mapped_(false),
+    matrixCopy_(NULL),
+    startCopy_(NULL),
+    numberRows_(0),
+    numberColumns_(0),
+    columnStart_(NULL),
+    row_(NULL),
+    element_(NULL),
+    columnLower_(NULL),
+    columnUpper_(NULL),
+    objective_(NULL),
+    rowLower_(NULL),
+    rowUpper_(NULL),
+    integerType_(NULL),
+    names_(NULL),
+    nameOffsets_(NULL),
+    originalColumns_(NULL),
+    originalRows_(NULL),
+    objectiveOffset_(0.0),
+    objectiveSense_(1.0)
+{
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+CoinModelFile::~CoinModelFile ()
+{
+  close();
+}
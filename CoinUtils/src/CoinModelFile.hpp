@@ -0,0 +1,237 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CoinModelFile_H
+#define CoinModelFile_H
+
+#include <string>
+#include <vector>
+
+#include "CoinUtilsConfig.h"
+#include "CoinTypes.hpp"
+#include "CoinPackedMatrix.hpp"
+
+/** Binary model file.
+
+    Holds a problem exactly as OsiSolverInterface::loadProblem wants it -
+    column ordered matrix without gaps, bounds, objective and row bounds
+    - so a problem can be loaded without any text parsing.  Integrality,
+    names and a mapping back to an original problem (as given by
+    CglPreProcess) are optional.
+
+    Version 1 layout (native byte order, checked by header):
+
+    - header of 256 bytes - "CoinMdl" and a zero byte, version (int),
+      0x01020304 (int), flags (int, 1 if checksum), sizeof(CoinBigIndex)
+      (int), number of rows, columns and elements (64 bit), objective
+      offset and sense (doubles), checksum (64 bit, zero if none), file
+      size (64 bit) then position of each section (64 bit, zero if
+      absent).
+    - sections, each starting on an 8 byte boundary - column starts
+      (CoinBigIndex), row indices (int), elements, column lower and upper
+      bounds, objective, row lower and upper bounds (doubles),
+      integrality (char), names, original columns and original rows
+      (int).
+    - names are a table of 64 bit offsets (from start of section) to
+      problem name, objective name, row names, column names and end,
+      followed by the zero terminated names.
+
+    The checksum is 64 bit FNV-1a over everything after the header.
+
+    The file is mapped so the arrays returned point straight into it and
+    loading is just the cost of bringing the pages in.  If the file was
+    written with a different size of CoinBigIndex the starts are
+    converted.
+
+    To write, pass arrays with setModel etc (no copies are made unless
+    the matrix is row ordered or has gaps) and then call write.
+*/
+class CoinModelFile {
+
+public:
+
+  /**@name Reading */
+  //@{
+  /** Open (map) file.  Section extents, column starts and row indices
+      are always checked and if verify the checksum (if any) as well.
+      Returns 0 if OK, 1 if can not be opened, 2 if not a model file,
+      3 if truncated or checksum wrong. */
+  int open(const char * fileName, bool verify=false);
+  /// Unmap file (and forget anything passed in)
+  void close();
+  /// True if file starts like a model file
+  static bool isModelFile(const char * fileName);
+  /// True if a file is open
+  inline bool isOpen() const
+  { return data_!=NULL;}
+  /// Name of file open
+  inline const char * fileName() const
+  { return fileName_.c_str();}
+  //@}
+
+  /**@name Problem (from file or as passed in) */
+  //@{
+  /// Number of rows
+  inline int getNumRows() const
+  { return numberRows_;}
+  /// Number of columns
+  inline int getNumCols() const
+  { return numberColumns_;}
+  /// Number of elements
+  inline CoinBigIndex getNumElements() const
+  { return numberColumns_ ? columnStart_[numberColumns_] : 0;}
+  /// Column starts (numberColumns+1)
+  inline const CoinBigIndex * getColumnStarts() const
+  { return columnStart_;}
+  /// Row indices
+  inline const int * getIndices() const
+  { return row_;}
+  /// Elements
+  inline const double * getElements() const
+  { return element_;}
+  /// Column lower bounds
+  inline const double * getColLower() const
+  { return columnLower_;}
+  /// Column upper bounds
+  inline const double * getColUpper() const
+  { return columnUpper_;}
+  /// Objective
+  inline const double * getObjCoefficients() const
+  { return objective_;}
+  /// Row lower bounds
+  inline const double * getRowLower() const
+  { return rowLower_;}
+  /// Row upper bounds
+  inline const double * getRowUpper() const
+  { return rowUpper_;}
+  /// Integrality (1 if integer) or NULL if all continuous
+  inline const char * integerColumns() const
+  { return integerType_;}
+  /// True if column is integer
+  inline bool isInteger(int i) const
+  { return integerType_&&integerType_[i]!=0;}
+  /// Objective offset (as OsiObjOffset)
+  inline double objectiveOffset() const
+  { return objectiveOffset_;}
+  /// Objective sense (1 minimize, -1 maximize)
+  inline double objectiveSense() const
+  { return objectiveSense_;}
+  /// True if names
+  inline bool hasNames() const
+  { return names_!=NULL||!rowNames_.empty()||!columnNames_.empty();}
+  /// Problem name ("" if none)
+  const char * getProblemName() const;
+  /// Objective name ("" if none)
+  const char * getObjectiveName() const;
+  /// Row name or NULL if no names
+  const char * rowName(int i) const;
+  /// Column name or NULL if no names
+  const char * columnName(int i) const;
+  /// Original column of each column or NULL
+  inline const int * originalColumns() const
+  { return originalColumns_;}
+  /// Original row of each row or NULL
+  inline const int * originalRows() const
+  { return originalRows_;}
+  //@}
+
+  /**@name Writing */
+  //@{
+  /** Pass in problem (arrays are not copied so must last until write).
+      Matrix may be either ordering.  Integrality may be NULL. */
+  void setModel(const CoinPackedMatrix & matrix,
+		const double * columnLower, const double * columnUpper,
+		const double * objective, const char * integerType,
+		const double * rowLower, const double * rowUpper);
+  /// Pass in names (copied); empty vectors for no names
+  void setNames(const char * problemName, const char * objectiveName,
+		const std::vector<std::string> & rowNames,
+		const std::vector<std::string> & columnNames);
+  /** Pass in mapping to original problem (not copied) - as from
+      CglPreProcess::originalColumns() and originalRows().  Either may be
+      NULL. */
+  void setOriginalIndices(const int * originalColumns,
+			  const int * originalRows);
+  /// Set objective offset (as OsiObjOffset)
+  inline void setObjectiveOffset(double value)
+  { objectiveOffset_=value;}
+  /// Set objective sense (1 minimize, -1 maximize)
+  inline void setObjectiveSense(double value)
+  { objectiveSense_=value;}
+  /** Write problem as passed in (or as open).
+      Returns 0 if OK, 1 if can not be opened or a write failed. */
+  int write(const char * fileName, bool checksum=true) const;
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor
+  CoinModelFile ();
+  /// Destructor
+  ~CoinModelFile ();
+  //@}
+
+private:
+  /// Not copyable
+  CoinModelFile (const CoinModelFile &);
+  CoinModelFile & operator=(const CoinModelFile &);
+
+  /**@name Private member data */
+  //@{
+  /// Name of file
+  std::string fileName_;
+  /// File contents
+  const char * data_;
+  /// Number of bytes
+  size_t size_;
+  /// True if data_ mapped (otherwise allocated)
+  bool mapped_;
+  /// Column ordered copy of matrix passed in (if needed)
+  CoinPackedMatrix * matrixCopy_;
+  /// Converted starts (if file has other size of CoinBigIndex)
+  CoinBigIndex * startCopy_;
+  /// Number of rows
+  int numberRows_;
+  /// Number of columns
+  int numberColumns_;
+  /// Column starts
+  const CoinBigIndex * columnStart_;
+  /// Row indices
+  const int * row_;
+  /// Elements
+  const double * element_;
+  /// Column lower
+  const double * columnLower_;
+  /// Column upper
+  const double * columnUpper_;
+  /// Objective
+  const double * objective_;
+  /// Row lower
+  const double * rowLower_;
+  /// Row upper
+  const double * rowUpper_;
+  /// Integrality
+  const char * integerType_;
+  /// Names section in file
+  const char * names_;
+  /// Offsets of names in names_
+  const CoinInt64 * nameOffsets_;
+  /// Names passed in - problem then objective
+  std::string problemNames_[2];
+  /// Row names passed in
+  std::vector<std::string> rowNames_;
+  /// Column names passed in
+  std::vector<std::string> columnNames_;
+  /// Original columns
+  const int * originalColumns_;
+  /// Original rows
+  const int * originalRows_;
+  /// Objective offset
+  double objectiveOffset_;
+  /// Objective sense
+  double objectiveSense_;
+  //@}
+};
+#endif
@@ -24,6 +24,22 @@
 #include "CoinModel.hpp"
 #include "CoinSort.hpp"
 
+/* readMps with setNumberReadThreads parses blocks on several pthreads.
+   Without pthreads (configure defines COIN_MPS_NO_THREADS) or on Windows
+   the blocks are parsed one after another.  Plain files are memory mapped
+   if configure found mmap and COIN_MPS_NO_MMAP is not defined. */
+#if !defined(COIN_MPS_NO_THREADS) && !defined(_MSC_VER)
+#define COIN_MPS_HAS_THREADS 1
+#include <pthread.h>
+#endif
+#if !defined(COIN_MPS_NO_MMAP) && defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+#define COIN_MPS_HAS_MMAP 1
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 //#############################################################################
 // type - 0 normal, 1 INTEL IEEE, 2 other IEEE
 
@@ -38,105 +54,112 @@ namespace {
   {1.0e-9,1.0e-8,1.0e-7,1.0e-6,1.0e-5,1.0e-4,1.0e-3,1.0e-2,1.0e-1,
    1.0,1.0e1,1.0e2,1.0e3,1.0e4,1.0e5,1.0e6,1.0e7,1.0e8,1.0e9};
 
-} // end file-local namespace
-double CoinMpsCardReader::osi_strtod(char * ptr, char ** output, int type) 
-{
-
-  double value = 0.0;
-  char * save = ptr;
 
-  // take off leading white space
+/* Decimal number for osi_strtod (type 0) - ptr is past leading white space.
+   Returns false (output not set) unless number ends with white space
+   or end of string.  Also used when reading in blocks so values are
+   bit for bit the same. */
+bool decimalValue(char * ptr, char ** output, double & value)
+{
+  value = 0.0;
+  double sign1=1.0;
+  // do + or -
+  if (*ptr=='-') {
+    sign1=-1.0;
+    ptr++;
+  } else if (*ptr=='+') {
+    ptr++;
+  }
+  // more white space
   while (*ptr==' '||*ptr=='\t')
     ptr++;
-  if (!type) {
-    double sign1=1.0;
+  char thisChar=0;
+  while (value<1.0e30) {
+    thisChar = *ptr;
+    ptr++;
+    if (thisChar>='0'&&thisChar<='9') 
+      value = value*10.0+thisChar-'0';
+    else
+      break;
+  }
+  if (value>=1.0e30)
+    return false; // bad value
+  if (thisChar=='.') {
+    // do fraction
+    double value2 = 0.0;
+    int nfrac=0;
+    while (nfrac<24) {
+      thisChar = *ptr;
+      ptr++;
+      if (thisChar>='0'&&thisChar<='9') {
+	value2 = value2*10.0+thisChar-'0';
+	nfrac++;
+      } else {
+	break;
+      }
+    }
+    if (nfrac<24) {
+      value += value2*fraction[nfrac];
+    } else {
+      thisChar='x'; // force error
+    }
+  }
+  if (thisChar=='e'||thisChar=='E') {
+    // exponent
+    int sign2=1;
     // do + or -
     if (*ptr=='-') {
-      sign1=-1.0;
+      sign2=-1;
       ptr++;
     } else if (*ptr=='+') {
       ptr++;
     }
-    // more white space
-    while (*ptr==' '||*ptr=='\t')
-      ptr++;
-    char thisChar=0;
-    while (value<1.0e30) {
+    int value3 = 0;
+    while (value3<1000) {
       thisChar = *ptr;
       ptr++;
-      if (thisChar>='0'&&thisChar<='9') 
-	value = value*10.0+thisChar-'0';
-      else
+      if (thisChar>='0'&&thisChar<='9') {
+	value3 = value3*10+thisChar-'0';
+      } else {
 	break;
-    }
-    if (value<1.0e30) {
-      if (thisChar=='.') {
-	// do fraction
-	double value2 = 0.0;
-	int nfrac=0;
-	while (nfrac<24) {
-	  thisChar = *ptr;
-	  ptr++;
-	  if (thisChar>='0'&&thisChar<='9') {
-	    value2 = value2*10.0+thisChar-'0';
-	    nfrac++;
-	  } else {
-	    break;
-	  }
-	}
-	if (nfrac<24) {
-	  value += value2*fraction[nfrac];
-	} else {
-	  thisChar='x'; // force error
-	}
       }
-      if (thisChar=='e'||thisChar=='E') {
-	// exponent
-	int sign2=1;
-	// do + or -
-	if (*ptr=='-') {
-	  sign2=-1;
-	  ptr++;
-	} else if (*ptr=='+') {
-	  ptr++;
-	}
-	int value3 = 0;
-	while (value3<1000) {
-	  thisChar = *ptr;
-	  ptr++;
-	  if (thisChar>='0'&&thisChar<='9') {
-	    value3 = value3*10+thisChar-'0';
-	  } else {
-	    break;
-	  }
-	}
-	if (value3<300) {
-	  value3 *= sign2; // power of 10
-	  if (abs(value3)<10) {
-	    // do most common by lookup (for accuracy?)
-	    value *= exponent[value3+9];
-	  } else {
-	    value *= pow(10.0,value3);
-	  }
-	} else if (sign2<0.0) {
-	  value = 0.0; // force zero
-	} else {
-	  value = COIN_DBL_MAX;
-	}
-      } 
-      if (thisChar==0||thisChar=='\t'||thisChar==' ') {
-	// okay
-	*output=ptr;
+    }
+    if (value3<300) {
+      value3 *= sign2; // power of 10
+      if (abs(value3)<10) {
+	// do most common by lookup (for accuracy?)
+	value *= exponent[value3+9];
       } else {
-	value = osi_strtod(save,output);
-	sign1=1.0;
+	value *= pow(10.0,value3);
       }
+    } else if (sign2<0.0) {
+      value = 0.0; // force zero
     } else {
-      // bad value
-      value = osi_strtod(save,output);
-      sign1=1.0;
+      value = COIN_DBL_MAX;
     }
+  } 
+  if (thisChar==0||thisChar=='\t'||thisChar==' ') {
+    // okay
+    *output=ptr;
     value *= sign1;
+    return true;
+  } else {
+    return false;
+  }
+}
+} // end file-local namespace
+double CoinMpsCardReader::osi_strtod(char * ptr, char ** output, int type) 
+{
+
+  double value = 0.0;
+  char * save = ptr;
+
+  // take off leading white space
+  while (*ptr==' '||*ptr=='\t')
+    ptr++;
+  if (!type) {
+    if (!decimalValue(ptr,output,value))
+      value = osi_strtod(save,output);
   } else {
     // ieee - 3 bytes go to 2
     assert (sizeof(double)==8*sizeof(char));
@@ -1211,6 +1234,91 @@ int hash ( const char *name, int maxsiz, int length )
   }
   return ( abs ( n ) % maxsiz );	/* integer abs */
 }
+
+// Task for doMpsTasks - iThread is less than number of threads
+typedef void (*CoinMpsTask) ( void * info, int iTask, int iThread );
+typedef struct {
+  CoinMpsTask task;
+  void * info;
+  int numberTasks;
+  volatile int nextTask;
+} CoinMpsTasks;
+typedef struct {
+  CoinMpsTasks * tasks;
+  int iThread;
+#ifdef COIN_MPS_HAS_THREADS
+  pthread_t id;
+#endif
+} CoinMpsThread;
+
+// Takes tasks until none left
+void * runMpsTasks ( void * info )
+{
+  CoinMpsThread * thread = static_cast<CoinMpsThread *> (info);
+  CoinMpsTasks * tasks = thread->tasks;
+  while ( true ) {
+#ifdef COIN_MPS_HAS_THREADS
+    int iTask = __sync_fetch_and_add ( &tasks->nextTask, 1 );
+#else
+    int iTask = tasks->nextTask++;
+#endif
+    if ( iTask >= tasks->numberTasks )
+      break;
+    tasks->task ( tasks->info, iTask, thread->iThread );
+  }
+  return NULL;
+}
+
+// Does tasks 0 to numberTasks-1 using up to numberThreads threads
+void doMpsTasks ( CoinMpsTask task, void * info, int numberTasks,
+		  int numberThreads )
+{
+  CoinMpsTasks tasks;
+  tasks.task = task;
+  tasks.info = info;
+  tasks.numberTasks = numberTasks;
+  tasks.nextTask = 0;
+  numberThreads = CoinMax ( 1, CoinMin ( numberThreads, numberTasks ) );
+  CoinMpsThread * thread = new CoinMpsThread [numberThreads];
+  int numberStarted = 1;
+  for ( int i = 0; i < numberThreads; i++ ) {
+    thread[i].tasks = &tasks;
+    thread[i].iThread = i;
+  }
+#ifdef COIN_MPS_HAS_THREADS
+  for ( int i = 1; i < numberThreads; i++ ) {
+    if ( pthread_create ( &thread[i].id, NULL, runMpsTasks, thread + i ) )
+      break; // can't get thread - make do with what we have
+    numberStarted++;
+  }
+#endif
+  runMpsTasks ( thread );
+#ifdef COIN_MPS_HAS_THREADS
+  for ( int i = 1; i < numberStarted; i++ )
+    pthread_join ( thread[i].id, NULL );
+#endif
+  delete [] thread;
+}
+
+// Hash values of a range of names
+typedef struct {
+  char ** names;
+  int * position;
+  int maxhash;
+  int number;
+  int blockSize;
+} CoinMpsHashInfo;
+void hashTask ( void * info, int iTask, int )
+{
+  CoinMpsHashInfo * hashInfo = static_cast<CoinMpsHashInfo *> (info);
+  int first = iTask * hashInfo->blockSize;
+  int last = CoinMin ( first + hashInfo->blockSize, hashInfo->number );
+  for ( int i = first; i < last; i++ ) {
+    char *thisName = hashInfo->names[i];
+    int length = static_cast<int>(strlen(thisName));
+    hashInfo->position[i] = hash ( thisName, hashInfo->maxhash, length );
+  }
+}
 } // end file-local namespace
 
 // Define below if you are reading a Cnnnnnn file 
@@ -1227,12 +1335,18 @@ CoinMpsIO::startHash ( char **names, const COINColumnIndex number , int section
 }
 void
 CoinMpsIO::startHash ( int section ) const
+{
+  fillHash ( section, false );
+}
+int
+CoinMpsIO::fillHash ( int section, bool quiet ) const
 {
   char ** names = names_[section];
   COINColumnIndex number = numberHash_[section];
   COINColumnIndex i;
   COINColumnIndex maxhash = 4 * number;
   COINColumnIndex ipos, iput;
+  int numberDuplicates = 0;
 
   //hash_=(CoinHashLink *) malloc(maxhash*sizeof(CoinHashLink));
   hash_[section] = new CoinHashLink[maxhash];
@@ -1244,16 +1358,24 @@ CoinMpsIO::startHash ( int section ) const
     hashThis[i].next = -1;
   }
 
+  // hash values (in parallel if threads wanted)
+  COINColumnIndex * position = new COINColumnIndex [number];
+  CoinMpsHashInfo info;
+  info.names = names;
+  info.position = position;
+  info.maxhash = maxhash;
+  info.number = number;
+  info.blockSize = 50000;
+  doMpsTasks ( hashTask, &info, ( number + info.blockSize - 1 ) / info.blockSize,
+	       numberReadThreads_ );
+
   /*
    * Initialize the hash table.  Only the index of the first name that
    * hashes to a value is entered in the table; subsequent names that
    * collide with it are not entered.
    */
   for ( i = 0; i < number; ++i ) {
-    char *thisName = names[i];
-    int length = static_cast<int>(strlen(thisName));
-
-    ipos = hash ( thisName, maxhash, length );
+    ipos = position[i];
     if ( hashThis[ipos].index == -1 ) {
       hashThis[ipos].index = i;
     }
@@ -1268,9 +1390,8 @@ CoinMpsIO::startHash ( int section ) const
   iput = -1;
   for ( i = 0; i < number; ++i ) {
     char *thisName = names[i];
-    int length = static_cast<int>(strlen(thisName));
 
-    ipos = hash ( thisName, maxhash, length );
+    ipos = position[i];
 
     while ( 1 ) {
       COINColumnIndex j1 = hashThis[ipos].index;
@@ -1281,6 +1402,11 @@ CoinMpsIO::startHash ( int section ) const
 	char *thisName2 = names[j1];
 
 	if ( strcmp ( thisName, thisName2 ) == 0 ) {
+	  numberDuplicates++;
+	  if ( quiet ) {
+	    delete [] position;
+	    return numberDuplicates;
+	  }
 	  printf ( "** duplicate name %s\n", names[i] );
 	  break;
 	} else {
@@ -1308,6 +1434,8 @@ CoinMpsIO::startHash ( int section ) const
       }
     }
   }
+  delete [] position;
+  return numberDuplicates;
 }
 
 //  stopHash.  Deletes hash storage
@@ -1372,6 +1500,11 @@ void
 CoinMpsIO::startHash ( int section ) const
 {
 }
+int
+CoinMpsIO::fillHash ( int section, bool quiet ) const
+{
+  return 0;
+}
 
 //  stopHash.  Deletes hash storage
 void
@@ -1531,6 +1664,96 @@ int CoinMpsIO::getDefaultBound() const
 {
   return defaultBound_;
 }
+// Turns rhs (in rowlower) and range (in rowupper) into row bounds
+static void
+mpsRowBounds ( COINRowIndex numberRows, const COINMpsType * rowType,
+	       double * rowlower, double * rowupper, double infinity )
+{
+  COINRowIndex irow;
+
+  for ( irow = 0; irow < numberRows; irow++ ) {
+    double lo = rowlower[irow];
+    double up = rowupper[irow];
+    double up2 = rowupper[irow];	//range
+
+    switch ( rowType[irow] ) {
+    case COIN_E_ROW:
+      if ( lo == -infinity )
+	lo = 0.0;
+      if ( up == infinity ) {
+	up = lo;
+      } else if ( up > 0.0 ) {
+	up += lo;
+      } else {
+	up = lo;
+	lo += up2;
+      }
+      break;
+    case COIN_L_ROW:
+      if ( lo == -infinity ) {
+	up = 0.0;
+      } else {
+	up = lo;
+	lo = -infinity;
+      }
+      if ( up2 != infinity ) {
+	lo = up - fabs ( up2 );
+      }
+      break;
+    case COIN_G_ROW:
+      if ( lo == -infinity ) {
+	lo = 0.0;
+	up = infinity;
+      } else {
+	up = infinity;
+      }
+      if ( up2 != infinity ) {
+	up = lo + fabs ( up2 );
+      }
+      break;
+    default:
+      abort();
+    }
+    rowlower[irow] = lo;
+    rowupper[irow] = up;
+  }
+}
+// Default and tidy bounds of integer variables
+static void
+mpsIntegerBounds ( COINColumnIndex numberColumns, const char * integerType,
+		   const COINMpsType * columnType, double * collower,
+		   double * colupper, int defaultBound )
+{
+  COINColumnIndex icolumn;
+
+  for ( icolumn = 0; icolumn < numberColumns; icolumn++ ) {
+    if ( integerType[icolumn] ) {
+      collower[icolumn] = CoinMax( collower[icolumn] , -MAX_INTEGER );
+      // if 0 infinity make 0-1 ???
+      if ( columnType[icolumn] == COIN_UNSET_BOUND ) 
+	colupper[icolumn] = defaultBound;
+      if ( colupper[icolumn] > MAX_INTEGER ) 
+	colupper[icolumn] = MAX_INTEGER;
+      // clean up to allow for bad reads on 1.0e2 etc
+      if (colupper[icolumn]<1.0e10) {
+	double value = colupper[icolumn];
+	double value2 = floor(value+0.5);
+	if (value!=value2) {
+	  if (fabs(value-value2)<1.0e-5)
+	    colupper[icolumn]=value2;
+	}
+      }
+      if (collower[icolumn]>-1.0e10) {
+	double value = collower[icolumn];
+	double value2 = floor(value+0.5);
+	if (value!=value2) {
+	  if (fabs(value-value2)<1.0e-5)
+	    collower[icolumn]=value2;
+	}
+      }
+    }
+  }
+}
 //------------------------------------------------------------------
 // Read mps files
 //------------------------------------------------------------------
@@ -1547,6 +1770,8 @@ int CoinMpsIO::readMps(const char * filename,  const char * extension)
     cardReader_ = new CoinMpsCardReader ( input, this);
   }
   if (!extension||(strcmp(extension,"gms")&&!strstr(filename,".gms"))) {
+    if (returnCode>0 && readMpsInBlocks())
+      return 0;
     return readMps();
   } else {
     int numberSets=0;
@@ -1570,6 +1795,11 @@ int CoinMpsIO::readMps(const char * filename,  const char * extension,
     delete cardReader_;
     cardReader_ = new CoinMpsCardReader ( input, this);
   }
+  if (returnCode>0 && readMpsInBlocks()) {
+    numberSets=0;
+    sets=NULL;
+    return 0;
+  }
   return readMps(numberSets,sets);
 }
 int CoinMpsIO::readMps()
@@ -2192,56 +2422,7 @@ int CoinMpsIO::readMps(int & numberSets,CoinSet ** &sets)
     }
     stopHash ( 0 );
     // massage ranges
-    {
-      COINRowIndex irow;
-
-      for ( irow = 0; irow < numberRows_; irow++ ) {
-	double lo = rowlower_[irow];
-	double up = rowupper_[irow];
-	double up2 = rowupper_[irow];	//range
-
-	switch ( rowType[irow] ) {
-	case COIN_E_ROW:
-	  if ( lo == -infinity_ )
-	    lo = 0.0;
-	  if ( up == infinity_ ) {
-	    up = lo;
-	  } else if ( up > 0.0 ) {
-	    up += lo;
-	  } else {
-	    up = lo;
-	    lo += up2;
-	  }
-	  break;
-	case COIN_L_ROW:
-	  if ( lo == -infinity_ ) {
-	    up = 0.0;
-	  } else {
-	    up = lo;
-	    lo = -infinity_;
-	  }
-	  if ( up2 != infinity_ ) {
-	    lo = up - fabs ( up2 );
-	  }
-	  break;
-	case COIN_G_ROW:
-	  if ( lo == -infinity_ ) {
-	    lo = 0.0;
-	    up = infinity_;
-	  } else {
-	    up = infinity_;
-	  }
-	  if ( up2 != infinity_ ) {
-	    up = lo + fabs ( up2 );
-	  }
-	  break;
-	default:
-	  abort();
-	}
-	rowlower_[irow] = lo;
-	rowupper_[irow] = up;
-      }
-    }
+    mpsRowBounds ( numberRows_, rowType, rowlower_, rowupper_, infinity_ );
     free ( rowType );
     // default bounds
     if (numberColumns_) {
@@ -2294,257 +2475,10 @@ int CoinMpsIO::readMps(int & numberSets,CoinSet ** &sets)
 	COINColumnIndex icolumn = findHash ( cardReader_->rowName (  ) , 1 );
 
 	if ( icolumn >= 0 ) {
-	  double value = cardReader_->value (  );
-	  bool ifError = false;
-
-	  switch ( cardReader_->mpsType (  ) ) {
-	  case COIN_UP_BOUND:
-	    if ( value == -1.0e100 )
-	      ifError = true;
-	    if (value==STRING_VALUE) {
-	      value=1.0e10;
-	      // tiny element - string
-	      const char * s = cardReader_->valueString();
-	      assert (*s=='=');
-	      addString(numberRows_+2,icolumn,s+1);
-	    }
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
-	      if ( value < 0.0 ) {
-		collower_[icolumn] = -infinity_;
-	      }
-	    } else if ( columnType[icolumn] == COIN_LO_BOUND ||
-                        columnType[icolumn] == COIN_LI_BOUND) {
-	      if ( value < collower_[icolumn] ) {
-		ifError = true;
-	      } else if ( value < collower_[icolumn] + smallElement_ ) {
-		value = collower_[icolumn];
-	      }
-	    } else if ( columnType[icolumn] == COIN_MI_BOUND ) {
-	    } else {
-	      ifError = true;
-	    }
-            if (value>1.0e25)
-              value=infinity_;
-	    colupper_[icolumn] = value;
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
- 	        columnType[icolumn] = COIN_UP_BOUND;
-            } else {
- 	        columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
-            }
-	    break;
-	  case COIN_LO_BOUND:
-	    if ( value == -1.0e100 )
-	      ifError = true;
-	    if (value==STRING_VALUE) {
-	      value=-1.0e10;
-	      // tiny element - string
-	      const char * s = cardReader_->valueString();
-	      assert (*s=='=');
-	      addString(numberRows_+1,icolumn,s+1);
-	    }
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
-	    } else if ( columnType[icolumn] == COIN_UP_BOUND ||
-			columnType[icolumn] == COIN_UI_BOUND ) {
-	      if ( value > colupper_[icolumn] ) {
-		ifError = true;
-	      } else if ( value > colupper_[icolumn] - smallElement_ ) {
-		value = colupper_[icolumn];
-	      }
-	    } else if ( columnType[icolumn] == COIN_PL_BOUND ) {
-	    } else {
-	      ifError = true;
-	    }
-            if (value<-1.0e25)
-              value=-infinity_;
-	    collower_[icolumn] = value;
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
- 	        columnType[icolumn] = COIN_LO_BOUND;
-            } else {
- 	        columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
-            }
-	    break;
-	  case COIN_FX_BOUND:
-	    if ( value == -1.0e100 )
-	      ifError = true;
-	    if (value==STRING_VALUE) {
-	      value=0.0;
-	      // tiny element - string
-	      const char * s = cardReader_->valueString();
-	      assert (*s=='=');
-	      addString(numberRows_+1,icolumn,s+1);
-	      addString(numberRows_+2,icolumn,s+1);
-	    }
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {    
-	    } else if (columnType[icolumn] == COIN_FX_BOUND ) {
-		ifError=true;
-            } else if (integerType_[icolumn] ) {
-	      // Allow so people can easily put FX's at end
-	      double value2 = floor(value);
-	      if (fabs(value2-value)>1.0e-12||
-		  value2<collower_[icolumn]||
-		  value2>colupper_[icolumn]) {
-		ifError=true;
-	      } else {
-		// take off integer list
-		    numberIntegers--;
-		    integerType_[icolumn] = 0;
-	      }
-	    } else {
-	      ifError = true;
-	    }
-	    collower_[icolumn] = value;
-	    colupper_[icolumn] = value;
-	    columnType[icolumn] = COIN_FX_BOUND;
-	    break;
-	  case COIN_FR_BOUND:
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
-	    } else {
-	      ifError = true;
-	    }
-	    collower_[icolumn] = -infinity_;
-	    colupper_[icolumn] = infinity_;
-	    columnType[icolumn] = COIN_FR_BOUND;
-	    break;
-	  case COIN_MI_BOUND:
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
-	      colupper_[icolumn] = COIN_DBL_MAX;
-	    } else if ( columnType[icolumn] == COIN_UP_BOUND ||
-			columnType[icolumn] == COIN_UI_BOUND ) {
-	    } else {
-	      ifError = true;
-	    }
-	    collower_[icolumn] = -infinity_;
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
- 	        columnType[icolumn] = COIN_MI_BOUND;
-            } else {
- 	        columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
-            }
-	    break;
-	  case COIN_PL_BOUND:
-	    // change to allow if no upper bound set
-	    //if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
-	    if (colupper_[icolumn]==infinity_) {
-	    } else {
-	      ifError = true;
-	    }
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
- 	        columnType[icolumn] = COIN_PL_BOUND;
-            } else {
- 	        columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
-            }
-	    break;
-	  case COIN_UI_BOUND:
-	    if (value==STRING_VALUE) {
-	      value=1.0e20;
-	      // tiny element - string
-	      const char * s = cardReader_->valueString();
-	      assert (*s=='=');
-	      addString(numberRows_+2,icolumn,s+1);
-	    }
-#if 0
-	    if ( value == -1.0e100 ) 
-	      ifError = true;
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
-	    } else if ( columnType[icolumn] == COIN_LO_BOUND ||
-                        columnType[icolumn] == COIN_LI_BOUND) {
-	      if ( value < collower_[icolumn] ) {
-		ifError = true;
-	      } else if ( value < collower_[icolumn] + smallElement_ ) {
-		value = collower_[icolumn];
-	      }
-	    } else if ( columnType[icolumn] == COIN_MI_BOUND ) {
-	    } else {
-	      ifError = true;
-	    }
-#else
-	    if ( value == -1.0e100 ) {
-	       value = infinity_;
-	       if (columnType[icolumn] != COIN_UNSET_BOUND &&
-		       columnType[icolumn] != COIN_LO_BOUND &&
-		       columnType[icolumn] != COIN_LI_BOUND &&
-		       columnType[icolumn] != COIN_MI_BOUND) {
-		     ifError = true;
-	       }
-	    } else {
-	       if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
-	       } else if ( columnType[icolumn] == COIN_LO_BOUND ||
-			   columnType[icolumn] == COIN_LI_BOUND ||
-                           columnType[icolumn] == COIN_MI_BOUND ) {
-		  if ( value < collower_[icolumn] ) {
-		     ifError = true;
-		  } else if ( value < collower_[icolumn] + smallElement_ ) {
-		     value = collower_[icolumn];
-		  }
-	       } else {
-		  ifError = true;
-	       }
-	    }
-#endif
-            if (value>1.0e25)
-              value=infinity_;
-	    colupper_[icolumn] = value;
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
- 	        columnType[icolumn] = COIN_UI_BOUND;
-            } else {
- 	        columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
-            }
-	    if ( !integerType_[icolumn] ) {
-	      numberIntegers++;
-	      integerType_[icolumn] = 1;
-	    }
-	    break;
-	  case COIN_LI_BOUND:
-	    if ( value == -1.0e100 )
-	      ifError = true;
-	    if (value==STRING_VALUE) {
-	      value=-1.0e20;
-	      // tiny element - string
-	      const char * s = cardReader_->valueString();
-	      assert (*s=='=');
-	      addString(numberRows_+1,icolumn,s+1);
-	    }
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
-	    } else if ( columnType[icolumn] == COIN_UP_BOUND ||
-			columnType[icolumn] == COIN_UI_BOUND ) {
-	      if ( value > colupper_[icolumn] ) {
-		ifError = true;
-	      } else if ( value > colupper_[icolumn] - smallElement_ ) {
-		value = colupper_[icolumn];
-	      }
-	    } else if ( columnType[icolumn] == COIN_PL_BOUND ) {
-	    } else {
-	      ifError = true;
-	    }
-            if (value<-1.0e25)
-              value=-infinity_;
-	    collower_[icolumn] = value;
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
- 	        columnType[icolumn] = COIN_LI_BOUND;
-            } else {
- 	        columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
-            }
-	    if ( !integerType_[icolumn] ) {
-	      numberIntegers++;
-	      integerType_[icolumn] = 1;
-	    }
-	    break;
-	  case COIN_BV_BOUND:
-	    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
-	    } else {
-	      ifError = true;
-	    }
-	    collower_[icolumn] = 0.0;
-	    colupper_[icolumn] = 1.0;
-	    columnType[icolumn] = COIN_BV_BOUND;
-	    if ( !integerType_[icolumn] ) {
-	      numberIntegers++;
-	      integerType_[icolumn] = 1;
-	    }
-	    break;
-	  default:
-	    ifError = true;
-	    break;
-	  }
+	  bool ifError = setBound ( cardReader_->mpsType (  ), icolumn,
+				    cardReader_->value (  ),
+				    cardReader_->valueString (  ),
+				    columnType, numberIntegers );
 	  if ( ifError ) {
 	    numberErrors++;
 	    if ( numberErrors < 100 ) {
@@ -2636,35 +2570,8 @@ int CoinMpsIO::readMps(int & numberSets,CoinSet ** &sets)
       free(integerType_);
       integerType_ = NULL;
     } else {
-      COINColumnIndex icolumn;
-
-      for ( icolumn = 0; icolumn < numberColumns_; icolumn++ ) {
-	if ( integerType_[icolumn] ) {
-	  collower_[icolumn] = CoinMax( collower_[icolumn] , -MAX_INTEGER );
-	  // if 0 infinity make 0-1 ???
-	  if ( columnType[icolumn] == COIN_UNSET_BOUND ) 
-	    colupper_[icolumn] = defaultBound_;
-	  if ( colupper_[icolumn] > MAX_INTEGER ) 
-	    colupper_[icolumn] = MAX_INTEGER;
-	  // clean up to allow for bad reads on 1.0e2 etc
-	  if (colupper_[icolumn]<1.0e10) {
-	    double value = colupper_[icolumn];
-	    double value2 = floor(value+0.5);
-	    if (value!=value2) {
-	      if (fabs(value-value2)<1.0e-5)
-		colupper_[icolumn]=value2;
-	    }
-	  }
-	  if (collower_[icolumn]>-1.0e10) {
-	    double value = collower_[icolumn];
-	    double value2 = floor(value+0.5);
-	    if (value!=value2) {
-	      if (fabs(value-value2)<1.0e-5)
-		collower_[icolumn]=value2;
-	    }
-	  }
-	}
-      }
+      mpsIntegerBounds ( numberColumns_, integerType_, columnType,
+			 collower_, colupper_, defaultBound_ );
     }
     free ( columnType );
     if ( cardReader_->whichSection (  ) != COIN_ENDATA_SECTION &&
@@ -2759,6 +2666,1658 @@ int CoinMpsIO::readMps(int & numberSets,CoinSet ** &sets)
 					    <<CoinMessageEol;
   return numberErrors;
 }
+// Sets bound from BOUNDS entry - returns true if error
+bool
+CoinMpsIO::setBound(COINMpsType type, COINColumnIndex icolumn, double value,
+		    const char * valueString, COINMpsType * columnType,
+		    COINColumnIndex & numberIntegers)
+{
+  bool ifError = false;
+
+  switch ( type ) {
+  case COIN_UP_BOUND:
+    if ( value == -1.0e100 )
+      ifError = true;
+    if (value==STRING_VALUE) {
+      value=1.0e10;
+      // tiny element - string
+      const char * s = valueString;
+      assert (*s=='=');
+      addString(numberRows_+2,icolumn,s+1);
+    }
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+      if ( value < 0.0 ) {
+	collower_[icolumn] = -infinity_;
+      }
+    } else if ( columnType[icolumn] == COIN_LO_BOUND ||
+		columnType[icolumn] == COIN_LI_BOUND) {
+      if ( value < collower_[icolumn] ) {
+	ifError = true;
+      } else if ( value < collower_[icolumn] + smallElement_ ) {
+	value = collower_[icolumn];
+      }
+    } else if ( columnType[icolumn] == COIN_MI_BOUND ) {
+    } else {
+      ifError = true;
+    }
+    if (value>1.0e25)
+      value=infinity_;
+    colupper_[icolumn] = value;
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+	columnType[icolumn] = COIN_UP_BOUND;
+    } else {
+	columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
+    }
+    break;
+  case COIN_LO_BOUND:
+    if ( value == -1.0e100 )
+      ifError = true;
+    if (value==STRING_VALUE) {
+      value=-1.0e10;
+      // tiny element - string
+      const char * s = valueString;
+      assert (*s=='=');
+      addString(numberRows_+1,icolumn,s+1);
+    }
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+    } else if ( columnType[icolumn] == COIN_UP_BOUND ||
+		columnType[icolumn] == COIN_UI_BOUND ) {
+      if ( value > colupper_[icolumn] ) {
+	ifError = true;
+      } else if ( value > colupper_[icolumn] - smallElement_ ) {
+	value = colupper_[icolumn];
+      }
+    } else if ( columnType[icolumn] == COIN_PL_BOUND ) {
+    } else {
+      ifError = true;
+    }
+    if (value<-1.0e25)
+      value=-infinity_;
+    collower_[icolumn] = value;
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+	columnType[icolumn] = COIN_LO_BOUND;
+    } else {
+	columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
+    }
+    break;
+  case COIN_FX_BOUND:
+    if ( value == -1.0e100 )
+      ifError = true;
+    if (value==STRING_VALUE) {
+      value=0.0;
+      // tiny element - string
+      const char * s = valueString;
+      assert (*s=='=');
+      addString(numberRows_+1,icolumn,s+1);
+      addString(numberRows_+2,icolumn,s+1);
+    }
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {    
+    } else if (columnType[icolumn] == COIN_FX_BOUND ) {
+	ifError=true;
+    } else if (integerType_[icolumn] ) {
+      // Allow so people can easily put FX's at end
+      double value2 = floor(value);
+      if (fabs(value2-value)>1.0e-12||
+	  value2<collower_[icolumn]||
+	  value2>colupper_[icolumn]) {
+	ifError=true;
+      } else {
+	// take off integer list
+	    numberIntegers--;
+	    integerType_[icolumn] = 0;
+      }
+    } else {
+      ifError = true;
+    }
+    collower_[icolumn] = value;
+    colupper_[icolumn] = value;
+    columnType[icolumn] = COIN_FX_BOUND;
+    break;
+  case COIN_FR_BOUND:
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+    } else {
+      ifError = true;
+    }
+    collower_[icolumn] = -infinity_;
+    colupper_[icolumn] = infinity_;
+    columnType[icolumn] = COIN_FR_BOUND;
+    break;
+  case COIN_MI_BOUND:
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+      colupper_[icolumn] = COIN_DBL_MAX;
+    } else if ( columnType[icolumn] == COIN_UP_BOUND ||
+		columnType[icolumn] == COIN_UI_BOUND ) {
+    } else {
+      ifError = true;
+    }
+    collower_[icolumn] = -infinity_;
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+	columnType[icolumn] = COIN_MI_BOUND;
+    } else {
+	columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
+    }
+    break;
+  case COIN_PL_BOUND:
+    // change to allow if no upper bound set
+    //if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+    if (colupper_[icolumn]==infinity_) {
+    } else {
+      ifError = true;
+    }
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+	columnType[icolumn] = COIN_PL_BOUND;
+    } else {
+	columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
+    }
+    break;
+  case COIN_UI_BOUND:
+    if (value==STRING_VALUE) {
+      value=1.0e20;
+      // tiny element - string
+      const char * s = valueString;
+      assert (*s=='=');
+      addString(numberRows_+2,icolumn,s+1);
+    }
+#if 0
+    if ( value == -1.0e100 ) 
+      ifError = true;
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+    } else if ( columnType[icolumn] == COIN_LO_BOUND ||
+		columnType[icolumn] == COIN_LI_BOUND) {
+      if ( value < collower_[icolumn] ) {
+	ifError = true;
+      } else if ( value < collower_[icolumn] + smallElement_ ) {
+	value = collower_[icolumn];
+      }
+    } else if ( columnType[icolumn] == COIN_MI_BOUND ) {
+    } else {
+      ifError = true;
+    }
+#else
+    if ( value == -1.0e100 ) {
+       value = infinity_;
+       if (columnType[icolumn] != COIN_UNSET_BOUND &&
+	       columnType[icolumn] != COIN_LO_BOUND &&
+	       columnType[icolumn] != COIN_LI_BOUND &&
+	       columnType[icolumn] != COIN_MI_BOUND) {
+	     ifError = true;
+       }
+    } else {
+       if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+       } else if ( columnType[icolumn] == COIN_LO_BOUND ||
+		   columnType[icolumn] == COIN_LI_BOUND ||
+		   columnType[icolumn] == COIN_MI_BOUND ) {
+	  if ( value < collower_[icolumn] ) {
+	     ifError = true;
+	  } else if ( value < collower_[icolumn] + smallElement_ ) {
+	     value = collower_[icolumn];
+	  }
+       } else {
+	  ifError = true;
+       }
+    }
+#endif
+    if (value>1.0e25)
+      value=infinity_;
+    colupper_[icolumn] = value;
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+	columnType[icolumn] = COIN_UI_BOUND;
+    } else {
+	columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
+    }
+    if ( !integerType_[icolumn] ) {
+      numberIntegers++;
+      integerType_[icolumn] = 1;
+    }
+    break;
+  case COIN_LI_BOUND:
+    if ( value == -1.0e100 )
+      ifError = true;
+    if (value==STRING_VALUE) {
+      value=-1.0e20;
+      // tiny element - string
+      const char * s = valueString;
+      assert (*s=='=');
+      addString(numberRows_+1,icolumn,s+1);
+    }
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+    } else if ( columnType[icolumn] == COIN_UP_BOUND ||
+		columnType[icolumn] == COIN_UI_BOUND ) {
+      if ( value > colupper_[icolumn] ) {
+	ifError = true;
+      } else if ( value > colupper_[icolumn] - smallElement_ ) {
+	value = colupper_[icolumn];
+      }
+    } else if ( columnType[icolumn] == COIN_PL_BOUND ) {
+    } else {
+      ifError = true;
+    }
+    if (value<-1.0e25)
+      value=-infinity_;
+    collower_[icolumn] = value;
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+	columnType[icolumn] = COIN_LI_BOUND;
+    } else {
+	columnType[icolumn] = COIN_BOTH_BOUNDS_SET;
+    }
+    if ( !integerType_[icolumn] ) {
+      numberIntegers++;
+      integerType_[icolumn] = 1;
+    }
+    break;
+  case COIN_BV_BOUND:
+    if ( columnType[icolumn] == COIN_UNSET_BOUND ) {
+    } else {
+      ifError = true;
+    }
+    collower_[icolumn] = 0.0;
+    colupper_[icolumn] = 1.0;
+    columnType[icolumn] = COIN_BV_BOUND;
+    if ( !integerType_[icolumn] ) {
+      numberIntegers++;
+      integerType_[icolumn] = 1;
+    }
+    break;
+  default:
+    ifError = true;
+    break;
+  }
+  return ifError;
+}
+//#############################################################################
+// Reading whole file in blocks (see setNumberReadThreads)
+
+namespace {
+// Most fields on a card the block reader will look at
+const int maxMpsFields = 64;
+
+/* Stands in for file input once whole file has been read.  Has what
+   came after ENDATA so card reader can go on as after reading card by card */
+class CoinMpsReadInput : public CoinFileInput {
+public:
+  CoinMpsReadInput ( const CoinFileInput * input, const char * rest,
+		     size_t length )
+    : CoinFileInput ( input->getFileName () ),
+      rest_ ( rest, length ),
+      position_ ( 0 )
+  { readType_ = input->getReadType ();}
+  virtual int read ( void * buffer, int size )
+  {
+    int n = static_cast<int> (CoinMin ( static_cast<size_t> (size),
+					rest_.size () - position_ ));
+    memcpy ( buffer, rest_.data () + position_, n );
+    position_ += n;
+    return n;
+  }
+  // as fgets
+  virtual char * gets ( char * buffer, int size )
+  {
+    if ( position_ == rest_.size () || size < 2 )
+      return NULL;
+    int n = 0;
+    while ( n < size - 1 && position_ < rest_.size () ) {
+      char thisChar = rest_[position_++];
+      buffer[n++] = thisChar;
+      if ( thisChar == '\n' )
+	break;
+    }
+    buffer[n] = '\0';
+    return buffer;
+  }
+private:
+  std::string rest_;
+  size_t position_;
+};
+
+/* Finds card in line as cleanCard would leave it (up to first control
+   character less trailing blanks) - returns start of next line */
+inline const char *
+mpsCard ( const char * line, const char * end, const char * & eol )
+{
+  const char * image = line;
+  eol = line;
+  while ( image < end ) {
+    unsigned char thisChar = *image;
+    if ( thisChar != '\t' && thisChar < ' ' )
+      break;
+    image++;
+    if ( thisChar != '\t' && thisChar != ' ' )
+      eol = image;
+  }
+  const char * next =
+    static_cast<const char *> (memchr ( image, '\n', end - image ));
+  return next ? next + 1 : end;
+}
+
+/* Splits card into fields as nextBlankOr would.  Returns number of fields
+   or -1 if too many or a lone + or - (which card reader joins to next) */
+inline int
+mpsFields ( const char * card, const char * eol,
+	    const char ** field, const char ** fieldEnd )
+{
+  int n = 0;
+  const char * image = card;
+  while ( true ) {
+    while ( image < eol && ( *image == ' ' || *image == '\t' ) )
+      image++;
+    if ( image == eol )
+      break;
+    if ( n == maxMpsFields )
+      return -1;
+    field[n] = image;
+    while ( image < eol && *image != ' ' && *image != '\t' )
+      image++;
+    fieldEnd[n] = image;
+    if ( image - field[n] == 1 && ( *field[n] == '+' || *field[n] == '-' ) )
+      return -1;
+    n++;
+  }
+  return n;
+}
+
+/* True if name in field is not too long and is read the same whether or
+   not card reader still allows eight character names with blanks
+   (position is where such a name would start).  eightChar is
+   cleared where card reader would stop allowing blanks */
+inline bool
+mpsName ( const char * card, const char * eol, const char * field,
+	  const char * fieldEnd, int position, bool freeFormat,
+	  bool & eightChar )
+{
+  if ( fieldEnd - field >= COIN_MAX_FIELD_LENGTH )
+    return false;
+  if ( freeFormat || field != card + position )
+    return true;
+  if ( eol - field >= 8 ) {
+    if ( field + 8 < eol && field[8] != ' ' ) {
+      // card reader stops allowing blanks
+      eightChar = false;
+      return true;
+    }
+    // card reader would take eight characters less blanks
+    for ( const char * image = fieldEnd; image < field + 8; image++ ) {
+      if ( *image != ' ' )
+	return false;
+    }
+    return true;
+  } else {
+    // card reader would take rest of card less blanks
+    return fieldEnd == eol;
+  }
+}
+
+// Value in field as osi_strtod would read it - false if error
+inline bool
+mpsValue ( const char * field, const char * fieldEnd, double & value )
+{
+  char temp[COIN_MAX_FIELD_LENGTH];
+  int length = static_cast<int> (fieldEnd - field);
+  if ( length >= COIN_MAX_FIELD_LENGTH )
+    return false;
+  memcpy ( temp, field, length );
+  temp[length] = '\0';
+  char * after;
+  return decimalValue ( temp, &after, value ) && value != STRING_VALUE;
+}
+
+// True if card has 'MARKER' (looked for as in nextField)
+inline bool
+mpsMarker ( const char * card, const char * eol )
+{
+  const char * image = card;
+  while ( eol - image >= 8 ) {
+    image = static_cast<const char *> (memchr ( image, '\'', eol - image - 7 ));
+    if ( !image )
+      return false;
+    if ( !memcmp ( image, "'MARKER'", 8 ) )
+      return true;
+    image++;
+  }
+  return false;
+}
+
+inline char *
+mpsStrdup ( const char * field, const char * fieldEnd )
+{
+  size_t length = fieldEnd - field;
+  char * name = reinterpret_cast<char *> (malloc ( length + 1 ));
+  memcpy ( name, field, length );
+  name[length] = '\0';
+  return name;
+}
+} // end file-local namespace
+
+/* Reads MPS file held in memory.  Sections are split into blocks of lines
+   which are parsed as tasks.  Anything at all unusual makes it give up so
+   the file can be read card by card - this means results are always the
+   same as reading card by card. */
+class CoinMpsBlockReader {
+public:
+  CoinMpsBlockReader ( CoinMpsIO * model );
+  ~CoinMpsBlockReader ();
+  /* Reads problem from file.  Returns false if it must be read card by
+     card when model is unchanged */
+  bool read ( CoinFileInput * input );
+  /// Whether input was read from (so must be opened again)
+  inline bool usedInput () const
+  { return usedInput_;}
+  /// Card reader left after ENDATA as if it had read the cards
+  CoinMpsCardReader * cardReader ( const CoinFileInput * input ) const;
+
+private:
+  // Entry in RHS, RANGES or BOUNDS
+  typedef struct {
+    const char * name;
+    int nameLength;
+    COINMpsType type;
+    int index;
+    double value;
+  } Entry;
+  // Block of lines for a task and what it found
+  struct Block {
+    const char * start;
+    const char * end;
+    bool bad;
+    // false if card reader would stop allowing blanks in names
+    bool eightChar;
+    // section cards and number of lines (first pass)
+    std::vector<const char *> header;
+    std::vector<CoinBigIndex> headerLine;
+    CoinBigIndex numberLines;
+    // ROWS and COLUMNS (COIN_UNKNOWN_MPS_TYPE if integer as before block)
+    std::vector<char *> name;
+    std::vector<COINMpsType> type;
+    // COLUMNS
+    std::vector<double> objective;
+    std::vector<CoinBigIndex> start2;
+    std::vector<COINRowIndex> row;
+    std::vector<double> element;
+    // -1 no marker, 0 INTEND or 1 INTORG last in block
+    int marker;
+    COINColumnIndex columnOffset;
+    CoinBigIndex elementOffset;
+    // RHS, RANGES and BOUNDS
+    std::vector<Entry> entry;
+  };
+
+  // Loads whole file
+  bool load ( CoinFileInput * input );
+  // Number of blocks for part of file
+  int numberBlocks ( const char * start, const char * end ) const;
+  // Splits part of file into blocks at line boundaries
+  void split ( const char * start, const char * end, int number );
+  // Runs task for each block - false if any bad
+  bool runBlocks ( int section );
+  static void blockTask ( void * info, int iBlock, int iThread );
+  // Tasks
+  void scanBlock ( Block & block );
+  void rowBlock ( Block & block );
+  void columnBlock ( Block & block, CoinBigIndex * rowUsed );
+  void entryBlock ( Block & block );
+  void boundBlock ( Block & block );
+  void copyColumns ( const Block & block );
+  // Start of first column in COLUMNS after position
+  const char * columnBoundary ( const char * start, const char * end,
+				const char * position ) const;
+  // Name of column if normal COLUMNS card
+  static bool columnName ( const char * line, const char * eol,
+			   const char * & name, int & length );
+  // Index of name (-1 if not found)
+  int lookup ( const char * field, const char * fieldEnd, int section ) const;
+  // All the work after load
+  bool readSections ();
+  // Applies RHS or RANGES entries
+  bool applyEntries ( int section, char * & vectorName, double & offset );
+  // Frees names still in blocks
+  void freeBlocks ();
+
+  // data
+  CoinMpsIO * model_;
+  int numberThreads_;
+  const char * data_;
+  size_t size_;
+  bool mapped_;
+  bool usedInput_;
+  bool freeFormat_;
+  bool eightChar_;
+  // ENDATA card and what follows it
+  std::string endata_;
+  CoinBigIndex endataCard_;
+  const char * rest_;
+  // what tasks are doing
+  int task_;
+  volatile bool failed_;
+  std::vector<Block> blocks_;
+  std::vector<CoinBigIndex *> rowUsed_;
+  // sections
+  const char * sectionStart_[COIN_UNKNOWN_SECTION + 1];
+  const char * sectionEnd_[COIN_UNKNOWN_SECTION + 1];
+  // cards to print and their numbers
+  std::vector<std::string> card_;
+  std::vector<CoinBigIndex> cardNumber_;
+  // problem as read
+  char * problemName_;
+  char * objectiveName_;
+  char * rhsName_;
+  char * rangeName_;
+  char * boundName_;
+  COINRowIndex numberRows_;
+  COINRowIndex numberRowNames_;
+  COINColumnIndex numberColumns_;
+  CoinBigIndex numberElements_;
+  COINColumnIndex numberIntegers_;
+  COINMpsType * rowType_;
+  char ** rowName_;
+  COINMpsType * columnType_;
+  char ** columnName_;
+  double * objective_;
+  CoinBigIndex * start_;
+  COINRowIndex * row_;
+  double * element_;
+  double * rowlower_;
+  double * rowupper_;
+  double * collower_;
+  double * colupper_;
+  char * integerType_;
+  double objectiveOffset_;
+};
+
+CoinMpsBlockReader::CoinMpsBlockReader ( CoinMpsIO * model )
+  : model_ ( model ),
+    numberThreads_ ( CoinMax ( model->numberReadThreads (), 1 ) ),
+    data_ ( NULL ),
+    size_ ( 0 ),
+    mapped_ ( false ),
+    usedInput_ ( false ),
+    freeFormat_ ( false ),
+    eightChar_ ( true ),
+    endataCard_ ( 0 ),
+    rest_ ( NULL ),
+    task_ ( 0 ),
+    failed_ ( false ),
+    problemName_ ( NULL ),
+    objectiveName_ ( NULL ),
+    rhsName_ ( NULL ),
+    rangeName_ ( NULL ),
+    boundName_ ( NULL ),
+    numberRows_ ( 0 ),
+    numberRowNames_ ( 0 ),
+    numberColumns_ ( 0 ),
+    numberElements_ ( 0 ),
+    numberIntegers_ ( 0 ),
+    rowType_ ( NULL ),
+    rowName_ ( NULL ),
+    columnType_ ( NULL ),
+    columnName_ ( NULL ),
+    objective_ ( NULL ),
+    start_ ( NULL ),
+    row_ ( NULL ),
+    element_ ( NULL ),
+    rowlower_ ( NULL ),
+    rowupper_ ( NULL ),
+    collower_ ( NULL ),
+    colupper_ ( NULL ),
+    integerType_ ( NULL ),
+    objectiveOffset_ ( 0.0 )
+{
+  for ( int i = 0; i <= COIN_UNKNOWN_SECTION; i++ ) {
+    sectionStart_[i] = NULL;
+    sectionEnd_[i] = NULL;
+  }
+}
+
+// Anything not passed to model is freed
+CoinMpsBlockReader::~CoinMpsBlockReader ()
+{
+  freeBlocks ();
+  for ( size_t i = 0; i < rowUsed_.size (); i++ )
+    delete [] rowUsed_[i];
+  if ( rowName_ ) {
+    for ( COINRowIndex i = 0; i < numberRowNames_; i++ )
+      free ( rowName_[i] );
+  }
+  if ( columnName_ ) {
+    for ( COINColumnIndex i = 0; i < numberColumns_; i++ )
+      free ( columnName_[i] );
+  }
+  free ( problemName_ );
+  free ( objectiveName_ );
+  free ( rhsName_ );
+  free ( rangeName_ );
+  free ( boundName_ );
+  free ( rowType_ );
+  free ( rowName_ );
+  free ( columnType_ );
+  free ( columnName_ );
+  free ( objective_ );
+  free ( start_ );
+  free ( row_ );
+  free ( element_ );
+  free ( rowlower_ );
+  free ( rowupper_ );
+  free ( collower_ );
+  free ( colupper_ );
+  free ( integerType_ );
+  if ( mapped_ ) {
+#ifdef COIN_MPS_HAS_MMAP
+    munmap ( const_cast<char *> (data_), size_ );
+#endif
+  } else {
+    free ( const_cast<char *> (data_) );
+  }
+}
+
+void
+CoinMpsBlockReader::freeBlocks ()
+{
+  for ( size_t i = 0; i < blocks_.size (); i++ ) {
+    std::vector<char *> & name = blocks_[i].name;
+    for ( size_t j = 0; j < name.size (); j++ )
+      free ( name[j] );
+  }
+  blocks_.clear ();
+}
+
+// Memory maps plain file or decompresses into memory
+bool
+CoinMpsBlockReader::load ( CoinFileInput * input )
+{
+#ifdef COIN_MPS_HAS_MMAP
+  if ( input->getReadType () == "plain" ) {
+    int fd = open ( input->getFileName (), O_RDONLY );
+    if ( fd < 0 )
+      return false;
+    struct stat status;
+    if ( fstat ( fd, &status ) || status.st_size <= 0 ) {
+      close ( fd );
+      return false;
+    }
+    void * address = mmap ( NULL, status.st_size, PROT_READ, MAP_PRIVATE,
+			    fd, 0 );
+    close ( fd );
+    if ( address == MAP_FAILED )
+      return false;
+    data_ = static_cast<const char *> (address);
+    size_ = status.st_size;
+    mapped_ = true;
+    return true;
+  }
+#endif
+  usedInput_ = true;
+  size_t maximumSize = 1 << 24;
+  char * buffer = reinterpret_cast<char *> (malloc ( maximumSize ));
+  while ( buffer ) {
+    if ( size_ == maximumSize ) {
+      maximumSize *= 2;
+      char * temp = reinterpret_cast<char *> (realloc ( buffer, maximumSize ));
+      if ( !temp ) {
+	free ( buffer );
+	buffer = NULL;
+	break;
+      }
+      buffer = temp;
+    }
+    int chunk = static_cast<int> (CoinMin ( maximumSize - size_,
+					    static_cast<size_t> (1 << 30) ));
+    int n = input->read ( buffer + size_, chunk );
+    if ( n <= 0 )
+      break;
+    size_ += n;
+  }
+  data_ = buffer;
+  return buffer && size_;
+}
+
+int
+CoinMpsBlockReader::numberBlocks ( const char * start, const char * end ) const
+{
+  if ( numberThreads_ == 1 )
+    return 1;
+  size_t number = static_cast<size_t> ( end - start ) >> 12;
+  return static_cast<int> (CoinMax ( static_cast<size_t> (1),
+	     CoinMin ( number, static_cast<size_t> (4 * numberThreads_) ) ));
+}
+
+void
+CoinMpsBlockReader::split ( const char * start, const char * end, int number )
+{
+  freeBlocks ();
+  blocks_.resize ( number );
+  size_t size = end - start;
+  const char * last = start;
+  for ( int i = 0; i < number; i++ ) {
+    Block & block = blocks_[i];
+    const char * blockEnd = end;
+    if ( i < number - 1 ) {
+      blockEnd = CoinMax ( start + ( size / number ) * ( i + 1 ), last );
+      if ( blockEnd > start && blockEnd < end ) {
+	// on to start of next line
+	const char * next = static_cast<const char *>
+	  (memchr ( blockEnd - 1, '\n', end - blockEnd + 1 ));
+	blockEnd = next ? next + 1 : end;
+      }
+    }
+    block.start = last;
+    block.end = blockEnd;
+    block.bad = false;
+    block.eightChar = true;
+    block.numberLines = 0;
+    block.marker = -1;
+    block.columnOffset = 0;
+    block.elementOffset = 0;
+    last = blockEnd;
+  }
+}
+
+bool
+CoinMpsBlockReader::runBlocks ( int section )
+{
+  task_ = section;
+  failed_ = false;
+  doMpsTasks ( blockTask, this, static_cast<int> (blocks_.size ()),
+	       numberThreads_ );
+  for ( size_t i = 0; i < blocks_.size (); i++ ) {
+    if ( blocks_[i].bad )
+      return false;
+    if ( !blocks_[i].eightChar )
+      eightChar_ = false;
+  }
+  return true;
+}
+
+void
+CoinMpsBlockReader::blockTask ( void * info, int iBlock, int iThread )
+{
+  CoinMpsBlockReader * reader = static_cast<CoinMpsBlockReader *> (info);
+  Block & block = reader->blocks_[iBlock];
+  if ( reader->failed_ ) {
+    block.bad = true;
+    return;
+  }
+  switch ( reader->task_ ) {
+  case COIN_NO_SECTION:
+    reader->scanBlock ( block );
+    break;
+  case COIN_ROW_SECTION:
+    reader->rowBlock ( block );
+    break;
+  case COIN_COLUMN_SECTION:
+    reader->columnBlock ( block, reader->rowUsed_[iThread] );
+    break;
+  case COIN_RHS_SECTION:
+  case COIN_RANGES_SECTION:
+    reader->entryBlock ( block );
+    break;
+  case COIN_BOUNDS_SECTION:
+    reader->boundBlock ( block );
+    break;
+  default:
+    // copy of columns
+    reader->copyColumns ( block );
+    break;
+  }
+  if ( block.bad )
+    reader->failed_ = true;
+}
+
+// Finds section cards and checks no card is too long for card reader
+void
+CoinMpsBlockReader::scanBlock ( Block & block )
+{
+  const char * line = block.start;
+  CoinBigIndex numberLines = 0;
+  while ( line < block.end ) {
+    const char * next = static_cast<const char *>
+      (memchr ( line, '\n', block.end - line ));
+    next = next ? next + 1 : block.end;
+    if ( next - line > MAX_CARD_LENGTH - 1 ) {
+      // card reader would split line
+      block.bad = true;
+      return;
+    }
+    unsigned char thisChar = *line;
+    if ( thisChar != ' ' && thisChar != '*' &&
+	 ( thisChar >= ' ' || thisChar == '\t' ) ) {
+      block.header.push_back ( line );
+      block.headerLine.push_back ( numberLines );
+    }
+    numberLines++;
+    line = next;
+  }
+  block.numberLines = numberLines;
+}
+
+int
+CoinMpsBlockReader::lookup ( const char * field, const char * fieldEnd,
+			     int section ) const
+{
+  char name[COIN_MAX_FIELD_LENGTH];
+  int length = static_cast<int> (fieldEnd - field);
+  memcpy ( name, field, length );
+  name[length] = '\0';
+  return model_->findHash ( name, section );
+}
+
+void
+CoinMpsBlockReader::rowBlock ( Block & block )
+{
+  const char * field[maxMpsFields];
+  const char * fieldEnd[maxMpsFields];
+  const char * line = block.start;
+  while ( line < block.end ) {
+    const char * eol;
+    const char * next = mpsCard ( line, block.end, eol );
+    if ( eol > line && *line != '*' ) {
+      int n = mpsFields ( line, eol, field, fieldEnd );
+      if ( n != 2 || fieldEnd[0] - field[0] != 1 ||
+	   !mpsName ( line, eol, field[1], fieldEnd[1], 4, freeFormat_,
+		      block.eightChar ) ) {
+	block.bad = true;
+	return;
+      }
+      COINMpsType type;
+      switch ( *field[0] ) {
+      case 'N':
+	type = COIN_N_ROW;
+	break;
+      case 'E':
+	type = COIN_E_ROW;
+	break;
+      case 'L':
+	type = COIN_L_ROW;
+	break;
+      case 'G':
+	type = COIN_G_ROW;
+	break;
+      default:
+	block.bad = true;
+	return;
+      }
+      block.type.push_back ( type );
+      block.name.push_back ( mpsStrdup ( field[1], fieldEnd[1] ) );
+    }
+    line = next;
+  }
+}
+
+bool
+CoinMpsBlockReader::columnName ( const char * line, const char * eol,
+				 const char * & name, int & length )
+{
+  if ( eol == line || *line == '*' || mpsMarker ( line, eol ) )
+    return false;
+  const char * image = line;
+  while ( image < eol && ( *image == ' ' || *image == '\t' ) )
+    image++;
+  name = image;
+  while ( image < eol && *image != ' ' && *image != '\t' )
+    image++;
+  length = static_cast<int> (image - name);
+  return true;
+}
+
+/* Blocks of COLUMNS must start with a new column.  Returns first card
+   at or after position which is not part of column before position. */
+const char *
+CoinMpsBlockReader::columnBoundary ( const char * start, const char * end,
+				     const char * position ) const
+{
+  const char * lastName = NULL;
+  int lastLength = 0;
+  const char * line = position;
+  // find last column before position
+  while ( line > start && !lastName ) {
+    const char * previous = line - 1;
+    while ( previous > start && previous[-1] != '\n' )
+      previous--;
+    const char * eol;
+    mpsCard ( previous, end, eol );
+    columnName ( previous, eol, lastName, lastLength );
+    line = previous;
+  }
+  if ( !lastName )
+    return position;
+  line = position;
+  while ( line < end ) {
+    const char * eol;
+    const char * next = mpsCard ( line, end, eol );
+    const char * name;
+    int length;
+    if ( columnName ( line, eol, name, length ) &&
+	 ( length != lastLength || memcmp ( name, lastName, length ) ) )
+      return line;
+    line = next;
+  }
+  return end;
+}
+
+void
+CoinMpsBlockReader::columnBlock ( Block & block, CoinBigIndex * rowUsed )
+{
+  const char * field[maxMpsFields];
+  const char * fieldEnd[maxMpsFields];
+  double smallElement = model_->smallElement_;
+  const char * lastName = NULL;
+  int lastLength = 0;
+  COINMpsType integer = COIN_UNKNOWN_MPS_TYPE;
+  bool objUsed = false;
+  CoinBigIndex columnStart = 0;
+  const char * line = block.start;
+  while ( line < block.end ) {
+    const char * eol;
+    const char * next = mpsCard ( line, block.end, eol );
+    if ( eol == line || *line == '*' ) {
+      line = next;
+      continue;
+    }
+    int n = mpsFields ( line, eol, field, fieldEnd );
+    if ( n < 0 )
+      break;
+    if ( mpsMarker ( line, eol ) ) {
+      if ( n < 3 || fieldEnd[1] - field[1] < 8 ||
+	   memcmp ( field[1], "'MARKER'", 8 ) || eol - field[2] < 8 ||
+	   !mpsName ( line, eol, field[0], fieldEnd[0], 4, freeFormat_,
+		      block.eightChar ) ||
+	   !mpsName ( line, eol, field[1], fieldEnd[1], 14, freeFormat_,
+		      block.eightChar ) )
+	break;
+      if ( fieldEnd[0] - field[0] == 2 && field[0][0] == 'S' &&
+	   field[0][1] >= '1' && field[0][1] <= '3' )
+	break; // SOS in COLUMNS
+      if ( !memcmp ( field[2], "'INTORG'", 8 ) ) {
+	integer = COIN_INTORG;
+	block.marker = 1;
+      } else if ( !memcmp ( field[2], "'INTEND'", 8 ) ) {
+	integer = COIN_UNSET_BOUND;
+	block.marker = 0;
+      } else {
+	break;
+      }
+      line = next;
+      continue;
+    }
+    if ( n < 3 || !( n & 1 ) ||
+	 !mpsName ( line, eol, field[0], fieldEnd[0], 4, freeFormat_,
+		    block.eightChar ) )
+      break;
+    int length = static_cast<int> (fieldEnd[0] - field[0]);
+    if ( !lastName || length != lastLength ||
+	 memcmp ( field[0], lastName, length ) ) {
+      // new column
+      for ( CoinBigIndex j = columnStart;
+	    j < static_cast<CoinBigIndex> (block.row.size ()); j++ )
+	rowUsed[block.row[j]] = -1;
+      columnStart = static_cast<CoinBigIndex> (block.row.size ());
+      block.name.push_back ( mpsStrdup ( field[0], fieldEnd[0] ) );
+      block.type.push_back ( integer );
+      block.objective.push_back ( 0.0 );
+      block.start2.push_back ( columnStart );
+      objUsed = false;
+      lastName = field[0];
+      lastLength = length;
+    }
+    int k;
+    for ( k = 1; k < n; k += 2 ) {
+      double value;
+      if ( !mpsName ( line, eol, field[k], fieldEnd[k], k == 1 ? 14 : 39,
+		      freeFormat_, block.eightChar ) ||
+	   !mpsValue ( field[k + 1], fieldEnd[k + 1], value ) )
+	break;
+      if ( fabs ( value ) > smallElement ) {
+	int irow = lookup ( field[k], fieldEnd[k], 0 );
+	if ( irow < 0 )
+	  break;
+	if ( irow == numberRows_ ) {
+	  // objective
+	  if ( objUsed )
+	    break;
+	  objUsed = true;
+	  value += block.objective.back ();
+	  if ( fabs ( value ) <= smallElement )
+	    value = 0.0;
+	  block.objective.back () = value;
+	} else if ( irow < numberRows_ ) {
+	  if ( rowUsed[irow] >= 0 )
+	    break;
+	  rowUsed[irow] = static_cast<CoinBigIndex> (block.row.size ());
+	  block.row.push_back ( irow );
+	  block.element.push_back ( value );
+	}
+      }
+    }
+    if ( k < n )
+      break;
+    line = next;
+  }
+  if ( line < block.end )
+    block.bad = true;
+  for ( CoinBigIndex j = columnStart;
+	j < static_cast<CoinBigIndex> (block.row.size ()); j++ )
+    rowUsed[block.row[j]] = -1;
+}
+
+// Moves block of columns into model arrays
+void
+CoinMpsBlockReader::copyColumns ( const Block & block )
+{
+  COINColumnIndex offset = block.columnOffset;
+  int number = static_cast<int> (block.name.size ());
+  for ( int j = 0; j < number; j++ ) {
+    columnName_[offset + j] = block.name[j];
+    columnType_[offset + j] = block.type[j];
+    objective_[offset + j] = block.objective[j];
+    start_[offset + j] = block.start2[j] + block.elementOffset;
+  }
+  CoinBigIndex numberElements = static_cast<CoinBigIndex> (block.row.size ());
+  if ( numberElements ) {
+    memcpy ( row_ + block.elementOffset, &block.row[0],
+	     numberElements * sizeof ( COINRowIndex ) );
+    memcpy ( element_ + block.elementOffset, &block.element[0],
+	     numberElements * sizeof ( double ) );
+  }
+}
+
+// RHS or RANGES
+void
+CoinMpsBlockReader::entryBlock ( Block & block )
+{
+  const char * field[maxMpsFields];
+  const char * fieldEnd[maxMpsFields];
+  const char * line = block.start;
+  while ( line < block.end ) {
+    const char * eol;
+    const char * next = mpsCard ( line, block.end, eol );
+    if ( eol == line || *line == '*' ) {
+      line = next;
+      continue;
+    }
+    int n = mpsFields ( line, eol, field, fieldEnd );
+    if ( n < 0 )
+      break;
+    Entry entry;
+    entry.type = COIN_BLANK_COLUMN;
+    int first;
+    if ( !freeFormat_ && eol - line >= 12 &&
+	 !memcmp ( line + 4, "        ", 8 ) ) {
+      // no name
+      entry.name = "        ";
+      entry.nameLength = 8;
+      first = 0;
+    } else {
+      if ( !mpsName ( line, eol, field[0], fieldEnd[0], 4, freeFormat_,
+		      block.eightChar ) )
+	break;
+      entry.name = field[0];
+      entry.nameLength = static_cast<int> (fieldEnd[0] - field[0]);
+      first = 1;
+    }
+    if ( n - first < 2 || ( ( n - first ) & 1 ) )
+      break;
+    int k;
+    for ( k = first; k < n; k += 2 ) {
+      if ( !mpsName ( line, eol, field[k], fieldEnd[k], k == first ? 14 : 39,
+		      freeFormat_, block.eightChar ) ||
+	   !mpsValue ( field[k + 1], fieldEnd[k + 1], entry.value ) )
+	break;
+      entry.index = lookup ( field[k], fieldEnd[k], 0 );
+      if ( entry.index < 0 )
+	break;
+      block.entry.push_back ( entry );
+    }
+    if ( k < n )
+      break;
+    line = next;
+  }
+  if ( line < block.end )
+    block.bad = true;
+}
+
+void
+CoinMpsBlockReader::boundBlock ( Block & block )
+{
+  const char * field[maxMpsFields];
+  const char * fieldEnd[maxMpsFields];
+  const char * line = block.start;
+  while ( line < block.end ) {
+    const char * eol;
+    const char * next = mpsCard ( line, block.end, eol );
+    if ( eol == line || *line == '*' ) {
+      line = next;
+      continue;
+    }
+    // card reader would expand tabs
+    if ( !freeFormat_ && memchr ( line, '\t', eol - line ) )
+      break;
+    int n = mpsFields ( line, eol, field, fieldEnd );
+    if ( n < 2 || fieldEnd[0] - field[0] != 2 )
+      break;
+    Entry entry;
+    entry.type = COIN_UNKNOWN_MPS_TYPE;
+    for ( int i = COIN_UP_BOUND; i <= COIN_LI_BOUND; i++ ) {
+      if ( !strncmp ( field[0], mpsTypes[i], 2 ) ) {
+	entry.type = static_cast<COINMpsType> (i);
+	break;
+      }
+    }
+    if ( entry.type == COIN_UNKNOWN_MPS_TYPE )
+      break;
+    int first;
+    if ( !freeFormat_ && eol - line >= 12 &&
+	 !memcmp ( line + 4, "        ", 8 ) ) {
+      // no name
+      entry.name = "        ";
+      entry.nameLength = 8;
+      first = 1;
+    } else {
+      if ( !mpsName ( line, eol, field[1], fieldEnd[1], 4, freeFormat_,
+		      block.eightChar ) )
+	break;
+      entry.name = field[1];
+      entry.nameLength = static_cast<int> (fieldEnd[1] - field[1]);
+      first = 2;
+    }
+    if ( n < first + 1 || n > first + 2 ||
+	 !mpsName ( line, eol, field[first], fieldEnd[first], 14, freeFormat_,
+		    block.eightChar ) )
+      break;
+    entry.value = 0.0;
+    if ( n == first + 2 &&
+	 !mpsValue ( field[first + 1], fieldEnd[first + 1], entry.value ) )
+      break;
+    entry.index = lookup ( field[first], fieldEnd[first], 1 );
+    if ( entry.index < 0 )
+      break;
+    block.entry.push_back ( entry );
+    line = next;
+  }
+  if ( line < block.end )
+    block.bad = true;
+}
+
+// Applies RHS or RANGES entries in order
+bool
+CoinMpsBlockReader::applyEntries ( int section, char * & vectorName,
+				   double & offset )
+{
+  bool objUsed = false;
+  for ( size_t i = 0; i < blocks_.size (); i++ ) {
+    const std::vector<Entry> & entries = blocks_[i].entry;
+    for ( size_t j = 0; j < entries.size (); j++ ) {
+      const Entry & entry = entries[j];
+      if ( !vectorName ) {
+	vectorName = mpsStrdup ( entry.name, entry.name + entry.nameLength );
+      } else if ( static_cast<int> (strlen ( vectorName )) != entry.nameLength ||
+		  memcmp ( vectorName, entry.name, entry.nameLength ) ) {
+	// card reader skips rest of section (and a bit more)
+	return false;
+      }
+      COINRowIndex irow = entry.index;
+      double value = entry.value;
+      if ( section == COIN_RHS_SECTION ) {
+	if ( irow == numberRows_ ) {
+	  if ( objUsed )
+	    return false;
+	  objUsed = true;
+	  offset += value;
+	} else if ( irow < numberRows_ ) {
+	  if ( rowlower_[irow] != -model_->infinity_ )
+	    return false;
+	  rowlower_[irow] = value;
+	}
+      } else {
+	if ( irow == numberRows_ )
+	  return false;
+	if ( irow < numberRows_ ) {
+	  if ( rowupper_[irow] != model_->infinity_ )
+	    return false;
+	  rowupper_[irow] = value;
+	}
+      }
+    }
+  }
+  return true;
+}
+
+bool
+CoinMpsBlockReader::read ( CoinFileInput * input )
+{
+  if ( !load ( input ) )
+    return false;
+  // model members used by findHash and setBound
+  char ** saveNames[2] = {model_->names_[0], model_->names_[1]};
+  COINColumnIndex saveNumberHash[2] = {model_->numberHash_[0],
+				       model_->numberHash_[1]};
+  CoinMpsIO::CoinHashLink * saveHash[2] = {model_->hash_[0], model_->hash_[1]};
+  double * saveLower = model_->collower_;
+  double * saveUpper = model_->colupper_;
+  char * saveInteger = model_->integerType_;
+  model_->hash_[0] = NULL;
+  model_->hash_[1] = NULL;
+  bool ok = readSections ();
+  for ( int section = 0; section < 2; section++ ) {
+    delete [] model_->hash_[section];
+    model_->hash_[section] = NULL;
+  }
+  if ( !ok ) {
+    model_->names_[0] = saveNames[0];
+    model_->names_[1] = saveNames[1];
+    model_->numberHash_[0] = saveNumberHash[0];
+    model_->numberHash_[1] = saveNumberHash[1];
+    model_->hash_[0] = saveHash[0];
+    model_->hash_[1] = saveHash[1];
+    model_->collower_ = saveLower;
+    model_->colupper_ = saveUpper;
+    model_->integerType_ = saveInteger;
+    return false;
+  }
+  // now model can have it
+  CoinMpsIO * model = model_;
+  free ( model->problemName_ );
+  model->problemName_ = problemName_;
+  problemName_ = NULL;
+  free ( model->objectiveName_ );
+  model->objectiveName_ = objectiveName_;
+  objectiveName_ = NULL;
+  if ( rhsName_ ) {
+    free ( model->rhsName_ );
+    model->rhsName_ = rhsName_;
+    rhsName_ = NULL;
+  }
+  if ( rangeName_ ) {
+    free ( model->rangeName_ );
+    model->rangeName_ = rangeName_;
+    rangeName_ = NULL;
+  }
+  if ( boundName_ ) {
+    free ( model->boundName_ );
+    model->boundName_ = boundName_;
+    boundName_ = NULL;
+  }
+  model->numberRows_ = numberRows_;
+  model->numberColumns_ = numberColumns_;
+  model->numberElements_ = numberElements_;
+  model->names_[0] = rowName_;
+  model->numberHash_[0] = numberRowNames_;
+  rowName_ = NULL;
+  model->names_[1] = columnName_;
+  model->numberHash_[1] = numberColumns_;
+  columnName_ = NULL;
+  model->rowlower_ = rowlower_;
+  model->rowupper_ = rowupper_;
+  rowlower_ = rowupper_ = NULL;
+  model->collower_ = collower_;
+  model->colupper_ = colupper_;
+  collower_ = colupper_ = NULL;
+  model->objective_ = objective_;
+  objective_ = NULL;
+  model->integerType_ = integerType_;
+  integerType_ = NULL;
+  model->objectiveOffset_ = objectiveOffset_;
+  model->matrixByColumn_ =
+    new CoinPackedMatrix ( true, numberRows_, numberColumns_, numberElements_,
+			   element_, row_, start_, NULL );
+  // print cards as card reader would have
+  CoinMessageHandler * handler = model->handler_;
+  for ( size_t i = 0; i < card_.size (); i++ )
+    handler->message ( COIN_MPS_LINE, model->messages_ ) << cardNumber_[i]
+      << card_[i].c_str () << CoinMessageEol;
+  handler->message ( COIN_MPS_STATS, model->messages_ ) << model->problemName_
+    << numberRows_ << numberColumns_ << numberElements_ << CoinMessageEol;
+  return true;
+}
+
+bool
+CoinMpsBlockReader::readSections ()
+{
+  // find section cards
+  split ( data_, data_ + size_, numberBlocks ( data_, data_ + size_ ) );
+  if ( !runBlocks ( COIN_NO_SECTION ) )
+    return false;
+  std::vector<const char *> header;
+  std::vector<CoinBigIndex> headerCard;
+  CoinBigIndex numberLines = 0;
+  for ( size_t i = 0; i < blocks_.size (); i++ ) {
+    const Block & block = blocks_[i];
+    for ( size_t j = 0; j < block.header.size (); j++ ) {
+      header.push_back ( block.header[j] );
+      headerCard.push_back ( numberLines + block.headerLine[j] + 1 );
+    }
+    numberLines += block.numberLines;
+  }
+  const char * end = data_ + size_;
+  char card[MAX_CARD_LENGTH];
+  // NAME must be first card which is not a comment
+  size_t iHeader = 0;
+  const char * line = data_;
+  while ( line < end ) {
+    const char * eol;
+    const char * next = mpsCard ( line, end, eol );
+    if ( eol > line && *line != '*' && *line != '#' )
+      break;
+    if ( iHeader < header.size () && header[iHeader] == line )
+      iHeader++;
+    line = next;
+  }
+  if ( line == end || iHeader == header.size () || header[iHeader] != line )
+    return false;
+  {
+    const char * eol;
+    line = mpsCard ( line, end, eol );
+    int length = static_cast<int> (eol - header[iHeader]);
+    memcpy ( card, header[iHeader], length );
+    card[length] = '\0';
+    if ( strncmp ( card, "NAME", 4 ) )
+      return false;
+    // as readToNextSection
+    const char * next = card + 5;
+    const char * cardEnd = card + length;
+    while ( next < cardEnd && ( *next == ' ' || *next == '\t' ) )
+      next++;
+    if ( next < cardEnd ) {
+      const char * nextBlank = next;
+      while ( nextBlank < cardEnd && *nextBlank != ' ' && *nextBlank != '\t' )
+	nextBlank++;
+      if ( nextBlank - next >= COIN_MAX_FIELD_LENGTH ||
+	   ( nextBlank - next == 1 && ( *next == '+' || *next == '-' ) ) )
+	return false;
+      problemName_ = mpsStrdup ( next, nextBlank );
+      if ( nextBlank < cardEnd ) {
+	if ( strstr ( nextBlank, "IEEE" ) )
+	  return false;
+	if ( strstr ( nextBlank, "FREE" ) || strstr ( nextBlank, "VALUES" ) )
+	  freeFormat_ = true;
+      }
+    } else {
+      problemName_ = CoinStrdup ( "no_name" );
+    }
+    card_.push_back ( card );
+    cardNumber_.push_back ( headerCard[iHeader] );
+    iHeader++;
+  }
+  // nothing but comments before ROWS
+  const char * nameEnd = iHeader < header.size () ? header[iHeader] : end;
+  while ( line < nameEnd ) {
+    const char * eol;
+    const char * next = mpsCard ( line, end, eol );
+    if ( eol > line && *line != '*' )
+      return false;
+    line = next;
+  }
+  // sections must be in usual order
+  const COINSectionType order[] = {
+    COIN_ROW_SECTION, COIN_COLUMN_SECTION, COIN_RHS_SECTION,
+    COIN_RANGES_SECTION, COIN_BOUNDS_SECTION, COIN_ENDATA_SECTION
+  };
+  int iOrder = 0;
+  int lastSection = -1;
+  for ( ; iHeader < header.size (); iHeader++ ) {
+    const char * eol;
+    const char * next = mpsCard ( header[iHeader], end, eol );
+    int length = static_cast<int> (eol - header[iHeader]);
+    memcpy ( card, header[iHeader], length );
+    card[length] = '\0';
+    if ( !freeFormat_ && memchr ( card, '\t', length ) )
+      return false;
+    int iSection;
+    for ( iSection = COIN_ROW_SECTION; iSection < COIN_UNKNOWN_SECTION;
+	  iSection++ ) {
+      if ( !strncmp ( card, section[iSection], strlen ( section[iSection] ) ) )
+	break;
+    }
+    int jOrder;
+    for ( jOrder = iOrder; jOrder < 6; jOrder++ ) {
+      if ( order[jOrder] == iSection || jOrder < 3 )
+	break;
+    }
+    if ( jOrder == 6 || order[jOrder] != iSection )
+      return false;
+    iOrder = jOrder + 1;
+    card_.push_back ( card );
+    cardNumber_.push_back ( headerCard[iHeader] );
+    if ( lastSection >= 0 )
+      sectionEnd_[lastSection] = header[iHeader];
+    if ( iSection == COIN_ENDATA_SECTION ) {
+      endata_ = card;
+      endataCard_ = headerCard[iHeader];
+      rest_ = next;
+      break;
+    }
+    sectionStart_[iSection] = next;
+    lastSection = iSection;
+  }
+  if ( iHeader == header.size () )
+    return false; // no ENDATA
+  header.clear ();
+  headerCard.clear ();
+
+  // ROWS
+  const char * start = sectionStart_[COIN_ROW_SECTION];
+  end = sectionEnd_[COIN_ROW_SECTION];
+  split ( start, end, numberBlocks ( start, end ) );
+  if ( !runBlocks ( COIN_ROW_SECTION ) )
+    return false;
+  COINRowIndex numberFree = 0;
+  for ( size_t i = 0; i < blocks_.size (); i++ ) {
+    const std::vector<COINMpsType> & type = blocks_[i].type;
+    for ( size_t j = 0; j < type.size (); j++ ) {
+      if ( type[j] != COIN_N_ROW )
+	numberRows_++;
+      else
+	numberFree++;
+    }
+  }
+  if ( !numberFree )
+    return false; // no objective
+  numberFree--;
+  rowType_ = reinterpret_cast<COINMpsType *>
+    (malloc ( CoinMax ( numberRows_, 1 ) * sizeof ( COINMpsType ) ));
+  rowName_ = reinterpret_cast<char **>
+    (malloc ( ( numberRows_ + 1 + numberFree ) * sizeof ( char * ) ));
+  COINRowIndex iFree = numberRows_ + 1;
+  for ( size_t i = 0; i < blocks_.size (); i++ ) {
+    std::vector<COINMpsType> & type = blocks_[i].type;
+    std::vector<char *> & name = blocks_[i].name;
+    for ( size_t j = 0; j < type.size (); j++ ) {
+      if ( type[j] != COIN_N_ROW ) {
+	rowType_[numberRowNames_] = type[j];
+	rowName_[numberRowNames_++] = name[j];
+      } else if ( !objectiveName_ ) {
+	objectiveName_ = name[j];
+      } else {
+	rowName_[iFree++] = name[j];
+      }
+    }
+    name.clear ();
+  }
+  rowName_[numberRows_] = CoinStrdup ( objectiveName_ );
+  numberRowNames_ = iFree;
+  model_->names_[0] = rowName_;
+  model_->numberHash_[0] = numberRowNames_;
+  if ( model_->fillHash ( 0, true ) )
+    return false; // duplicates
+
+  // COLUMNS
+  start = sectionStart_[COIN_COLUMN_SECTION];
+  end = sectionEnd_[COIN_COLUMN_SECTION];
+  split ( start, end, numberBlocks ( start, end ) );
+  // move boundaries so no column is split
+  for ( size_t i = 1; i < blocks_.size (); i++ ) {
+    const char * position = CoinMax ( blocks_[i].start, blocks_[i - 1].start );
+    if ( position < end )
+      position = columnBoundary ( start, end, position );
+    blocks_[i].start = position;
+    blocks_[i - 1].end = position;
+  }
+  rowUsed_.resize ( numberThreads_ );
+  for ( int i = 0; i < numberThreads_; i++ ) {
+    rowUsed_[i] = new CoinBigIndex [CoinMax ( numberRows_, 1 )];
+    for ( COINRowIndex j = 0; j < numberRows_; j++ )
+      rowUsed_[i][j] = -1;
+  }
+  if ( !runBlocks ( COIN_COLUMN_SECTION ) )
+    return false;
+  COINMpsType integer = COIN_UNSET_BOUND;
+  for ( size_t i = 0; i < blocks_.size (); i++ ) {
+    Block & block = blocks_[i];
+    block.columnOffset = numberColumns_;
+    block.elementOffset = numberElements_;
+    for ( size_t j = 0; j < block.type.size (); j++ ) {
+      if ( block.type[j] == COIN_UNKNOWN_MPS_TYPE )
+	block.type[j] = integer;
+      if ( block.type[j] == COIN_INTORG )
+	numberIntegers_++;
+    }
+    if ( block.marker >= 0 )
+      integer = block.marker ? COIN_INTORG : COIN_UNSET_BOUND;
+    numberColumns_ += static_cast<COINColumnIndex> (block.name.size ());
+    numberElements_ += static_cast<CoinBigIndex> (block.row.size ());
+  }
+  columnName_ = reinterpret_cast<char **>
+    (malloc ( CoinMax ( numberColumns_, 1 ) * sizeof ( char * ) ));
+  columnType_ = reinterpret_cast<COINMpsType *>
+    (malloc ( CoinMax ( numberColumns_, 1 ) * sizeof ( COINMpsType ) ));
+  objective_ = reinterpret_cast<double *>
+    (malloc ( CoinMax ( numberColumns_, 1 ) * sizeof ( double ) ));
+  start_ = reinterpret_cast<CoinBigIndex *>
+    (malloc ( ( numberColumns_ + 1 ) * sizeof ( CoinBigIndex ) ));
+  row_ = reinterpret_cast<COINRowIndex *>
+    (malloc ( CoinMax ( numberElements_, 1 ) * sizeof ( COINRowIndex ) ));
+  element_ = reinterpret_cast<double *>
+    (malloc ( CoinMax ( numberElements_, 1 ) * sizeof ( double ) ));
+  start_[numberColumns_] = numberElements_;
+  runBlocks ( COIN_UNKNOWN_SECTION );
+  for ( size_t i = 0; i < blocks_.size (); i++ )
+    blocks_[i].name.clear (); // now in columnName_
+
+  // RHS and RANGES
+  rowlower_ = reinterpret_cast<double *>
+    (malloc ( CoinMax ( numberRows_, 1 ) * sizeof ( double ) ));
+  rowupper_ = reinterpret_cast<double *>
+    (malloc ( CoinMax ( numberRows_, 1 ) * sizeof ( double ) ));
+  double infinity = model_->infinity_;
+  for ( COINRowIndex i = 0; i < numberRows_; i++ ) {
+    rowlower_[i] = -infinity;
+    rowupper_[i] = infinity;
+  }
+  for ( int iSection = COIN_RHS_SECTION; iSection <= COIN_RANGES_SECTION;
+	iSection++ ) {
+    start = sectionStart_[iSection];
+    if ( !start )
+      continue;
+    end = sectionEnd_[iSection];
+    split ( start, end, numberBlocks ( start, end ) );
+    if ( !runBlocks ( iSection ) )
+      return false;
+    if ( !applyEntries ( iSection,
+			 iSection == COIN_RHS_SECTION ? rhsName_ : rangeName_,
+			 objectiveOffset_ ) )
+      return false;
+  }
+  mpsRowBounds ( numberRows_, rowType_, rowlower_, rowupper_, infinity );
+
+  // BOUNDS
+  collower_ = reinterpret_cast<double *>
+    (malloc ( CoinMax ( numberColumns_, 1 ) * sizeof ( double ) ));
+  colupper_ = reinterpret_cast<double *>
+    (malloc ( CoinMax ( numberColumns_, 1 ) * sizeof ( double ) ));
+  integerType_ = reinterpret_cast<char *>
+    (malloc ( CoinMax ( numberColumns_, 1 ) * sizeof ( char ) ));
+  for ( COINColumnIndex i = 0; i < numberColumns_; i++ ) {
+    collower_[i] = 0.0;
+    colupper_[i] = infinity;
+    if ( columnType_[i] == COIN_INTORG ) {
+      integerType_[i] = 1;
+      columnType_[i] = COIN_UNSET_BOUND;
+    } else {
+      integerType_[i] = 0;
+    }
+  }
+  model_->names_[1] = columnName_;
+  model_->numberHash_[1] = numberColumns_;
+  if ( model_->fillHash ( 1, true ) )
+    return false; // duplicates
+  start = sectionStart_[COIN_BOUNDS_SECTION];
+  if ( start ) {
+    end = sectionEnd_[COIN_BOUNDS_SECTION];
+    split ( start, end, numberBlocks ( start, end ) );
+    if ( !runBlocks ( COIN_BOUNDS_SECTION ) )
+      return false;
+    model_->collower_ = collower_;
+    model_->colupper_ = colupper_;
+    model_->integerType_ = integerType_;
+    for ( size_t i = 0; i < blocks_.size (); i++ ) {
+      const std::vector<Entry> & entries = blocks_[i].entry;
+      for ( size_t j = 0; j < entries.size (); j++ ) {
+	const Entry & entry = entries[j];
+	if ( !boundName_ ) {
+	  boundName_ = mpsStrdup ( entry.name, entry.name + entry.nameLength );
+	} else if ( static_cast<int> (strlen ( boundName_ )) != entry.nameLength ||
+		    memcmp ( boundName_, entry.name, entry.nameLength ) ) {
+	  return false;
+	}
+	if ( model_->setBound ( entry.type, entry.index, entry.value, NULL,
+				columnType_, numberIntegers_ ) )
+	  return false;
+      }
+    }
+  }
+  freeBlocks ();
+  if ( !numberIntegers_ ) {
+    free ( integerType_ );
+    integerType_ = NULL;
+  } else {
+    mpsIntegerBounds ( numberColumns_, integerType_, columnType_,
+		       collower_, colupper_, model_->defaultBound_ );
+  }
+  return true;
+}
+
+CoinMpsCardReader *
+CoinMpsBlockReader::cardReader ( const CoinFileInput * input ) const
+{
+  const char * end = data_ + size_;
+  CoinMpsCardReader * cardReader =
+    new CoinMpsCardReader ( new CoinMpsReadInput ( input, rest_, end - rest_ ),
+			    model_ );
+  strcpy ( cardReader->card_, endata_.c_str () );
+  cardReader->position_ = cardReader->card_;
+  cardReader->eol_ = cardReader->card_;
+  cardReader->section_ = COIN_ENDATA_SECTION;
+  cardReader->cardNumber_ = endataCard_;
+  cardReader->freeFormat_ = freeFormat_;
+  cardReader->eightChar_ = eightChar_;
+  return cardReader;
+}
+
+// Reads whole file in blocks using numberReadThreads_ threads
+bool
+CoinMpsIO::readMpsInBlocks ()
+{
+#ifndef NONAMES
+  if ( numberReadThreads_ <= 0 || !strcmp ( fileName_, "stdin" ) ||
+       allowStringElements_ )
+    return false;
+  CoinFileInput * input = cardReader_->fileInput ();
+  CoinMpsBlockReader reader ( this );
+  if ( reader.read ( input ) ) {
+    CoinMpsCardReader * cardReader = reader.cardReader ( input );
+    delete cardReader_;
+    cardReader_ = cardReader;
+    return true;
+  } else {
+    if ( reader.usedInput () ) {
+      // start again
+      std::string name = input->getFileName ();
+      delete cardReader_;
+      cardReader_ = new CoinMpsCardReader ( CoinFileInput::create ( name ),
+					    this );
+    }
+    return false;
+  }
+#else
+  return false;
+#endif
+}
 #ifdef COIN_HAS_GLPK
 #include "glpk.h"
 glp_tran* cbc_glp_tran = NULL;
@@ -5295,7 +6854,8 @@ convertObjective_(false),
 allowStringElements_(0),
 maximumStringElements_(0),
 numberStringElements_(0),
-stringElements_(NULL)
+stringElements_(NULL),
+numberReadThreads_(0)
 {
   numberHash_[0]=0;
   hash_[0]=NULL;
@@ -5341,7 +6901,8 @@ cardReader_(NULL),
 allowStringElements_(rhs.allowStringElements_),
 maximumStringElements_(rhs.maximumStringElements_),
 numberStringElements_(rhs.numberStringElements_),
-stringElements_(NULL)
+stringElements_(NULL),
+numberReadThreads_(rhs.numberReadThreads_)
 {
   numberHash_[0]=0;
   hash_[0]=NULL;
@@ -5424,6 +6985,7 @@ void CoinMpsIO::gutsOfCopy(const CoinMpsIO & rhs)
   allowStringElements_ = rhs.allowStringElements_;
   maximumStringElements_ = rhs.maximumStringElements_;
   numberStringElements_ = rhs.numberStringElements_;
+  numberReadThreads_ = rhs.numberReadThreads_;
   if (numberStringElements_) {
     stringElements_ = new char * [maximumStringElements_];
     for (int i=0;i<numberStringElements_;i++)
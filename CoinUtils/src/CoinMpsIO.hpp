@@ -210,6 +210,8 @@ public:
   double osi_strtod(char * ptr, char ** output);
   //@}
 
+  /// Block reader leaves card reader as if it had read the cards
+  friend class CoinMpsBlockReader;
 };
 
 //#############################################################################
@@ -328,6 +330,7 @@ protected:
 
 class CoinMpsIO {
    friend void CoinMpsIOUnitTest(const std::string & mpsDir);
+   friend class CoinMpsBlockReader;
 
 public:
 
@@ -564,6 +567,17 @@ public:
     { return smallElement_;}
     inline void setSmallElementValue(double value)
     { smallElement_=value;} 
+    /** Number of threads used by readMps.
+        0 (default) reads card by card.  Otherwise the whole file is
+        loaded (memory mapped if plain) and ROWS, COLUMNS, RHS, RANGES and
+        BOUNDS are split into blocks of lines which are parsed on this many
+        threads.  Files the block reader does not handle (e.g. OBJSENSE,
+        SOS or quadratic sections, IEEE format, string elements or any
+        errors) are read card by card.  The result is the same either way. */
+    inline int numberReadThreads() const
+    { return numberReadThreads_;}
+    inline void setNumberReadThreads(int value)
+    { numberReadThreads_ = value;}
 //@}
 
 
@@ -890,6 +904,14 @@ protected:
   void addString(int iRow,int iColumn, const char * value);
   /// Decode string
   void decodeString(int iString, int & iRow, int & iColumn, const char * & value) const;
+  /** Sets bound from BOUNDS entry - returns true if error.
+      valueString only used for string elements */
+  bool setBound(COINMpsType type, COINColumnIndex icolumn, double value,
+		const char * valueString, COINMpsType * columnType,
+		COINColumnIndex & numberIntegers);
+  /** Reads whole file in blocks using numberReadThreads_ threads.
+      Returns false if file must be read card by card (nothing changed) */
+  bool readMpsInBlocks();
   //@}
 
   
@@ -904,6 +926,9 @@ protected:
   void startHash ( char **names, const int number , int section );
   /// This one does it when names are already in
   void startHash ( int section ) const;
+  /** Does work of startHash - returns number of duplicate names.
+      If quiet stops at first duplicate without printing */
+  int fillHash ( int section, bool quiet ) const;
   /// Deletes hash storage
   void stopHash ( int section );
   /// Finds match using hash,  -1 not found
@@ -1027,6 +1052,8 @@ protected:
       int numberStringElements_;
       /// String elements
       char ** stringElements_;
+      /// Number of threads for readMps (0 reads card by card)
+      int numberReadThreads_;
     //@}
 
 };
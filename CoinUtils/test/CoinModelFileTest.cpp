@@ -0,0 +1,216 @@
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+#include "CoinMpsIO.hpp"
+#include "CoinModelFile.hpp"
+
+//#############################################################################
+
+// Returns true if file has same problem as mps
+static bool sameProblem(const CoinModelFile & file, const CoinMpsIO & m,
+			bool names)
+{
+  int numberRows = m.getNumRows();
+  int numberColumns = m.getNumCols();
+  const CoinPackedMatrix * matrix = m.getMatrixByCol();
+  CoinBigIndex numberElements = matrix->getNumElements();
+  if (file.getNumRows()!=numberRows||file.getNumCols()!=numberColumns||
+      file.getNumElements()!=numberElements||
+      file.objectiveOffset()!=m.objectiveOffset())
+    return false;
+  if (memcmp(file.getColumnStarts(),matrix->getVectorStarts(),
+	     (numberColumns+1)*sizeof(CoinBigIndex))||
+      memcmp(file.getIndices(),matrix->getIndices(),
+	     numberElements*sizeof(int))||
+      memcmp(file.getElements(),matrix->getElements(),
+	     numberElements*sizeof(double))||
+      memcmp(file.getColLower(),m.getColLower(),numberColumns*sizeof(double))||
+      memcmp(file.getColUpper(),m.getColUpper(),numberColumns*sizeof(double))||
+      memcmp(file.getObjCoefficients(),m.getObjCoefficients(),
+	     numberColumns*sizeof(double))||
+      memcmp(file.getRowLower(),m.getRowLower(),numberRows*sizeof(double))||
+      memcmp(file.getRowUpper(),m.getRowUpper(),numberRows*sizeof(double)))
+    return false;
+  for (int i=0;i<numberColumns;i++) {
+    if (file.isInteger(i)!=m.isInteger(i))
+      return false;
+  }
+  if (names!=file.hasNames())
+    return false;
+  if (names) {
+    if (strcmp(file.getProblemName(),m.getProblemName())||
+	strcmp(file.getObjectiveName(),m.getObjectiveName()))
+      return false;
+    for (int i=0;i<numberRows;i++) {
+      if (strcmp(file.rowName(i),m.rowName(i)))
+	return false;
+    }
+    for (int i=0;i<numberColumns;i++) {
+      if (strcmp(file.columnName(i),m.columnName(i)))
+	return false;
+    }
+  }
+  return true;
+}
+
+//--------------------------------------------------------------------------
+// test binary model file
+void
+CoinModelFileUnitTest(const std::string & mpsDir)
+{
+  const char * fileName = "CoinModelFile.bin";
+  const char * models[] = {"exmip1","p0033"};
+  for (int iModel=0;iModel<2;iModel++) {
+    CoinMpsIO m;
+    m.messageHandler()->setLogLevel(0);
+    std::string fn = mpsDir+models[iModel];
+    int numErr = m.readMps(fn.c_str(),"mps");
+    assert( numErr== 0 );
+    int numberRows = m.getNumRows();
+    int numberColumns = m.getNumCols();
+    std::vector<std::string> rowNames;
+    for (int i=0;i<numberRows;i++)
+      rowNames.push_back(m.rowName(i));
+    std::vector<std::string> columnNames;
+    for (int i=0;i<numberColumns;i++)
+      columnNames.push_back(m.columnName(i));
+    // Write with names from column copy and without from row copy
+    for (int iPass=0;iPass<2;iPass++) {
+      CoinModelFile output;
+      const CoinPackedMatrix * matrix =
+	iPass ? m.getMatrixByRow() : m.getMatrixByCol();
+      output.setModel(*matrix,m.getColLower(),m.getColUpper(),
+		      m.getObjCoefficients(),m.integerColumns(),
+		      m.getRowLower(),m.getRowUpper());
+      if (!iPass)
+	output.setNames(m.getProblemName(),m.getObjectiveName(),
+			rowNames,columnNames);
+      output.setObjectiveOffset(m.objectiveOffset());
+      assert (sameProblem(output,m,!iPass));
+      assert (!output.write(fileName));
+      assert (CoinModelFile::isModelFile(fileName));
+      CoinModelFile input;
+      assert (!input.open(fileName,true));
+      assert (sameProblem(input,m,!iPass));
+      assert (!input.originalColumns());
+      assert (!input.originalRows());
+      assert (input.objectiveSense()==1.0);
+      if (iPass)
+	assert (!input.rowName(0)&&!input.columnName(0));
+    }
+  }
+  // Mapping to original and rewriting an open file
+  {
+    CoinMpsIO m;
+    m.messageHandler()->setLogLevel(0);
+    std::string fn = mpsDir+"exmip1";
+    int numErr = m.readMps(fn.c_str(),"mps");
+    assert( numErr== 0 );
+    int numberRows = m.getNumRows();
+    int numberColumns = m.getNumCols();
+    std::vector<int> originalColumns(numberColumns);
+    for (int i=0;i<numberColumns;i++)
+      originalColumns[i]=2*i+1;
+    std::vector<int> originalRows(numberRows);
+    for (int i=0;i<numberRows;i++)
+      originalRows[i]=numberRows-i;
+    CoinModelFile output;
+    output.setModel(*m.getMatrixByCol(),m.getColLower(),m.getColUpper(),
+		    m.getObjCoefficients(),NULL,
+		    m.getRowLower(),m.getRowUpper());
+    output.setOriginalIndices(&originalColumns[0],&originalRows[0]);
+    output.setObjectiveSense(-1.0);
+    assert (!output.write(fileName,false));
+    CoinModelFile input;
+    assert (!input.open(fileName,true));
+    assert (!input.integerColumns());
+    assert (input.objectiveSense()==-1.0);
+    assert (!memcmp(input.originalColumns(),&originalColumns[0],
+		    numberColumns*sizeof(int)));
+    assert (!memcmp(input.originalRows(),&originalRows[0],
+		    numberRows*sizeof(int)));
+    std::string copyName = std::string(fileName)+"2";
+    assert (!input.write(copyName.c_str()));
+    CoinModelFile copy;
+    assert (!copy.open(copyName.c_str(),true));
+    assert (copy.getNumElements()==input.getNumElements());
+    assert (!memcmp(copy.getElements(),input.getElements(),
+		    input.getNumElements()*sizeof(double)));
+    assert (!memcmp(copy.originalColumns(),&originalColumns[0],
+		    numberColumns*sizeof(int)));
+    copy.close();
+    assert (!copy.isOpen());
+    remove(copyName.c_str());
+  }
+  // Damaged files
+  {
+    std::string fn = mpsDir+"exmip1.mps";
+    CoinModelFile input;
+    assert (input.open("CoinModelFile.missing")==1);
+    assert (!CoinModelFile::isModelFile(fn.c_str()));
+    assert (input.open(fn.c_str())==2);
+    CoinMpsIO m;
+    m.messageHandler()->setLogLevel(0);
+    int numErr = m.readMps(fn.c_str(),"");
+    assert( numErr== 0 );
+    CoinModelFile output;
+    output.setModel(*m.getMatrixByCol(),m.getColLower(),m.getColUpper(),
+		    m.getObjCoefficients(),m.integerColumns(),
+		    m.getRowLower(),m.getRowUpper());
+    assert (!output.write(fileName));
+    FILE * fp = fopen(fileName,"rb");
+    assert (fp);
+    fseek(fp,0,SEEK_END);
+    long size = ftell(fp);
+    fseek(fp,0,SEEK_SET);
+    std::vector<char> contents(size);
+    assert (fread(&contents[0],1,size,fp)==static_cast<size_t>(size));
+    fclose(fp);
+    // flip integrality of last column - only found if verifying
+    contents[size-1] ^= 1;
+    fp = fopen(fileName,"wb");
+    fwrite(&contents[0],1,size,fp);
+    fclose(fp);
+    assert (!input.open(fileName));
+    assert (input.open(fileName,true)==3);
+    input.close();
+    // row index out of range or starts going back - found without verify
+    CoinInt64 position[2];
+    memcpy(position,&contents[80],16);
+    int numberRows = m.getNumRows();
+    std::vector<char> bad(contents);
+    memcpy(&bad[position[1]+4],&numberRows,sizeof(int));
+    fp = fopen(fileName,"wb");
+    fwrite(&bad[0],1,size,fp);
+    fclose(fp);
+    assert (input.open(fileName)==3);
+    bad = contents;
+    CoinBigIndex start = m.getMatrixByCol()->getVectorStarts()[2]+1;
+    memcpy(&bad[position[0]+sizeof(CoinBigIndex)],&start,
+	   sizeof(CoinBigIndex));
+    fp = fopen(fileName,"wb");
+    fwrite(&bad[0],1,size,fp);
+    fclose(fp);
+    assert (input.open(fileName)==3);
+    // truncate
+    fp = fopen(fileName,"wb");
+    fwrite(&contents[0],1,size-8,fp);
+    fclose(fp);
+    assert (input.open(fileName)==3);
+  }
+  remove(fileName);
+}
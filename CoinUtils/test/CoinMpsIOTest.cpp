@@ -459,6 +459,60 @@ CoinMpsIOUnitTest(const std::string & mpsDir)
 		assert (coneIdx[6] == 14);
 	}
 
+    // test reading in blocks gives same problem as reading card by card
+    {
+      const char * names[] = {"exmip1", "p0033", "p0548", "afiro", "brandy",
+			      "e226", "finnis", "spec_sections"};
+      for (int iName = 0; iName < 8; iName++) {
+	std::string fn = mpsDir+names[iName];
+	CoinMpsIO m1;
+	m1.messageHandler()->setLogLevel(0);
+	int numErr = m1.readMps(fn.c_str(),"mps");
+	assert( numErr== 0 );
+	CoinMpsIO m2;
+	m2.messageHandler()->setLogLevel(0);
+	m2.setNumberReadThreads(4);
+	numErr = m2.readMps(fn.c_str(),"mps");
+	assert( numErr== 0 );
+	int nr = m1.getNumRows();
+	int nc = m1.getNumCols();
+	assert( m2.getNumRows() == nr );
+	assert( m2.getNumCols() == nc );
+	assert( m2.getNumElements() == m1.getNumElements() );
+	assert( !strcmp( m2.problemName_ , m1.problemName_ ));
+	assert( !strcmp( m2.objectiveName_ , m1.objectiveName_ ));
+	assert( !strcmp( m2.rhsName_ , m1.rhsName_ ));
+	assert( !strcmp( m2.rangeName_ , m1.rangeName_ ));
+	assert( !strcmp( m2.boundName_ , m1.boundName_ ));
+	assert( m2.objectiveOffset() == m1.objectiveOffset() );
+	for (int i = 0; i < nr; i++) {
+	  assert( !strcmp( m2.rowName(i) , m1.rowName(i) ));
+	  assert( m2.getRowLower()[i] == m1.getRowLower()[i] );
+	  assert( m2.getRowUpper()[i] == m1.getRowUpper()[i] );
+	}
+	assert( !strcmp( m2.names_[0][nr] , m1.names_[0][nr] ));
+	assert( m2.numberHash_[0] == m1.numberHash_[0] );
+	for (int i = 0; i < nc; i++) {
+	  assert( !strcmp( m2.columnName(i) , m1.columnName(i) ));
+	  assert( m2.getColLower()[i] == m1.getColLower()[i] );
+	  assert( m2.getColUpper()[i] == m1.getColUpper()[i] );
+	  assert( m2.getObjCoefficients()[i] == m1.getObjCoefficients()[i] );
+	  assert( m2.isInteger(i) == m1.isInteger(i) );
+	}
+	const CoinPackedMatrix * matrix1 = m1.getMatrixByCol();
+	const CoinPackedMatrix * matrix2 = m2.getMatrixByCol();
+	for (int i = 0; i <= nc; i++)
+	  assert( matrix2->getVectorStarts()[i] == matrix1->getVectorStarts()[i] );
+	for (int i = 0; i < m1.getNumElements(); i++) {
+	  assert( matrix2->getIndices()[i] == matrix1->getIndices()[i] );
+	  assert( matrix2->getElements()[i] == matrix1->getElements()[i] );
+	}
+	// card reader left at end of file
+	numErr = m2.readMps(fn.c_str(),"mps");
+	assert( numErr < 0 );
+      }
+    }
+
 #ifdef COIN_HAS_GLPK
     // test GMPL reader
     {
@@ -26,6 +26,7 @@
 #include "CoinMessageHandler.hpp"
 void CoinModelUnitTest(const std::string & mpsDir,
                        const std::string & netlibDir, const std::string & testModel);
+void CoinModelFileUnitTest(const std::string & mpsDir);
 // Function Prototypes. Function definitions is in this file.
 void testingMessage( const char * const msg );
 
@@ -201,6 +202,9 @@ int main (int argc, const char *argv[])
   testingMessage( "Testing CoinMpsIO\n" );
   CoinMpsIOUnitTest(mpsDir);
 
+  testingMessage( "Testing CoinModelFile\n" );
+  CoinModelFileUnitTest(mpsDir);
+
   testingMessage( "Testing CoinLpIO\n" );
   CoinLpIOUnitTest(mpsDir);
 
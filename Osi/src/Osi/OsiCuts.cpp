@@ -18,7 +18,13 @@
 OsiCuts::OsiCuts ()
 :
 rowCutPtrs_(),
-colCutPtrs_()
+colCutPtrs_(),
+hashDuplicates_(false),
+numberHashed_(0),
+hashSize_(0),
+maximumHashed_(0),
+hashFirst_(NULL),
+hashNext_(NULL)
 {
   // nothing to do here
 }
@@ -29,7 +35,13 @@ colCutPtrs_()
 OsiCuts::OsiCuts (const OsiCuts & source)
 :
 rowCutPtrs_(),
-colCutPtrs_()     
+colCutPtrs_(),
+hashDuplicates_(source.hashDuplicates_),
+numberHashed_(0),
+hashSize_(0),
+maximumHashed_(0),
+hashFirst_(NULL),
+hashNext_(NULL)
 {  
   gutsOfCopy( source );
 }
@@ -41,6 +53,7 @@ colCutPtrs_()
 OsiCuts::~OsiCuts ()
 {
   gutsOfDestructor();
+  freeHash();
 }
 
 //----------------------------------------------------------------
@@ -52,6 +65,7 @@ OsiCuts::operator=(const OsiCuts& rhs)
   if (this != &rhs) {
     gutsOfDestructor();
     gutsOfCopy( rhs );
+    setDuplicateHashing(rhs.hashDuplicates_);
   }
   return *this;
 }
@@ -83,6 +97,7 @@ void OsiCuts::gutsOfDestructor()
       delete rowCutPtrs_[i];
   }
   rowCutPtrs_.clear();
+  numberHashed_=0;
   
   ne = static_cast<int>(colCutPtrs_.size());
   for (i=0; i<ne; i++) {
@@ -302,7 +317,12 @@ OsiCuts::insertIfNotDuplicate( OsiRowCut & rc , CoinAbsFltEq treatAsSame)
   CoinSort_2(newIndices,newIndices+numberElements,newElements);
   bool notDuplicate=true;
   int numberRowCuts = sizeRowCuts();
-  for ( int i =0; i<numberRowCuts;i++) {
+  int first = numberRowCuts ? 0 : -1;
+  if (hashDuplicates_&&numberRowCuts) {
+    extendHash();
+    first = hashFirst_[hashIndices(numberElements,newIndices)&(hashSize_-1)];
+  }
+  for ( int i =first; i>=0;i=nextCandidate(i)) {
     const OsiRowCut * cutPtr = rowCutPtr(i);
     if (cutPtr->row().getNumElements()!=numberElements)
       continue;
@@ -347,7 +367,12 @@ OsiCuts::insertIfNotDuplicate( OsiRowCut & rc , CoinRelFltEq treatAsSame)
   CoinSort_2(newIndices,newIndices+numberElements,newElements);
   bool notDuplicate=true;
   int numberRowCuts = sizeRowCuts();
-  for ( int i =0; i<numberRowCuts;i++) {
+  int first = numberRowCuts ? 0 : -1;
+  if (hashDuplicates_&&numberRowCuts) {
+    extendHash();
+    first = hashFirst_[hashIndices(numberElements,newIndices)&(hashSize_-1)];
+  }
+  for ( int i =first; i>=0;i=nextCandidate(i)) {
     const OsiRowCut * cutPtr = rowCutPtr(i);
     if (cutPtr->row().getNumElements()!=numberElements)
       continue;
@@ -378,3 +403,122 @@ OsiCuts::insertIfNotDuplicate( OsiRowCut & rc , CoinRelFltEq treatAsSame)
     rowCutPtrs_.push_back(newCutPtr);
   }
 }
+
+//-------------------------------------------------------------------
+// Hashed duplicate detection
+//-------------------------------------------------------------------
+bool
+OsiCuts::isDuplicate( const OsiRowCut & rc , CoinAbsFltEq treatAsSame)
+{
+  int numberRowCuts = sizeRowCuts();
+  if (!numberRowCuts)
+    return false;
+  double newLb = rc.lb();
+  double newUb = rc.ub();
+  CoinPackedVector vector = rc.row();
+  int numberElements =vector.getNumElements();
+  int * newIndices = vector.getIndices();
+  double * newElements = vector.getElements();
+  CoinSort_2(newIndices,newIndices+numberElements,newElements);
+  int first = 0;
+  if (hashDuplicates_) {
+    extendHash();
+    first = hashFirst_[hashIndices(numberElements,newIndices)&(hashSize_-1)];
+  }
+  for ( int i =first; i>=0;i=nextCandidate(i)) {
+    const OsiRowCut * cutPtr = rowCutPtr(i);
+    if (cutPtr->row().getNumElements()!=numberElements)
+      continue;
+    if (!treatAsSame(cutPtr->lb(),newLb))
+      continue;
+    if (!treatAsSame(cutPtr->ub(),newUb))
+      continue;
+    const int * indices = cutPtr->row().getIndices();
+    const double * elements = cutPtr->row().getElements();
+    int j;
+    for(j=1;j<numberElements;j++) {
+      if (indices[j]<indices[j-1])
+	break;
+    }
+    CoinPackedVector sorted;
+    if (j<numberElements) {
+      // inserted unsorted - compare sorted copy
+      sorted = cutPtr->row();
+      sorted.sortIncrIndex();
+      indices = sorted.getIndices();
+      elements = sorted.getElements();
+    }
+    for(j=0;j<numberElements;j++) {
+      if (indices[j]!=newIndices[j])
+	break;
+      if (!treatAsSame(elements[j],newElements[j]))
+	break;
+    }
+    if (j==numberElements)
+      return true;
+  }
+  return false;
+}
+
+void
+OsiCuts::setDuplicateHashing(bool onOff)
+{
+  hashDuplicates_=onOff;
+  if (!onOff)
+    freeHash();
+}
+
+unsigned int
+OsiCuts::hashIndices(int numberElements, const int * indices)
+{
+  /* Only exact quantities go into the key.  Indices are mixed one by one
+     and summed so order does not matter - cuts inserted unsorted are in
+     the same bucket as their sorted versions (see isDuplicate). */
+  unsigned int hashValue = static_cast<unsigned int>(numberElements)*2654435761U;
+  for (int j=0;j<numberElements;j++) {
+    unsigned int k = static_cast<unsigned int>(indices[j])*2654435761U;
+    k = (k^(k>>16))*0x45d9f3bU;
+    hashValue += k^(k>>16);
+  }
+  return hashValue^(hashValue>>15);
+}
+
+void
+OsiCuts::extendHash()
+{
+  int numberRowCuts = sizeRowCuts();
+  if (numberRowCuts>maximumHashed_) {
+    // grow - keep table at most half full
+    freeHash();
+    maximumHashed_ = 2*numberRowCuts+64;
+    hashSize_ = 128;
+    while (hashSize_<2*maximumHashed_)
+      hashSize_ *= 2;
+    hashFirst_ = new int [hashSize_];
+    hashNext_ = new int [maximumHashed_];
+  }
+  if (!numberHashed_) {
+    for (int k=0;k<hashSize_;k++)
+      hashFirst_[k]=-1;
+  }
+  assert (numberHashed_<=numberRowCuts);
+  for (int i=numberHashed_;i<numberRowCuts;i++) {
+    const CoinPackedVector & row = rowCutPtrs_[i]->row();
+    int k = hashIndices(row.getNumElements(),row.getIndices())&(hashSize_-1);
+    hashNext_[i]=hashFirst_[k];
+    hashFirst_[k]=i;
+  }
+  numberHashed_=numberRowCuts;
+}
+
+void
+OsiCuts::freeHash()
+{
+  delete [] hashFirst_;
+  delete [] hashNext_;
+  hashFirst_=NULL;
+  hashNext_=NULL;
+  hashSize_=0;
+  maximumHashed_=0;
+  numberHashed_=0;
+}
@@ -168,6 +168,31 @@ public:
     /// Number of cuts in collection
     inline int sizeCuts() const;
   //@}
+
+  /**@name Duplicate detection */
+  //@{
+    /** \brief Switch hashed duplicate detection on or off.
+
+      When on, insertIfNotDuplicate looks up an index keyed on the number
+      of elements and the set of indices of each row cut, and only
+      compares bounds and coefficients (with the given tolerance) against
+      cuts in the same bucket.  Bounds and coefficients are deliberately
+      not part of the key, so results are exactly those of the linear scan.
+      The index is brought up to date lazily; cuts must not be modified in
+      place through rowCutPtr while it is on.
+    */
+    void setDuplicateHashing(bool onOff);
+    /// Whether hashed duplicate detection is on
+    inline bool duplicateHashing() const { return hashDuplicates_; }
+    /** \brief Whether a row cut is a duplicate of one in collection.
+
+      Decides as insertIfNotDuplicate would but inserts nothing, and
+      cuts in collection which were inserted unsorted are compared in
+      sorted order too.  Neither cut is modified.  Uses the hash index
+      if on.
+    */
+    bool isDuplicate( const OsiRowCut & rc , CoinAbsFltEq treatAsSame=CoinAbsFltEq(1.0e-12) );
+  //@}
    
   /**@name Debug stuff */
   //@{
@@ -287,6 +312,16 @@ private:
     void gutsOfCopy( const OsiCuts & source );
     /// Delete internal data
     void gutsOfDestructor();
+    /// Hash value of number of elements and set of indices
+    static unsigned int hashIndices(int numberElements, const int * indices);
+    /// Bring duplicate index up to date with rowCutPtrs_
+    void extendHash();
+    /// Delete duplicate index
+    void freeHash();
+    /// Next row cut to compare against in insertIfNotDuplicate (-1 if none)
+    inline int nextCandidate(int i) const
+    { if (hashDuplicates_) return hashNext_[i];
+      else return (i+1<sizeRowCuts()) ? i+1 : -1; }
   //@}
     
   /**@name Private member data */
@@ -295,6 +330,18 @@ private:
     OsiVectorRowCutPtr rowCutPtrs_;
     /// Vector of column cuts pointers
     OsiVectorColCutPtr colCutPtrs_;
+    /// Whether insertIfNotDuplicate uses the hash index
+    bool hashDuplicates_;
+    /// Number of leading row cuts currently in hash index
+    int numberHashed_;
+    /// Size of hash table (power of 2, 0 if not allocated)
+    int hashSize_;
+    /// Room in hashNext_
+    int maximumHashed_;
+    /// First row cut in each bucket (-1 if empty)
+    int * hashFirst_;
+    /// Next row cut in same bucket (-1 if last)
+    int * hashNext_;
   //@}
 
 };
@@ -365,6 +412,7 @@ void OsiCuts::sort()
 {
   std::sort(colCutPtrs_.begin(),colCutPtrs_.end(),OsiCutCompare()); 
   std::sort(rowCutPtrs_.begin(),rowCutPtrs_.end(),OsiCutCompare()); 
+  numberHashed_=0;
 }
 
 
@@ -443,6 +491,7 @@ void OsiCuts::eraseRowCut(int i)
 {
   delete rowCutPtrs_[i];
   rowCutPtrs_.erase( rowCutPtrs_.begin()+i ); 
+  numberHashed_=0;
 }
 void OsiCuts::eraseColCut(int i) 
 {   
@@ -456,11 +505,13 @@ OsiCuts::rowCutPtrAndZap(int i)
   OsiRowCut * cut = rowCutPtrs_[i];
   rowCutPtrs_[i]=NULL;
   rowCutPtrs_.erase( rowCutPtrs_.begin()+i ); 
+  numberHashed_=0;
   return cut;
 }
 void OsiCuts::dumpCuts()
 {
   rowCutPtrs_.clear() ;
+  numberHashed_=0;
 }
 void OsiCuts::eraseAndDumpCuts(const std::vector<int> to_erase)
 {
@@ -468,6 +519,7 @@ void OsiCuts::eraseAndDumpCuts(const std::vector<int> to_erase)
     delete rowCutPtrs_[to_erase[i]];
   }
   rowCutPtrs_.clear();
+  numberHashed_=0;
 }
 
 
@@ -13,6 +13,7 @@
 #include "CoinLpIO.hpp"
 #include "CoinMpsIO.hpp"
 #include "CoinModel.hpp"
+#include "CoinModelFile.hpp"
 
 /*
   These routines support three name disciplines:
@@ -806,3 +807,65 @@ void OsiSolverInterface::setRowColNames (CoinLpIO &mod)
 */
   return ; }
 
+
+
+/*
+  Install the name information from a CoinModelFile object. The file may
+  have been written without names, in which case we treat every name as
+  missing.
+*/
+void OsiSolverInterface::setRowColNames (const CoinModelFile &file)
+
+{ int nameDiscipline,m,n ;
+/*
+  Determine how we're handling names. It's possible that the underlying solver
+  has overridden getIntParam, but doesn't recognise OsiNameDiscipline. In that
+  case, we want to default to auto names
+*/
+  bool recognisesOsiNames = getIntParam(OsiNameDiscipline,nameDiscipline) ;
+  if (recognisesOsiNames == false)
+  { nameDiscipline = 0 ; }
+/*
+  Whatever happens, we're about to clean out the current name vectors. Decide
+  on an appropriate size and call reallocRowColNames to adjust capacity.
+*/
+  if (nameDiscipline == 0)
+  { m = 0 ;
+    n = 0 ; }
+  else
+  { m = file.getNumRows() ;
+    n = file.getNumCols() ; }
+  reallocRowColNames(rowNames_,m,colNames_,n) ;
+/*
+  If name discipline is auto, we're done already. Otherwise, load 'em
+  up.
+*/
+  if (nameDiscipline != 0)
+  { int maxRowNdx=-1, maxColNdx=-1 ;
+    bool hasNames = file.hasNames() ;
+    rowNames_.resize(m) ;
+    for (int i = 0 ; i < m ; i++)
+    { std::string nme = hasNames ? file.rowName(i) : "" ;
+      if (nme.length() == 0)
+      { if (nameDiscipline == 2)
+	{ nme = dfltRowColName('r',i) ; } }
+      if (nme.length() > 0)
+      { maxRowNdx = i ; }
+      rowNames_[i] = nme ; }
+    rowNames_.resize(maxRowNdx+1) ;
+    if (hasNames)
+    { objName_ = file.getObjectiveName() ; }
+    colNames_.resize(n) ;
+    for (int j = 0 ; j < n ; j++)
+    { std::string nme = hasNames ? file.columnName(j) : "" ;
+      if (nme.length() == 0)
+      { if (nameDiscipline == 2)
+	{ nme = dfltRowColName('c',j) ; } }
+      if (nme.length() > 0)
+      { maxColNdx = j ; }
+      colNames_[j] = nme ; }
+    colNames_.resize(maxColNdx+1) ; }
+/*
+  And we're done.
+*/
+  return ; }
@@ -28,6 +28,7 @@
 #include "CoinFinite.hpp"
 #include "CoinBuild.hpp"
 #include "CoinModel.hpp"
+#include "CoinModelFile.hpp"
 #include "CoinLpIO.hpp"
 //#############################################################################
 // Hotstart related methods (primarily used in strong branching)
@@ -1576,6 +1577,95 @@ int OsiSolverInterface::readLp(FILE *fp, const double epsilon) {
   return(0);
 } /* readLp */
 
+/*************************************************************************/
+int OsiSolverInterface::readModelFile(const char * filename, bool verify)
+{
+  CoinModelFile m;
+  int returnCode = m.open(filename,verify);
+  if (returnCode) {
+    const char * reason[3] = {"can not open",
+			      "not a model file",
+			      verify ? "truncated or checksum wrong" : "truncated"};
+    handler_->message(COIN_SOLVER_MODEL_FILE_BAD,messages_)
+      <<filename<<reason[CoinMin(returnCode,3)-1]<<CoinMessageEol;
+    return returnCode;
+  }
+  handler_->message(COIN_SOLVER_MODEL_FILE,messages_)
+    <<filename<<m.getNumRows()<<m.getNumCols()
+    <<static_cast<int>(m.getNumElements())<<CoinMessageEol;
+
+  // set objective function offset
+  setDblParam(OsiObjOffset,m.objectiveOffset());
+
+  // set problem name
+  setStrParam(OsiProbName,m.getProblemName());
+
+  // load straight from file, set names and integrality
+  loadProblem(m.getNumCols(),m.getNumRows(),m.getColumnStarts(),
+	      m.getIndices(),m.getElements(),m.getColLower(),m.getColUpper(),
+	      m.getObjCoefficients(),m.getRowLower(),m.getRowUpper());
+  setObjSense(m.objectiveSense());
+  setRowColNames(m) ;
+  const char * integer = m.integerColumns();
+  if (integer) {
+    int i,n=0;
+    int nCols=m.getNumCols();
+    int * index = new int [nCols];
+    for (i=0;i<nCols;i++) {
+      if (integer[i]) {
+	index[n++]=i;
+      }
+    }
+    setInteger(index,n);
+    delete [] index;
+  }
+  return 0;
+} /* readModelFile */
+
+/*************************************************************************/
+int OsiSolverInterface::writeModelFile(const char * filename,
+				       bool keepNames,
+				       const int * originalColumns,
+				       const int * originalRows) const
+{
+  const int numcols = getNumCols();
+  const int numrows = getNumRows();
+  char* integrality = new char[numcols];
+  bool hasInteger = false;
+  for (int i = 0; i < numcols; ++i) {
+    if (isInteger(i)) {
+      integrality[i] = 1;
+      hasInteger = true;
+    } else {
+      integrality[i] = 0;
+    }
+  }
+  CoinModelFile writer;
+  writer.setModel(*getMatrixByCol(),getColLower(),getColUpper(),
+		  getObjCoefficients(),hasInteger ? integrality : NULL,
+		  getRowLower(),getRowUpper());
+  if (keepNames) {
+    std::string problemName;
+    getStrParam(OsiProbName,problemName);
+    std::vector<std::string> rowNames(numrows);
+    for (int i = 0; i < numrows; ++i)
+      rowNames[i] = getRowName(i);
+    std::vector<std::string> columnNames(numcols);
+    for (int i = 0; i < numcols; ++i)
+      columnNames[i] = getColName(i);
+    writer.setNames(problemName.c_str(),getObjName().c_str(),
+		    rowNames,columnNames);
+  }
+  writer.setOriginalIndices(originalColumns,originalRows);
+  double objOffset=0.0;
+  getDblParam(OsiObjOffset,objOffset);
+  writer.setObjectiveOffset(objOffset);
+  writer.setObjectiveSense(getObjSense());
+  int returnCode = writer.write(filename);
+  delete[] integrality;
+  return returnCode;
+} /* writeModelFile */
+
 /*************************************************************************/
 
 // Pass in Message handler (not deleted at end)
@@ -1814,6 +1904,35 @@ OsiSolverInterface::getBInvARow(int , double* , double * ) const
 		  "OsiSolverInterface");
 }
 
+//Get several rows of the tableau (sparse)
+void 
+OsiSolverInterface::getBInvARows(int number, const int* rows,
+				 CoinPackedMatrix& result) const 
+{
+  int numberColumns = getNumCols();
+  int numberTotal = numberColumns+getNumRows();
+  double * z = new double [numberTotal];
+  CoinBigIndex * start = new CoinBigIndex [number+1];
+  std::vector<int> index;
+  std::vector<double> element;
+  start[0]=0;
+  for (int i=0;i<number;i++) {
+    getBInvARow(rows[i],z,z+numberColumns);
+    for (int j=0;j<numberTotal;j++) {
+      if (z[j]) {
+	index.push_back(j);
+	element.push_back(z[j]);
+      }
+    }
+    start[i+1]=static_cast<CoinBigIndex>(index.size());
+  }
+  result.copyOf(false,numberTotal,number,start[number],
+		element.empty() ? NULL : &element[0],
+		index.empty() ? NULL : &index[0],start,NULL);
+  delete [] start;
+  delete [] z;
+}
+
 //Get a row of the basis inverse
 void OsiSolverInterface::getBInvRow(int , double* ) const 
 {
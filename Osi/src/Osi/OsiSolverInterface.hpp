@@ -23,6 +23,7 @@
 class CoinSnapshot;
 class CoinLpIO;
 class CoinMpsIO;
+class CoinModelFile;
 
 class OsiCuts;
 class OsiAuxInfo;
@@ -1041,6 +1042,14 @@ public:
     */
     void setRowColNames(CoinLpIO &mod) ;
 
+    /*! \brief Set row and column names from a CoinModelFile object.
+
+      Also sets the name of the objective function. If the name discipline
+      is auto or the file has no names, you get what you asked for. This
+      routine does not use setRowName or setColName.
+    */
+    void setRowColNames(const CoinModelFile &file) ;
+
   //@}
   //-------------------------------------------------------------------------
     
@@ -1558,6 +1567,28 @@ public:
   /// See class CoinLpIO for description of this format.
   int readLp(FILE *fp, const double epsilon = 1e-5);
 
+  /*! \brief Read a problem from a binary model file.
+
+    The file (see class CoinModelFile) is mapped and its arrays are passed
+    straight to loadProblem, so there is no parsing.  If verify is true the
+    checksum is checked first.  Names, integrality, objective sense and
+    offset are set as stored.
+    Returns 0 if OK, 1 if the file can not be opened, 2 if it is not a
+    model file, 3 if it is truncated or the checksum is wrong.
+  */
+  virtual int readModelFile(const char *filename, bool verify = false);
+
+  /*! \brief Write the problem as a binary model file.
+
+    Row and column names (as from getRowName and getColName) are written
+    if keepNames is true.  If given, originalColumns and originalRows
+    (one per column and row, as from CglPreProcess) are stored too.
+    Returns non-zero on I/O error.
+  */
+  int writeModelFile(const char *filename, bool keepNames = true,
+		     const int *originalColumns = NULL,
+		     const int *originalRows = NULL) const;
+
   //@}
 
   //---------------------------------------------------------------------------
@@ -1857,6 +1888,22 @@ public:
   */
   virtual void getBInvARow(int row, double* z, double* slack = NULL) const ;
 
+  /*! \brief Get several rows of the tableau in sparse form
+
+    Row \p rows[i] of the tableau becomes major vector i of \p result,
+    which is row ordered with getNumCols()+getNumRows() columns -
+    structurals as in \p z of #getBInvARow, then the logicals (indices
+    getNumCols()+k) as in \p slack.  Only nonzeros are stored and indices
+    within a row need not be sorted.
+
+    The default implementation calls #getBInvARow for each row and packs
+    the result.  Solvers which can form tableau rows sparsely should
+    override it, so the cost follows the number of nonzeros rather than
+    the size of the model.
+  */
+  virtual void getBInvARows(int number, const int* rows,
+			    CoinPackedMatrix& result) const ;
+
   /*! \brief Get a row of the basis inverse */
   virtual void getBInvRow(int row, double* z) const ;
 
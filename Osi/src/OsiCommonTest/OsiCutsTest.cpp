@@ -248,4 +248,65 @@ OsiCutsUnitTest()
       OSIUNITTEST_ASSERT_ERROR(sort_ok, {}, "osicuts", "sorting cuts");
     }
   }
+
+  // Hashed duplicate detection must agree with the linear scan
+  {
+    OsiCuts linear;
+    OsiCuts hashed;
+    hashed.setDuplicateHashing(true);
+    OSIUNITTEST_ASSERT_ERROR(hashed.duplicateHashing(), {}, "osicuts", "hashed duplicates");
+    for ( i=0; i<400; i++ ) {
+      // many cuts share a support, some are exact or near duplicates
+      int indices[3];
+      double elements[3];
+      int k = i%37;
+      indices[0] = k+2; indices[1] = k; indices[2] = k+7;
+      elements[0] = 1.0; elements[1] = 2.0+(i%3); elements[2] = -1.0;
+      if (i%5==0)
+        elements[2] += 1.0e-14;
+      OsiRowCut rc;
+      rc.setRow(3,indices,elements);
+      rc.setLb(-COIN_DBL_MAX);
+      rc.setUb(static_cast<double>(i%4));
+      OsiRowCut rc2(rc);
+      linear.insertIfNotDuplicate(rc);
+      hashed.insertIfNotDuplicate(rc2);
+      if (i==200) {
+        linear.eraseRowCut(3);
+        hashed.eraseRowCut(3);
+      }
+    }
+    OSIUNITTEST_ASSERT_ERROR(hashed.sizeRowCuts() == linear.sizeRowCuts(), {}, "osicuts", "hashed duplicates");
+    bool same = hashed.sizeRowCuts() == linear.sizeRowCuts();
+    for ( i=0; same && i<linear.sizeRowCuts(); i++ )
+      same = hashed.rowCut(i) == linear.rowCut(i);
+    OSIUNITTEST_ASSERT_ERROR(same, {}, "osicuts", "hashed duplicates");
+    // relative tolerance version
+    OsiCuts copy(hashed);
+    int before = copy.sizeRowCuts();
+    OsiRowCut rc(copy.rowCut(0));
+    copy.insertIfNotDuplicate(rc, CoinRelFltEq(1.0e-10));
+    OSIUNITTEST_ASSERT_ERROR(copy.sizeRowCuts() == before, {}, "osicuts", "hashed duplicates");
+    // query without inserting
+    OSIUNITTEST_ASSERT_ERROR(hashed.isDuplicate(rc) && linear.isDuplicate(rc), {}, "osicuts", "hashed duplicates");
+    rc.setUb(rc.ub()+0.5);
+    OSIUNITTEST_ASSERT_ERROR(!hashed.isDuplicate(rc) && !linear.isDuplicate(rc), {}, "osicuts", "hashed duplicates");
+    OSIUNITTEST_ASSERT_ERROR(hashed.sizeRowCuts() == before, {}, "osicuts", "hashed duplicates");
+    // cut inserted unsorted is found from sorted or unsorted query
+    {
+      int indices[3] = {5, 1, 3};
+      double elements[3] = {1.0, -2.0, 3.0};
+      OsiRowCut unsorted;
+      unsorted.setRow(3,indices,elements);
+      unsorted.setLb(-COIN_DBL_MAX);
+      unsorted.setUb(7.0);
+      hashed.insert(unsorted);
+      linear.insert(unsorted);
+      OsiRowCut sorted(unsorted);
+      sorted.mutableRow().sortIncrIndex();
+      OSIUNITTEST_ASSERT_ERROR(hashed.isDuplicate(sorted) && linear.isDuplicate(sorted), {}, "osicuts", "hashed duplicates");
+      OSIUNITTEST_ASSERT_ERROR(hashed.isDuplicate(unsorted) && linear.isDuplicate(unsorted), {}, "osicuts", "hashed duplicates");
+      OSIUNITTEST_ASSERT_ERROR(unsorted.row().getIndices()[0] == 5, {}, "osicuts", "hashed duplicates");
+    }
+  }
 }
@@ -334,6 +334,60 @@ void testBInvARow (const OsiSolverInterface *si)
   OSIUNITTEST_ASSERT_ERROR(abariMtx.isEquivalent2(abarjMtx), {}, solverName, "testBInvARow: tableaus built by rows and columns match");
 }
 
+/*
+  Test rows from getBInvARows against rows from getBInvARow (already tested).
+  Rows are asked for in reverse order with the last one repeated, and the
+  default implementation in OsiSolverInterface is checked too.
+
+  It's assumed that the si passed as a parameter is ready for tableau
+  queries: a problem has been loaded and solved to optimality and
+  enableFactorization has been called.
+*/
+void testBInvARows (const OsiSolverInterface *si)
+{ std::string solverName ;
+  si->getStrParam(OsiSolverName,solverName) ;
+
+  int n = si->getNumCols() ;
+  int m = si->getNumRows() ;
+
+  std::cout << "  Testing getBInvARows ... " << std::endl;
+
+  std::vector<int> rows ;
+  for (int i = m-1 ; i >= 0 ; i--)
+    rows.push_back(i) ;
+  rows.push_back(0) ;
+  int number = static_cast<int>(rows.size()) ;
+  double *abari = new double[n+m] ;
+  double *sparse = new double[n+m] ;
+  CoinAbsFltEq eq(1.0e-10) ;
+  for (int which = 0 ; which < 2 ; which++)
+  { CoinPackedMatrix abarMtx ;
+    if (which == 0)
+    { OSIUNITTEST_CATCH_ERROR(si->getBInvARows(number,&rows[0],abarMtx), continue, solverName, "testBInvARows") ; }
+    else
+    { OSIUNITTEST_CATCH_ERROR(si->OsiSolverInterface::getBInvARows(number,&rows[0],abarMtx), continue, solverName, "testBInvARows default") ; }
+    OSIUNITTEST_ASSERT_ERROR(abarMtx.isColOrdered() == false &&
+			     abarMtx.getNumRows() == number &&
+			     abarMtx.getNumCols() == n+m,
+			     continue, solverName, "testBInvARows: size") ;
+    int numberBad = 0 ;
+    for (int k = 0 ; k < number ; k++)
+    { si->getBInvARow(rows[k],abari,abari+n) ;
+      CoinZeroN(sparse,n+m) ;
+      const CoinShallowPackedVector pv = abarMtx.getVector(k) ;
+      for (int v = 0 ; v < pv.getNumElements() ; v++)
+	sparse[pv.getIndices()[v]] += pv.getElements()[v] ;
+      for (int j = 0 ; j < n+m ; j++)
+      { if (!eq(sparse[j],abari[j]))
+	  numberBad++ ; } }
+    OSIUNITTEST_ASSERT_ERROR(numberBad == 0,
+      if (OsiUnitTest::verbosity >= 1)
+      { std::cout << "  " << numberBad << " entries differ from getBInvARow." << std::endl ; },
+      solverName, which ? "testBInvARows default" : "testBInvARows") ; }
+  delete[] abari ;
+  delete[] sparse ;
+}
+
 /*
   Test the row and column duals returned by getReducedGradient.
 
@@ -649,6 +703,7 @@ void testSimplexMode1 (const OsiSolverInterface *emptySi, std::string sampleDir)
     testBInvRow(si) ;
     testBInvACol(si) ;
     testBInvARow(si) ;
+    testBInvARows(si) ;
     testReducedGradient(si) ;
 /*
   Disable simplex mode 1.
@@ -2381,8 +2381,8 @@ void testReducedCosts (const OsiSolverInterface *emptySi,
 
 
 /*
-  Test the writeMps and writeMpsNative functions by loading a problem,
-  writing it out to a file, reloading it, and solving.
+  Test the writeMps, writeMpsNative and writeModelFile functions by loading
+  a problem, writing it out to a file, reloading it, and solving.
   
   Implicitly assumes readMps has already been tested.
 
@@ -2430,12 +2430,27 @@ void testWriteMps (const OsiSolverInterface *emptySi, std::string fn)
     OSIUNITTEST_CATCH_ERROR(si3->initialSolve(), return, *si1, "testWriteMps: solving LP written by writeMps");
     OSIUNITTEST_ASSERT_ERROR(eq(soln,si3->getObjValue()), return, *si1, "testWriteMps: solving LP written by writeMps");
   }
+/*
+  And with writeModelFile. The binary file should give back exactly what was
+  written, including names.
+*/
+  OsiSolverInterface *si4 = emptySi->clone();
+  OSIUNITTEST_ASSERT_ERROR(si1->writeModelFile("test.bin") == 0, return, *si1, "testWriteMps: writeModelFile");
+  OSIUNITTEST_ASSERT_ERROR(si4->readModelFile("test.bin",true) == 0, return, *si1, "testWriteMps: read model written by writeModelFile");
+  OSIUNITTEST_ASSERT_ERROR(si4->getNumRows() == si1->getNumRows() && si4->getNumCols() == si1->getNumCols() && si4->getNumElements() == si1->getNumElements(), return, *si1, "testWriteMps: size of model written by writeModelFile");
+  OSIUNITTEST_ASSERT_WARNING(si4->getColName(0) == si1->getColName(0) && si4->getRowName(0) == si1->getRowName(0), {}, *si1, "testWriteMps: names in model written by writeModelFile");
+  if (solved) {
+    OSIUNITTEST_CATCH_ERROR(si4->initialSolve(), return, *si1, "testWriteMps: solving model written by writeModelFile");
+    OSIUNITTEST_ASSERT_ERROR(eq(soln,si4->getObjValue()), return, *si1, "testWriteMps: solving model written by writeModelFile");
+  }
+  remove("test.bin");
 /*
   Clean up.
 */
   delete si1;
   delete si2;
   delete si3;
+  delete si4;
 }
 
 